@@ -0,0 +1,1027 @@
+/**
+ * @file        src/Benchmark/main.cc
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+/*
+ * Headless node graph benchmark
+ *
+ * Builds a synthetic graph of nodes, pins and links, then drives
+ * ImNodeGraph::Update through a scripted sequence of input phases - idle,
+ * pan, zoom, hover, select, marquee select and drag - with no window,
+ * renderer or GPU. ImGui is given a null backend: input is queued directly,
+ * and texture requests are acknowledged without being uploaded anywhere.
+ *
+ * For each frame the CPU time from NewFrame to Render, the generated vertex
+ * and index counts, and the number and size of heap allocations are recorded;
+ * a per-phase summary is written to stdout, and optionally every frame to a
+ * CSV file.
+ *
+ * Arguments use the application format of --name=value:
+ *  --nodes=N      nodes to create (default 1024)
+ *  --pins=N       pins per node (default 4)
+ *  --links=N      links to create (default twice the node count)
+ *  --layout=X     grid, random or scalefree (default grid)
+ *  --seed=N       random generator seed (default 1)
+ *  --frames=N     frames per phase (default 120)
+ *  --width=N      display width (default 1920)
+ *  --height=N     display height (default 1080)
+ *  --csv=PATH     write every frame sample to PATH
+ *  --trace=PATH   write a profiler trace capture to PATH
+ *  --profile=1    print the most expensive profiler zones
+ *  --budget=MS    return failure if any phase 95th percentile exceeds MS
+ *
+ * Suitable for CI; exits non-zero on bad arguments or an exceeded budget.
+ */
+
+
+#include "app/definitions.h"
+
+#include "core/error.h"
+#include "core/services/ServiceLocator.h"
+#include "core/services/log/Log.h"
+#include "core/util/Profiler.h"
+#include "core/UUID.h"
+
+#include "imgui/BaseNode.h"
+#include "imgui/ImNodeGraph.h"
+#include "imgui/ImNodeGraphLink.h"
+#include "imgui/ImNodeGraphPin.h"
+#include "imgui/UserTexture.h"
+#include "imgui/dear_imgui/imgui.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#if !_WIN32
+#	include <strings.h>
+#	define stricmp strcasecmp
+#endif
+
+
+using namespace trezanik;
+
+
+/*
+ * Every heap allocation made through operator new or the ImGui allocator is
+ * counted, so per-frame churn within the node graph and ImGui is visible.
+ * Aligned and nothrow forms are not replaced; neither is in use here.
+ */
+static std::atomic<uint64_t>  g_alloc_count{ 0 };
+static std::atomic<uint64_t>  g_alloc_bytes{ 0 };
+
+
+void*
+operator new(
+	size_t size
+)
+{
+	g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+	g_alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+
+	void*  p = std::malloc(size == 0 ? 1 : size);
+	if ( p == nullptr )
+		throw std::bad_alloc();
+	return p;
+}
+
+
+void*
+operator new[](
+	size_t size
+)
+{
+	return operator new(size);
+}
+
+
+void
+operator delete(
+	void* p
+) noexcept
+{
+	std::free(p);
+}
+
+
+void
+operator delete[](
+	void* p
+) noexcept
+{
+	std::free(p);
+}
+
+
+void
+operator delete(
+	void* p,
+	size_t
+) noexcept
+{
+	std::free(p);
+}
+
+
+void
+operator delete[](
+	void* p,
+	size_t
+) noexcept
+{
+	std::free(p);
+}
+
+
+static void*
+imgui_alloc(
+	size_t size,
+	void*
+)
+{
+	g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+	g_alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+	return std::malloc(size);
+}
+
+
+static void
+imgui_free(
+	void* p,
+	void*
+)
+{
+	std::free(p);
+}
+
+
+/**
+ * Arrangement of the synthetic graph, determining node placement and links
+ */
+enum class GraphLayout : uint8_t
+{
+	/** Nodes in rows and columns, linked to their right and lower neighbours */
+	Grid,
+	/** Nodes scattered uniformly, linked to random other nodes */
+	Random,
+	/** Preferential attachment; few highly connected hubs, spiralling out */
+	ScaleFree
+};
+
+
+/**
+ * The scripted input applied for a run of frames
+ */
+enum BenchPhase_ : int
+{
+	BenchPhase_Idle = 0,
+	BenchPhase_Pan,
+	BenchPhase_Zoom,
+	BenchPhase_Hover,
+	BenchPhase_Select,
+	BenchPhase_Marquee,
+	BenchPhase_Drag,
+	BenchPhase_TOTAL
+};
+typedef int BenchPhase;
+
+
+static const char*  phase_names[BenchPhase_TOTAL] = {
+	"idle", "pan", "zoom", "hover", "select", "marquee", "drag"
+};
+
+
+/**
+ * Benchmark parameters, as parsed from the command line
+ */
+struct bench_config
+{
+	size_t  nodes = 1024;
+	size_t  pins = 4;
+	size_t  links = 0;
+	GraphLayout  layout = GraphLayout::Grid;
+	uint32_t  seed = 1;
+	int     frames = 120;
+	float   width = 1920.f;
+	float   height = 1080.f;
+	std::string  csv_path;
+	std::string  trace_path;
+	bool    profile = false;
+	float   budget_ms = 0.f;
+};
+
+
+/**
+ * Measurements for a single frame
+ */
+struct frame_sample
+{
+	BenchPhase  phase;
+	double    cpu_ms;
+	int       vtx_count;
+	int       idx_count;
+	uint64_t  allocs;
+	uint64_t  alloc_bytes;
+};
+
+
+/**
+ * Storage for the link properties that are referenced rather than owned
+ *
+ * The workspace holds these in its link data; held in a deque here so the
+ * addresses remain stable as more are added.
+ */
+struct link_data
+{
+	std::string  text;
+	ImVec2  offset;
+	imgui::LinkMethod  method = imgui::LinkMethod::CubicBezier;
+	std::vector<ImVec2>  control_points;
+};
+
+
+/**
+ * Minimal pin; links are only created by the benchmark itself
+ */
+class BenchPin : public imgui::Pin
+{
+public:
+	BenchPin(
+		const ImVec2& pos,
+		const core::UUID& id,
+		imgui::BaseNode* attached_node,
+		imgui::ImNodeGraph* ng
+	)
+	: imgui::Pin(pos, id, imgui::PinType_Connector, attached_node, ng, imgui::PinStyle::connector())
+	{
+	}
+
+
+	virtual void
+	CreateLink(
+		imgui::Pin*
+	) override
+	{
+		// dynamic link creation is not scripted
+	}
+
+
+	virtual bool
+	IsConnected() const override
+	{
+		return !_links.empty();
+	}
+};
+
+
+/**
+ * Minimal node; the default drawing with a set of pins around its edges
+ */
+class BenchNode : public imgui::BaseNode
+{
+public:
+	BenchNode(
+		core::UUID& id
+	)
+	: imgui::BaseNode(id)
+	{
+	}
+
+
+	void
+	AddPin(
+		std::shared_ptr<imgui::Pin> pin
+	)
+	{
+		_pins.emplace_back(pin);
+	}
+};
+
+
+/**
+ * Parses the command line into the benchmark configuration
+ *
+ * @param[in] argc
+ *  The argument count
+ * @param[in] argv
+ *  The argument values
+ * @param[out] cfg
+ *  The configuration to populate
+ * @return
+ *  0 on success, or -1 if any argument is invalid
+ */
+static int
+interpret_command_line(
+	int argc,
+	char** argv,
+	bench_config& cfg
+)
+{
+	for ( int i = 1; i < argc; i++ )
+	{
+		const char*  arg = argv[i];
+		const char*  p;
+
+		if ( strncmp(arg, "--", 2) != 0 || (p = strchr(arg, '=')) == nullptr || p == arg + 2 )
+		{
+			fprintf(stderr, "Invalid argument format (argc=%d): %s\n", i, arg);
+			return -1;
+		}
+
+		std::string  name(arg + 2, p);
+		const char*  val = p + 1;
+
+		if ( name == "nodes" )
+			cfg.nodes = std::strtoul(val, nullptr, 10);
+		else if ( name == "pins" )
+			cfg.pins = std::strtoul(val, nullptr, 10);
+		else if ( name == "links" )
+			cfg.links = std::strtoul(val, nullptr, 10);
+		else if ( name == "seed" )
+			cfg.seed = static_cast<uint32_t>(std::strtoul(val, nullptr, 10));
+		else if ( name == "frames" )
+			cfg.frames = std::atoi(val);
+		else if ( name == "width" )
+			cfg.width = static_cast<float>(std::atof(val));
+		else if ( name == "height" )
+			cfg.height = static_cast<float>(std::atof(val));
+		else if ( name == "csv" )
+			cfg.csv_path = val;
+		else if ( name == "trace" )
+			cfg.trace_path = val;
+		else if ( name == "profile" )
+			cfg.profile = std::atoi(val) != 0;
+		else if ( name == "budget" )
+			cfg.budget_ms = static_cast<float>(std::atof(val));
+		else if ( name == "layout" )
+		{
+			if ( stricmp(val, "grid") == 0 )
+				cfg.layout = GraphLayout::Grid;
+			else if ( stricmp(val, "random") == 0 )
+				cfg.layout = GraphLayout::Random;
+			else if ( stricmp(val, "scalefree") == 0 )
+				cfg.layout = GraphLayout::ScaleFree;
+			else
+			{
+				fprintf(stderr, "Unknown layout: %s\n", val);
+				return -1;
+			}
+		}
+		else
+		{
+			fprintf(stderr, "Unknown argument: %s\n", arg);
+			return -1;
+		}
+	}
+
+	if ( cfg.nodes < 2 || cfg.pins == 0 || cfg.frames < 2 || cfg.width < 64.f || cfg.height < 64.f )
+	{
+		fprintf(stderr, "Invalid configuration; requires 2+ nodes, 1+ pins, 2+ frames, 64+ display size\n");
+		return -1;
+	}
+	if ( cfg.links == 0 )
+	{
+		cfg.links = cfg.nodes * 2;
+	}
+
+	return 0;
+}
+
+
+/**
+ * Populates the node graph with the configured synthetic layout
+ *
+ * @param[in] cfg
+ *  The benchmark configuration
+ * @param[in] ng
+ *  The node graph to populate
+ * @param[out] nodes
+ *  The created nodes, in creation order
+ * @param[out] links
+ *  Storage for the referenced link properties
+ */
+static void
+build_graph(
+	const bench_config& cfg,
+	imgui::ImNodeGraph& ng,
+	std::vector<std::shared_ptr<BenchNode>>& nodes,
+	std::deque<link_data>& links
+)
+{
+	const float  node_w = TZK_DEFAULT_NEWNODE_WIDTH;
+	const float  node_h = TZK_DEFAULT_NEWNODE_HEIGHT;
+	const float  spacing_x = node_w * 2.f;
+	const float  spacing_y = node_h * 2.5f;
+	// leaves free space at the canvas origin for marquee selection
+	const float  margin = 40.f;
+
+	std::mt19937  rng(cfg.seed);
+	size_t  columns = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(cfg.nodes))));
+	float   extent = static_cast<float>(columns) * spacing_x;
+
+	nodes.reserve(cfg.nodes);
+
+	for ( size_t i = 0; i < cfg.nodes; i++ )
+	{
+		ImVec2  pos;
+
+		switch ( cfg.layout )
+		{
+		case GraphLayout::Grid:
+			pos.x = margin + static_cast<float>(i % columns) * spacing_x;
+			pos.y = margin + static_cast<float>(i / columns) * spacing_y;
+			break;
+		case GraphLayout::Random:
+			{
+				std::uniform_real_distribution<float>  dist(0.f, extent);
+				pos.x = margin + dist(rng);
+				pos.y = margin + dist(rng) * (spacing_y / spacing_x);
+			}
+			break;
+		case GraphLayout::ScaleFree:
+			{
+				// sunflower spiral; the earliest (best connected) nodes central
+				float  angle = static_cast<float>(i) * 2.39996f;
+				float  radius = spacing_x * 0.5f * std::sqrt(static_cast<float>(i));
+				pos.x = margin + extent * 0.5f + radius * std::cos(angle);
+				pos.y = margin + extent * 0.5f + radius * std::sin(angle);
+			}
+			break;
+		default:
+			break;
+		}
+
+		core::UUID  id;
+		id.Generate();
+
+		auto  node = ng.CreateNode<BenchNode>(pos, id);
+		node->SetStaticSize(ImVec2(node_w, node_h));
+
+		for ( size_t p = 0; p < cfg.pins; p++ )
+		{
+			// alternate left and right edges, spread vertically
+			size_t  per_side = (cfg.pins + 1) / 2;
+			ImVec2  rel(
+				(p % 2) == 0 ? 0.f : 1.f,
+				static_cast<float>(p / 2 + 1) / static_cast<float>(per_side + 1)
+			);
+			core::UUID  pin_id;
+			pin_id.Generate();
+			node->AddPin(std::make_shared<BenchPin>(rel, pin_id, node.get(), &ng));
+		}
+
+		nodes.push_back(node);
+	}
+
+	/*
+	 * Select the node pairs to link. Pins are assigned round-robin per node,
+	 * so busy nodes spread their links around their edges
+	 */
+	std::vector<std::pair<size_t, size_t>>  pairs;
+	pairs.reserve(cfg.links);
+
+	switch ( cfg.layout )
+	{
+	case GraphLayout::Grid:
+		for ( size_t i = 0; i < cfg.nodes && pairs.size() < cfg.links; i++ )
+		{
+			if ( (i + 1) % columns != 0 && i + 1 < cfg.nodes )
+				pairs.emplace_back(i, i + 1);
+			if ( i + columns < cfg.nodes && pairs.size() < cfg.links )
+				pairs.emplace_back(i, i + columns);
+		}
+		break;
+	case GraphLayout::Random:
+		{
+			std::uniform_int_distribution<size_t>  dist(0, cfg.nodes - 1);
+			while ( pairs.size() < cfg.links )
+			{
+				size_t  a = dist(rng);
+				size_t  b = dist(rng);
+				if ( a != b )
+					pairs.emplace_back(a, b);
+			}
+		}
+		break;
+	case GraphLayout::ScaleFree:
+		{
+			// Barabasi-Albert; each endpoint listed once per link it holds
+			size_t  per_node = std::max<size_t>(1, cfg.links / cfg.nodes);
+			std::vector<size_t>  endpoints;
+			endpoints.reserve(cfg.links * 2 + 2);
+			endpoints.push_back(0);
+
+			for ( size_t i = 1; i < cfg.nodes && pairs.size() < cfg.links; i++ )
+			{
+				for ( size_t l = 0; l < per_node && pairs.size() < cfg.links; l++ )
+				{
+					std::uniform_int_distribution<size_t>  dist(0, endpoints.size() - 1);
+					size_t  target = endpoints[dist(rng)];
+					if ( target == i )
+						continue;
+					pairs.emplace_back(i, target);
+					endpoints.push_back(target);
+				}
+				endpoints.push_back(i);
+			}
+		}
+		break;
+	default:
+		break;
+	}
+
+	std::vector<size_t>  next_pin(cfg.nodes, 0);
+
+	for ( auto& pair : pairs )
+	{
+		auto&  src_pins = nodes[pair.first]->GetPins();
+		auto&  tgt_pins = nodes[pair.second]->GetPins();
+		auto   src = src_pins[next_pin[pair.first]++ % src_pins.size()];
+		auto   tgt = tgt_pins[next_pin[pair.second]++ % tgt_pins.size()];
+
+		links.emplace_back();
+		link_data&  ld = links.back();
+
+		core::UUID  id;
+		id.Generate();
+
+		auto  link = ng.CreateLink<imgui::Link>(id, src, tgt, &ng,
+			&ld.text, &ld.offset, &ld.method, &ld.control_points
+		);
+		src->AssignLink(link);
+		tgt->AssignLink(link);
+	}
+}
+
+
+/**
+ * Acknowledges all pending texture requests, as a renderer would
+ *
+ * Nothing is uploaded; each texture is given a placeholder identifier.
+ */
+static void
+null_renderer_textures()
+{
+	for ( ImTextureData* tex : ImGui::GetPlatformIO().Textures )
+	{
+		if ( tex->Status == ImTextureStatus_WantCreate )
+		{
+			tex->SetTexID(static_cast<ImTextureID>(1));
+			tex->SetStatus(ImTextureStatus_OK);
+		}
+		else if ( tex->Status == ImTextureStatus_WantUpdates )
+		{
+			tex->SetStatus(ImTextureStatus_OK);
+		}
+		else if ( tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames > 0 )
+		{
+			tex->SetTexID(ImTextureID_Invalid);
+			tex->SetStatus(ImTextureStatus_Destroyed);
+		}
+	}
+}
+
+
+/**
+ * Obtains the screen centres of nodes wholly within the display
+ *
+ * @param[in] ng
+ *  The node graph; must have been updated at least once
+ * @param[in] nodes
+ *  The nodes to check
+ * @param[in] display
+ *  The display size
+ * @param[out] out
+ *  Replaced with the visible node centres, in creation order
+ */
+static void
+visible_node_centres(
+	imgui::ImNodeGraph& ng,
+	const std::vector<std::shared_ptr<BenchNode>>& nodes,
+	const ImVec2& display,
+	std::vector<ImVec2>& out
+)
+{
+	out.clear();
+
+	for ( auto& node : nodes )
+	{
+		ImVec2  min = ng.GetGridPosOnScreen(node->GetPosition());
+		ImVec2  max = min + node->GetSize();
+
+		if ( min.x >= 0.f && min.y >= 0.f && max.x < display.x && max.y < display.y )
+		{
+			out.push_back(ImVec2((min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f));
+		}
+	}
+}
+
+
+/**
+ * Queues the scripted input for a frame
+ *
+ * Every phase leaves the canvas at its default scroll and scale, and all
+ * buttons released, by its final frame.
+ *
+ * @param[in] io
+ *  The ImGui IO to queue events to
+ * @param[in] phase
+ *  The active phase
+ * @param[in] frame
+ *  The frame number within the phase
+ * @param[in] frames
+ *  The number of frames in the phase
+ * @param[in] targets
+ *  Screen positions of visible nodes
+ */
+static void
+script_input(
+	ImGuiIO& io,
+	BenchPhase phase,
+	int frame,
+	int frames,
+	const std::vector<ImVec2>& targets
+)
+{
+	ImVec2  centre = io.DisplaySize * 0.5f;
+	bool    last = frame == frames - 1;
+	int     half = frames / 2;
+
+	if ( frame == 0 )
+	{
+		// release the canvas reset keys pressed at the end of the zoom phase
+		io.AddKeyEvent(ImGuiKey_Z, false);
+		io.AddKeyEvent(ImGuiKey_R, false);
+	}
+
+	switch ( phase )
+	{
+	case BenchPhase_Pan:
+		// right-drag away and back again, returning to the start scroll
+		if ( frame == 0 )
+		{
+			io.AddMousePosEvent(centre.x, centre.y);
+			io.AddMouseButtonEvent(ImGuiMouseButton_Right, true);
+		}
+		else if ( last )
+		{
+			// drag recognition consumes the first move; reset rather than track it
+			io.AddMouseButtonEvent(ImGuiMouseButton_Right, false);
+			io.AddKeyEvent(ImGuiKey_R, true);
+		}
+		else
+		{
+			// equal moves out and back; any odd frame holds position
+			int    moves = half - 1;
+			float  step = 0.f;
+			if ( frame - 1 < moves )
+				step = 24.f;
+			else if ( frame - 1 < moves * 2 )
+				step = -24.f;
+			io.AddMousePosEvent(io.MousePos.x + step, io.MousePos.y + step * 0.5f);
+		}
+		break;
+	case BenchPhase_Zoom:
+		io.AddMousePosEvent(centre.x, centre.y);
+		if ( last )
+		{
+			io.AddKeyEvent(ImGuiKey_Z, true);
+			io.AddKeyEvent(ImGuiKey_R, true);
+		}
+		else
+		{
+			io.AddMouseWheelEvent(0.f, frame < half ? -1.f : 1.f);
+		}
+		break;
+	case BenchPhase_Hover:
+		if ( !targets.empty() )
+		{
+			// alternate node centres with the space between them
+			ImVec2  pos = targets[(frame / 2) % targets.size()];
+			if ( frame % 2 )
+				pos.x += TZK_DEFAULT_NEWNODE_WIDTH;
+			io.AddMousePosEvent(pos.x, pos.y);
+		}
+		break;
+	case BenchPhase_Select:
+		// click a new node every other frame; every third click adds to the selection
+		if ( !targets.empty() )
+		{
+			int     click = frame / 2;
+			ImVec2  pos = targets[(static_cast<size_t>(click) * 7) % targets.size()];
+
+			if ( frame % 2 == 0 && !last )
+			{
+				io.AddKeyEvent(ImGuiKey_LeftCtrl, click % 3 == 2);
+				io.AddMousePosEvent(pos.x, pos.y);
+				io.AddMouseButtonEvent(ImGuiMouseButton_Left, true);
+			}
+			else
+			{
+				io.AddMouseButtonEvent(ImGuiMouseButton_Left, false);
+				io.AddKeyEvent(ImGuiKey_LeftCtrl, false);
+			}
+		}
+		break;
+	case BenchPhase_Marquee:
+		// drag a selection rectangle from free space to the display centre
+		{
+			const float  start = 16.f; // within the canvas, short of the first node
+
+			if ( frame == 0 )
+			{
+				io.AddMousePosEvent(start, start);
+				io.AddMouseButtonEvent(ImGuiMouseButton_Left, true);
+			}
+			else if ( last )
+			{
+				io.AddMouseButtonEvent(ImGuiMouseButton_Left, false);
+			}
+			else
+			{
+				float  t = static_cast<float>(frame) / static_cast<float>(frames - 1);
+				io.AddMousePosEvent(start + (centre.x - start) * t, start + (centre.y - start) * t);
+			}
+		}
+		break;
+	case BenchPhase_Drag:
+		// drag the selection by one of its nodes, in a circle
+		if ( !targets.empty() )
+		{
+			if ( frame == 0 )
+			{
+				io.AddMousePosEvent(targets[0].x, targets[0].y);
+				io.AddMouseButtonEvent(ImGuiMouseButton_Left, true);
+			}
+			else if ( last )
+			{
+				io.AddMouseButtonEvent(ImGuiMouseButton_Left, false);
+			}
+			else
+			{
+				float  angle = static_cast<float>(frame) * 0.2f;
+				io.AddMousePosEvent(
+					targets[0].x + std::cos(angle) * 60.f - 60.f,
+					targets[0].y + std::sin(angle) * 60.f
+				);
+			}
+		}
+		break;
+	case BenchPhase_Idle:
+	default:
+		// mouse outside the display; nothing hovered
+		if ( frame == 0 )
+		{
+			io.AddMousePosEvent(-FLT_MAX, -FLT_MAX);
+		}
+		break;
+	}
+}
+
+
+/**
+ * Obtains a percentile from a sorted set of values
+ *
+ * @param[in] sorted
+ *  The values, ascending; must not be empty
+ * @param[in] pct
+ *  The percentile, 0..1
+ * @return
+ *  The value at the percentile
+ */
+static double
+percentile(
+	const std::vector<double>& sorted,
+	double pct
+)
+{
+	size_t  idx = static_cast<size_t>(pct * static_cast<double>(sorted.size() - 1) + 0.5);
+	return sorted[std::min(idx, sorted.size() - 1)];
+}
+
+
+int
+main(
+	int argc,
+	char** argv
+)
+{
+	bench_config  cfg;
+
+	if ( interpret_command_line(argc, argv, cfg) != 0 )
+	{
+		fprintf(stderr,
+			"Usage: %s [--nodes=N] [--pins=N] [--links=N] [--layout=grid|random|scalefree]\n"
+			"          [--seed=N] [--frames=N] [--width=N] [--height=N] [--csv=PATH]\n"
+			"          [--trace=PATH] [--profile=1] [--budget=MS]\n",
+			argv[0]
+		);
+		return EXIT_FAILURE;
+	}
+
+	core::ServiceLocator::CreateDefaultServices();
+	// no log targets exist; don't retain everything logged during the run
+	core::ServiceLocator::Log()->SetEventStorage(false);
+	core::ServiceLocator::Log()->DiscardStoredEvents();
+
+	ImGui::SetAllocatorFunctions(imgui_alloc, imgui_free, nullptr);
+	ImGui::CreateContext();
+
+	ImGuiIO&  io = ImGui::GetIO();
+	io.IniFilename = nullptr;
+	io.LogFilename = nullptr;
+	io.DisplaySize = ImVec2(cfg.width, cfg.height);
+	io.DeltaTime = 1.f / 60.f;
+	io.BackendPlatformName = "null";
+	io.BackendRendererName = "null";
+	io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasVtxOffset;
+
+	if ( !cfg.trace_path.empty() && core::Profiler::StartTrace(cfg.trace_path.c_str()) != ErrNONE )
+	{
+		fprintf(stderr, "Failed to start trace capture: %s\n", cfg.trace_path.c_str());
+	}
+	if ( cfg.profile )
+	{
+		core::Profiler::SetEnabled(true);
+	}
+
+	std::vector<frame_sample>  samples;
+	std::vector<ImVec2>  targets;
+	int  retval = EXIT_SUCCESS;
+
+	{
+		imgui::ImNodeGraph  ng;
+		std::vector<std::shared_ptr<BenchNode>>  nodes;
+		std::deque<link_data>  links;
+
+		ng.GetCanvas().configuration.zoom_enabled = true;
+		// reach the overview, where the detail levels take effect
+		ng.GetCanvas().configuration.zoom_min = 0.1f;
+
+		auto  build_start = std::chrono::steady_clock::now();
+		build_graph(cfg, ng, nodes, links);
+		double  build_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - build_start).count();
+
+		printf("Graph: %zu nodes, %zu pins, %zu links, layout=%s, seed=%u; built in %.2f ms\n",
+			nodes.size(), nodes.size() * cfg.pins, ng.GetLinks().size(),
+			cfg.layout == GraphLayout::Grid ? "grid" : cfg.layout == GraphLayout::Random ? "random" : "scalefree",
+			cfg.seed, build_ms
+		);
+
+		samples.reserve(static_cast<size_t>(cfg.frames) * BenchPhase_TOTAL);
+
+		for ( BenchPhase phase = BenchPhase_Idle; phase < BenchPhase_TOTAL; phase++ )
+		{
+			for ( int frame = 0; frame < cfg.frames; frame++ )
+			{
+				if ( frame == 0 )
+				{
+					visible_node_centres(ng, nodes, io.DisplaySize, targets);
+				}
+
+				script_input(io, phase, frame, cfg.frames, targets);
+
+				uint64_t  allocs = g_alloc_count.load(std::memory_order_relaxed);
+				uint64_t  bytes = g_alloc_bytes.load(std::memory_order_relaxed);
+				auto      start = std::chrono::steady_clock::now();
+
+				imgui::UserTexture::CollectRetired();
+				ImGui::NewFrame();
+				ImGui::SetNextWindowPos(ImVec2(0.f, 0.f));
+				ImGui::SetNextWindowSize(io.DisplaySize);
+				ImGui::Begin("Benchmark", nullptr,
+					ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoMove
+					| ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoBringToFrontOnFocus
+				);
+				ng.Update();
+				ImGui::End();
+				ImGui::Render();
+
+				auto  end = std::chrono::steady_clock::now();
+
+				null_renderer_textures();
+				core::Profiler::Frame();
+
+				ImDrawData*   dd = ImGui::GetDrawData();
+				frame_sample  fs;
+				fs.phase = phase;
+				fs.cpu_ms = std::chrono::duration<double, std::milli>(end - start).count();
+				fs.vtx_count = dd != nullptr ? dd->TotalVtxCount : 0;
+				fs.idx_count = dd != nullptr ? dd->TotalIdxCount : 0;
+				fs.allocs = g_alloc_count.load(std::memory_order_relaxed) - allocs;
+				fs.alloc_bytes = g_alloc_bytes.load(std::memory_order_relaxed) - bytes;
+				samples.push_back(fs);
+			}
+		}
+
+		printf("Final state: %zu selected, %zu nodes\n", ng.GetSelectedNodes().size(), ng.GetNodes().size());
+	}
+
+	printf("\n%-8s %8s %8s %8s %8s %10s %10s %10s %12s\n",
+		"phase", "mean_ms", "p50_ms", "p95_ms", "max_ms", "vtx", "idx", "allocs", "alloc_bytes"
+	);
+
+	for ( BenchPhase phase = BenchPhase_Idle; phase < BenchPhase_TOTAL; phase++ )
+	{
+		std::vector<double>  times;
+		double    total = 0.0;
+		uint64_t  vtx = 0;
+		uint64_t  idx = 0;
+		uint64_t  allocs = 0;
+		uint64_t  bytes = 0;
+
+		for ( auto& fs : samples )
+		{
+			if ( fs.phase != phase )
+				continue;
+
+			times.push_back(fs.cpu_ms);
+			total += fs.cpu_ms;
+			vtx += static_cast<uint64_t>(fs.vtx_count);
+			idx += static_cast<uint64_t>(fs.idx_count);
+			allocs += fs.allocs;
+			bytes += fs.alloc_bytes;
+		}
+
+		if ( times.empty() )
+			continue;
+
+		std::sort(times.begin(), times.end());
+
+		uint64_t  n = times.size();
+		double    p95 = percentile(times, 0.95);
+
+		// per-frame averages
+		printf("%-8s %8.3f %8.3f %8.3f %8.3f %10llu %10llu %10llu %12llu\n",
+			phase_names[phase], total / static_cast<double>(n), percentile(times, 0.5), p95, times.back(),
+			static_cast<unsigned long long>(vtx / n), static_cast<unsigned long long>(idx / n),
+			static_cast<unsigned long long>(allocs / n), static_cast<unsigned long long>(bytes / n)
+		);
+
+		if ( cfg.budget_ms > 0.f && p95 > cfg.budget_ms )
+		{
+			fprintf(stderr, "Phase '%s' exceeded budget: p95 %.3f ms > %.3f ms\n", phase_names[phase], p95, cfg.budget_ms);
+			retval = EXIT_FAILURE;
+		}
+	}
+
+	if ( !cfg.csv_path.empty() )
+	{
+		FILE*  fp = fopen(cfg.csv_path.c_str(), "w");
+
+		if ( fp == nullptr )
+		{
+			fprintf(stderr, "Failed to open %s for writing\n", cfg.csv_path.c_str());
+			retval = EXIT_FAILURE;
+		}
+		else
+		{
+			fprintf(fp, "frame,phase,cpu_ms,vtx,idx,allocs,alloc_bytes\n");
+			for ( size_t i = 0; i < samples.size(); i++ )
+			{
+				fprintf(fp, "%zu,%s,%.4f,%d,%d,%llu,%llu\n",
+					i, phase_names[samples[i].phase], samples[i].cpu_ms,
+					samples[i].vtx_count, samples[i].idx_count,
+					static_cast<unsigned long long>(samples[i].allocs),
+					static_cast<unsigned long long>(samples[i].alloc_bytes)
+				);
+			}
+			fclose(fp);
+		}
+	}
+
+	if ( cfg.profile )
+	{
+		std::vector<core::profile_zone_stats>  stats;
+		core::Profiler::GetZoneStats(0, stats);
+
+		printf("\n%-40s %10s %12s %10s\n", "zone", "calls", "total_ms", "max_ms");
+		for ( size_t i = 0; i < stats.size() && i < 20; i++ )
+		{
+			printf("%-40s %10u %12.3f %10.3f\n", stats[i].name, stats[i].calls,
+				static_cast<double>(stats[i].total) / 1000000.0,
+				static_cast<double>(stats[i].max) / 1000000.0
+			);
+		}
+	}
+
+	core::Profiler::StopTrace();
+	imgui::UserTexture::DestroyRetired();
+	ImGui::DestroyContext();
+	core::ServiceLocator::DestroyAllServices();
+
+	return retval;
+}
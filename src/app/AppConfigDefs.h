@@ -73,6 +73,10 @@ constexpr char  assetdir_sprites[]      = "sprites";
 #define TZK_CVAR_SETTING_AUDIO_FX_TASKFAILED_ENABLED    "audio.effects.task_failed.enabled"
 #define TZK_CVAR_SETTING_AUDIO_FX_TASKFAILED_NAME       "audio.effects.task_failed.name"
 #define TZK_CVAR_SETTING_CONFIG_SAVE_ON_EXIT            "config.save_on_exit"
+#define TZK_CVAR_SETTING_DATA_METRICS_ENABLED           "data.metrics.enabled"
+#define TZK_CVAR_SETTING_DATA_METRICS_FORMAT            "data.metrics.format"
+#define TZK_CVAR_SETTING_DATA_METRICS_INTERVAL          "data.metrics.interval"
+#define TZK_CVAR_SETTING_DATA_METRICS_PATH              "data.metrics.path"
 #define TZK_CVAR_SETTING_DATA_SYSINFO_ENABLED           "data.sysinfo.enabled"
 #define TZK_CVAR_SETTING_DATA_SYSINFO_MINIMAL           "data.sysinfo.minimal"
 #define TZK_CVAR_SETTING_DATA_TELEMETRY_ENABLED         "data.telemetry.enabled"
@@ -136,6 +140,10 @@ constexpr char  assetdir_sprites[]      = "sprites";
 #define TZK_CVAR_HASH_AUDIO_FX_TASKFAILED_ENABLED        TZK_COMPILE_TIME_HASH(TZK_CVAR_SETTING_AUDIO_FX_TASKFAILED_ENABLED)
 #define TZK_CVAR_HASH_AUDIO_FX_TASKFAILED_NAME           TZK_COMPILE_TIME_HASH(TZK_CVAR_SETTING_AUDIO_FX_TASKFAILED_NAME)
 #define TZK_CVAR_HASH_CONFIG_SAVE_ON_EXIT                TZK_COMPILE_TIME_HASH(TZK_CVAR_SETTING_CONFIG_SAVE_ON_EXIT)
+#define TZK_CVAR_HASH_DATA_METRICS_ENABLED               TZK_COMPILE_TIME_HASH(TZK_CVAR_SETTING_DATA_METRICS_ENABLED)
+#define TZK_CVAR_HASH_DATA_METRICS_FORMAT                TZK_COMPILE_TIME_HASH(TZK_CVAR_SETTING_DATA_METRICS_FORMAT)
+#define TZK_CVAR_HASH_DATA_METRICS_INTERVAL              TZK_COMPILE_TIME_HASH(TZK_CVAR_SETTING_DATA_METRICS_INTERVAL)
+#define TZK_CVAR_HASH_DATA_METRICS_PATH                  TZK_COMPILE_TIME_HASH(TZK_CVAR_SETTING_DATA_METRICS_PATH)
 #define TZK_CVAR_HASH_DATA_SYSINFO_ENABLED               TZK_COMPILE_TIME_HASH(TZK_CVAR_SETTING_DATA_SYSINFO_ENABLED)
 #define TZK_CVAR_HASH_DATA_SYSINFO_MINIMAL               TZK_COMPILE_TIME_HASH(TZK_CVAR_SETTING_DATA_SYSINFO_MINIMAL)
 #define TZK_CVAR_HASH_DATA_TELEMETRY_ENABLED             TZK_COMPILE_TIME_HASH(TZK_CVAR_SETTING_DATA_TELEMETRY_ENABLED)
@@ -200,6 +208,14 @@ constexpr char  assetdir_sprites[]      = "sprites";
 #define TZK_CVAR_DEFAULT_AUDIO_FX_TASKFAILED_ENABLED     "false"
 #define TZK_CVAR_DEFAULT_AUDIO_FX_TASKFAILED_NAME        ""
 #define TZK_CVAR_DEFAULT_CONFIG_SAVE_ON_EXIT             "true"
+#define TZK_CVAR_DEFAULT_DATA_METRICS_ENABLED            "false"
+#define TZK_CVAR_DEFAULT_DATA_METRICS_FORMAT             "Prometheus"
+#define TZK_CVAR_DEFAULT_DATA_METRICS_INTERVAL           "15"
+#if TZK_IS_WIN32
+#   define TZK_CVAR_DEFAULT_DATA_METRICS_PATH            "%APPDATA%/" TZK_ROOT_FOLDER_NAME "/" TZK_PROJECT_FOLDER_NAME "/metrics.prom"
+#else
+#   define TZK_CVAR_DEFAULT_DATA_METRICS_PATH            "$HOME/.config/" TZK_ROOT_FOLDER_NAME "/" TZK_PROJECT_FOLDER_NAME "/metrics.prom"
+#endif
 #define TZK_CVAR_DEFAULT_DATA_SYSINFO_ENABLED            "true"
 #define TZK_CVAR_DEFAULT_DATA_SYSINFO_MINIMAL            "true"
 #define TZK_CVAR_DEFAULT_DATA_TELEMETRY_ENABLED          "false"
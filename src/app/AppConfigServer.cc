@@ -13,6 +13,7 @@
 #include "app/TConverter.h"
 
 #include "core/services/log/Log.h"
+#include "core/services/metrics/Metrics.h"
 #include "core/util/net/net.h"
 #include "core/util/net/net_structs.h"
 #include "core/util/string/STR_funcs.h"
@@ -42,6 +43,10 @@ AppConfigServer::AppConfigServer()
 	TZK_CVAR(AUDIO_FX_TASKFAILED_ENABLED, "enabled");
 	TZK_CVAR(AUDIO_FX_TASKFAILED_NAME, "name");
 	TZK_CVAR(CONFIG_SAVE_ON_EXIT, "save_on_exit");
+	TZK_CVAR(DATA_METRICS_ENABLED, "enabled");
+	TZK_CVAR(DATA_METRICS_FORMAT, "format");
+	TZK_CVAR(DATA_METRICS_INTERVAL, "interval");
+	TZK_CVAR(DATA_METRICS_PATH, "path");
 	TZK_CVAR(DATA_SYSINFO_ENABLED, "enabled");
 	TZK_CVAR(DATA_SYSINFO_MINIMAL, "minimal");
 	TZK_CVAR(DATA_TELEMETRY_ENABLED, "enabled");
@@ -126,6 +131,7 @@ AppConfigServer::ValidateForCvar(
 		 * - do not check filesystem paths existence here!!
 		 */
 		return ErrNONE;
+	case TZK_CVAR_HASH_DATA_METRICS_PATH:
 	case TZK_CVAR_HASH_LOG_FILE_FOLDER_PATH:
 	case TZK_CVAR_HASH_RSS_DATABASE_PATH:
 	case TZK_CVAR_HASH_WORKSPACES_PATH:
@@ -150,6 +156,7 @@ AppConfigServer::ValidateForCvar(
 	case TZK_CVAR_HASH_AUDIO_FX_TASKCOMPLETE_ENABLED:
 	case TZK_CVAR_HASH_AUDIO_FX_TASKFAILED_ENABLED:
 	case TZK_CVAR_HASH_CONFIG_SAVE_ON_EXIT:
+	case TZK_CVAR_HASH_DATA_METRICS_ENABLED:
 	case TZK_CVAR_HASH_DATA_SYSINFO_ENABLED:
 	case TZK_CVAR_HASH_DATA_SYSINFO_MINIMAL:
 	case TZK_CVAR_HASH_DATA_TELEMETRY_ENABLED:
@@ -183,6 +190,23 @@ AppConfigServer::ValidateForCvar(
 			}
 		}
 		return ErrDATA;
+	case TZK_CVAR_HASH_DATA_METRICS_FORMAT:
+		{
+			if ( core::TConverter<MetricsFormat>::FromString(setting) == MetricsFormat::Invalid )
+				return ErrDATA;
+		}
+		return ErrNONE;
+	case TZK_CVAR_HASH_DATA_METRICS_INTERVAL:
+		{
+			// seconds; at least once a day, no more than once a second
+			if ( !STR_all_digits(setting) )
+				return ErrDATA;
+			if ( *setting == '0' || strlen(setting) > 5 )
+				return ErrDATA;
+			if ( core::TConverter<uint32_t>::FromString(setting) > 86400 )
+				return ErrDATA;
+		}
+		return ErrNONE;
 	case TZK_CVAR_HASH_LOG_FILE_LEVEL:
 	case TZK_CVAR_HASH_LOG_TERMINAL_LEVEL:
 		{
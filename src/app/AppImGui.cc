@@ -15,11 +15,14 @@
 #include "app/ForensicData.h"
 #include "app/ImGuiAboutDialog.h"
 #include "app/ImGuiActiveTasks.h"
+#include "app/ImGuiConsole.h"
 #include "app/ImGuiFileDialog.h"
 #include "app/ImGuiLog.h"
 #include "app/ImGuiMenuBar.h"
+#include "app/ImGuiMetrics.h"
 #include "app/ImGuiPingMonitor.h"
 #include "app/ImGuiPreferencesDialog.h"
+#include "app/ImGuiProfiler.h"
 #include "app/ImGuiRSS.h"
 #include "app/ImGuiSearchDialog.h"
 #include "app/ImGuiSemiFixedDock.h"
@@ -363,8 +366,9 @@ AppImGui::BuildFonts(
 	ImFont*  font_fixedw  = nullptr;
 	
 	/*
-	 * Check file existence ourselves to prevent imgui failing assertions.
-	 * If they don't exist, will still load the default inbuilt font and
+	 * Check file existence ourselves to prevent imgui failing assertions,
+	 * falling back to the embedded virtual files if not on disk.
+	 * If neither exist, will still load the default inbuilt font and
 	 * warning logged for the load failure, it just won't detail why
 	 * 
 	 * Important:
@@ -372,18 +376,36 @@ AppImGui::BuildFonts(
 	 * loaded and therefore EVERY imgui element that does not have an explicit
 	 * font setting will use it
 	 */
-	if ( default_font_path != nullptr && aux::file::exists(default_font_path) == EEXIST )
+	auto  add_font = [this, &io](const char* path, float size) -> ImFont*
 	{
-		/*
-		 * Yes, will be nice to use my own Font loading resources, but this is
-		 * just so damned convenient
-		 */
-		font_default = io.Fonts->AddFontFromFileTTF(default_font_path, default_font_size);
-	}
-	if ( fixedwidth_font_path != nullptr && aux::file::exists(fixedwidth_font_path) == EEXIST )
-	{
-		font_fixedw = io.Fonts->AddFontFromFileTTF(fixedwidth_font_path, fixedwidth_font_size);
-	}
+		if ( path == nullptr )
+			return nullptr;
+
+		if ( aux::file::exists(path) == EEXIST )
+		{
+			/*
+			 * Yes, will be nice to use my own Font loading resources, but this is
+			 * just so damned convenient
+			 */
+			return io.Fonts->AddFontFromFileTTF(path, size);
+		}
+
+		// embedded fonts are never extracted; use the in-memory copy directly
+		engine::memory_span  embedded = my_gui.context.GetVirtualFiles().Find(path);
+
+		if ( embedded.empty() )
+			return nullptr;
+
+		ImFontConfig  cfg;
+		// static data, owned by the binary; imgui must not attempt to free it
+		cfg.FontDataOwnedByAtlas = false;
+		return io.Fonts->AddFontFromMemoryTTF(
+			const_cast<unsigned char*>(embedded.data), static_cast<int>(embedded.size), size, &cfg
+		);
+	};
+
+	font_default = add_font(default_font_path, default_font_size);
+	font_fixedw = add_font(fixedwidth_font_path, fixedwidth_font_size);
 
 	// always last
 	ImFont*  inbuilt_font = io.Fonts->AddFontDefault();
@@ -1535,6 +1557,33 @@ AppImGui::PostEnd()
 	{
 		pingmon_window.reset();
 	}
+	else if ( TZK_UNLIKELY(my_gui.show_console && my_gui.console == nullptr) )
+	{
+		console_window = std::make_unique<ImGuiConsole>(my_gui);
+		my_gui.console = dynamic_cast<ImGuiConsole*>(console_window.get());
+	}
+	else if ( TZK_UNLIKELY(!my_gui.show_console && console_window != nullptr) )
+	{
+		console_window.reset();
+	}
+	else if ( TZK_UNLIKELY(my_gui.show_profiler && my_gui.profiler == nullptr) )
+	{
+		profiler_window = std::make_unique<ImGuiProfiler>(my_gui);
+		my_gui.profiler = dynamic_cast<ImGuiProfiler*>(profiler_window.get());
+	}
+	else if ( TZK_UNLIKELY(!my_gui.show_profiler && profiler_window != nullptr) )
+	{
+		profiler_window.reset();
+	}
+	else if ( TZK_UNLIKELY(my_gui.show_metrics && my_gui.metrics == nullptr) )
+	{
+		metrics_window = std::make_unique<ImGuiMetrics>(my_gui);
+		my_gui.metrics = dynamic_cast<ImGuiMetrics*>(metrics_window.get());
+	}
+	else if ( TZK_UNLIKELY(!my_gui.show_metrics && metrics_window != nullptr) )
+	{
+		metrics_window.reset();
+	}
 	else if ( TZK_UNLIKELY(my_gui.show_rss && rss_window == nullptr) )
 	{
 		rss_window = std::make_shared<ImGuiRSS>(my_gui);
@@ -1625,7 +1674,7 @@ AppImGui::PostEnd()
 				{
 					std::shared_ptr<Resource_Workspace>  wksp_res = std::make_shared<Resource_Workspace>(my_gui, path);
 
-					if ( my_gui.resource_loader.AddResource(std::dynamic_pointer_cast<engine::Resource>(wksp_res)) != ErrNONE )
+					if ( my_gui.resource_loader.AddResource(std::dynamic_pointer_cast<engine::Resource>(wksp_res), engine::LoadPriority::Blocking) != ErrNONE )
 					{
 						my_loading_workspace_resid = engine::null_id;
 					}
@@ -1864,6 +1913,18 @@ AppImGui::PreEnd()
 	{
 		pingmon_window->Draw();
 	}
+	if ( profiler_window != nullptr )
+	{
+		profiler_window->Draw();
+	}
+	if ( metrics_window != nullptr )
+	{
+		metrics_window->Draw();
+	}
+	if ( console_window != nullptr )
+	{
+		console_window->Draw();
+	}
 	if ( tasks_window != nullptr )
 	{
 		tasks_window->Draw();
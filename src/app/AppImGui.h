@@ -61,8 +61,10 @@ class ImGuiActiveTasks;
 class ImGuiConsole;
 class ImGuiFileDialog;
 class ImGuiHostDialog;
+class ImGuiMetrics;
 class ImGuiPingMonitor;
 class ImGuiPreferencesDialog;
+class ImGuiProfiler;
 class ImGuiRSS;
 class ImGuiSearchDialog;
 class ImGuiSemiFixedDock;
@@ -328,8 +330,10 @@ struct GuiInteractions
 	ImGuiConsole*            console = nullptr;
 	ImGuiFileDialog*         file_dialog = nullptr;
 	ImGuiHostDialog*         host_dialog = nullptr;
+	ImGuiMetrics*            metrics = nullptr;
 	ImGuiPingMonitor*        ping_monitor = nullptr;
 	ImGuiPreferencesDialog*  preferences_dialog = nullptr;
+	ImGuiProfiler*           profiler = nullptr;
 	ImGuiRSS*                rss = nullptr;
 	ImGuiSearchDialog*       search_dialog = nullptr;
 	ImGuiStyleEditor*        style_editor = nullptr;
@@ -342,8 +346,12 @@ struct GuiInteractions
 	bool  save_current_workspace = false;
 	/** Flag to show the about dialog */
 	bool  show_about = false;
+	/** Flag to show the console window */
+	bool  show_console = false;
 	/** Flag to show the file dialog */
 	bool  show_filedialog = false;
+	/** Flag to show the metrics window */
+	bool  show_metrics = false;
 	/** Flag to bring up the new workspace dialog (uses the file dialog) */// Pending removal
 	bool  show_new_workspace = false;
 	/** Flag to bring up the open workspace dialog (uses the file dialog) */// Pending removal
@@ -354,6 +362,8 @@ struct GuiInteractions
 	bool  show_pong = false;
 	/** Flag to show the preferences dialog */
 	bool  show_preferences = false;
+	/** Flag to show the profiler window */
+	bool  show_profiler = false;
 	/** Flag to show the RSS window draw client */
 	bool  show_rss = false;
 	/** Flag to show the Search dialog */
@@ -957,7 +967,9 @@ public:
 	// ---- standard windows ----
 	std::unique_ptr<IImGui>  console_window;
 	std::shared_ptr<IImGui>  log_window;
+	std::unique_ptr<IImGui>  metrics_window;
 	std::unique_ptr<IImGui>  pingmon_window;
+	std::unique_ptr<IImGui>  profiler_window;
 	std::shared_ptr<IImGui>  rss_window;
 	std::unique_ptr<IImGui>  style_window;
 	std::unique_ptr<IImGui>  tasks_window;
@@ -44,6 +44,7 @@
 #include "core/util/string/string.h"
 #include "core/util/string/STR_funcs.h"
 #include "core/util/sysinfo/DataSource_API.h"
+#include "core/util/Profiler.h"
 #include "core/util/time.h"
 #include "core/TConverter.h"
 #if TZK_IS_LINUX
@@ -293,6 +294,11 @@ Application::Cleanup()
 
 	TZK_LOG(LogLevel::Info, "Beginning application cleanup");
 
+	// no further frames will be drained, finalize the capture while possible
+	Profiler::StopTrace();
+	// final write while the log is still available; registry outlives us
+	core::ServiceLocator::Metrics()->StopDump();
+
 	if ( my_context != nullptr )
 	{
 		switch ( my_context->EngineState() )
@@ -721,27 +727,20 @@ Application::ErrorCallback(
 
 
 void
-Application::ExtractEmbeddedAssets()
+Application::ExposeEmbeddedAssets()
 {
 	using namespace trezanik::core;
 
 	/*
-	 * We extract everything at once, rather than on demand. It was initially
+	 * We handle everything at once, rather than on demand. It was initially
 	 * the latter, but every unique type needed special handling at whatever
 	 * point the 'need' was at, and this just ended up duplicating code and
-	 * hides what we do embed and extract.
+	 * hides what we do embed.
 	 * 
-	 * From here on, this is the sole method that will extract all embedded
+	 * From here on, this is the sole method that will expose all embedded
 	 * resources.
 	 */
 
-	auto  effects_list = aux::folder::scan_directory(my_assets_audio_effects_path, true);
-	//auto  tracks_list = aux::folder::scan_directory(my_assets_audio_tracks_path, true);
-	auto  font_list = aux::folder::scan_directory(my_assets_fonts_path, true);
-	auto  image_list = aux::folder::scan_directory(my_assets_images_path, true);
-	//auto  scripts_list = aux::folder::scan_directory(my_assets_scripts_path, true);
-	//auto  sprites_list = aux::folder::scan_directory(my_assets_sprites_path, true);
-
 	struct embedded_resource
 	{
 		std::string  dir;
@@ -750,100 +749,105 @@ Application::ExtractEmbeddedAssets()
 		size_t  data_size;
 	};
 
-	auto  extract_file = [](const embedded_resource& res)
-	{
-		assert(!res.dir.empty());
-		assert(!res.name.empty());
-		assert(res.data != nullptr);
-		assert(res.data != 0);
-
-		std::string  fpath = core::aux::BuildPath(res.dir, res.name);
-		int    flags = aux::file::OpenFlag_CreateUserR | aux::file::OpenFlag_CreateUserW | aux::file::OpenFlag_WriteOnly | aux::file::OpenFlag_Binary;
-		FILE*  fp = aux::file::open(fpath.c_str(), flags);
-
-		if ( fp != nullptr )
-		{
-			size_t  rc = aux::file::write(fp, res.data, res.data_size);
-			assert(res.data_size == rc);
-			aux::file::close(fp);
-			return true;
-		}
-		return false;
-	};
-
 	std::vector<embedded_resource>  resources;
 
 //#if TZK_EMBED_CONTF
-	auto  contf_res = std::find(font_list.begin(), font_list.end(), contf_name);
-	if ( contf_res == font_list.end() )
-	{
-		resources.push_back({ my_assets_fonts_path, contf_name, contf, contf_size });
-		resources.push_back({ my_assets_fonts_path, contf_license_name, contf_license, contf_license_size });
-	}
+	resources.push_back({ my_assets_fonts_path, contf_name, contf, contf_size });
+	resources.push_back({ my_assets_fonts_path, contf_license_name, contf_license, contf_license_size });
 //#endif
 //#if TZK_EMBED_FIRACODE
-	auto  firacode_res = std::find(font_list.begin(), font_list.end(), firacode_name);
-	if ( firacode_res == font_list.end() )
-	{
-		resources.push_back({ my_assets_fonts_path, firacode_name, firacode, firacode_size });
-		resources.push_back({ my_assets_fonts_path, firacode_license_name, firacode_license, firacode_license_size });
-	}
+	resources.push_back({ my_assets_fonts_path, firacode_name, firacode, firacode_size });
+	resources.push_back({ my_assets_fonts_path, firacode_license_name, firacode_license, firacode_license_size });
 //#endif
 //#if TZK_EMBED_OPENSANS
-	auto  opensans_res = std::find(font_list.begin(), font_list.end(), opensans_name);
-	if ( opensans_res == font_list.end() )
-	{
-		resources.push_back({ my_assets_fonts_path, opensans_name, opensans, opensans_size });
-		resources.push_back({ my_assets_fonts_path, opensans_license_name, opensans_license, opensans_license_size });
-	}
+	resources.push_back({ my_assets_fonts_path, opensans_name, opensans, opensans_size });
+	resources.push_back({ my_assets_fonts_path, opensans_license_name, opensans_license, opensans_license_size });
 //#endif
 //#if TZK_EMBED_PROGGYCLEAN
-	auto  progclean_res = std::find(font_list.begin(), font_list.end(), proggyclean_name);
-	if ( progclean_res == font_list.end() )
-	{
-		resources.push_back({ my_assets_fonts_path, proggyclean_name, proggyclean, proggyclean_size });
-		resources.push_back({ my_assets_fonts_path, proggyclean_license_name, proggyclean_license, proggyclean_license_size });
-	}
+	resources.push_back({ my_assets_fonts_path, proggyclean_name, proggyclean, proggyclean_size });
+	resources.push_back({ my_assets_fonts_path, proggyclean_license_name, proggyclean_license, proggyclean_license_size });
 //#endif
 //#if TZK_EMBED_ERRORWAV
-	auto  errorwav_res = std::find(effects_list.begin(), effects_list.end(), error_wav_name);
-	if ( errorwav_res == effects_list.end() )
-	{
-		resources.push_back({ my_assets_audio_effects_path, error_wav_name, error_wav, error_wav_size });
-		resources.push_back({ my_assets_audio_effects_path, error_wav_license_name, error_wav_license, error_wav_license_size });
-	}
+	resources.push_back({ my_assets_audio_effects_path, error_wav_name, error_wav, error_wav_size });
+	resources.push_back({ my_assets_audio_effects_path, error_wav_license_name, error_wav_license, error_wav_license_size });
 //#endif
-	
-	auto  isochrone_banner_res = std::find(image_list.begin(), image_list.end(), isochrone_banner_name);
-	auto  icon_pause_res = std::find(image_list.begin(), image_list.end(), icon_pause_name);
-	auto  icon_play_res = std::find(image_list.begin(), image_list.end(), icon_play_name);
-	auto  icon_stop_res = std::find(image_list.begin(), image_list.end(), icon_stop_name);
+	resources.push_back({ my_assets_images_path, isochrone_banner_name, isochrone_banner, isochrone_banner_size });
+	resources.push_back({ my_assets_images_path, isochrone_banner_license_name, isochrone_banner_license, isochrone_banner_license_size });
+	resources.push_back({ my_assets_images_path, icon_pause_name, icon_pause, icon_pause_size });
+	resources.push_back({ my_assets_images_path, icon_pause_license_name, icon_pause_license, icon_pause_license_size });
+	resources.push_back({ my_assets_images_path, icon_play_name, icon_play, icon_play_size });
+	resources.push_back({ my_assets_images_path, icon_play_license_name, icon_play_license, icon_play_license_size });
+	resources.push_back({ my_assets_images_path, icon_stop_name, icon_stop, icon_stop_size });
+	resources.push_back({ my_assets_images_path, icon_stop_license_name, icon_stop_license, icon_stop_license_size });
+
+	size_t  total_bytes = 0;
+	size_t  count = 0;
+	auto    start = std::chrono::steady_clock::now();
+
+#if TZK_EXTRACT_EMBEDDED_ASSETS
+	/*
+	 * Legacy behaviour; writes each resource out unless a file of that name
+	 * already exists. Retained for users wanting the files on disk to modify,
+	 * and to compare startup cost against the in-memory registration.
+	 */
+	auto  effects_list = aux::folder::scan_directory(my_assets_audio_effects_path, true);
+	auto  font_list = aux::folder::scan_directory(my_assets_fonts_path, true);
+	auto  image_list = aux::folder::scan_directory(my_assets_images_path, true);
 
-	if ( isochrone_banner_res == image_list.end() )
-	{
-		resources.push_back({ my_assets_images_path, isochrone_banner_name, isochrone_banner, isochrone_banner_size });
-		resources.push_back({ my_assets_images_path, isochrone_banner_license_name, isochrone_banner_license, isochrone_banner_license_size });
-	}
-	if ( icon_pause_res == image_list.end() )
-	{
-		resources.push_back({ my_assets_images_path, icon_pause_name, icon_pause, icon_pause_size });
-		resources.push_back({ my_assets_images_path, icon_pause_license_name, icon_pause_license, icon_pause_license_size });
-	}
-	if ( icon_play_res == image_list.end() )
-	{
-		resources.push_back({ my_assets_images_path, icon_play_name, icon_play, icon_play_size });
-		resources.push_back({ my_assets_images_path, icon_play_license_name, icon_play_license, icon_play_license_size });
-	}
-	if ( icon_stop_res == image_list.end() )
+	for ( const auto& res : resources )
 	{
-		resources.push_back({ my_assets_images_path, icon_stop_name, icon_stop, icon_stop_size });
-		resources.push_back({ my_assets_images_path, icon_stop_license_name, icon_stop_license, icon_stop_license_size });
+		const auto&  list = res.dir == my_assets_fonts_path() ? font_list
+			: res.dir == my_assets_images_path() ? image_list : effects_list;
+
+		if ( std::find(list.begin(), list.end(), res.name) != list.end() )
+			continue;
+
+		std::string  fpath = core::aux::BuildPath(res.dir, res.name);
+		int    flags = aux::file::OpenFlag_CreateUserR | aux::file::OpenFlag_CreateUserW | aux::file::OpenFlag_WriteOnly | aux::file::OpenFlag_Binary;
+		FILE*  fp = aux::file::open(fpath.c_str(), flags);
+
+		if ( fp != nullptr )
+		{
+			size_t  rc = aux::file::write(fp, res.data, res.data_size);
+			assert(res.data_size == rc);
+			aux::file::close(fp);
+			total_bytes += rc;
+			count++;
+		}
 	}
 
+	const char  action[] = "Extracted";
+#else
+	/*
+	 * Registered against the paths they would have been extracted to; the
+	 * type loaders prefer a real file at the same path, so users can still
+	 * override any of these by placing their own file in the assets folder.
+	 * No filesystem access at all, so read-only or noexec home directories
+	 * are no obstacle.
+	 */
+	engine::VirtualFiles&  vfiles = my_context->GetVirtualFiles();
+
 	for ( const auto& res : resources )
 	{
-		extract_file(res);
+		assert(res.data != nullptr);
+		assert(res.data_size != 0);
+
+		if ( vfiles.Register(res.dir, res.name, res.data, res.data_size) == ErrNONE )
+		{
+			total_bytes += res.data_size;
+			count++;
+		}
 	}
+
+	const char  action[] = "Registered";
+#endif  // TZK_EXTRACT_EMBEDDED_ASSETS
+
+	auto  elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+	TZK_LOG_FORMAT(LogLevel::Info,
+		"%s %zu embedded assets (%zu bytes) in %lld microseconds",
+		action, count, total_bytes, static_cast<long long>(elapsed.count())
+	);
 }
 
 
@@ -1386,6 +1390,20 @@ Application::Initialize(
 		log->DiscardStoredEvents();
 	}
 
+	if ( !my_trace_path.empty() && Profiler::StartTrace(my_trace_path.c_str()) != ErrNONE )
+	{
+		TZK_LOG_FORMAT(LogLevel::Warning, "Trace capture to '%s' could not be started", my_trace_path.c_str());
+	}
+
+	if ( my_cfg.data.metrics.enabled )
+	{
+		core::aux::Path  metrics_path(my_cfg.data.metrics.path);
+
+		core::ServiceLocator::Metrics()->StartDump(
+			metrics_path(), my_cfg.data.metrics.format, my_cfg.data.metrics.interval
+		);
+	}
+
 	
 	/*
 	 * Additional interactions with loaded configuration.
@@ -1487,7 +1505,7 @@ Application::Initialize(
 	CreatePath(my_assets_scripts_path);
 	CreatePath(my_assets_sprites_path);
 
-	ExtractEmbeddedAssets();
+	ExposeEmbeddedAssets();
 
 	// with essential resources defined/available, enter loading state
 	my_context->SetEngineState(trezanik::engine::State::Loading);
@@ -1526,6 +1544,12 @@ Application::Initialize(
 		{
 			TZK_LOG(LogLevel::Warning, "Network service initialization failed - proceeding with application init, no networking");
 		}
+		else
+		{
+			engine::ServiceLocator::Net()->GetHTTPCache().SetFolder(
+				my_context->UserDataPath() + "cache" + TZK_PATH_CHARSTR + "http"
+			);
+		}
 	}
 //#endif
 
@@ -1993,20 +2017,38 @@ Application::InitializeSDL()
 	// load in the default font SDL (but not imgui at this stage) will use
 	std::string  fontfile = my_context->AssetPath() + assetdir_fonts + TZK_PATH_CHARSTR + my_cfg.ui.default_font.name;
 #if TZK_USING_SDL_TTF
-	my_default_font = TTF_OpenFont(fontfile.c_str(), my_cfg.ui.default_font.pt_size);
+	auto  open_font = [this](const std::string& path, int pt_size) -> TTF_Font*
+	{
+		if ( aux::file::exists(path.c_str()) == EEXIST )
+		{
+			return TTF_OpenFont(path.c_str(), pt_size);
+		}
+
+		// embedded fonts are static; the RWops can reference them directly
+		engine::memory_span  embedded = my_context->GetVirtualFiles().Find(path);
+
+		if ( embedded.empty() )
+		{
+			return nullptr;
+		}
+
+		return TTF_OpenFontRW(SDL_RWFromConstMem(embedded.data, static_cast<int>(embedded.size)), 1, pt_size);
+	};
+
+	my_default_font = open_font(fontfile, my_cfg.ui.default_font.pt_size);
 	if ( my_default_font == nullptr )
 	{
 		TZK_LOG_FORMAT(LogLevel::Error, "[SDL] TTF_OpenFont(%s) failed: %s", fontfile.c_str(), SDL_GetError());
 		TZK_LOG(LogLevel::Warning, "Falling back to default inbuilt font");
 		
 		fontfile = my_context->AssetPath() + assetdir_fonts + TZK_PATH_CHARSTR + contf_name;
-		my_default_font = TTF_OpenFont(fontfile.c_str(), my_cfg.ui.default_font.pt_size);
+		my_default_font = open_font(fontfile, my_cfg.ui.default_font.pt_size);
 
 		/*
 		 * At least right now, this is only actually needed for Pong and other
 		 * extra applications, as imgui embeds defaults we can fall back to.
 		 * Retain the hard error for now, as this should always exist since we
-		 * write these defaults to disk - but it is safe to remove
+		 * embed these defaults - but it is safe to remove
 		 */
 		if ( my_default_font == nullptr )
 		{
@@ -2163,6 +2205,13 @@ Application::InterpretCommandLine(
 		TZK_LOG_FORMAT(LogLevel::Debug, "Opt#%d = %s -> %s", i, opt_name, opt_val.c_str());
 #endif
 
+		// not a configuration item; actioned once logging is available
+		if ( STR_compare(opt_name, "trace", 0) == 0 )
+		{
+			my_trace_path = opt_val;
+			continue;
+		}
+
 		_cli_args.emplace_back(opt_name, opt_val);
 	}
 
@@ -2248,7 +2297,8 @@ Application::LoadAudio()
 				{
 					auto  res = std::make_shared<Resource_Audio>(my_sounds[sound].fpath);
 
-					if ( ldr.AddResource(std::dynamic_pointer_cast<Resource>(res)) == ErrNONE )
+					// sound effects are not needed until an event triggers them
+					if ( ldr.AddResource(std::dynamic_pointer_cast<Resource>(res), LoadPriority::Prefetch) == ErrNONE )
 					{
 						my_sounds[sound].id = res->GetResourceID();
 						my_sounds[sound].sound = nullptr;
@@ -2594,6 +2644,10 @@ Application::MapSettingsFromMemberVars()
 	cfg->Set(TZK_CVAR_SETTING_AUDIO_VOLUME_EFFECTS, float_string_precision(my_cfg.audio.volume.effects, 2));
 	cfg->Set(TZK_CVAR_SETTING_AUDIO_VOLUME_MUSIC, float_string_precision(my_cfg.audio.volume.music, 2));
 	cfg->Set(TZK_CVAR_SETTING_CONFIG_SAVE_ON_EXIT, TConverter<bool>::ToString(my_cfg.config.save_on_exit));
+	cfg->Set(TZK_CVAR_SETTING_DATA_METRICS_ENABLED, TConverter<bool>::ToString(my_cfg.data.metrics.enabled));
+	cfg->Set(TZK_CVAR_SETTING_DATA_METRICS_FORMAT, TConverter<MetricsFormat>::ToString(my_cfg.data.metrics.format));
+	cfg->Set(TZK_CVAR_SETTING_DATA_METRICS_INTERVAL, TConverter<uint32_t>::ToString(my_cfg.data.metrics.interval));
+	cfg->Set(TZK_CVAR_SETTING_DATA_METRICS_PATH, my_cfg.data.metrics.path);
 	cfg->Set(TZK_CVAR_SETTING_DATA_SYSINFO_ENABLED, TConverter<bool>::ToString(my_cfg.data.sysinfo.enabled));
 	cfg->Set(TZK_CVAR_SETTING_DATA_SYSINFO_MINIMAL, TConverter<bool>::ToString(my_cfg.data.sysinfo.minimal));
 	cfg->Set(TZK_CVAR_SETTING_DATA_TELEMETRY_ENABLED, TConverter<bool>::ToString(my_cfg.data.telemetry.enabled));
@@ -2669,6 +2723,10 @@ Application::MapSettingsToMemberVars()
 	my_cfg.audio.volume.effects = TConverter<float>::FromString(cfg->Get(TZK_CVAR_SETTING_AUDIO_VOLUME_EFFECTS));
 	my_cfg.audio.volume.music = TConverter<float>::FromString(cfg->Get(TZK_CVAR_SETTING_AUDIO_VOLUME_MUSIC));
 	my_cfg.config.save_on_exit = TConverter<bool>::FromString(cfg->Get(TZK_CVAR_SETTING_CONFIG_SAVE_ON_EXIT));
+	my_cfg.data.metrics.enabled = TConverter<bool>::FromString(cfg->Get(TZK_CVAR_SETTING_DATA_METRICS_ENABLED));
+	my_cfg.data.metrics.format = TConverter<MetricsFormat>::FromString(cfg->Get(TZK_CVAR_SETTING_DATA_METRICS_FORMAT));
+	my_cfg.data.metrics.interval = TConverter<uint32_t>::FromString(cfg->Get(TZK_CVAR_SETTING_DATA_METRICS_INTERVAL));
+	my_cfg.data.metrics.path = cfg->Get(TZK_CVAR_SETTING_DATA_METRICS_PATH);
 	my_cfg.data.sysinfo.enabled = TConverter<bool>::FromString(cfg->Get(TZK_CVAR_SETTING_DATA_SYSINFO_ENABLED));
 	my_cfg.data.sysinfo.minimal = TConverter<bool>::FromString(cfg->Get(TZK_CVAR_SETTING_DATA_SYSINFO_MINIMAL));
 	my_cfg.data.telemetry.enabled = TConverter<bool>::FromString(cfg->Get(TZK_CVAR_SETTING_DATA_TELEMETRY_ENABLED));
@@ -2763,7 +2821,7 @@ Application::NewWorkspace(
 	std::shared_ptr<Resource_Workspace>  wksp_res = std::make_shared<Resource_Workspace>(*my_gui_interactions.get(), fpath);
 	auto& loader = my_context->GetResourceLoader();
 
-	rc = loader.AddResource(std::dynamic_pointer_cast<engine::Resource>(wksp_res));
+	rc = loader.AddResource(std::dynamic_pointer_cast<engine::Resource>(wksp_res), engine::LoadPriority::Blocking);
 
 	if ( rc != ErrNONE )
 	{
@@ -2807,7 +2865,7 @@ Application::PlaySound(
 		// application has a single emitter
 /// @todo separate func for ambient track, merge this one, or dedicated emitter?
 		ass->UseSound(my_audio_component, ref.sound, 128);
-		ref.sound->Play();
+		ass->StartSound(ref.sound);
 	}
 }
 
@@ -2830,6 +2888,9 @@ Application::PrintHelp()
 		ss << "\t" << def.first << "\n";
 
 	std::printf("%s", ss.str().c_str());
+
+	std::printf("\nAdditional options, not saved to configuration:\n");
+	std::printf("\t--trace=<file>  Capture profiler zones and task spans to <file>, in Chrome trace-event JSON format\n");
 }
 
 
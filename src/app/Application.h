@@ -13,6 +13,7 @@
 #include "app/event/AppEvent.h"
 #include "engine/services/event/EngineEvent.h"
 #include "core/services/log/LogLevel.h"
+#include "core/services/metrics/Metrics.h"
 #include "core/util/filesystem/Path.h"
 #include "core/util/SingularInstance.h"
 #include "core/UUID.h"
@@ -165,6 +166,12 @@ private:
 	 */
 	unsigned int  my_max_output_size;
 
+	/**
+	 * File path for a profiler trace capture, supplied on the command line.
+	 * Empty if no capture was requested
+	 */
+	std::string  my_trace_path;
+
 	/**
 	 * UUID registered with engine ResourceLoader for Workspace loading.
 	 * Engine is unaware of our classes, anything not integrated needs custom
@@ -251,6 +258,13 @@ private:
 
 		struct {
 
+			struct {
+				bool  enabled;
+				trezanik::core::MetricsFormat  format;
+				uint32_t     interval;
+				std::string  path;
+			} metrics;
+
 			struct {
 				bool  enabled;
 				bool  minimal;
@@ -470,22 +484,22 @@ private:
 
 
 	/**
-	 * Extracts from the binary all embedded assets, writing them to disk
+	 * Makes all assets embedded in the binary available to the resource system
 	 * 
 	 * Embedded resources can (will) be marked for inclusion via compile-time
 	 * defines. Each resource will increase the binary size, so they should be
 	 * kept minimal.
 	 * 
-	 * All files are written to the asset path for each file type. If a file of
-	 * that name already exists, extraction will be skipped; we make no attempt
-	 * to detect 'blocking' files, as it's up to the user.
-	 * Names are pre-determined in the associated header file under resources.
+	 * Each file is registered as a virtual file at the asset path for its
+	 * type, served from memory by the type loaders; a real file of the same
+	 * name takes precedence. Names are pre-determined in the associated header
+	 * file under resources.
 	 * 
-	 * May be linked in future with a custom command-line option to skip this
-	 * extraction.
+	 * If TZK_EXTRACT_EMBEDDED_ASSETS is enabled, the files are instead written
+	 * to disk (skipping any that already exist) as in prior versions.
 	 */
 	void
-	ExtractEmbeddedAssets();
+	ExposeEmbeddedAssets();
 
 
 	/**
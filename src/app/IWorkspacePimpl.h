@@ -33,6 +33,7 @@ namespace app {
  
 struct wksp_load;
 struct wksp_load_configs;
+struct wksp_load_groups;
 struct wksp_load_links;
 struct wksp_load_nodes;
 struct wksp_load_services;
@@ -42,6 +43,7 @@ struct wksp_load_styles;
 
 struct wksp_save;
 struct wksp_save_configs; 
+struct wksp_save_groups;
 struct wksp_save_links;
 struct wksp_save_nodes;
 struct wksp_save_services;
@@ -74,6 +76,11 @@ protected:
 		struct wksp_load_configs& loader
 	) = 0;
 
+	virtual int
+	LoadGroups(
+		struct wksp_load_groups& loader
+	) = 0;
+
 	virtual int
 	LoadLinks(
 		struct wksp_load_links& loader
@@ -110,6 +117,11 @@ protected:
 		struct wksp_save_configs& saver
 	) = 0;
 
+	virtual int
+	SaveGroups(
+		struct wksp_save_groups& saver
+	) = 0;
+
 	virtual int
 	SaveLinks(
 		struct wksp_save_links& saver
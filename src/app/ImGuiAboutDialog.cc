@@ -143,7 +143,9 @@ ImGuiAboutDialog::Draw()
 #if 0  // Code Disabled: debug use only
 			ImGui::Text("Image: %d x %d", w, h);
 #endif
-			ImGui::Image((ImTextureID)(uintptr_t)my_img->AsSDLTexture(), ImVec2(static_cast<float>(w), static_cast<float>(h)));
+			float  u0, v0, u1, v1;
+			my_img->TextureCoordinates(u0, v0, u1, v1);
+			ImGui::Image((ImTextureID)(uintptr_t)my_img->AsSDLTexture(), ImVec2(static_cast<float>(w), static_cast<float>(h)), ImVec2(u0, v0), ImVec2(u1, v1));
 		}
 #if 0
 		static SDL_Texture*  tex = nullptr;
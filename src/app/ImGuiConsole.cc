@@ -10,12 +10,314 @@
 #if TZK_USING_IMGUI
 
 #include "app/ImGuiConsole.h"
+#include "app/AppImGui.h"
+
+#include "core/services/log/Log.h"
+#include "core/util/string/STR_funcs.h"
+#include "core/util/string/string.h"
+#include "core/util/Profiler.h"
+#include "core/error.h"
+
+#include "engine/objects/EntityBenchmark.h"
+
+#include <cinttypes>
 
 
 namespace trezanik {
 namespace app {
 
 
+ImGuiConsole::ImGuiConsole(
+	GuiInteractions& gui_interactions
+)
+: IImGui(gui_interactions)
+, my_max_output_size(512)
+, my_scroll_to_bottom(false)
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Constructor starting");
+	{
+		my_input_buffer[0] = '\0';
+
+		_gui_interactions.console = this;
+		_gui_interactions.show_console = true;
+
+		Print("Enter 'help' for the available commands");
+	}
+	TZK_LOG(LogLevel::Trace, "Constructor finished");
+}
+
+
+ImGuiConsole::~ImGuiConsole()
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Destructor starting");
+	{
+		_gui_interactions.console = nullptr;
+		_gui_interactions.show_console = false;
+	}
+	TZK_LOG(LogLevel::Trace, "Destructor finished");
+}
+
+
+void
+ImGuiConsole::Draw()
+{
+	ImGuiWindowFlags  wnd_flags = ImGuiWindowFlags_NoCollapse;
+	ImVec2  min_size(320.f, 160.f);
+	ImVec2  start_size(_gui_interactions.app_usable_rect.Max * 0.4f);
+
+	ImGui::SetNextWindowSize(start_size, ImGuiCond_Appearing);
+	ImGui::SetNextWindowSizeConstraints(min_size, ImVec2(FLT_MAX, FLT_MAX));
+
+	if ( !ImGui::Begin("Console", &_gui_interactions.show_console, wnd_flags) )
+	{
+		ImGui::End();
+		return;
+	}
+
+	// reserve the input line
+	float  footer_height = ImGui::GetStyle().ItemSpacing.y + ImGui::GetFrameHeightWithSpacing();
+
+	if ( ImGui::BeginChild("ConsoleOutput", ImVec2(0, -footer_height), false, ImGuiWindowFlags_HorizontalScrollbar) )
+	{
+		for ( auto& line : my_output )
+		{
+			ImGui::TextUnformatted(line.c_str());
+		}
+
+		if ( my_scroll_to_bottom )
+		{
+			ImGui::SetScrollHereY(1.0f);
+			my_scroll_to_bottom = false;
+		}
+	}
+	ImGui::EndChild();
+
+	ImGui::Separator();
+
+	ImGui::SetNextItemWidth(-FLT_MIN);
+	if ( ImGui::InputText("##input", my_input_buffer, sizeof(my_input_buffer), ImGuiInputTextFlags_EnterReturnsTrue) )
+	{
+		std::string  cmdline = my_input_buffer;
+
+		my_input_buffer[0] = '\0';
+		Execute(cmdline);
+
+		// keep the input line active for the next command
+		ImGui::SetKeyboardFocusHere(-1);
+	}
+
+	ImGui::End();
+}
+
+
+void
+ImGuiConsole::Execute(
+	const std::string& cmdline
+)
+{
+	using namespace trezanik::core;
+
+	auto  tokens = aux::Split(cmdline, " ");
+
+	if ( tokens.empty() )
+		return;
+
+	Print("> " + cmdline);
+
+	std::string  cmd = tokens[0];
+	std::vector<std::string>  args(tokens.begin() + 1, tokens.end());
+
+	if ( cmd == "bench" )
+	{
+		ExecuteBench(args);
+	}
+	else if ( cmd == "clear" )
+	{
+		my_output.clear();
+	}
+	else if ( cmd == "help" )
+	{
+		Print("bench entities [n] [i] Times n entities (default 100000) over i updates (default 100) in both component layouts");
+		Print("clear                  Removes all console output");
+		Print("help                   Displays this list");
+		Print("profiler [on|off]      Enables or disables the profiler, or shows its state");
+		Print("trace start <file>     Captures profiler zones and task spans to a Chrome trace-event JSON file");
+		Print("trace stop             Stops the active capture, finalizing the file");
+		Print("trace status           Shows if a capture is active");
+	}
+	else if ( cmd == "profiler" )
+	{
+		ExecuteProfiler(args);
+	}
+	else if ( cmd == "trace" )
+	{
+		ExecuteTrace(args);
+	}
+	else
+	{
+		Print("Unknown command: '" + cmd + "'");
+	}
+}
+
+
+void
+ImGuiConsole::ExecuteBench(
+	const std::vector<std::string>& args
+)
+{
+	using namespace trezanik::core;
+
+	if ( args.empty() || args[0] != "entities" )
+	{
+		Print("Usage: bench entities [count] [iterations]");
+		return;
+	}
+
+	size_t  count = 100000;
+	size_t  iterations = 100;
+
+	if ( args.size() > 1 )
+	{
+		if ( !STR_all_digits(args[1].c_str()) || args[1].length() > 8 )
+		{
+			Print("Invalid entity count: '" + args[1] + "'");
+			return;
+		}
+		count = std::stoul(args[1]);
+	}
+	if ( args.size() > 2 )
+	{
+		if ( !STR_all_digits(args[2].c_str()) || args[2].length() > 5 )
+		{
+			Print("Invalid iteration count: '" + args[2] + "'");
+			return;
+		}
+		iterations = std::stoul(args[2]);
+	}
+
+	auto  res = engine::benchmark_entity_storage(count, iterations);
+	char  buf[256];
+
+	std::snprintf(buf, sizeof(buf), "%zu entities, %zu iterations", res.entity_count, res.iterations);
+	Print(buf);
+	std::snprintf(buf, sizeof(buf), "  pointer  : create %" PRIu64 "us, update %" PRIu64 "us",
+		res.pointer_create_us, res.pointer_update_us
+	);
+	Print(buf);
+	std::snprintf(buf, sizeof(buf), "  registry : create %" PRIu64 "us, update %" PRIu64 "us",
+		res.registry_create_us, res.registry_update_us
+	);
+	Print(buf);
+	if ( !res.results_match )
+	{
+		Print("  WARNING: layouts produced differing results");
+	}
+}
+
+
+void
+ImGuiConsole::ExecuteProfiler(
+	const std::vector<std::string>& args
+)
+{
+	using namespace trezanik::core;
+
+	if ( args.empty() )
+	{
+		Print(std::string("Profiler is ") + (Profiler::IsEnabled() ? "enabled" : "disabled"));
+	}
+	else if ( args[0] == "on" )
+	{
+		Profiler::SetEnabled(true);
+		Print("Profiler enabled");
+	}
+	else if ( args[0] == "off" )
+	{
+		Profiler::SetEnabled(false);
+		Print("Profiler disabled");
+	}
+	else
+	{
+		Print("Usage: profiler [on|off]");
+	}
+}
+
+
+void
+ImGuiConsole::ExecuteTrace(
+	const std::vector<std::string>& args
+)
+{
+	using namespace trezanik::core;
+
+	if ( args.empty() )
+	{
+		Print("Usage: trace start <file> | trace stop | trace status");
+	}
+	else if ( args[0] == "start" )
+	{
+		if ( args.size() < 2 )
+		{
+			Print("Usage: trace start <file>");
+			return;
+		}
+
+		// paths may contain spaces; rejoin the remainder
+		std::string  path = args[1];
+		for ( size_t i = 2; i < args.size(); i++ )
+		{
+			path += " " + args[i];
+		}
+
+		int  rc = Profiler::StartTrace(path.c_str());
+
+		if ( rc == ErrNONE )
+			Print("Trace capture started: " + path);
+		else if ( rc == EALREADY )
+			Print("A trace capture is already active");
+		else
+			Print("Failed to open '" + path + "' for writing");
+	}
+	else if ( args[0] == "stop" )
+	{
+		if ( !Profiler::IsTracing() )
+		{
+			Print("No trace capture is active");
+			return;
+		}
+
+		Profiler::StopTrace();
+		Print("Trace capture stopped");
+	}
+	else if ( args[0] == "status" )
+	{
+		Print(Profiler::IsTracing() ? "Trace capture active" : "No trace capture is active");
+	}
+	else
+	{
+		Print("Unknown trace option: '" + args[0] + "'");
+	}
+}
+
+
+void
+ImGuiConsole::Print(
+	const std::string& line
+)
+{
+	my_output.push_back(line);
+
+	while ( my_output.size() > my_max_output_size )
+	{
+		my_output.pop_front();
+	}
+
+	my_scroll_to_bottom = true;
+}
 
 
 } // namespace app
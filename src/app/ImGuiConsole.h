@@ -12,7 +12,13 @@
 
 #if TZK_USING_IMGUI
 
-#include <imgui/dear_imgui/imgui.h>
+#include "app/IImGui.h"
+
+#include "core/util/SingularInstance.h"
+
+#include <deque>
+#include <string>
+#include <vector>
 
 
 namespace trezanik {
@@ -21,7 +27,11 @@ namespace app {
 
 /**
  * Console window for issuing commands
- * 
+ *
+ * Presently a standalone window handling a small set of diagnostic commands,
+ * such as controlling the profiler and trace captures; enter 'help' for the
+ * full list.
+ *
  * @note
  *  Pretty niche which is why I haven't created this so far; much like a game
  *  console to edit settings/spawn items on the fly. Requires the design for
@@ -30,6 +40,8 @@ namespace app {
  *  Log window provides much of the feedback we need for now instead.
  */
 class ImGuiConsole
+	: public IImGui
+	, private trezanik::core::SingularInstance<ImGuiConsole>
 {
 	TZK_NO_CLASS_ASSIGNMENT(ImGuiConsole);
 	TZK_NO_CLASS_COPY(ImGuiConsole);
@@ -37,12 +49,90 @@ class ImGuiConsole
 	TZK_NO_CLASS_MOVECOPY(ImGuiConsole);
 
 private:
+
+	/** Holds the text currently within the input line */
+	char  my_input_buffer[1024];
+
+	/** The data output to the console; FIFO once limit hit */
+	std::deque<std::string>  my_output;
+
+	/** Maximum number of elements my_output holds until popping old data */
+	size_t  my_max_output_size;
+
+	/** Flag to scroll the output to the newest line on the next draw */
+	bool  my_scroll_to_bottom;
+
+
+	/**
+	 * Executes a command line, writing any feedback to the output
+	 *
+	 * @param[in] cmdline
+	 *  The full command line as entered
+	 */
+	void
+	Execute(
+		const std::string& cmdline
+	);
+
+
+	/**
+	 * Handles the 'bench' command
+	 *
+	 * @param[in] args
+	 *  The command arguments, excluding the command itself
+	 */
+	void
+	ExecuteBench(
+		const std::vector<std::string>& args
+	);
+
+
+	/**
+	 * Handles the 'profiler' command
+	 *
+	 * @param[in] args
+	 *  The command arguments, excluding the command itself
+	 */
+	void
+	ExecuteProfiler(
+		const std::vector<std::string>& args
+	);
+
+
+	/**
+	 * Handles the 'trace' command
+	 *
+	 * @param[in] args
+	 *  The command arguments, excluding the command itself
+	 */
+	void
+	ExecuteTrace(
+		const std::vector<std::string>& args
+	);
+
+
+	/**
+	 * Appends a line to the output
+	 *
+	 * @param[in] line
+	 *  The text to append
+	 */
+	void
+	Print(
+		const std::string& line
+	);
+
 protected:
 public:
 	/**
 	 * Standard constructor
+	 *
+	 * @param[in] gui_interactions
+	 *  Reference to the shared object
 	 */
-	ImGuiConsole();
+	ImGuiConsole(
+		GuiInteractions& gui_interactions
+	);
 
 
 	/**
@@ -50,6 +140,12 @@ public:
 	 */
 	~ImGuiConsole();
 
+
+	/**
+	 * Implementation of IImGui::Draw
+	 */
+	virtual void
+	Draw() override;
 };
 
 
@@ -48,45 +48,18 @@ ImGuiHostDialog::ImGuiHostDialog(
 		std::string  fpath_win8   = aux::BuildPath(my_context.AssetPath() + assetdir_images, "icon_win8.png");
 		std::string  fpath_win10  = aux::BuildPath(my_context.AssetPath() + assetdir_images, "icon_win10.png");
 		std::string  fpath_win11  = aux::BuildPath(my_context.AssetPath() + assetdir_images, "icon_win11.png");
-		my_icon_win2k_rid  = my_context.GetResourceCache().GetResourceID(fpath_win2k.c_str());
-		my_icon_winxp_rid  = my_context.GetResourceCache().GetResourceID(fpath_winxp.c_str());
-		my_icon_winvista7_rid  = my_context.GetResourceCache().GetResourceID(fpath_winvista7.c_str());
-		my_icon_win8_rid   = my_context.GetResourceCache().GetResourceID(fpath_win8.c_str());
-		my_icon_win10_rid  = my_context.GetResourceCache().GetResourceID(fpath_win10.c_str());
-		my_icon_win11_rid  = my_context.GetResourceCache().GetResourceID(fpath_win11.c_str());
-
 		auto& ldr = my_context.GetResourceLoader();
 
-		auto ResourceLoad = [&ldr, this](
-			trezanik::core::UUID& id,
-			std::shared_ptr<trezanik::engine::Resource_Image>& icon,
-			std::string& fpath
-		)
-		{
-			if ( icon != nullptr )
-				return;
-
-			if ( id == null_id )
-			{
-				auto res = std::make_shared<Resource_Image>(fpath);
-				if ( ldr.AddResource(std::dynamic_pointer_cast<Resource>(res)) == ErrNONE )
-				{
-					// track the resource so we can assign it when ready
-					id = res->GetResourceID();
-				}
-			}
-			else
-			{
-				icon = std::dynamic_pointer_cast<Resource_Image>(my_context.GetResourceCache().GetResource(id));
-			}
-		};
-
-		ResourceLoad(my_icon_win2k_rid, my_icon_win2k, fpath_win2k);
-		ResourceLoad(my_icon_winxp_rid, my_icon_winxp, fpath_winxp);
-		ResourceLoad(my_icon_winvista7_rid, my_icon_winvista7, fpath_winvista7);
-		ResourceLoad(my_icon_win8_rid, my_icon_win8, fpath_win8);
-		ResourceLoad(my_icon_win10_rid, my_icon_win10, fpath_win10);
-		ResourceLoad(my_icon_win11_rid, my_icon_win11, fpath_win11);
+		/*
+		 * Ready immediately if cached, or shares the load if already in
+		 * progress (e.g. dialog reopened); assigned in Draw once complete
+		 */
+		my_icon_win2k_load  = ldr.Load(std::make_shared<Resource_Image>(fpath_win2k));
+		my_icon_winxp_load  = ldr.Load(std::make_shared<Resource_Image>(fpath_winxp));
+		my_icon_winvista7_load  = ldr.Load(std::make_shared<Resource_Image>(fpath_winvista7));
+		my_icon_win8_load   = ldr.Load(std::make_shared<Resource_Image>(fpath_win8));
+		my_icon_win10_load  = ldr.Load(std::make_shared<Resource_Image>(fpath_win10));
+		my_icon_win11_load  = ldr.Load(std::make_shared<Resource_Image>(fpath_win11));
 
 		ldr.Sync();
 	}
@@ -111,6 +84,27 @@ ImGuiHostDialog::~ImGuiHostDialog()
 void
 ImGuiHostDialog::Draw()
 {
+	using namespace trezanik::engine;
+
+	// assign each icon once its load completes, no further need for the future
+	auto  assign_icon = [](std::shared_ptr<Resource_Image>& icon, load_future& load)
+	{
+		auto  res = load_result(load);
+
+		if ( res != nullptr )
+		{
+			icon = std::dynamic_pointer_cast<Resource_Image>(res);
+			load = load_future();
+		}
+	};
+
+	assign_icon(my_icon_win2k, my_icon_win2k_load);
+	assign_icon(my_icon_winxp, my_icon_winxp_load);
+	assign_icon(my_icon_winvista7, my_icon_winvista7_load);
+	assign_icon(my_icon_win8, my_icon_win8_load);
+	assign_icon(my_icon_win10, my_icon_win10_load);
+	assign_icon(my_icon_win11, my_icon_win11_load);
+
 	const char*  host = "PLACEHOLDER";
 	const char*  domain = "PLACEHOLDER";
 	const char*  ipv4 = "PLACEHOLDER";
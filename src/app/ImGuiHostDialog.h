@@ -17,6 +17,7 @@
 
 #include "engine/Context.h"
 #include "engine/resources/Resource_Image.h"
+#include "engine/resources/ResourceLoader.h"
 
 #include "core/util/SingularInstance.h"
 
@@ -56,17 +57,17 @@ private:
 	// argh! pairing!
 	/* Icons for all different operating systems */
 	std::shared_ptr<trezanik::engine::Resource_Image>  my_icon_win2k;
-	trezanik::core::UUID  my_icon_win2k_rid;
+	trezanik::engine::load_future  my_icon_win2k_load;
 	std::shared_ptr<trezanik::engine::Resource_Image>  my_icon_winxp;
-	trezanik::core::UUID  my_icon_winxp_rid;
+	trezanik::engine::load_future  my_icon_winxp_load;
 	std::shared_ptr<trezanik::engine::Resource_Image>  my_icon_winvista7;
-	trezanik::core::UUID  my_icon_winvista7_rid;
+	trezanik::engine::load_future  my_icon_winvista7_load;
 	std::shared_ptr<trezanik::engine::Resource_Image>  my_icon_win8;
-	trezanik::core::UUID  my_icon_win8_rid;
+	trezanik::engine::load_future  my_icon_win8_load;
 	std::shared_ptr<trezanik::engine::Resource_Image>  my_icon_win10;
-	trezanik::core::UUID  my_icon_win10_rid;
+	trezanik::engine::load_future  my_icon_win10_load;
 	std::shared_ptr<trezanik::engine::Resource_Image>  my_icon_win11;
-	trezanik::core::UUID  my_icon_win11_rid;
+	trezanik::engine::load_future  my_icon_win11_load;
 	// icon_freebsd
 	// icon_linux
 	// icon_openbsd
@@ -47,7 +47,10 @@ ImGuiMenuBar::ImGuiMenuBar(
 , guide           { "Usage Guide",        "Ctrl+G", &unused, true }
 , preferences     { "Preferences",        "Ctrl+P", &gui_interactions.show_preferences, true }
 , save_cfg_exit   { "Save Config on Exit","", &unused, true } 
+, console         { "Console",            "", &gui_interactions.show_console, true }
 , demo            { "Show imgui demo",    "Ctrl+D", &gui_interactions.show_demo, true }
+, metrics         { "Metrics",            "", &gui_interactions.show_metrics, true }
+, profiler        { "Profiler",           "", &gui_interactions.show_profiler, true }
 , update          { "Update",             "Ctrl+U", &gui_interactions.show_update, true }
 , workspace_close { "Close",              "Ctrl+W", &gui_interactions.close_current_workspace, true }
 , workspace_new   { "New",                "Ctrl+N", &gui_interactions.show_new_workspace, true }
@@ -243,7 +246,10 @@ ImGuiMenuBar::Draw()
 
 	if ( ImGui::BeginMenu("Windows") )
 	{
+		ImGui::MenuItem(console.text, console.shortcut, console.setting, console.enabled);
 		ImGui::MenuItem(demo.text, demo.shortcut, demo.setting, demo.enabled);
+		ImGui::MenuItem(metrics.text, metrics.shortcut, metrics.setting, metrics.enabled);
+		ImGui::MenuItem(profiler.text, profiler.shortcut, profiler.setting, profiler.enabled);
 
 		ImGui::Separator();
 
@@ -76,8 +76,14 @@ private:
 	MenuBarItem  preferences;
 	/** Menu item controlling the save config on exit option */
 	MenuBarItem  save_cfg_exit;
+	/** Menu item controlling the console window */
+	MenuBarItem  console;
 	/** Menu item controlling the imgui demo window */
 	MenuBarItem  demo;
+	/** Menu item controlling the metrics window */
+	MenuBarItem  metrics;
+	/** Menu item controlling the profiler window */
+	MenuBarItem  profiler;
 	/** Menu item controlling the update dialog */
 	MenuBarItem  update;
 	/** Menu item to close the current workspace */
@@ -0,0 +1,243 @@
+/**
+ * @file        src/app/ImGuiMetrics.cc
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "app/definitions.h"
+
+#if TZK_USING_IMGUI
+
+#include "app/ImGuiMetrics.h"
+#include "app/AppImGui.h"
+
+#include "core/services/log/Log.h"
+
+#include <cinttypes>
+
+
+namespace trezanik {
+namespace app {
+
+
+/**
+ * Presents the help text of a metric as a tooltip for the last item
+ *
+ * @param[in] metric
+ *  The metric to present the help text of
+ */
+static void
+metric_tooltip(
+	const trezanik::core::Metric& metric
+)
+{
+	if ( !metric.Help().empty() && ImGui::IsItemHovered() )
+	{
+		ImGui::SetTooltip("%s", metric.Help().c_str());
+	}
+}
+
+
+ImGuiMetrics::ImGuiMetrics(
+	GuiInteractions& gui_interactions
+)
+: IImGui(gui_interactions)
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Constructor starting");
+	{
+		_gui_interactions.metrics = this;
+		_gui_interactions.show_metrics = true;
+	}
+	TZK_LOG(LogLevel::Trace, "Constructor finished");
+}
+
+
+ImGuiMetrics::~ImGuiMetrics()
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Destructor starting");
+	{
+		_gui_interactions.metrics = nullptr;
+		_gui_interactions.show_metrics = false;
+	}
+	TZK_LOG(LogLevel::Trace, "Destructor finished");
+}
+
+
+void
+ImGuiMetrics::Draw()
+{
+	using namespace trezanik::core;
+
+	ImGuiWindowFlags  wnd_flags = ImGuiWindowFlags_NoCollapse;
+	ImVec2  min_size(400.f, 240.f);
+	ImVec2  start_size(_gui_interactions.app_usable_rect.Max * 0.5f);
+
+	ImGui::SetNextWindowSize(start_size, ImGuiCond_Appearing);
+	ImGui::SetNextWindowSizeConstraints(min_size, ImVec2(FLT_MAX, FLT_MAX));
+
+	if ( !ImGui::Begin("Metrics", &_gui_interactions.show_metrics, wnd_flags) )
+	{
+		ImGui::End();
+		return;
+	}
+
+	auto  metrics = ServiceLocator::Metrics();
+
+	if ( ImGui::Button("Copy Prometheus") )
+	{
+		ImGui::SetClipboardText(metrics->Serialize(MetricsFormat::Prometheus).c_str());
+	}
+	ImGui::SameLine();
+	if ( ImGui::Button("Copy JSON") )
+	{
+		ImGui::SetClipboardText(metrics->Serialize(MetricsFormat::JSON).c_str());
+	}
+	ImGui::SameLine();
+	if ( metrics->IsDumping() )
+		ImGui::TextColored(ImVec4(0.2f, 0.8f, 0.2f, 1.f), "Periodic dump active");
+	else
+		ImGui::TextDisabled("Periodic dump inactive");
+
+	my_filter.Draw("Filter [include,-exclude]", 200.f);
+
+	ImGui::Separator();
+
+	metrics->GetCounters(my_counters);
+	metrics->GetGauges(my_gauges);
+	metrics->GetHistograms(my_histograms);
+
+	if ( ImGui::CollapsingHeader("Counters and Gauges", ImGuiTreeNodeFlags_DefaultOpen) )
+	{
+		DrawValues();
+	}
+	if ( ImGui::CollapsingHeader("Histograms", ImGuiTreeNodeFlags_DefaultOpen) )
+	{
+		DrawHistograms();
+	}
+
+	ImGui::End();
+}
+
+
+void
+ImGuiMetrics::DrawHistograms()
+{
+	using namespace trezanik::core;
+
+	if ( my_histograms.empty() )
+	{
+		ImGui::TextDisabled("No histograms registered");
+		return;
+	}
+
+	ImGuiTableFlags  tbl_flags = ImGuiTableFlags_Resizable
+		| ImGuiTableFlags_Borders
+		| ImGuiTableFlags_NoSavedSettings
+		| ImGuiTableFlags_RowBg
+		| ImGuiTableFlags_SizingStretchProp;
+
+	if ( !ImGui::BeginTable("HistogramTable##", 6, tbl_flags) )
+		return;
+
+	ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch, 0.4f);
+	ImGui::TableSetupColumn("Count", ImGuiTableColumnFlags_WidthStretch, 0.12f);
+	ImGui::TableSetupColumn("p50", ImGuiTableColumnFlags_WidthStretch, 0.12f);
+	ImGui::TableSetupColumn("p90", ImGuiTableColumnFlags_WidthStretch, 0.12f);
+	ImGui::TableSetupColumn("p99", ImGuiTableColumnFlags_WidthStretch, 0.12f);
+	ImGui::TableSetupColumn("Max", ImGuiTableColumnFlags_WidthStretch, 0.12f);
+	ImGui::TableHeadersRow();
+
+	for ( auto& histogram : my_histograms )
+	{
+		if ( !my_filter.PassFilter(histogram->Name().c_str()) )
+			continue;
+
+		histogram->Snapshot(my_snapshot);
+
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		ImGui::Text("%s", histogram->Name().c_str());
+		metric_tooltip(*histogram);
+		ImGui::TableNextColumn();
+		ImGui::Text("%" PRIu64, my_snapshot.count);
+		ImGui::TableNextColumn();
+		ImGui::Text("%" PRIu64, my_snapshot.Percentile(50.0));
+		ImGui::TableNextColumn();
+		ImGui::Text("%" PRIu64, my_snapshot.Percentile(90.0));
+		ImGui::TableNextColumn();
+		ImGui::Text("%" PRIu64, my_snapshot.Percentile(99.0));
+		ImGui::TableNextColumn();
+		ImGui::Text("%" PRIu64, my_snapshot.max);
+	}
+
+	ImGui::EndTable();
+}
+
+
+void
+ImGuiMetrics::DrawValues()
+{
+	using namespace trezanik::core;
+
+	if ( my_counters.empty() && my_gauges.empty() )
+	{
+		ImGui::TextDisabled("No counters or gauges registered");
+		return;
+	}
+
+	ImGuiTableFlags  tbl_flags = ImGuiTableFlags_Resizable
+		| ImGuiTableFlags_Borders
+		| ImGuiTableFlags_NoSavedSettings
+		| ImGuiTableFlags_RowBg
+		| ImGuiTableFlags_SizingStretchProp;
+
+	if ( !ImGui::BeginTable("ValueTable##", 3, tbl_flags) )
+		return;
+
+	ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch, 0.6f);
+	ImGui::TableSetupColumn("Type", ImGuiTableColumnFlags_WidthStretch, 0.15f);
+	ImGui::TableSetupColumn("Value", ImGuiTableColumnFlags_WidthStretch, 0.25f);
+	ImGui::TableHeadersRow();
+
+	for ( auto& counter : my_counters )
+	{
+		if ( !my_filter.PassFilter(counter->Name().c_str()) )
+			continue;
+
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		ImGui::Text("%s", counter->Name().c_str());
+		metric_tooltip(*counter);
+		ImGui::TableNextColumn();
+		ImGui::TextUnformatted("counter");
+		ImGui::TableNextColumn();
+		ImGui::Text("%" PRIu64, counter->Value());
+	}
+	for ( auto& gauge : my_gauges )
+	{
+		if ( !my_filter.PassFilter(gauge->Name().c_str()) )
+			continue;
+
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		ImGui::Text("%s", gauge->Name().c_str());
+		metric_tooltip(*gauge);
+		ImGui::TableNextColumn();
+		ImGui::TextUnformatted("gauge");
+		ImGui::TableNextColumn();
+		ImGui::Text("%" PRId64, gauge->Value());
+	}
+
+	ImGui::EndTable();
+}
+
+
+} // namespace app
+} // namespace trezanik
+
+#endif  // TZK_USING_IMGUI
@@ -0,0 +1,104 @@
+#pragma once
+
+/**
+ * @file        src/app/ImGuiMetrics.h
+ * @brief       Metrics registry counters, gauges and histograms window
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "app/definitions.h"
+
+#if TZK_USING_IMGUI
+
+#include "app/IImGui.h"
+
+#include "core/services/metrics/Metrics.h"
+#include "core/util/SingularInstance.h"
+
+#include <vector>
+
+
+namespace trezanik {
+namespace app {
+
+
+/**
+ * Dedicated window presenting the core Metrics registry
+ *
+ * Lists every registered counter and gauge with its current value, and every
+ * histogram with its count and percentiles; the full text exposition can be
+ * copied to the clipboard, in either supported format.
+ */
+class ImGuiMetrics
+	: public IImGui
+	, private trezanik::core::SingularInstance<ImGuiMetrics>
+{
+	TZK_NO_CLASS_ASSIGNMENT(ImGuiMetrics);
+	TZK_NO_CLASS_COPY(ImGuiMetrics);
+	TZK_NO_CLASS_MOVEASSIGNMENT(ImGuiMetrics);
+	TZK_NO_CLASS_MOVECOPY(ImGuiMetrics);
+
+private:
+
+	/** Registered counters; refreshed each draw */
+	std::vector<const trezanik::core::MetricCounter*>  my_counters;
+
+	/** Registered gauges; refreshed each draw */
+	std::vector<const trezanik::core::MetricGauge*>  my_gauges;
+
+	/** Registered histograms; refreshed each draw */
+	std::vector<const trezanik::core::MetricHistogram*>  my_histograms;
+
+	/** Reused snapshot for the histograms table */
+	trezanik::core::metric_histogram_snapshot  my_snapshot;
+
+	/** Metric name filter */
+	ImGuiTextFilter  my_filter;
+
+
+	/**
+	 * Draws the counters and gauges table
+	 */
+	void
+	DrawValues();
+
+
+	/**
+	 * Draws the histograms table
+	 */
+	void
+	DrawHistograms();
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 *
+	 * @param[in] gui_interactions
+	 *  Reference to the shared object
+	 */
+	ImGuiMetrics(
+		GuiInteractions& gui_interactions
+	);
+
+
+	/**
+	 * Standard destructor
+	 */
+	~ImGuiMetrics();
+
+
+	/**
+	 * Implementation of IImGui::Draw
+	 */
+	virtual void
+	Draw() override;
+};
+
+
+} // namespace app
+} // namespace trezanik
+
+#endif  // TZK_USING_IMGUI
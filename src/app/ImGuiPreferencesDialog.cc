@@ -85,36 +85,14 @@ ImGuiPreferencesDialog::ImGuiPreferencesDialog(
 		std::string  fpath_play  = aux::BuildPath(my_context.AssetPath() + assetdir_images, icon_play_name);
 		std::string  fpath_stop  = aux::BuildPath(my_context.AssetPath() + assetdir_images, icon_stop_name);
 		auto& ldr = my_context.GetResourceLoader();
-		
-		auto ResourceLoad = [&ldr, this](
-			trezanik::core::UUID& id,
-			std::shared_ptr<trezanik::engine::Resource_Image>& icon,
-			std::string& fpath
-		)
-		{
-			if ( icon != nullptr )
-				return;
-
-			id = my_context.GetResourceCache().GetResourceID(fpath.c_str());
 
-			if ( id == null_id )
-			{
-				auto res = std::make_shared<Resource_Image>(fpath);
-				if ( ldr.AddResource(std::dynamic_pointer_cast<Resource>(res)) == ErrNONE )
-				{
-					// track the resource so we can assign it when ready
-					id = res->GetResourceID();
-				}
-			}
-			else
-			{
-				icon = std::dynamic_pointer_cast<Resource_Image>(my_context.GetResourceCache().GetResource(id));
-			}
-		};
-		
-		ResourceLoad(my_icon_pause_rid, my_icon_pause, fpath_pause);
-		ResourceLoad(my_icon_play_rid, my_icon_play, fpath_play);
-		ResourceLoad(my_icon_stop_rid, my_icon_stop, fpath_stop);
+		/*
+		 * Ready immediately if cached, or shares the load if already in
+		 * progress (e.g. dialog reopened); assigned in Draw_Audio once complete
+		 */
+		my_icon_pause_load = ldr.Load(std::make_shared<Resource_Image>(fpath_pause));
+		my_icon_play_load  = ldr.Load(std::make_shared<Resource_Image>(fpath_play));
+		my_icon_stop_load  = ldr.Load(std::make_shared<Resource_Image>(fpath_stop));
 
 		ldr.Sync();
 
@@ -275,6 +253,22 @@ ImGuiPreferencesDialog::Draw_Audio()
 	using namespace trezanik::engine;
 	using std::get;
 
+	// assign each icon once its load completes, no further need for the future
+	auto  assign_icon = [](std::shared_ptr<Resource_Image>& icon, load_future& load)
+	{
+		auto  res = load_result(load);
+
+		if ( res != nullptr )
+		{
+			icon = std::dynamic_pointer_cast<Resource_Image>(res);
+			load = load_future();
+		}
+	};
+
+	assign_icon(my_icon_play, my_icon_play_load);
+	assign_icon(my_icon_pause, my_icon_pause_load);
+	assign_icon(my_icon_stop, my_icon_stop_load);
+
 	ImGui::SetNextWindowPosCenter();
 	ImGui::SetNextWindowSizeConstraints(my_initial_subwnd_size, ImVec2(FLT_MAX, FLT_MAX));
 	ImGui::SetNextWindowSize(my_initial_subwnd_size, ImGuiCond_Appearing);
@@ -486,7 +480,10 @@ ImGuiPreferencesDialog::Draw_AudioItem(
 			// can/do we want to enforce size here?
 			float  w = (float)icon->Width();
 			float  h = (float)icon->Height();
-			if ( ImGui::ImageButton(label, (ImTextureID)(uintptr_t)icon->AsSDLTexture(), ImVec2(w, h)) )
+			float  u0, v0, u1, v1;
+			// icons are usually atlased, so only a sub-region of the texture
+			icon->TextureCoordinates(u0, v0, u1, v1);
+			if ( ImGui::ImageButton(label, (ImTextureID)(uintptr_t)icon->AsSDLTexture(), ImVec2(w, h), ImVec2(u0, v0), ImVec2(u1, v1)) )
 				selected = true;
 		}
 		else if ( ImGui::Button(label, ImVec2(16, 16)) )
@@ -541,7 +538,7 @@ ImGuiPreferencesDialog::Draw_AudioItem(
 							std::get<float>(my_current_settings[TZK_CVAR_SETTING_AUDIO_VOLUME_EFFECTS]),
 							std::get<float>(my_current_settings[TZK_CVAR_SETTING_AUDIO_VOLUME_MUSIC])
 						);*/
-						sound->Play();
+						ass->StartSound(sound);
 					}
 				}
 			}
@@ -554,7 +551,7 @@ ImGuiPreferencesDialog::Draw_AudioItem(
 				);
 				if ( sound != nullptr )
 				{
-					action == AudioAction::Pause ? sound->Pause() : sound->Stop();
+					action == AudioAction::Pause ? ass->PauseSound(sound) : ass->StopSound(sound);
 				}
 			}
 		}
@@ -971,6 +968,26 @@ ImGuiPreferencesDialog::Draw_Engine()
 
 			// add: typeloader loader method preference, queue switch
 
+			auto   stats = my_context.GetResourceCache().GetStatistics();
+			float  mib = 1024.f * 1024.f;
+
+			ImGui::Text("Cached: %zu resources, %.2f MiB", stats.count, stats.TotalBytes() / mib);
+			if ( stats.budget == 0 )
+				ImGui::Text("Budget: unlimited");
+			else
+				ImGui::Text("Budget: %.2f MiB", stats.budget / mib);
+			ImGui::HelpMarker("Memory budget for cached resources (engine.resources.cache_budget_mb)\n"
+				"- Least recently used resources with no active users are evicted once exceeded\n"
+				"- A value of 0 disables eviction"
+			);
+			ImGui::Text("Textures: %.2f MiB", stats.texture_bytes / mib);
+			ImGui::Text("Audio: %.2f MiB", stats.pcm_bytes / mib);
+			ImGui::Text("Fonts: %.2f MiB", stats.font_bytes / mib);
+			ImGui::Text("Other: %.2f MiB", stats.other_bytes / mib);
+			ImGui::Text("Hits: %zu  Misses: %zu  Evictions: %zu",
+				stats.hits, stats.misses, stats.evictions
+			);
+
 			ImGui::Unindent();
 		}
 	}
@@ -1629,24 +1646,9 @@ ImGuiPreferencesDialog::HandleResourceState(
 				// binds the emitter to the sound, and sets the priority
 				engine::ServiceLocator::Audio()->UseSound(my_audio_component, sound, engine::max_playback_priority);
 
-				sound->Play();
+				engine::ServiceLocator::Audio()->StartSound(sound);
 			}
 		}
-		else if ( rid == my_icon_pause_rid )
-		{
-			auto ires = std::dynamic_pointer_cast<Resource_Image>(res);
-			my_icon_pause = ires;
-		}
-		else if ( rid == my_icon_play_rid )
-		{
-			auto ires = std::dynamic_pointer_cast<Resource_Image>(res);
-			my_icon_play = ires;
-		}
-		else if ( rid == my_icon_stop_rid )
-		{
-			auto ires = std::dynamic_pointer_cast<Resource_Image>(res);
-			my_icon_stop = ires;
-		}
 	}
 }
 
@@ -1685,6 +1687,12 @@ ImGuiPreferencesDialog::LoadPreferences()
 		// acquire the actual available files from the disk
 		my_effect_list = aux::folder::scan_directory(my_context.AssetPath() + assetdir_effects, true);
 		my_music_list  = aux::folder::scan_directory(my_context.AssetPath() + assetdir_music, true);
+		// plus the embedded files, unless overridden by a file on disk
+		for ( auto& name : my_context.GetVirtualFiles().List(my_context.AssetPath() + assetdir_effects) )
+		{
+			if ( std::find(my_effect_list.begin(), my_effect_list.end(), name) == my_effect_list.end() )
+				my_effect_list.push_back(name);
+		}
 
 		// don't display license files
 		/// @todo filter out all non-fileext tracked items, that way we include only what we support
@@ -1733,6 +1741,11 @@ ImGuiPreferencesDialog::LoadPreferences()
 	{
 		my_font_list.clear();
 		my_font_list = aux::folder::scan_directory(my_context.AssetPath() + assetdir_fonts, true);
+		for ( auto& name : my_context.GetVirtualFiles().List(my_context.AssetPath() + assetdir_fonts) )
+		{
+			if ( std::find(my_font_list.begin(), my_font_list.end(), name) == my_font_list.end() )
+				my_font_list.push_back(name);
+		}
 		my_font_list.erase(
 			std::remove_if(my_font_list.begin(), my_font_list.end(), [](std::string& str) -> bool {
 				if ( aux::EndsWith(str, ".license") )
@@ -1742,7 +1755,7 @@ ImGuiPreferencesDialog::LoadPreferences()
 		), my_font_list.end());
 		/*
 		 * While it might seem funny being able to set a blank font, since we
-		 * have those inbuilt and auto-extraction/imgui proggyclean too this
+		 * have those inbuilt and embedded/imgui proggyclean too this
 		 * would be a shorthand to revert to those
 		 */
 		my_font_list.emplace(my_font_list.begin(), "");
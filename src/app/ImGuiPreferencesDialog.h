@@ -18,6 +18,7 @@
 #include "core/util/SingularInstance.h"
 #include "engine/resources/ResourceTypes.h"
 #include "engine/resources/Resource_Image.h"
+#include "engine/resources/ResourceLoader.h"
 #include "engine/services/event/EngineEvent.h"
 
 #include <map>
@@ -198,16 +199,16 @@ private:
 
 	/** Audio play icon */
 	std::shared_ptr<trezanik::engine::Resource_Image>  my_icon_play;
-	/** Audio play icon resource ID */
-	trezanik::core::UUID  my_icon_play_rid;
+	/** Audio play icon load, until assigned */
+	trezanik::engine::load_future  my_icon_play_load;
 	/** Audio pause icon */
 	std::shared_ptr<trezanik::engine::Resource_Image>  my_icon_pause;
-	/** Audio pause icon resource ID */
-	trezanik::core::UUID  my_icon_pause_rid;
+	/** Audio pause icon load, until assigned */
+	trezanik::engine::load_future  my_icon_pause_load;
 	/** Audio stop icon */
 	std::shared_ptr<trezanik::engine::Resource_Image>  my_icon_stop;
-	/** Audio stop icon resource ID */
-	trezanik::core::UUID  my_icon_stop_rid;
+	/** Audio stop icon load, until assigned */
+	trezanik::engine::load_future  my_icon_stop_load;
 
 
 	/// Available audio device names, obtained from OpenAL
@@ -0,0 +1,397 @@
+/**
+ * @file        src/app/ImGuiProfiler.cc
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "app/definitions.h"
+
+#if TZK_USING_IMGUI
+
+#include "app/ImGuiProfiler.h"
+#include "app/AppImGui.h"
+
+#include "core/services/log/Log.h"
+
+#include "imgui/dear_imgui/imgui_internal.h"  // ImHashStr
+
+#include <algorithm>
+
+
+namespace trezanik {
+namespace app {
+
+
+/** Nanoseconds to milliseconds, for display */
+static constexpr double  ns_per_ms = 1000000.0;
+
+/** Frame durations at or under this many milliseconds are good (60fps) */
+static constexpr float  timeline_good_ms = 1000.f / 60.f;
+
+/** Frame durations at or under this many milliseconds are tolerable (30fps) */
+static constexpr float  timeline_fair_ms = 1000.f / 30.f;
+
+
+/**
+ * Generates a stable colour for a zone name
+ *
+ * @param[in] name
+ *  The zone name
+ * @return
+ *  The packed colour
+ */
+static ImU32
+zone_colour(
+	const char* name
+)
+{
+	float  r, g, b;
+	float  hue = static_cast<float>(ImHashStr(name) % 360) / 360.f;
+
+	ImGui::ColorConvertHSVtoRGB(hue, 0.45f, 0.80f, r, g, b);
+	return ImGui::GetColorU32(ImVec4(r, g, b, 1.f));
+}
+
+
+ImGuiProfiler::ImGuiProfiler(
+	GuiInteractions& gui_interactions
+)
+: IImGui(gui_interactions)
+, my_selected(-1)
+, my_top_count(15)
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Constructor starting");
+	{
+		_gui_interactions.profiler = this;
+		_gui_interactions.show_profiler = true;
+	}
+	TZK_LOG(LogLevel::Trace, "Constructor finished");
+}
+
+
+ImGuiProfiler::~ImGuiProfiler()
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Destructor starting");
+	{
+		_gui_interactions.profiler = nullptr;
+		_gui_interactions.show_profiler = false;
+	}
+	TZK_LOG(LogLevel::Trace, "Destructor finished");
+}
+
+
+void
+ImGuiProfiler::Draw()
+{
+	using namespace trezanik::core;
+
+	ImGuiWindowFlags  wnd_flags = ImGuiWindowFlags_NoCollapse;
+	ImVec2  min_size(480.f, 320.f);
+	ImVec2  start_size(_gui_interactions.app_usable_rect.Max * 0.6f);
+
+	ImGui::SetNextWindowSize(start_size, ImGuiCond_Appearing);
+	ImGui::SetNextWindowSizeConstraints(min_size, ImVec2(FLT_MAX, FLT_MAX));
+
+	if ( !ImGui::Begin("Profiler", &_gui_interactions.show_profiler, wnd_flags) )
+	{
+		ImGui::End();
+		return;
+	}
+
+	bool  enabled = Profiler::IsEnabled();
+	bool  paused = Profiler::IsPaused();
+
+	if ( ImGui::Checkbox("Enabled", &enabled) )
+	{
+		Profiler::SetEnabled(enabled);
+	}
+	ImGui::SameLine();
+	if ( ImGui::Checkbox("Paused", &paused) )
+	{
+		Profiler::SetPaused(paused);
+	}
+	ImGui::SameLine();
+	if ( ImGui::Button("Clear") )
+	{
+		Profiler::Clear();
+		my_selected = -1;
+	}
+	ImGui::SameLine();
+	ImGui::Text("Dropped zones: %llu", static_cast<unsigned long long>(Profiler::GetDroppedCount()));
+	if ( Profiler::IsTracing() )
+	{
+		ImGui::SameLine();
+		ImGui::TextColored(ImVec4(1.f, 0.4f, 0.4f, 1.f), "Trace capture active");
+	}
+#if !TZK_PROFILER
+	ImGui::TextDisabled("Zones are not compiled into this build (TZK_PROFILER)");
+#endif
+
+	Profiler::GetFrameDurations(my_durations);
+
+	// only a paused history is stable enough to hold a selection
+	if ( !Profiler::IsPaused() || my_selected >= static_cast<int>(my_durations.size()) )
+	{
+		my_selected = -1;
+	}
+
+	if ( ImGui::CollapsingHeader("Frame Timeline", ImGuiTreeNodeFlags_DefaultOpen) )
+	{
+		DrawTimeline();
+	}
+
+	int  index = my_selected >= 0 ? my_selected : static_cast<int>(my_durations.size()) - 1;
+
+	if ( index < 0 || !Profiler::GetFrame(static_cast<size_t>(index), my_frame) )
+	{
+		my_frame = profile_frame();
+	}
+
+	if ( ImGui::CollapsingHeader("Flame Graph", ImGuiTreeNodeFlags_DefaultOpen) )
+	{
+		DrawFlameGraph();
+	}
+	if ( ImGui::CollapsingHeader("Top Zones", ImGuiTreeNodeFlags_DefaultOpen) )
+	{
+		DrawTopZones();
+	}
+
+	ImGui::End();
+}
+
+
+void
+ImGuiProfiler::DrawFlameGraph()
+{
+	using namespace trezanik::core;
+
+	if ( my_frame.threads.empty() )
+	{
+		ImGui::TextDisabled("No zones captured in the selected frame");
+		return;
+	}
+
+	ImDrawList*  draw_list = ImGui::GetWindowDrawList();
+	uint64_t     span = std::max<uint64_t>(my_frame.end - my_frame.start, 1);
+	float        width = std::max(ImGui::GetContentRegionAvail().x, 1.f);
+	float        row_height = ImGui::GetTextLineHeight() + 2.f;
+	ImU32        text_colour = ImGui::GetColorU32(ImVec4(0.f, 0.f, 0.f, 1.f));
+	ImVec2       mouse = ImGui::GetMousePos();
+
+	ImGui::Text("Frame %llu: %.3f ms",
+		static_cast<unsigned long long>(my_frame.number),
+		static_cast<double>(span) / ns_per_ms
+	);
+
+	for ( size_t t = 0; t < my_frame.threads.size(); t++ )
+	{
+		const profile_thread&  thread = my_frame.threads[t];
+		uint16_t  max_depth = 0;
+
+		for ( auto& z : thread.zones )
+		{
+			max_depth = std::max(max_depth, z.depth);
+		}
+
+		ImGui::Text("%s [%u]", thread.name.c_str(), thread.thread_id);
+
+		ImVec2  origin = ImGui::GetCursorScreenPos();
+		ImVec2  lane_size(width, (max_depth + 1) * row_height);
+
+		ImGui::PushID(static_cast<int>(t));
+		ImGui::InvisibleButton("##lane", lane_size);
+		ImGui::PopID();
+
+		bool  lane_hovered = ImGui::IsItemHovered();
+		const profile_zone*  hovered_zone = nullptr;
+
+		draw_list->AddRectFilled(origin, origin + lane_size, ImGui::GetColorU32(ImGuiCol_FrameBg));
+		draw_list->PushClipRect(origin, origin + lane_size, true);
+
+		for ( auto& z : thread.zones )
+		{
+			// task zones can begin frames earlier; completion can race the frame mark
+			uint64_t  zs = z.start < my_frame.start ? 0 : z.start - my_frame.start;
+			uint64_t  ze = std::min(z.end, my_frame.end);
+			ze = ze < my_frame.start ? 0 : ze - my_frame.start;
+
+			float  x0 = origin.x + static_cast<float>(static_cast<double>(zs) / span * width);
+			float  x1 = origin.x + static_cast<float>(static_cast<double>(ze) / span * width);
+			float  y0 = origin.y + z.depth * row_height;
+			ImVec2  rmin(x0, y0);
+			ImVec2  rmax(std::max(x1, x0 + 1.f), y0 + row_height - 1.f);
+
+			draw_list->AddRectFilled(rmin, rmax, zone_colour(z.name));
+
+			ImVec2  text_size = ImGui::CalcTextSize(z.name);
+			if ( text_size.x + 4.f < rmax.x - rmin.x )
+			{
+				draw_list->AddText(ImVec2(rmin.x + 2.f, rmin.y + 1.f), text_colour, z.name);
+			}
+
+			if ( lane_hovered && ImRect(rmin, rmax).Contains(mouse)
+			  && (hovered_zone == nullptr || z.depth > hovered_zone->depth) )
+			{
+				hovered_zone = &z;
+			}
+		}
+
+		draw_list->PopClipRect();
+
+		if ( hovered_zone != nullptr )
+		{
+			ImGui::BeginTooltip();
+			ImGui::Text("%s", hovered_zone->name);
+			ImGui::Text("%.3f ms", static_cast<double>(hovered_zone->end - hovered_zone->start) / ns_per_ms);
+			ImGui::TextDisabled("Depth %u", hovered_zone->depth);
+			ImGui::EndTooltip();
+		}
+	}
+}
+
+
+void
+ImGuiProfiler::DrawTimeline()
+{
+	using namespace trezanik::core;
+
+	ImDrawList*  draw_list = ImGui::GetWindowDrawList();
+	ImVec2  origin = ImGui::GetCursorScreenPos();
+	ImVec2  size(std::max(ImGui::GetContentRegionAvail().x, 1.f), 80.f);
+	float   bar_width = std::max(size.x / TZK_PROFILER_FRAME_HISTORY, 1.f);
+	// keep typical frames legible; spikes beyond this extend the scale
+	float   max_ms = timeline_fair_ms * 1.5f;
+	int     count = static_cast<int>(my_durations.size());
+	int     selected = my_selected >= 0 ? my_selected : count - 1;
+
+	for ( auto d : my_durations )
+	{
+		max_ms = std::max(max_ms, d);
+	}
+
+	ImGui::InvisibleButton("##timeline", size);
+
+	bool  hovered = ImGui::IsItemHovered();
+	bool  clicked = ImGui::IsItemClicked(ImGuiMouseButton_Left);
+
+	draw_list->AddRectFilled(origin, origin + size, ImGui::GetColorU32(ImGuiCol_FrameBg));
+
+	for ( float ref : { timeline_good_ms, timeline_fair_ms } )
+	{
+		float  y = origin.y + size.y - (ref / max_ms * size.y);
+		draw_list->AddLine(ImVec2(origin.x, y), ImVec2(origin.x + size.x, y), ImGui::GetColorU32(ImGuiCol_Separator));
+	}
+
+	for ( int i = 0; i < count; i++ )
+	{
+		float  d = my_durations[i];
+		float  x = origin.x + i * bar_width;
+		float  h = std::max(d / max_ms * size.y, 1.f);
+		ImU32  col;
+
+		if ( d <= timeline_good_ms )
+			col = IM_COL32(80, 180, 80, 255);
+		else if ( d <= timeline_fair_ms )
+			col = IM_COL32(210, 180, 60, 255);
+		else
+			col = IM_COL32(210, 70, 60, 255);
+
+		if ( i == selected )
+		{
+			draw_list->AddRectFilled(ImVec2(x, origin.y), ImVec2(x + bar_width, origin.y + size.y), ImGui::GetColorU32(ImGuiCol_HeaderActive));
+		}
+		draw_list->AddRectFilled(ImVec2(x, origin.y + size.y - h), ImVec2(x + std::max(bar_width - 1.f, 1.f), origin.y + size.y), col);
+	}
+
+	if ( hovered && count > 0 )
+	{
+		int  idx = static_cast<int>((ImGui::GetMousePos().x - origin.x) / bar_width);
+
+		if ( idx >= 0 && idx < count )
+		{
+			ImGui::SetTooltip("%.3f ms", my_durations[idx]);
+
+			if ( clicked )
+			{
+				my_selected = idx;
+				Profiler::SetPaused(true);
+			}
+		}
+	}
+}
+
+
+void
+ImGuiProfiler::DrawTopZones()
+{
+	using namespace trezanik::core;
+
+	Profiler::GetZoneStats(0, my_stats);
+
+	ImGui::SetNextItemWidth(160.f);
+	ImGui::SliderInt("Rows", &my_top_count, 5, 50);
+
+	if ( my_stats.empty() )
+	{
+		ImGui::TextDisabled("No zones captured");
+		return;
+	}
+
+	double  frames = static_cast<double>(std::max<size_t>(my_durations.size(), 1));
+
+	ImGuiTableFlags  tbl_flags = ImGuiTableFlags_Resizable
+		| ImGuiTableFlags_Borders
+		| ImGuiTableFlags_NoSavedSettings
+		| ImGuiTableFlags_RowBg
+		| ImGuiTableFlags_SizingStretchProp;
+
+	if ( !ImGui::BeginTable("ZoneTable##", 6, tbl_flags) )
+		return;
+
+	ImGui::TableSetupColumn("Zone", ImGuiTableColumnFlags_WidthStretch, 0.4f);
+	ImGui::TableSetupColumn("Calls", ImGuiTableColumnFlags_WidthStretch, 0.12f);
+	ImGui::TableSetupColumn("Total (ms)", ImGuiTableColumnFlags_WidthStretch, 0.12f);
+	ImGui::TableSetupColumn("Per Frame (ms)", ImGuiTableColumnFlags_WidthStretch, 0.12f);
+	ImGui::TableSetupColumn("Avg (ms)", ImGuiTableColumnFlags_WidthStretch, 0.12f);
+	ImGui::TableSetupColumn("Max (ms)", ImGuiTableColumnFlags_WidthStretch, 0.12f);
+	ImGui::TableHeadersRow();
+
+	size_t  rows = std::min(my_stats.size(), static_cast<size_t>(my_top_count));
+
+	for ( size_t i = 0; i < rows; i++ )
+	{
+		const profile_zone_stats&  s = my_stats[i];
+		double  total_ms = static_cast<double>(s.total) / ns_per_ms;
+
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		ImGui::PushID(static_cast<int>(i));
+		ImGui::ColorButton("##col", ImGui::ColorConvertU32ToFloat4(zone_colour(s.name)), ImGuiColorEditFlags_NoTooltip, ImVec2(ImGui::GetTextLineHeight(), ImGui::GetTextLineHeight()));
+		ImGui::PopID();
+		ImGui::SameLine();
+		ImGui::Text("%s", s.name);
+		ImGui::TableNextColumn();
+		ImGui::Text("%u", s.calls);
+		ImGui::TableNextColumn();
+		ImGui::Text("%.3f", total_ms);
+		ImGui::TableNextColumn();
+		ImGui::Text("%.3f", total_ms / frames);
+		ImGui::TableNextColumn();
+		ImGui::Text("%.3f", total_ms / s.calls);
+		ImGui::TableNextColumn();
+		ImGui::Text("%.3f", static_cast<double>(s.max) / ns_per_ms);
+	}
+
+	ImGui::EndTable();
+}
+
+
+} // namespace app
+} // namespace trezanik
+
+#endif  // TZK_USING_IMGUI
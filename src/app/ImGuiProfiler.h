@@ -0,0 +1,116 @@
+#pragma once
+
+/**
+ * @file        src/app/ImGuiProfiler.h
+ * @brief       Profiler frame timeline, flame graph and top zones window
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "app/definitions.h"
+
+#if TZK_USING_IMGUI
+
+#include "app/IImGui.h"
+
+#include "core/util/Profiler.h"
+#include "core/util/SingularInstance.h"
+
+#include <vector>
+
+
+namespace trezanik {
+namespace app {
+
+
+/**
+ * Dedicated window presenting the core Profiler captures
+ *
+ * Provides the runtime toggle, a timeline of recent frame durations, a flame
+ * graph per thread for the selected frame, and the most expensive zones
+ * across all retained frames.
+ *
+ * Selecting a frame in the timeline pauses capture, so the selection remains
+ * stable; resuming returns to following the latest frame.
+ */
+class ImGuiProfiler
+	: public IImGui
+	, private trezanik::core::SingularInstance<ImGuiProfiler>
+{
+	TZK_NO_CLASS_ASSIGNMENT(ImGuiProfiler);
+	TZK_NO_CLASS_COPY(ImGuiProfiler);
+	TZK_NO_CLASS_MOVEASSIGNMENT(ImGuiProfiler);
+	TZK_NO_CLASS_MOVECOPY(ImGuiProfiler);
+
+private:
+
+	/** Duration of each retained frame, in milliseconds; refreshed each draw */
+	std::vector<float>  my_durations;
+
+	/** Zone statistics for the top zones table; refreshed each draw */
+	std::vector<trezanik::core::profile_zone_stats>  my_stats;
+
+	/** The frame presented in the flame graph */
+	trezanik::core::profile_frame  my_frame;
+
+	/** Index of the selected frame within the history; -1 follows the latest */
+	int  my_selected;
+
+	/** Number of rows in the top zones table */
+	int  my_top_count;
+
+
+	/**
+	 * Draws the flame graph for my_frame
+	 *
+	 * Each thread is a separate lane, zones stacked by depth
+	 */
+	void
+	DrawFlameGraph();
+
+
+	/**
+	 * Draws the frame duration timeline, handling frame selection
+	 */
+	void
+	DrawTimeline();
+
+
+	/**
+	 * Draws the top zones table
+	 */
+	void
+	DrawTopZones();
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 *
+	 * @param[in] gui_interactions
+	 *  Reference to the shared object
+	 */
+	ImGuiProfiler(
+		GuiInteractions& gui_interactions
+	);
+
+
+	/**
+	 * Standard destructor
+	 */
+	~ImGuiProfiler();
+
+
+	/**
+	 * Implementation of IImGui::Draw
+	 */
+	virtual void
+	Draw() override;
+};
+
+
+} // namespace app
+} // namespace trezanik
+
+#endif  // TZK_USING_IMGUI
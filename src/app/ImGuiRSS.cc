@@ -296,7 +296,7 @@ ImGuiRSS::UpdateThread()
 		std::this_thread::sleep_for(std::chrono::seconds(10));
 
 		// iterate all feeds; target is one per 60 seconds, but large counts can deviate appropriately
-		for ( auto feed : my_feed_entries )
+		for ( auto& feed : my_feed_entries )
 		{
 			//feed.refresh_rate;
 			//feed.last_refresh;
@@ -311,8 +311,17 @@ ImGuiRSS::UpdateThread()
 
 				feed.last_refresh = aux::get_ms_since_epoch();
 
-
-				if ( session->Establish() != ErrNONE )
+				/*
+				 * A fresh cache entry is served by the request without sending
+				 * it; no connection needed
+				 */
+				URI   uri = session->GetURI();
+				auto  cached = engine::ServiceLocator::Net()->GetHTTPCache().Lookup(
+					HTTPCache::Key(uri.GetHost(), uri.GetPort(), uri.GetPath())
+				);
+				bool  fresh = cached != nullptr && HTTPCache::IsFresh(*cached);
+
+				if ( !fresh && session->Establish() != ErrNONE )
 				{
 					continue;
 				}
@@ -331,8 +340,16 @@ ImGuiRSS::UpdateThread()
 
 					if ( rsp->InternalStatus() == HTTPResponseInternalStatus::Completed )
 					{
+						bool  unchanged = rsp->FromCache() && feed.last_success_refresh != 0;
+
 						feed.last_success_refresh = feed.last_refresh;
 
+						if ( unchanged )
+						{
+							// not modified since last parsed; nothing to do
+							continue;
+						}
+
 						std::string  content = rsp->GetContent();
 						
 						// temp - write out to file for comparison analysis
@@ -210,6 +210,14 @@ ImGuiWkspSettings::Draw()
 			}
 			ImGui::TableNextColumn();
 
+			ImGui::TreeNodeEx("Draw Minimap", tree_node_flags);
+			ImGui::TableNextColumn();
+			if ( ImGui::Checkbox("##Minimap.Draw", &ng_settings.minimap_style.draw) )
+			{
+				my_wksp->ApplySetting(settingname_minimap_draw, core::TConverter<bool>::ToString(ng_settings.minimap_style.draw).c_str());
+			}
+			ImGui::TableNextColumn();
+
 			ImVec4  fb = ImGui::ColorConvertU32ToFloat4(ng_settings.grid_style.colours.background);
 			ImVec4  fp = ImGui::ColorConvertU32ToFloat4(ng_settings.grid_style.colours.primary);
 			ImVec4  fs = ImGui::ColorConvertU32ToFloat4(ng_settings.grid_style.colours.secondary);
@@ -343,6 +351,14 @@ ImGuiWkspSettings::Draw()
 			}
 			ImGui::TableNextColumn();
 
+			ImGui::TreeNodeEx("Health Check Services", tree_node_flags);
+			ImGui::TableNextColumn();
+			if ( ImGui::Checkbox("##Node.HealthCheckServices", &topology_settings.node_health_check_services) )
+			{
+				my_wksp->ApplySetting(settingname_node_healthcheckservices, core::TConverter<bool>::ToString(topology_settings.node_health_check_services).c_str());
+			}
+			ImGui::TableNextColumn();
+
 			ImGui::TreeNodeEx("Track Online State", tree_node_flags);
 			ImGui::TableNextColumn();
 			if ( ImGui::Checkbox("##Node.TrackOnlineState", &topology_settings.node_track_online_state) )
@@ -29,6 +29,7 @@
 #include "core/services/log/Log.h"
 #include "core/util/net/net.h"
 #include "core/util/net/net_structs.h"
+#include "core/util/Profiler.h"
 #include "core/util/time.h"
 #include "core/TConverter.h"
 #include "core/error.h"
@@ -43,7 +44,10 @@
 #include "imgui/TConverter.h"
 
 #include <algorithm>
+#include <map>
 #include <sstream>
+#include <unordered_map>
+#include <unordered_set>
 
 
 namespace trezanik {
@@ -136,6 +140,9 @@ ImGuiWkspTopology::ImGuiWkspTopology(
 , my_draw_hardware_popup(false)
 , my_open_linktext_popup(false)
 , my_draw_linktext_popup(false)
+, my_layout_generation(0)
+, my_proxy_links_dirty(false)
+, my_status_changed(false)
 {
 	using namespace trezanik::core;
 
@@ -185,9 +192,10 @@ ImGuiWkspTopology::AddNode(
 
 	/*
 	 * Called by two routes:
-	 * 1) Initial load, via our Populate method
-	 *  Nodes already exist, this method is being called in order to create the
-	 *  nodegraph objects. Don't amend the list.
+	 * 1) Existing node
+	 *  Node already exists, this method is being called in order to create the
+	 *  nodegraph objects. Don't amend the list. Populate and group expansion
+	 *  know this already, so use CreateGraphNode directly.
 	 * 2) Dynamic addition
 	 *  New node via topology context menu/nodelist new, etc. - the node object
 	 *  passed in is created immediately prior to this call and is untracked
@@ -209,48 +217,17 @@ ImGuiWkspTopology::AddNode(
 		}
 	}
 
-	auto sptr = my_nodegraph.CreateNode<IsochroneNode>(
-		ImVec2(node->graph.position.x, node->graph.position.y), node->id, my_wksp, node
-	);
-
-	if ( sptr == nullptr )
+	if ( wkspdata_push_back && my_wksp_data->nodes.size() >= static_cast<size_t>(TZK_MAX_NODES) )
 	{
-		TZK_LOG(LogLevel::Error, "Failed to create new NodeGraph IsochroneNode");
+		TZK_LOG_FORMAT(LogLevel::Warning, "Maximum of %d nodes reached; not adding '%s'", TZK_MAX_NODES, node->name.c_str());
 		return ErrFAILED;
 	}
 
-	/*
-	 * Track this graph node shared_ptr, all graph node operations done with these
-	 * 
-	 * Do this now so nodegraph update events have an associated node, otherwise
-	 * it'll warn that the node isn't found
-	 */
-	my_nodes.push_back(sptr);
-
-	/*
-	 * Ensure the graph node style is populated even if we're using the default
-	 * styles; this allows the combo box/whatever to display the active style,
-	 * which is more desired than a blank box entry - when the list does actually
-	 * contain the style in use.
-	 * We make sure not to save this, if it's the default however.
-	 */
-	if ( node->graph.style.empty() )
-	{
-		node->graph.style = reserved_style_system.c_str();
-	}
-	
-	sptr->SetStyle(GetNodeStyle(node->graph.style.c_str()));
-
-
-	if ( node->graph.size.y != 0 && node->graph.size.x != 0 )
+	if ( CreateGraphNode(node) == nullptr )
 	{
-		sptr->SetStaticSize(node->graph.size);
+		return ErrFAILED;
 	}
 
-
-	AddNodePins(sptr, node->graph.pins);
-	
-
 	if ( wkspdata_push_back )
 	{
 		// New node, add a timestamp unless it was already explicitly set
@@ -787,19 +764,124 @@ ImGuiWkspTopology::BreakLink(
 {
 	using namespace trezanik::core;
 
-	for ( auto& ngl : my_nodegraph.GetLinks() )
+	auto  ngl = my_nodegraph.GetLink(id);
+	if ( ngl == nullptr )
+	{
+		/*
+		 * Links to members of a collapsed group have no graph link, so there's
+		 * nothing to raise the deletion event; remove it from the dataset here
+		 */
+		auto  iter = std::find_if(my_wksp_data->links.begin(), my_wksp_data->links.end(), [&id](auto&& l) {
+			return l->id == id;
+		});
+		if ( iter != my_wksp_data->links.end() )
+		{
+			TZK_LOG_FORMAT(LogLevel::Debug, "Breaking hidden link %s", id.GetCanonical());
+			my_wksp_data->links.erase(iter);
+			my_proxy_links_dirty = true;
+			return;
+		}
+
+		TZK_LOG_FORMAT(LogLevel::Warning, "Failed to find link with id %s", id.GetCanonical());
+		return;
+	}
+
+	TZK_LOG_FORMAT(LogLevel::Debug, "Breaking link %s", ngl->GetID().GetCanonical());
+	my_nodegraph.RemoveLink(ngl);
+}
+
+
+int
+ImGuiWkspTopology::CollapseGroup(
+	std::shared_ptr<node_group> group
+)
+{
+	using namespace trezanik::core;
+
+	std::unordered_set<UUID>  member_ids(group->members.begin(), group->members.end());
+	std::vector<std::shared_ptr<workspace_node>>  members;
+	float  sum_x = 0.f;
+	float  sum_y = 0.f;
+
+	// the set of nodes is changing; what's been laid out so far is committed
+	my_layout.Stop();
+
+	members.reserve(group->members.size());
+
+	for ( auto& n : my_wksp_data->nodes )
 	{
-		if ( ngl->GetID() == id )
+		if ( member_ids.count(n->id) == 0 )
+			continue;
+
+		members.push_back(n);
+		sum_x += n->graph.position.x;
+		sum_y += n->graph.position.y;
+
+		auto  gn = my_nodegraph.GetNode(n->id);
+		if ( gn == nullptr || gn->IsPendingDestruction() )
+			continue;
+
+		/*
+		 * The workspace retains these links; only the graph objects go, so no
+		 * notifications. RemoveLink modifies the pins collection, so iterate a
+		 * copy
+		 */
+		for ( auto& p : gn->GetPins() )
 		{
-			TZK_LOG_FORMAT(LogLevel::Debug, "Breaking link %s", ngl->GetID().GetCanonical());
+			std::vector<std::shared_ptr<imgui::Link>>  links = p->GetLinks();
 
-			// and the nodegraph - must return, iterator broken
-			my_nodegraph.RemoveLink(ngl);
-			return;
+			for ( auto& l : links )
+			{
+				my_nodegraph.RemoveLink(l, false);
+			}
+		}
+
+		if ( my_context_node == gn.get() )
+		{
+			my_context_node = nullptr;
 		}
+		my_nodegraph.DeleteNode(gn.get());
+	}
+
+	my_nodes.erase(
+		std::remove_if(my_nodes.begin(), my_nodes.end(), [&member_ids](auto& n) {
+			return member_ids.count(n->GetID()) != 0;
+		}),
+		my_nodes.end()
+	);
+
+	// never placed; centre on the members
+	if ( group->position.x == 0.f && group->position.y == 0.f && !members.empty() )
+	{
+		group->position = ImVec2(sum_x / members.size(), sum_y / members.size());
+	}
+
+	auto  proxy = my_nodegraph.CreateNode<GroupNode>(
+		group->position, group->id, group, std::move(members)
+	);
+
+	if ( proxy == nullptr )
+	{
+		TZK_LOG(LogLevel::Error, "Failed to create new NodeGraph GroupNode");
+		return ErrFAILED;
+	}
+
+	proxy->SetStyle(GetNodeStyle(reserved_style_multisystem.c_str()));
+
+	if ( group->size.y != 0 && group->size.x != 0 )
+	{
+		proxy->SetStaticSize(group->size);
 	}
 
-	TZK_LOG_FORMAT(LogLevel::Warning, "Failed to find link with id %s", id.GetCanonical());
+	my_group_nodes.push_back(proxy);
+	my_proxy_links_dirty = true;
+	my_status_changed = true;
+
+	TZK_LOG_FORMAT(LogLevel::Debug, "Collapsed group '%s' (%zu members)",
+		group->id.GetCanonical(), proxy->GetMembers().size()
+	);
+
+	return ErrNONE;
 }
 
 
@@ -934,10 +1016,15 @@ ImGuiWkspTopology::ContextPopup(
 		else
 		{
 			auto  node = dynamic_cast<IsochroneNode*>(my_context_node);
+			auto  grpnode = dynamic_cast<GroupNode*>(my_context_node);
 			if ( node != nullptr )
 			{
 				close_popup = DrawContextPopupNodeSelect(node);
 			}
+			else if ( grpnode != nullptr )
+			{
+				close_popup = DrawContextPopupGroupSelect(grpnode);
+			}
 		}
 	}
 	else if ( cp.nodes.size() > 1 )
@@ -972,10 +1059,15 @@ ImGuiWkspTopology::ContextPopup(
 		else
 		{
 			auto  node = dynamic_cast<IsochroneNode*>(my_context_node);
+			auto  grpnode = dynamic_cast<GroupNode*>(my_context_node);
 			if ( node != nullptr )
 			{
 				close_popup = DrawContextPopupNodeSelect(node);
 			}
+			else if ( grpnode != nullptr )
+			{
+				close_popup = DrawContextPopupGroupSelect(grpnode);
+			}
 		}
 	}
 	else
@@ -1002,6 +1094,215 @@ ImGuiWkspTopology::ContextPopup(
 }
 
 
+void
+ImGuiWkspTopology::CreateGraphLinks()
+{
+	using namespace trezanik::core;
+
+	/*
+	 * Resolve every pin once, rather than searching all nodes for the
+	 * endpoints of each link; pins of nodes without a graph node are hidden
+	 * in a collapsed group, and their links represented by proxies
+	 */
+	std::unordered_map<UUID, std::shared_ptr<trezanik::imgui::Pin>>  pins;
+	std::unordered_set<UUID>  hidden_pins;
+
+	for ( auto& n : my_wksp_data->nodes )
+	{
+		auto  gn = my_nodegraph.GetNode(n->id);
+
+		if ( gn == nullptr || gn->IsPendingDestruction() )
+		{
+			for ( auto& p : n->graph.pins )
+			{
+				hidden_pins.insert(p.id);
+			}
+			continue;
+		}
+
+		for ( auto& p : gn->GetPins() )
+		{
+			pins[p->GetID()] = p;
+		}
+	}
+
+	for ( auto& iter : my_wksp_data->links )
+	{
+		if ( my_nodegraph.GetLink(iter->id) != nullptr )
+			continue;
+		if ( hidden_pins.count(iter->source) != 0 || hidden_pins.count(iter->target) != 0 )
+			continue;
+
+		auto  src = pins.find(iter->source);
+		auto  tgt = pins.find(iter->target);
+
+		if ( src == pins.end() )
+		{
+			TZK_LOG_FORMAT(LogLevel::Error,
+				"No source pin found for link: %s -> %s",
+				iter->source.GetCanonical(), iter->target.GetCanonical()
+			);
+			continue;
+		}
+		if ( tgt == pins.end() )
+		{
+			TZK_LOG_FORMAT(LogLevel::Error,
+				"No target pin found for link: %s -> %s",
+				iter->source.GetCanonical(), iter->target.GetCanonical()
+			);
+			continue;
+		}
+
+		std::shared_ptr<trezanik::imgui::Pin>  impin_out = src->second;
+		std::shared_ptr<trezanik::imgui::Pin>  impin_inp = tgt->second;
+
+		TZK_LOG_FORMAT(LogLevel::Trace,
+			"Creating Link for " TZK_PRIxPTR " to " TZK_PRIxPTR,
+			impin_out.get(), impin_inp.get()
+		);
+
+		// create the link in the nodegraph itself
+		auto  ngl = my_nodegraph.CreateLink<imgui::Link>(iter->id,
+			impin_out, impin_inp, &my_nodegraph, &iter->text,
+			(ImVec2*)&iter->offset, &iter->method, &iter->control_points
+		);
+		// assign the link to the pins
+		impin_inp->AssignLink(ngl);
+		impin_out->AssignLink(ngl);
+
+
+		/*
+		 * Pin CreateLink and here are the sources of 'creation' and therefore
+		 * tooltips, without being per-frame. Listeners are always handled via
+		 * their constructor, then dynamic updates
+		 */
+		std::string  tt = "Connected to:\n";
+		auto iscn = dynamic_cast<IsochroneNode*>(impin_inp->GetAttachedNode());
+		tt += iscn->GetWorkspaceNode()->name;
+		impin_out->SetTooltipText(tt);
+	}
+}
+
+
+std::shared_ptr<IsochroneNode>
+ImGuiWkspTopology::CreateGraphNode(
+	std::shared_ptr<workspace_node> node
+)
+{
+	using namespace trezanik::core;
+
+	auto sptr = my_nodegraph.CreateNode<IsochroneNode>(
+		ImVec2(node->graph.position.x, node->graph.position.y), node->id, my_wksp, node
+	);
+
+	if ( sptr == nullptr )
+	{
+		TZK_LOG(LogLevel::Error, "Failed to create new NodeGraph IsochroneNode");
+		return nullptr;
+	}
+
+	/*
+	 * Track this graph node shared_ptr, all graph node operations done with these
+	 * 
+	 * Do this now so nodegraph update events have an associated node, otherwise
+	 * it'll warn that the node isn't found
+	 */
+	my_nodes.push_back(sptr);
+
+	/*
+	 * Ensure the graph node style is populated even if we're using the default
+	 * styles; this allows the combo box/whatever to display the active style,
+	 * which is more desired than a blank box entry - when the list does actually
+	 * contain the style in use.
+	 * We make sure not to save this, if it's the default however.
+	 */
+	if ( node->graph.style.empty() )
+	{
+		node->graph.style = reserved_style_system.c_str();
+	}
+	
+	sptr->SetStyle(GetNodeStyle(node->graph.style.c_str()));
+
+
+	if ( node->graph.size.y != 0 && node->graph.size.x != 0 )
+	{
+		sptr->SetStaticSize(node->graph.size);
+	}
+
+
+	AddNodePins(sptr, node->graph.pins);
+
+	// new graph nodes (such as expanded group members) start uncoloured
+	my_status_changed = true;
+
+	return sptr;
+}
+
+
+std::shared_ptr<node_group>
+ImGuiWkspTopology::CreateGroup(
+	const std::string& name,
+	const std::vector<trezanik::core::UUID>& members
+)
+{
+	using namespace trezanik::core;
+
+	if ( members.empty() )
+	{
+		return nullptr;
+	}
+
+	std::unordered_set<UUID>  member_ids(members.begin(), members.end());
+	std::vector<std::shared_ptr<node_group>>  emptied;
+
+	// a node can only be in one group; take them from any existing
+	for ( auto& grp : my_wksp_data->groups )
+	{
+		size_t  count = grp->members.size();
+
+		grp->members.erase(
+			std::remove_if(grp->members.begin(), grp->members.end(), [&member_ids](const UUID& id) {
+				return member_ids.count(id) != 0;
+			}),
+			grp->members.end()
+		);
+
+		if ( grp->members.size() == count )
+			continue;
+
+		if ( grp->members.empty() )
+		{
+			emptied.push_back(grp);
+		}
+		else
+		{
+			my_groups_changed.push_back(grp);
+		}
+	}
+
+	for ( auto& grp : emptied )
+	{
+		DissolveGroup(grp);
+	}
+
+	auto  group = std::make_shared<node_group>();
+
+	group->id.Generate();
+	group->name = name;
+	group->members = members;
+	group->collapsed = true;
+
+	my_wksp_data->groups.push_back(group);
+	my_groups_changed.push_back(group);
+
+	TZK_LOG_FORMAT(LogLevel::Info, "Created group %s '%s' with %zu members",
+		group->id.GetCanonical(), name.c_str(), members.size()
+	);
+
+	return group;
+}
+
+
 std::shared_ptr<imgui::Link>
 ImGuiWkspTopology::CreateLink(
 	std::shared_ptr<trezanik::imgui::Pin> source,
@@ -1034,22 +1335,49 @@ ImGuiWkspTopology::CreateLink(
 
 
 void
-ImGuiWkspTopology::Draw()
+ImGuiWkspTopology::DissolveGroup(
+	std::shared_ptr<node_group> group
+)
 {
 	using namespace trezanik::core;
 
-	if ( ImGui::BeginChild(my_window_label.c_str()) )
+	auto  iter = std::find(my_wksp_data->groups.begin(), my_wksp_data->groups.end(), group);
+	if ( iter == my_wksp_data->groups.end() )
 	{
-		/*
-		 * Draws Canvas
-		 * Updates Selected nodes and Deletes those pending destruction
-		 * Iterates nodes
-		 * node.Update()
+		return;
+	}
+
+	TZK_LOG_FORMAT(LogLevel::Info, "Dissolving group %s", group->id.GetCanonical());
+
+	// the set of nodes is changing; what's been laid out so far is committed
+	my_layout.Stop();
+
+	my_wksp_data->groups.erase(iter);
+	// the proxy, if any, is removed and the members expanded on the next frame
+	my_groups_changed.push_back(group);
+}
+
+
+void
+ImGuiWkspTopology::Draw()
+{
+	using namespace trezanik::core;
+
+	if ( ImGui::BeginChild(my_window_label.c_str()) )
+	{
+		/*
+		 * Draws Canvas
+		 * Updates Selected nodes and Deletes those pending destruction
+		 * Iterates nodes
+		 * node.Update()
 		 *   Draws self, and iterates pins [in+out independently]
 		 *     pin.Update()
 		 *       Draws self
 		 * Hover/selection handling determined in each Update call
 		 */
+		UpdateGroups();
+		UpdateAutoLayout();
+		UpdateStatusColours();
 		my_nodegraph.Update();
 		my_selected_nodes = my_nodegraph.GetSelectedNodes();
 
@@ -1209,6 +1537,37 @@ ImGuiWkspTopology::Draw()
 }
 
 
+bool
+ImGuiWkspTopology::DrawContextPopupGroupSelect(
+	GroupNode* node
+)
+{
+	using namespace trezanik::core;
+
+	bool  retval = false;
+	auto  group = node->GetGroup();
+
+	ImGui::Text("Group Context Menu");
+	ImGui::Separator();
+
+	if ( ImGui::Button("Expand Group") )
+	{
+		TZK_LOG_FORMAT(LogLevel::Trace, "Expanding group %s", group->id.GetCanonical());
+
+		SetGroupCollapsed(group, false);
+		retval = true;
+	}
+
+	if ( ImGui::Button("Dissolve Group") )
+	{
+		DissolveGroup(group);
+		retval = true;
+	}
+
+	return retval;
+}
+
+
 bool
 ImGuiWkspTopology::DrawContextPopupLinkSelect(
 	trezanik::imgui::Link* link
@@ -1292,8 +1651,38 @@ ImGuiWkspTopology::DrawContextPopupMultiSelect(
 	{
 		// confirm deletions - list node names/ids
 		for ( auto& n : nodes )
-			my_nodegraph.DeleteNode(n);
+		{
+			// group proxies are dissolved, never deleting their members
+			auto  grpnode = dynamic_cast<GroupNode*>(n);
+			if ( grpnode != nullptr )
+				DissolveGroup(grpnode->GetGroup());
+			else
+				my_nodegraph.DeleteNode(n);
+		}
+
+		return true;
+	}
+
+	if ( !my_layout.IsRunning() && ImGui::Button("Auto Layout (Keep Selected)") )
+	{
+		StartAutoLayout(nodes);
+		return true;
+	}
+
+	if ( ImGui::Button("Group Selected") )
+	{
+		std::vector<trezanik::core::UUID>  members;
+
+		// group proxies can't be nested
+		for ( auto& n : nodes )
+		{
+			if ( dynamic_cast<IsochroneNode*>(n) != nullptr )
+			{
+				members.push_back(n->GetID());
+			}
+		}
 
+		CreateGroup("Group", members);
 		return true;
 	}
 
@@ -1352,6 +1741,27 @@ ImGuiWkspTopology::DrawContextPopupNoSelect()
 
 		retval = true;
 	}
+
+	if ( my_layout.IsRunning() )
+	{
+		if ( ImGui::Button("Stop Auto Layout") )
+		{
+			// final positions are committed on the next frame
+			my_layout.Stop();
+			retval = true;
+		}
+	}
+	else if ( ImGui::Button("Auto Layout") )
+	{
+		StartAutoLayout({});
+		retval = true;
+	}
+
+	if ( ImGui::Button("Group by Subnet") )
+	{
+		GroupBySubnet();
+		retval = true;
+	}
 	
 	return retval;
 }
@@ -1547,6 +1957,13 @@ ImGuiWkspTopology::DrawContextPopupNodeSelect(
 		retval = true;
 	}
 
+	auto  group = GetNodeGroup(node->GetID());
+	if ( group != nullptr && ImGui::Button("Collapse Group") )
+	{
+		SetGroupCollapsed(group, true);
+		retval = true;
+	}
+
 	ImGui::Separator();
 
 	float  button_width = ImGui::GetContentRegionAvail().x;
@@ -1898,6 +2315,9 @@ ImGuiWkspTopology::DrawPropertyView()
 		{
 			auto  node = std::dynamic_pointer_cast<IsochroneNode>(n);
 
+			if ( node == nullptr )
+				continue;
+
 			ImGui::PushID(n->GetID().GetCanonical());
 
 			if ( ImGui::TreeNode("Node") )
@@ -1931,7 +2351,10 @@ ImGuiWkspTopology::DrawPropertyView()
 			ImGui::TableNextRow();
 
 			auto  node = std::dynamic_pointer_cast<IsochroneNode>(my_selected_nodes[0]);
-			DrawPropertyView_Node(node);
+			if ( node != nullptr )
+			{
+				DrawPropertyView_Node(node);
+			}
 
 			ImGui::EndTable();
 		}
@@ -3237,6 +3660,80 @@ ImGuiWkspTopology::DrawServiceSelector()
 }
 
 
+int
+ImGuiWkspTopology::ExpandGroup(
+	std::shared_ptr<node_group> group
+)
+{
+	using namespace trezanik::core;
+
+	auto  proxy = std::find_if(my_group_nodes.begin(), my_group_nodes.end(), [&group](auto& gn) {
+		return gn->GetGroup() == group;
+	});
+	if ( proxy == my_group_nodes.end() )
+	{
+		return ErrNONE;
+	}
+
+	// the set of nodes is changing; what's been laid out so far is committed
+	my_layout.Stop();
+
+	// members taken by another group stay hidden
+	std::unordered_set<UUID>  member_ids(group->members.begin(), group->members.end());
+	auto&  members = (*proxy)->GetMembers();
+
+	for ( auto& n : members )
+	{
+		auto  gn = my_nodegraph.GetNode(n->id);
+
+		// collapsed this frame; the graph still holds it until purged
+		if ( gn != nullptr && gn->IsPendingDestruction() && member_ids.count(n->id) != 0 )
+		{
+			return EBUSY;
+		}
+	}
+
+	for ( auto& n : members )
+	{
+		if ( member_ids.count(n->id) == 0 || my_nodegraph.GetNode(n->id) != nullptr )
+			continue;
+
+		CreateGraphNode(n);
+	}
+
+	if ( my_context_node == proxy->get() )
+	{
+		my_context_node = nullptr;
+	}
+	my_nodegraph.DeleteNode(proxy->get());
+	my_group_nodes.erase(proxy);
+
+	CreateGraphLinks();
+	my_proxy_links_dirty = true;
+
+	TZK_LOG_FORMAT(LogLevel::Debug, "Expanded group %s", group->id.GetCanonical());
+
+	return ErrNONE;
+}
+
+
+std::shared_ptr<node_group>
+ImGuiWkspTopology::GetNodeGroup(
+	const trezanik::core::UUID& node_id
+)
+{
+	for ( auto& grp : my_wksp_data->groups )
+	{
+		if ( std::find(grp->members.begin(), grp->members.end(), node_id) != grp->members.end() )
+		{
+			return grp;
+		}
+	}
+
+	return nullptr;
+}
+
+
 std::shared_ptr<trezanik::imgui::NodeStyle>
 ImGuiWkspTopology::GetNodeStyle(
 	const char* name
@@ -3402,6 +3899,52 @@ ImGuiWkspTopology::GetServiceGroup(
 }
 
 
+void
+ImGuiWkspTopology::GroupBySubnet()
+{
+	using namespace trezanik::core;
+
+	std::unordered_set<UUID>  grouped;
+
+	for ( auto& grp : my_wksp_data->groups )
+	{
+		grouped.insert(grp->members.begin(), grp->members.end());
+	}
+
+	// keyed on the network address, so groups are created in address order
+	std::map<uint32_t, std::vector<UUID>>  subnets;
+
+	for ( auto& n : my_wksp_data->nodes )
+	{
+		if ( n->targets.size() != 1 || grouped.count(n->id) != 0 )
+			continue;
+
+		unsigned char  buf[sizeof(in_addr)];
+
+		if ( inet_pton(AF_INET, n->targets[0].target.c_str(), buf) != 1 )
+			continue;
+
+		uint32_t  network = (uint32_t(buf[0]) << 24) | (uint32_t(buf[1]) << 16) | (uint32_t(buf[2]) << 8);
+		subnets[network].push_back(n->id);
+	}
+
+	for ( auto& sn : subnets )
+	{
+		if ( sn.second.size() < 2 )
+			continue;
+
+		std::string  name = std::to_string((sn.first >> 24) & 0xFF);
+		name += ".";
+		name += std::to_string((sn.first >> 16) & 0xFF);
+		name += ".";
+		name += std::to_string((sn.first >> 8) & 0xFF);
+		name += ".0/24";
+
+		CreateGroup(name, sn.second);
+	}
+}
+
+
 int
 ImGuiWkspTopology::IndexFromNodeStyle(
 	std::string* style
@@ -3439,212 +3982,180 @@ ImGuiWkspTopology::IndexFromPinStyle(
 }
 
 
+bool
+ImGuiWkspTopology::IsNodeHidden(
+	const trezanik::core::UUID& node_id
+)
+{
+	for ( auto& gn : my_group_nodes )
+	{
+		for ( auto& m : gn->GetMembers() )
+		{
+			if ( m->id == node_id )
+				return true;
+		}
+	}
+
+	return false;
+}
+
+
 void
 ImGuiWkspTopology::Populate()
 {
 	using namespace trezanik::core;
 
-	auto& nodes = my_wksp_data->nodes;
-	
-	for ( auto& iter : nodes )
+	std::unordered_set<UUID>  hidden;
+
+	for ( auto& grp : my_wksp_data->groups )
 	{
-		AddNode(iter);
+		if ( grp->collapsed )
+		{
+			hidden.insert(grp->members.begin(), grp->members.end());
+		}
 	}
 
-	for ( auto& iter : my_wksp_data->links )
+	/*
+	 * Members of collapsed groups are only instantiated upon expansion; this
+	 * is what keeps large workspaces workable, as the per-frame cost follows
+	 * the graph node count rather than the workspace node count.
+	 * Nodes are already in the workspace data, so bypass AddNode
+	 */
+	for ( auto& iter : my_wksp_data->nodes )
 	{
-		const trezanik::app::pin*  psrc = nullptr;
-		const trezanik::app::pin*  ptgt = nullptr;
-		std::shared_ptr<trezanik::imgui::BaseNode>  nsrc;
-		std::shared_ptr<trezanik::imgui::BaseNode>  ntgt;
-		std::shared_ptr<trezanik::imgui::Pin> impin_out;
-		std::shared_ptr<trezanik::imgui::Pin> impin_inp;
+		if ( hidden.count(iter->id) != 0 )
+			continue;
 
-		/*
-		 * Not a fan but works.
-		 * Goal is to identify all the imgui:: types from the app:: types, as
-		 * loaded into the workspace
-		 */
-		for ( auto& n : nodes )
+		CreateGraphNode(iter);
+	}
+
+	for ( auto& grp : my_wksp_data->groups )
+	{
+		if ( grp->collapsed )
 		{
-			for ( auto& p : n->graph.pins )
-			{
-				// find the pin id for source and target
-				if ( p.id == iter->source || p.id == iter->target )
-				{
-					TZK_LOG_FORMAT(LogLevel::Trace,
-						"Found link %s in node %s for link: %s -> %s",
-						p.id == iter->source ? "source" : "target",
-						n->id.GetCanonical(),
-						iter->source.GetCanonical(), iter->target.GetCanonical()
-					);
-
-					// find the IsochroneNode* for the app::graph_node_system
-					if ( p.type == PinType::Server )
-					{
-						ptgt = &p;
+			CollapseGroup(grp);
+		}
+	}
 
-						auto niter = std::find_if(my_nodes.begin(), my_nodes.end(), [&n](auto&& node)
-						{
-							//TZK_LOG_FORMAT(LogLevel::Trace, "%s : %s", node->GetID().GetCanonical(), n->id.GetCanonical());
-							return node->GetID() == n->id;
-						});
-						if ( niter == my_nodes.end() )
-						{
-							TZK_LOG_FORMAT(LogLevel::Error,
-								"No matching graph node %s found for link: %s -> %s",
-								"target", iter->source.GetCanonical(), iter->target.GetCanonical()
-							);
-							continue;
-						}
-						
-						ntgt = *niter;
-					}
-					else if ( p.type == PinType::Client )
-					{
-						psrc = &p;
-						auto niter = std::find_if(my_nodes.begin(), my_nodes.end(), [&n](auto&& node)
-						{
-							//TZK_LOG_FORMAT(LogLevel::Trace, "%s : %s", node->GetID().GetCanonical(), n->id.GetCanonical());
-							return node->GetID() == n->id;
-						});
-						if ( niter == my_nodes.end() )
-						{
-							TZK_LOG_FORMAT(LogLevel::Error,
-								"No matching graph node %s found for link: %s -> %s",
-								"source", iter->source.GetCanonical(), iter->target.GetCanonical()
-							);
-							continue;
-						}
-						
-						nsrc = *niter;
-					}
-					else if ( p.type == PinType::Connector )
-					{
-						auto niter = std::find_if(my_nodes.begin(), my_nodes.end(), [&n](auto&& node)
-						{
-							//TZK_LOG_FORMAT(LogLevel::Trace, "%s : %s", node->GetID().GetCanonical(), n->id.GetCanonical());
-							return node->GetID() == n->id;
-						});
-						if ( niter == my_nodes.end() )
-						{
-							TZK_LOG_FORMAT(LogLevel::Error,
-								"No matching graph node found for link: %s -> %s",
-								iter->source.GetCanonical(), iter->target.GetCanonical()
-							);
-							continue;
-						}
-						if ( psrc == nullptr )
-						{
-							psrc = &p;
-							nsrc = *niter;
-						}
-						else if ( ptgt == nullptr )
-						{
-							ptgt = &p;
-							ntgt = *niter;
-						}
-					}
+	CreateGraphLinks();
+	RefreshProxyLinks();
 
-					// nodes can't link to themselves
-					break;
-				}
-			}
+	// no-op needed for node_styles
 
-			if ( psrc != nullptr && nsrc != nullptr && ptgt != nullptr && ntgt != nullptr)
-			{
-				// find the trezanik::imgui::Pin for src from the app::pin
-				for ( auto& srcpin : nsrc->GetPins() )
-				{
-					if ( srcpin->GetID() == psrc->id )
-					{
-						impin_out = srcpin;
-						break;
-					}
-				}
-				// and again for the target
-				for ( auto& tgtpin : ntgt->GetPins() )
-				{
-					if ( tgtpin->GetID() == ptgt->id )
-					{
-						impin_inp = tgtpin;
-						break;
-					}
-				}
-			}
+	// no-op needed for pin_styles
+
+	// no-op needed for services
+
+	// no-op needed for service_groups
+
+
+	my_wksp->AssignDockClient("Canvas Debug", my_wksp->my_settings->settings.dock_canvasdbg, std::bind(&trezanik::imgui::ImNodeGraph::DrawDebug, &my_nodegraph), drawclient_canvasdbg_uuid);
+	my_wksp->AssignDockClient("Property View", my_wksp->my_settings->settings.dock_propview, std::bind(&ImGuiWkspTopology::DrawPropertyView, this), drawclient_propview_uuid);
+}
+
+
+void
+ImGuiWkspTopology::RefreshProxyLinks()
+{
+	using namespace trezanik::core;
+	using namespace trezanik::imgui;
+
+	my_proxy_links_dirty = false;
+
+	std::vector<link_aggregate>  proxies;
+
+	if ( my_group_nodes.empty() )
+	{
+		my_nodegraph.SetProxyLinks(std::move(proxies));
+		return;
+	}
+
+	/*
+	 * Map every pin to the graph node displayed in place of its owner; the
+	 * node itself, or the proxy of the group hiding it
+	 */
+	struct pin_owner
+	{
+		BaseNode*  node;
+		const trezanik::app::pin*  data;
+		bool  hidden;
+	};
+	std::unordered_map<UUID, BaseNode*>  proxy_of;
+	std::unordered_map<UUID, pin_owner>  pins;
+
+	for ( auto& gn : my_group_nodes )
+	{
+		for ( auto& m : gn->GetMembers() )
+		{
+			proxy_of[m->id] = gn.get();
 		}
+	}
+
+	for ( auto& n : my_wksp_data->nodes )
+	{
+		BaseNode*  shown;
+		bool  hidden = false;
+		auto  iter = proxy_of.find(n->id);
 
-		if ( psrc == nullptr )
+		if ( iter != proxy_of.end() )
 		{
-			TZK_LOG_FORMAT(LogLevel::Error,
-				"No source found for link: %s -> %s",
-				iter->source.GetCanonical(), iter->target.GetCanonical()
-			);
-			continue;
+			shown = iter->second;
+			hidden = true;
 		}
-		if ( ptgt == nullptr )
+		else
 		{
-			TZK_LOG_FORMAT(LogLevel::Error,
-				"No target found for link: %s -> %s",
-				iter->source.GetCanonical(), iter->target.GetCanonical()
-			);
-			continue;
+			shown = my_nodegraph.GetNode(n->id).get();
 		}
-		if ( impin_inp == nullptr )
-		{
-			TZK_LOG_FORMAT(LogLevel::Error,
-				"No target pin found for link: %s -> %s",
-				iter->source.GetCanonical(), iter->target.GetCanonical()
-			);
+
+		if ( shown == nullptr )
 			continue;
-		}
-		if ( impin_out == nullptr )
+
+		for ( auto& p : n->graph.pins )
 		{
-			TZK_LOG_FORMAT(LogLevel::Error,
-				"No source pin found for link: %s -> %s",
-				iter->source.GetCanonical(), iter->target.GetCanonical()
-			);
-			continue;
+			pins[p.id] = { shown, &p, hidden };
 		}
+	}
 
-		TZK_LOG_FORMAT(LogLevel::Trace,
-			"Creating Link for " TZK_PRIxPTR " to " TZK_PRIxPTR,
-			impin_out.get(), impin_inp.get()
-		);
-
-		
-		// create the link in the nodegraph itself
-		auto  ngl = my_nodegraph.CreateLink<imgui::Link>(iter->id,
-			impin_out, impin_inp, &my_nodegraph, &iter->text,
-			(ImVec2*)&iter->offset, &iter->method, &iter->control_points
-		);
-		// assign the link to the pins
-		impin_inp->AssignLink(ngl);
-		impin_out->AssignLink(ngl);
+	std::map<std::pair<BaseNode*, BaseNode*>, size_t>  pair_index;
 
+	for ( auto& l : my_wksp_data->links )
+	{
+		auto  src = pins.find(l->source);
+		auto  tgt = pins.find(l->target);
 
-		/*
-		 * Pin CreateLink and here are the sources of 'creation' and therefore
-		 * tooltips, without being per-frame. Listeners are always handled via
-		 * their constructor, then dynamic updates
-		 */
-		std::string  tt = "Connected to:\n";
-		auto iscn = dynamic_cast<IsochroneNode*>(impin_inp->GetAttachedNode());
-		tt += iscn->GetWorkspaceNode()->name;
-		impin_out->SetTooltipText(tt);
-	}
+		if ( src == pins.end() || tgt == pins.end() )
+			continue;
+		// both visible; a regular graph link
+		if ( !src->second.hidden && !tgt->second.hidden )
+			continue;
+		// internal to a group
+		if ( src->second.node == tgt->second.node )
+			continue;
 
-	// no-op needed for node_styles
+		BaseNode*  a = src->second.node;
+		BaseNode*  b = tgt->second.node;
+		auto  res = pair_index.emplace(std::make_pair(a < b ? a : b, a < b ? b : a), proxies.size());
 
-	// no-op needed for pin_styles
+		if ( !res.second )
+		{
+			proxies[res.first->second].count++;
+			continue;
+		}
 
-	// no-op needed for services
+		const std::string&  style = tgt->second.data->style;
+		auto  pinstyle = GetPinStyle(style.empty() ? reserved_style_connector.c_str() : style.c_str());
+		link_aggregate  agg;
 
-	// no-op needed for service_groups
+		agg.first = res.first->first.first;
+		agg.second = res.first->first.second;
+		agg.colour = pinstyle != nullptr ? pinstyle->socket_colour : my_nodegraph.settings.grid_style.colours.link;
+		agg.count = 1;
+		proxies.push_back(agg);
+	}
 
+	TZK_LOG_FORMAT(LogLevel::Trace, "%zu proxy links for %zu collapsed groups", proxies.size(), my_group_nodes.size());
 
-	my_wksp->AssignDockClient("Canvas Debug", my_wksp->my_settings->settings.dock_canvasdbg, std::bind(&trezanik::imgui::ImNodeGraph::DrawDebug, &my_nodegraph), drawclient_canvasdbg_uuid);
-	my_wksp->AssignDockClient("Property View", my_wksp->my_settings->settings.dock_propview, std::bind(&ImGuiWkspTopology::DrawPropertyView, this), drawclient_propview_uuid);
+	my_nodegraph.SetProxyLinks(std::move(proxies));
 }
 
 
@@ -3724,6 +4235,33 @@ ImGuiWkspTopology::RemoveNode(
 {
 	using namespace trezanik::core;
 
+	bool  hidden = IsNodeHidden(node->id);
+	auto  group = GetNodeGroup(node->id);
+
+	if ( group != nullptr )
+	{
+		group->members.erase(
+			std::remove(group->members.begin(), group->members.end(), node->id),
+			group->members.end()
+		);
+
+		if ( group->members.empty() )
+		{
+			DissolveGroup(group);
+		}
+		else
+		{
+			my_groups_changed.push_back(group);
+		}
+	}
+
+	if ( hidden )
+	{
+		// no graph node to remove; the proxy drops it on the next frame
+		TZK_LOG_FORMAT(LogLevel::Debug, "Removing hidden node '%s' from group", node->id.GetCanonical());
+		return ErrNONE;
+	}
+
 	// get the BaseNode* (as a IsochroneNode*) from the workspace_node
 	auto mapiter = std::find_if(my_nodes.begin(), my_nodes.end(), [&node](auto& p)
 	{
@@ -4003,6 +4541,17 @@ ImGuiWkspTopology::RenamePinStyle(
 }
 
 
+void
+ImGuiWkspTopology::SetGroupCollapsed(
+	std::shared_ptr<node_group> group,
+	bool collapsed
+)
+{
+	group->collapsed = collapsed;
+	my_groups_changed.push_back(group);
+}
+
+
 void
 ImGuiWkspTopology::SortNodes()
 {
@@ -4039,6 +4588,241 @@ ImGuiWkspTopology::SortNodes()
 }
 
 
+int
+ImGuiWkspTopology::StartAutoLayout(
+	const std::vector<trezanik::imgui::BaseNode*>& pinned
+)
+{
+	using namespace trezanik::core;
+	using namespace trezanik::imgui;
+
+	if ( my_nodes.empty() && my_group_nodes.empty() )
+		return ENOENT;
+
+	std::vector<std::shared_ptr<BaseNode>>  bodies;
+	std::vector<force_layout_node>  lnodes;
+	std::vector<force_layout_edge>  ledges;
+	std::unordered_map<BaseNode*, uint32_t>  indices;
+	std::unordered_map<uint64_t, size_t>  pairs;
+
+	bodies.reserve(my_nodes.size() + my_group_nodes.size());
+	bodies.insert(bodies.end(), my_nodes.begin(), my_nodes.end());
+	// collapsed groups occupy space and hold links like any other node
+	bodies.insert(bodies.end(), my_group_nodes.begin(), my_group_nodes.end());
+
+	lnodes.reserve(bodies.size());
+	indices.reserve(bodies.size());
+	my_layout_pinned.clear();
+	my_layout_pinned.insert(pinned.begin(), pinned.end());
+
+	for ( auto& n : bodies )
+	{
+		force_layout_node  ln;
+
+		ln.position = n->GetPosition();
+		ln.size = n->GetSize();
+		ln.pinned = (n->GetFlags() & NodeFlags_NoMove) || my_layout_pinned.count(n.get()) != 0;
+
+		indices[n.get()] = static_cast<uint32_t>(lnodes.size());
+		lnodes.push_back(ln);
+	}
+
+	// multiple links between the same two nodes strengthen their attraction
+	auto  add_edge = [&](BaseNode* first, BaseNode* second, float weight) {
+		auto  src = indices.find(first);
+		auto  tgt = indices.find(second);
+
+		if ( src == indices.end() || tgt == indices.end() || src->second == tgt->second )
+			return;
+
+		uint32_t  a = std::min(src->second, tgt->second);
+		uint32_t  b = std::max(src->second, tgt->second);
+		uint64_t  key = (static_cast<uint64_t>(a) << 32) | b;
+		auto      iter = pairs.find(key);
+
+		if ( iter != pairs.end() )
+		{
+			ledges[iter->second].weight += weight;
+			return;
+		}
+
+		pairs[key] = ledges.size();
+		ledges.push_back({ a, b, weight });
+	};
+
+	for ( auto& link : my_nodegraph.GetLinks() )
+	{
+		add_edge(link->Source()->GetAttachedNode(), link->Target()->GetAttachedNode(), 1.f);
+	}
+	// links to members of collapsed groups; one proxy per pair, counting them all
+	for ( auto& agg : my_nodegraph.GetProxyLinks() )
+	{
+		add_edge(agg.first, agg.second, static_cast<float>(agg.count));
+	}
+
+	TZK_LOG_FORMAT(LogLevel::Info, "Starting automatic layout of %zu nodes (%zu pinned)", lnodes.size(), pinned.size());
+
+	int  rc = my_layout.Start(std::move(lnodes), std::move(ledges), force_layout_config());
+
+	if ( rc != ErrNONE )
+	{
+		TZK_LOG_FORMAT(LogLevel::Warning, "Automatic layout failed to start: %s", err_as_string(rc));
+		return rc;
+	}
+
+	my_layout_nodes = std::move(bodies);
+	my_layout_generation = 0;
+
+	return ErrNONE;
+}
+
+
+void
+ImGuiWkspTopology::UpdateAutoLayout()
+{
+	using namespace trezanik::core;
+
+	if ( my_layout_nodes.empty() )
+		return;
+
+	TZK_PROFILE_ZONE("ImGuiWkspTopology::UpdateAutoLayout");
+
+	/*
+	 * The layout holds its own references, so a node deleted or hidden by a
+	 * collapsed group during the run outlives its removal from the graph;
+	 * positioning it would notify the graph of a node it no longer tracks
+	 */
+	auto  in_graph = [this](const std::shared_ptr<trezanik::imgui::BaseNode>& n) {
+		return my_nodegraph.GetNode(n->GetID()).get() == n.get() && !n->IsPendingDestruction();
+	};
+
+	// read before fetching, so the final publish is never missed
+	bool  finished = !my_layout.IsRunning();
+
+	if ( my_layout.GetPositions(my_layout_positions, my_layout_generation) && my_layout_positions.size() == my_layout_nodes.size() )
+	{
+		for ( size_t i = 0; i < my_layout_nodes.size(); i++ )
+		{
+			auto&  n = my_layout_nodes[i];
+
+			if ( !in_graph(n) )
+				continue;
+			// the user has placed it; leave it be for the rest of the run
+			if ( n->IsBeingDragged() )
+			{
+				my_layout_pinned.insert(n.get());
+			}
+			if ( my_layout_pinned.count(n.get()) != 0 )
+				continue;
+
+			n->SetPosition(my_layout_positions[i], false);
+		}
+	}
+
+	if ( !finished )
+		return;
+
+	/*
+	 * Commit to the workspace data directly, as the NodePosition handler
+	 * would have; one pass, rather than an event and node lookup each.
+	 * Dragged nodes were already committed by that handler
+	 */
+	size_t  committed = 0;
+
+	for ( size_t i = 0; i < my_layout_nodes.size() && i < my_layout_positions.size(); i++ )
+	{
+		auto&  n = my_layout_nodes[i];
+
+		if ( !in_graph(n) || my_layout_pinned.count(n.get()) != 0 )
+			continue;
+
+		auto  grpnode = dynamic_cast<GroupNode*>(n.get());
+		auto  isonode = dynamic_cast<IsochroneNode*>(n.get());
+
+		if ( grpnode != nullptr )
+		{
+			grpnode->GetGroup()->position = my_layout_positions[i];
+		}
+		else if ( isonode != nullptr )
+		{
+			isonode->GetWorkspaceNode()->graph.position = my_layout_positions[i];
+		}
+		committed++;
+	}
+
+	TZK_LOG_FORMAT(LogLevel::Info,
+		"Automatic layout of %zu nodes committed after %u iterations",
+		committed, my_layout.GetIteration()
+	);
+
+	my_layout_nodes.clear();
+	my_layout_positions.clear();
+	my_layout_pinned.clear();
+}
+
+
+void
+ImGuiWkspTopology::UpdateGroups()
+{
+	using namespace trezanik::core;
+
+	if ( my_groups_changed.empty() && !my_proxy_links_dirty )
+		return;
+
+	TZK_PROFILE_ZONE("ImGuiWkspTopology::UpdateGroups");
+
+	std::vector<std::shared_ptr<node_group>>  changed;
+	changed.swap(my_groups_changed);
+
+	/*
+	 * Changes are applied by state rather than by request, so a group
+	 * toggled more than once since the last frame is handled just the once
+	 */
+	for ( auto& grp : changed )
+	{
+		bool  exists = std::find(my_wksp_data->groups.begin(), my_wksp_data->groups.end(), grp) != my_wksp_data->groups.end();
+		auto  proxy = std::find_if(my_group_nodes.begin(), my_group_nodes.end(), [&grp](auto& gn) {
+			return gn->GetGroup() == grp;
+		});
+
+		if ( exists && grp->collapsed )
+		{
+			if ( proxy == my_group_nodes.end() )
+			{
+				CollapseGroup(grp);
+			}
+			else
+			{
+				// membership changed; drop those no longer present
+				std::unordered_set<UUID>  member_ids(grp->members.begin(), grp->members.end());
+				auto&  members = (*proxy)->GetMembers();
+
+				members.erase(
+					std::remove_if(members.begin(), members.end(), [&member_ids](auto& m) {
+						return member_ids.count(m->id) == 0;
+					}),
+					members.end()
+				);
+			}
+		}
+		else if ( proxy != my_group_nodes.end() )
+		{
+			if ( ExpandGroup(grp) == EBUSY )
+			{
+				my_groups_changed.push_back(grp);
+			}
+		}
+
+		my_proxy_links_dirty = true;
+	}
+
+	if ( my_proxy_links_dirty )
+	{
+		RefreshProxyLinks();
+	}
+}
+
+
 void
 ImGuiWkspTopology::UpdatePinTooltip(
 	trezanik::imgui::Pin* pin
@@ -4121,6 +4905,73 @@ ImGuiWkspTopology::UpdatePinTooltip(
 }
 
 
+void
+ImGuiWkspTopology::UpdateStatusColours()
+{
+	using namespace trezanik::core;
+
+	if ( !my_status_changed.exchange(false) )
+		return;
+
+	// same source as the nodelist, so the colours match
+	nodelist_style*  nl_style = my_wksp->my_settings->settings.nodelist_override_app_style
+		? my_wksp_data->nlist_style.get()
+		: &_gui_interactions.active_app_style.nl_style;
+	ImU32  col_up = ImGui::ColorConvertFloat4ToU32(nl_style->online_indicator_colour_up);
+	ImU32  col_down = ImGui::ColorConvertFloat4ToU32(nl_style->online_indicator_colour_down);
+	ImU32  col_mixed = ImGui::ColorConvertFloat4ToU32(nl_style->online_indicator_colour_mixed);
+	bool   tracking = my_wksp->my_pingmon != nullptr;
+
+	auto  up_state_of = [tracking](workspace_node& n) {
+		if ( !tracking || n.pingmonitor_target_uuid == blank_uuid || !n.has_component(cth_cmpt_online_track) )
+			return UpState::Indeterminate;
+
+		for ( auto& t : n.targets )
+		{
+			if ( t.uuid == n.pingmonitor_target_uuid )
+				return t.up_state;
+		}
+		return UpState::Indeterminate;
+	};
+
+	for ( auto& n : my_nodes )
+	{
+		switch ( up_state_of(*n->GetWorkspaceNode()) )
+		{
+		case UpState::Up:   n->SetStatusColour(col_up); break;
+		case UpState::Down: n->SetStatusColour(col_down); break;
+		default:
+			n->SetStatusColour(IM_COL32_BLACK_TRANS);
+		}
+	}
+
+	for ( auto& g : my_group_nodes )
+	{
+		size_t  up = 0;
+		size_t  down = 0;
+
+		for ( auto& m : g->GetMembers() )
+		{
+			UpState  state = up_state_of(*m);
+
+			if ( state == UpState::Up )
+				up++;
+			else if ( state == UpState::Down )
+				down++;
+		}
+
+		if ( up > 0 && down > 0 )
+			g->SetStatusColour(col_mixed);
+		else if ( up > 0 )
+			g->SetStatusColour(col_up);
+		else if ( down > 0 )
+			g->SetStatusColour(col_down);
+		else
+			g->SetStatusColour(IM_COL32_BLACK_TRANS);
+	}
+}
+
+
 void
 ImGuiWkspTopology::UpdateWorkspaceData()
 {
@@ -4220,6 +5071,79 @@ IsochroneNode::DrawContent()
 
 
 
+// ---------------------
+// GroupNode
+
+GroupNode::GroupNode(
+	trezanik::core::UUID& id,
+	std::shared_ptr<node_group> group,
+	std::vector<std::shared_ptr<workspace_node>> members
+)
+: BaseNode(id)
+, my_group(group)
+, my_members(std::move(members))
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Constructor starting");
+	{
+		_header_text = &my_group->name;
+	}
+	TZK_LOG(LogLevel::Trace, "Constructor finished");
+}
+
+
+GroupNode::~GroupNode()
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Destructor starting");
+	{
+	}
+	TZK_LOG(LogLevel::Trace, "Destructor finished");
+}
+
+
+void
+GroupNode::DrawContent()
+{
+	using namespace trezanik::core;
+
+	size_t  up = 0;
+	size_t  down = 0;
+
+	// only drawn when on-screen, and a single pass; no caching warranted
+	for ( auto& m : my_members )
+	{
+		if ( m->pingmonitor_target_uuid == blank_uuid )
+			continue;
+
+		for ( auto& t : m->targets )
+		{
+			if ( t.uuid != m->pingmonitor_target_uuid )
+				continue;
+
+			if ( t.up_state == UpState::Up )
+				up++;
+			else if ( t.up_state == UpState::Down )
+				down++;
+			break;
+		}
+	}
+
+	ImGui::PushID(this);
+
+	ImGui::Text("%zu nodes", my_members.size());
+	if ( up + down > 0 )
+	{
+		ImGui::Text("Up: %zu  Down: %zu", up, down);
+	}
+
+	ImGui::PopID();
+}
+
+
+
 // ---------------------
 // ClientPin
 
@@ -16,12 +16,15 @@
 #include "app/Workspace.h"
 
 #include "imgui/BaseNode.h"
+#include "imgui/ForceLayout.h"
 #include "imgui/ImNodeGraph.h"
 #include "imgui/dear_imgui/imgui.h"
 
 #include "core/services/event/EventDispatcher.h"
 
+#include <atomic>
 #include <set>
+#include <unordered_set>
 
 
 namespace trezanik {
@@ -379,6 +382,91 @@ public:
 
 
 
+/**
+ * Proxy node standing in for the members of a collapsed node group
+ *
+ * Has no pins; links to and from the members are shown as proxy links drawn
+ * by the node graph. The member nodes are not instantiated in the graph while
+ * the group remains collapsed, which is what allows workspaces of many
+ * thousands of nodes to be worked with.
+ */
+class GroupNode : public trezanik::imgui::BaseNode
+{
+	TZK_NO_CLASS_ASSIGNMENT(GroupNode);
+	TZK_NO_CLASS_COPY(GroupNode);
+	TZK_NO_CLASS_MOVEASSIGNMENT(GroupNode);
+	TZK_NO_CLASS_MOVECOPY(GroupNode);
+
+private:
+
+	/** The group this node represents */
+	std::shared_ptr<node_group>  my_group;
+
+	/** The workspace nodes of each group member, in membership order */
+	std::vector<std::shared_ptr<workspace_node>>  my_members;
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 *
+	 * @param[in] id
+	 *  Node unique identifier; the group ID
+	 * @param[in] group
+	 *  The node group being represented
+	 * @param[in] members
+	 *  The workspace nodes of the group members
+	 */
+	GroupNode(
+		trezanik::core::UUID& id,
+		std::shared_ptr<node_group> group,
+		std::vector<std::shared_ptr<workspace_node>> members
+	);
+
+
+	/**
+	 * Standard destructor
+	 */
+	~GroupNode();
+
+
+	/**
+	 * Reimplementation of BaseNode::DrawContent
+	 *
+	 * Outputs the member count and their aggregated online state
+	 */
+	virtual void
+	DrawContent();
+
+
+	/**
+	 * Obtains the node group this node represents
+	 *
+	 * @return
+	 *  A shared_ptr to the node_group held in the workspace data structure
+	 */
+	std::shared_ptr<node_group>
+	GetGroup()
+	{
+		return my_group;
+	}
+
+
+	/**
+	 * Obtains the workspace nodes of the group members
+	 *
+	 * @return
+	 *  A reference to the member collection
+	 */
+	std::vector<std::shared_ptr<workspace_node>>&
+	GetMembers()
+	{
+		return my_members;
+	}
+};
+
+
+
 /**
  * GUI tab for the topology view
  * 
@@ -501,12 +589,51 @@ private:
 	 */
 	std::set<uint64_t>  my_reg_ids;
 
+	/** Automatic layout engine; computes on its own threads */
+	trezanik::imgui::ForceLayout  my_layout;
+
+	/** Nodes and group proxies being positioned by the automatic layout, in the order supplied */
+	std::vector<std::shared_ptr<trezanik::imgui::BaseNode>>  my_layout_nodes;
+
+	/** The latest positions retrieved from the automatic layout */
+	std::vector<ImVec2>  my_layout_positions;
+
+	/** Generation of my_layout_positions, for skipping unchanged results */
+	uint64_t  my_layout_generation;
+
+	/** Nodes the automatic layout must not move; pinned at the start, or dragged since */
+	std::unordered_set<trezanik::imgui::BaseNode*>  my_layout_pinned;
+
+	/** Proxy nodes of every collapsed node group */
+	std::vector<std::shared_ptr<GroupNode>>  my_group_nodes;
+
+	/**
+	 * Node groups created, dissolved, or with a changed collapsed state
+	 *
+	 * Applied at the start of the next frame, as the changes are predominantly
+	 * requested from within the node graph update (e.g. context menus), where
+	 * nodes and links must not be added or removed
+	 */
+	std::vector<std::shared_ptr<node_group>>  my_groups_changed;
+
+	/** Flag to recalculate the proxy links at the start of the next frame */
+	bool  my_proxy_links_dirty;
+
+	/**
+	 * Flag to refresh the node status colours at the start of the next frame
+	 *
+	 * Set from the ping monitor thread as target states change, hence atomic;
+	 * the graph nodes themselves are only touched from the drawing thread
+	 */
+	std::atomic<bool>  my_status_changed;
+
 
 	/**
 	 * Adds a graphical node to the workspace
 	 * 
 	 * Errors in pins and other indirect node attributes will be reported but
-	 * not cause a failure
+	 * not cause a failure. New nodes are refused once the workspace holds
+	 * TZK_MAX_NODES.
 	 * 
 	 * @param[in] gn
 	 *  (Template) The graph_node subtype containing the data we use to provide
@@ -672,6 +799,25 @@ private:
 	);
 
 
+	/**
+	 * Replaces the graph nodes of a groups members with a single proxy node
+	 *
+	 * Links attached to the members are removed from the graph without
+	 * notification; the workspace retains them, and they are represented by
+	 * proxy links until the group is expanded.
+	 *
+	 * @param[in] group
+	 *  The node group to collapse
+	 * @return
+	 *  - ErrFAILED if the proxy node could not be created
+	 *  - ErrNONE on success
+	 */
+	int
+	CollapseGroup(
+		std::shared_ptr<node_group> group
+	);
+
+
 	/**
 	 * Calculate where a pin would be created based on cursor position
 	 * 
@@ -699,6 +845,78 @@ private:
 	);
 
 
+	/**
+	 * Creates graph links for all workspace links not yet in the graph
+	 *
+	 * Links with an endpoint in a collapsed group are skipped, as are those
+	 * with an endpoint pin that cannot be found.
+	 */
+	void
+	CreateGraphLinks();
+
+
+	/**
+	 * Creates the graph node, and its pins, for a workspace node
+	 *
+	 * The workspace data is not modified beyond assigning default styles.
+	 *
+	 * @param[in] node
+	 *  The workspace node
+	 * @return
+	 *  The new graph node, or nullptr on failure
+	 */
+	std::shared_ptr<IsochroneNode>
+	CreateGraphNode(
+		std::shared_ptr<workspace_node> node
+	);
+
+
+	/**
+	 * Creates a new collapsed node group
+	 *
+	 * Members already in another group are moved into the new one; groups
+	 * left empty as a result are dissolved.
+	 *
+	 * @param[in] name
+	 *  The group name, as displayed in the proxy node header
+	 * @param[in] members
+	 *  The IDs of the workspace nodes to group
+	 * @return
+	 *  The new group, or nullptr if no members were supplied
+	 */
+	std::shared_ptr<node_group>
+	CreateGroup(
+		const std::string& name,
+		const std::vector<trezanik::core::UUID>& members
+	);
+
+
+	/**
+	 * Removes a node group, expanding its members if collapsed
+	 *
+	 * @param[in] group
+	 *  The node group to dissolve
+	 */
+	void
+	DissolveGroup(
+		std::shared_ptr<node_group> group
+	);
+
+
+	/**
+	 * Context menu drawing, with a group proxy node selected
+	 *
+	 * @param[in] node
+	 *  The selected group node
+	 * @return
+	 *  true if the popup should be closed (usually by action/selection), otherwise false
+	 */
+	bool
+	DrawContextPopupGroupSelect(
+		GroupNode* node
+	);
+
+
 	/**
 	 * Context menu drawing, with link selected (technically only hovered)
 	 * 
@@ -883,6 +1101,37 @@ private:
 	DrawServiceSelector();
 
 
+	/**
+	 * Recreates the graph nodes and links of a groups members
+	 *
+	 * Removes the proxy node; member nodes reappear at their own positions.
+	 *
+	 * @param[in] group
+	 *  The node group to expand
+	 * @return
+	 *  - EBUSY if a member node is still pending destruction
+	 *  - ErrNONE on success
+	 */
+	int
+	ExpandGroup(
+		std::shared_ptr<node_group> group
+	);
+
+
+	/**
+	 * Obtains the group a workspace node is a member of
+	 *
+	 * @param[in] node_id
+	 *  The workspace node ID
+	 * @return
+	 *  The node group, or nullptr if the node is not grouped
+	 */
+	std::shared_ptr<node_group>
+	GetNodeGroup(
+		const trezanik::core::UUID& node_id
+	);
+
+
 	/**
 	 * Obtains the NodeStyle with the specified name; case-sensitive
 	 * 
@@ -1012,6 +1261,16 @@ private:
 #endif
 
 
+	/**
+	 * Groups all ungrouped nodes by the /24 subnet of their IPv4 target
+	 *
+	 * Only nodes with a single IPv4 target are considered; subnets with a
+	 * single node are left as-is. New groups are created collapsed.
+	 */
+	void
+	GroupBySubnet();
+
+
 	/**
 	 * Gets the index of the supplied style name in the node styles collection
 	 * 
@@ -1048,6 +1307,20 @@ private:
 	);
 
 
+	/**
+	 * Determines if a workspace node is hidden within a collapsed group
+	 *
+	 * @param[in] node_id
+	 *  The workspace node ID
+	 * @return
+	 *  Boolean state; true if hidden
+	 */
+	bool
+	IsNodeHidden(
+		const trezanik::core::UUID& node_id
+	);
+
+
 	/**
 	 * Loads the contents of the workspace data structure into imgui node form
 	 *
@@ -1061,6 +1334,17 @@ private:
 	Populate();
 
 
+	/**
+	 * Recalculates the proxy links drawn for collapsed groups
+	 *
+	 * Every workspace link with an endpoint hidden in a collapsed group is
+	 * mapped to the nodes displayed in place of its endpoints; links mapping to
+	 * the same pair are merged, and those internal to a group are dropped.
+	 */
+	void
+	RefreshProxyLinks();
+
+
 	/**
 	 * Removes a node by its BaseNode pointer
 	 * 
@@ -1220,6 +1504,23 @@ private:
 	);
 
 
+	/**
+	 * Requests a node group be collapsed or expanded
+	 *
+	 * Applied at the start of the next frame.
+	 *
+	 * @param[in] group
+	 *  The node group
+	 * @param[in] collapsed
+	 *  The new collapsed state
+	 */
+	void
+	SetGroupCollapsed(
+		std::shared_ptr<node_group> group,
+		bool collapsed
+	);
+
+
 	/**
 	 * Sorts the workspace data nodes based on configuration
 	 */
@@ -1227,6 +1528,53 @@ private:
 	SortNodes();
 
 
+	/**
+	 * Begins automatic placement of all nodes
+	 *
+	 * Collapsed group proxies are placed alongside the regular nodes, with
+	 * their proxy links attracting as the links they stand in for would.
+	 * Links between each pair of nodes are merged into a single weighted
+	 * attraction. Intermediate positions are applied every frame via
+	 * UpdateAutoLayout, which commits the final positions to the workspace
+	 * data once the layout converges or is stopped.
+	 *
+	 * @param[in] pinned
+	 *  Nodes to hold in place; nodes flagged NoMove are always held
+	 * @return
+	 *  - ErrNONE if the layout started
+	 *  - ENOENT if there are no nodes to position
+	 */
+	int
+	StartAutoLayout(
+		const std::vector<trezanik::imgui::BaseNode*>& pinned
+	);
+
+
+	/**
+	 * Applies the latest automatic layout results to the nodes
+	 *
+	 * Called every frame; a no-op unless a layout is in progress. Positions
+	 * are applied without per-node notification, then written back to the
+	 * workspace nodes in a single pass upon completion.
+	 *
+	 * Nodes no longer in the graph (deleted, or hidden by a collapsed group)
+	 * are skipped. A node the user drags is left where they put it for the
+	 * remainder of the run, as though it had been pinned.
+	 */
+	void
+	UpdateAutoLayout();
+
+
+	/**
+	 * Applies pending node group changes and refreshes the proxy links
+	 *
+	 * Called every frame prior to the node graph update; a no-op unless a
+	 * group has changed.
+	 */
+	void
+	UpdateGroups();
+
+
 	/**
 	 * Updates the tooltip shown when a pin is hovered
 	 * 
@@ -1249,6 +1597,20 @@ private:
 	) const;
 
 
+	/**
+	 * Assigns each graph node the colour of its online state
+	 *
+	 * Nodes use the nodelist online indicator colour of their monitored
+	 * target; group nodes that of their members combined. Nodes with no
+	 * monitored target, or an indeterminate state, have the colour cleared.
+	 * 
+	 * Called every frame prior to the node graph update; a no-op unless
+	 * my_status_changed is set.
+	 */
+	void
+	UpdateStatusColours();
+
+
 protected:
 public:
 	/**
@@ -1262,6 +1624,7 @@ public:
 	 * file, which is default; only written if modified.
 	 */
 	struct {
+		bool  node_health_check_services = false;
 		bool  node_track_online_state = false;
 	} settings;
 
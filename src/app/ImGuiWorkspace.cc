@@ -21,6 +21,7 @@
 #include "app/Command.h"
 #include "app/tasks/Tasker.h"
 #include "app/tasks/Artifacts.h"
+#include "app/tasks/HealthCheck.h"
 #include "app/tasks/Persistence.h"
 #include "app/tasks/Ping.h"
 #include "app/tasks/PingMonitor.h"
@@ -38,6 +39,7 @@
 #include "core/util/filesystem/file.h"
 #include "core/util/net/net.h"
 #include "core/util/net/net_structs.h"
+#include "core/util/Profiler.h"
 #include "core/util/string/typeconv.h"
 #include "core/util/time.h"
 #include "core/TConverter.h"
@@ -370,9 +372,12 @@ public:
 				if ( selected < 2 && sel != nullptr ) // 0 if topology inactive, else == 1
 				{
 					IsochroneNode* iscn = dynamic_cast<IsochroneNode*>(sel.get());
-					assert(iscn != nullptr);
-					selected_node = iscn->GetWorkspaceNode();
-					selected_node_target = (selected_node->selected_target == -1) ? nullptr : &selected_node->targets.at(selected_node->selected_target);
+					// group proxies have no workspace node to select
+					if ( iscn != nullptr )
+					{
+						selected_node = iscn->GetWorkspaceNode();
+						selected_node_target = (selected_node->selected_target == -1) ? nullptr : &selected_node->targets.at(selected_node->selected_target);
+					}
 				}
 
 				unselected_lastframe.clear();
@@ -1633,6 +1638,7 @@ ImGuiWorkspace::ImGuiWorkspace(
 		my_reg_ids.emplace(my_evtmgr.Register(std::make_shared<core::Event<app::EventData::updated_node>>(uuid_listnode_updated, std::bind(&ImGuiWorkspace::HandleNodelistNodeUpdate, this, std::placeholders::_1))));
 
 		my_reg_ids.emplace(my_evtmgr.Register(std::make_shared<core::Event<app::EventData::node_target_state>>(uuid_nodetarget_state, std::bind(&ImGuiWorkspace::HandleNodeTargetState, this, std::placeholders::_1))));
+		my_reg_ids.emplace(my_evtmgr.Register(std::make_shared<core::DelayedEvent<std::shared_ptr<app::EventData::health_check_result>>>(uuid_healthcheck_result, std::bind(&ImGuiWorkspace::HandleHealthCheckResult, this, std::placeholders::_1))));
 
 		my_reg_ids.emplace(my_evtmgr.Register(std::make_shared<core::Event<imgui::EventData::node_graph_update>>(imgui::uuid_nodegraph_update, std::bind(&ImGuiWorkspace::HandleNodegraphUpdate, this, std::placeholders::_1))));
 	}
@@ -1832,6 +1838,10 @@ ImGuiWorkspace::ApplySetting(
 			my_topology->my_nodegraph.settings.link_default_method = static_cast<int>(link_method);
 		}
 		break;
+	case cth_minimap_draw:
+		common_update();
+		my_topology->my_nodegraph.settings.minimap_style.draw = core::TConverter<bool>::FromString(setting_value);
+		break;
 	case cth_node_dragfromheadersonly:
 		common_update();
 		my_topology->my_nodegraph.settings.node_drag_from_headers_only = core::TConverter<bool>::FromString(setting_value);
@@ -1840,6 +1850,11 @@ ImGuiWorkspace::ApplySetting(
 		common_update();
 		my_topology->my_nodegraph.settings.node_draw_headers = core::TConverter<bool>::FromString(setting_value);
 		break;
+	case cth_node_healthcheckservices:
+		common_update();
+		my_topology->settings.node_health_check_services = core::TConverter<bool>::FromString(setting_value);
+		UpdateHealthCheckState(my_topology->settings.node_health_check_services);
+		break;
 	case cth_node_trackonlinestate:
 		common_update();
 		my_topology->settings.node_track_online_state = core::TConverter<bool>::FromString(setting_value);
@@ -1953,6 +1968,8 @@ ImGuiWorkspace::Draw()
 {
 	using namespace trezanik::core;
 
+	TZK_PROFILE_ZONE("ImGuiWorkspace::Draw");
+
 	//ImGuiWindowFlags_UnsavedDocument = my_wksp_data != my_wksp->wksp_data
 	ImGuiWindowFlags  wnd_flags = ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoResize;
 	ImVec2  min_size(360.f, 240.f);
@@ -4145,6 +4162,52 @@ ImGuiWorkspace::HandleConfigChange(
 }
 
 
+void
+ImGuiWorkspace::HandleHealthCheckResult(
+	std::shared_ptr<app::EventData::health_check_result> result
+)
+{
+	using namespace trezanik::core;
+
+	if ( result->workspace_id != my_wksp_data.id || my_healthcheck == nullptr || my_topology == nullptr )
+	{
+		return;
+	}
+
+	ImU32  col_up = ImGui::ColorConvertFloat4ToU32(_gui_interactions.active_app_style.nl_style.online_indicator_colour_up);
+	ImU32  col_down = ImGui::ColorConvertFloat4ToU32(_gui_interactions.active_app_style.nl_style.online_indicator_colour_down);
+
+	for ( auto& state : result->pins )
+	{
+		auto  iter = my_healthcheck_pins.find(state.pin_id);
+
+		if ( iter == my_healthcheck_pins.end() )
+			continue;
+
+		// removed since the targets were last updated
+		auto  pin = iter->second.lock();
+
+		if ( pin == nullptr )
+			continue;
+
+		std::string  text = state.up_state == UpState::Up ? "Up: " : "Down: ";
+		text += state.detail;
+		if ( state.ttfb_ms != 0 )
+		{
+			text += "\nTTFB " + std::to_string(state.ttfb_ms) + " ms";
+			if ( state.total_ms != 0 )
+			{
+				text += ", total " + std::to_string(state.total_ms) + " ms";
+			}
+		}
+
+		pin->SetStatus(state.up_state == UpState::Up ? col_up : col_down, text);
+	}
+
+	UpdateHealthCheckTargets();
+}
+
+
 void
 ImGuiWorkspace::HandleLoadedNode(
 	app::EventData::loaded_node loaded
@@ -4421,6 +4484,33 @@ ImGuiWorkspace::HandleNodegraphUpdate(
 		}
 		if ( iso_node == nullptr )
 		{
+			/*
+			 * Group proxy nodes have no workspace node; only their placement
+			 * is retained, within the group itself. Deleting one dissolves
+			 * the group, never its members
+			 */
+			for ( auto& gn : my_topology->my_group_nodes )
+			{
+				if ( gn->GetID() != update.opt.node_uuid )
+					continue;
+
+				switch ( update.update )
+				{
+				case NodeGraphUpdate::NodeDeleting:
+					my_topology->DissolveGroup(gn->GetGroup());
+					break;
+				case NodeGraphUpdate::NodePosition:
+					gn->GetGroup()->position = update.opt.vec2;
+					break;
+				case NodeGraphUpdate::NodeSize:
+					gn->GetGroup()->size = update.opt.vec2;
+					break;
+				default:
+					break;
+				}
+				return;
+			}
+
 			TZK_LOG_FORMAT(LogLevel::Warning, "Couldn't find node associated with update: %s", update.opt.node_uuid.GetCanonical());
 			return;
 		}
@@ -4711,6 +4801,15 @@ ImGuiWorkspace::HandleNodelistSelected(
 	 * implementation - ensure the parameter node is used for operations
 	 */
 
+	/*
+	 * Members of collapsed groups are only instantiated on demand; expand the
+	 * group so the node is shown from the next frame
+	 */
+	if ( my_topology->IsNodeHidden(selected.node->id) )
+	{
+		my_topology->SetGroupCollapsed(my_topology->GetNodeGroup(selected.node->id), false);
+	}
+
 	/*
 	 * Find the node in the topology, and set it as selected.
 	 * Must also clear any other selection in the nodegraph.
@@ -4760,6 +4859,11 @@ ImGuiWorkspace::HandleNodeTargetState(
 			if ( t.uuid == state.target_id )
 			{
 				t.up_state = state.up_state;
+				// invoked from the ping monitor thread; applied by the next frame
+				if ( my_topology != nullptr )
+				{
+					my_topology->my_status_changed = true;
+				}
 				return;
 			}
 		}
@@ -4847,6 +4951,132 @@ ImGuiWorkspace::ServiceManagementSelection(
 }
 
 
+void
+ImGuiWorkspace::UpdateHealthCheckState(
+	bool enabled
+)
+{
+	using namespace trezanik::core;
+
+	if ( enabled )
+	{
+		if ( my_healthcheck == nullptr )
+		{
+			my_healthcheck = std::make_shared<HealthCheck>(my_wksp_data.id);
+			UpdateHealthCheckTargets();
+		}
+
+		_gui_interactions.task_runner.AddTask(my_healthcheck, my_wksp_data.id);
+		_gui_interactions.task_runner.Sync();
+	}
+	else if ( my_healthcheck != nullptr )
+	{
+		// call task stop directly to avoid potential deadlock routes in task runner
+		my_healthcheck->Stop();
+		// drop our reference, task runner should hold remainder and auto-delete it
+		my_healthcheck.reset();
+		my_healthcheck_pins.clear();
+
+		for ( auto& n : my_topology->my_nodes )
+		{
+			for ( auto& pin : n->GetPins() )
+			{
+				pin->SetStatus(0, "");
+			}
+		}
+	}
+}
+
+
+void
+ImGuiWorkspace::UpdateHealthCheckTargets()
+{
+	using namespace trezanik::core;
+
+	if ( my_healthcheck == nullptr )
+	{
+		return;
+	}
+
+	std::vector<health_check_target>  targets;
+	std::unordered_map<UUID, std::shared_ptr<IsochroneNode>>  topology_nodes;
+
+	my_healthcheck_pins.clear();
+
+	for ( auto& n : my_topology->my_nodes )
+	{
+		topology_nodes[n->GetID()] = n;
+	}
+
+	auto  add_service = [&targets](const UUID& pin_id, const std::string& host, const std::shared_ptr<service>& svc)
+	{
+		if ( svc == nullptr || svc->protocol_num != IPProto::tcp )
+			return;
+
+		/*
+		 * Port ranges are probed at their low port only. HTTP and TLS are
+		 * inferred; services have no application protocol to check against,
+		 * so anything else is only connected to
+		 */
+		health_check_target  tgt;
+		tgt.pin_id = pin_id;
+		tgt.host = host;
+		tgt.port = static_cast<uint16_t>(svc->port_num);
+		tgt.tls = svc->port_num == 443 || svc->port_num == 8443
+			|| svc->name.find("https") != std::string::npos
+			|| svc->name.find("HTTPS") != std::string::npos;
+		tgt.http = tgt.tls || svc->port_num == 80 || svc->port_num == 8080
+			|| svc->name.find("http") != std::string::npos
+			|| svc->name.find("HTTP") != std::string::npos;
+		targets.push_back(tgt);
+	};
+
+	for ( auto& n : my_wksp_data.nodes )
+	{
+		const workspace_node_target*  target = nullptr;
+
+		for ( auto& t : n->targets )
+		{
+			if ( t.uuid == n->pingmonitor_target_uuid || n->targets.size() == 1 )
+			{
+				target = &t;
+				break;
+			}
+		}
+
+		if ( target == nullptr || target->disabled || target->target.empty() )
+			continue;
+
+		auto  topology_node = topology_nodes.find(n->id);
+
+		if ( topology_node == topology_nodes.end() )
+			continue;
+
+		for ( auto& pin : n->graph.pins )
+		{
+			if ( pin.type != PinType::Server )
+				continue;
+
+			my_healthcheck_pins[pin.id] = topology_node->second->GetPin(pin.id);
+
+			if ( pin.svc != nullptr )
+			{
+				add_service(pin.id, target->target, pin.svc);
+			}
+			else if ( pin.svc_grp != nullptr )
+			{
+				for ( auto& svc_name : pin.svc_grp->services )
+				{
+					add_service(pin.id, target->target, my_topology->GetService(svc_name.c_str()));
+				}
+			}
+		}
+	}
+
+	my_healthcheck->SetTargets(std::move(targets));
+}
+
+
 void
 ImGuiWorkspace::UpdateTrackingState(
 	bool enabled
@@ -4927,6 +5157,11 @@ ImGuiWorkspace::UpdateTrackingState(
 		// drop our reference, task runner should hold remainder and auto-delete it
 		my_pingmon.reset();
 	}
+
+	if ( my_topology != nullptr )
+	{
+		my_topology->my_status_changed = true;
+	}
 }
 
 int
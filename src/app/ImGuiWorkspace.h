@@ -41,6 +41,7 @@ namespace app {
 
 
 class Command;
+class HealthCheck;
 class ImGuiSemiFixedDock;
 class ImGuiWkspDefinition;
 class ImGuiWkspForensics;
@@ -122,6 +123,12 @@ private:
 	/** A ping monitor for tracking nodes online state if enabled */
 	std::shared_ptr<PingMonitor>  my_pingmon;
 
+	/** A health checker for probing server pin services if enabled */
+	std::shared_ptr<HealthCheck>  my_healthcheck;
+
+	/** The topology pins of the health check targets, for applying results */
+	std::unordered_map<trezanik::core::UUID, std::weak_ptr<trezanik::imgui::Pin>>  my_healthcheck_pins;
+
 
 	/** 
 	 * Live state of the workspace data, that will eventually be fed back to
@@ -356,6 +363,22 @@ private:
 	);
 
 
+	/**
+	 * Event handler for a completed health check cycle
+	 *
+	 * Marks each server pin with its service state and latency, and refreshes
+	 * the health check targets so node and pin changes are picked up by the
+	 * next cycle
+	 *
+	 * @param[in] result
+	 *  The results of all probed pins
+	 */
+	void
+	HandleHealthCheckResult(
+		std::shared_ptr<app::EventData::health_check_result> result
+	);
+
+
 	/**
 	 * Event handler for when a component config has been loaded
 	 *
@@ -538,6 +561,37 @@ private:
 	);
 
 
+	/**
+	 * Common handler for toggling service health checks
+	 *
+	 * Starts or stops the associated task; when stopped, all pin status
+	 * indicators are cleared
+	 *
+	 * @param[in] enabled
+	 *  Boolean state; true if now enabled, otherwise false
+	 */
+	void
+	UpdateHealthCheckState(
+		bool enabled
+	);
+
+
+	/**
+	 * Supplies the health check task with the services of all server pins
+	 *
+	 * Each TCP service - directly, or within a service group - on a server pin
+	 * becomes a target, using the nodes PingMonitor target, or its only target
+	 * if it has one. Nodes without a determinable target are skipped. Only
+	 * services identifiable as HTTP are sent a request; the remainder are
+	 * checked for accepting connections.
+	 *
+	 * The topology pin of each target is recorded, so results are applied
+	 * without searching every node.
+	 */
+	void
+	UpdateHealthCheckTargets();
+
+
 	/**
 	 * Common handler for toggling node online tracking state
 	 *
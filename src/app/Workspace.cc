@@ -20,6 +20,7 @@
 #include "core/services/log/Log.h"
 #include "core/util/filesystem/file.h"
 #include "core/util/filesystem/folder.h"
+#include "core/util/Profiler.h"
 #include "core/util/string/string.h"
 #include "core/util/string/STR_funcs.h"
 #include "core/util/time.h"
@@ -732,6 +733,8 @@ Workspace::Load(
 #if TZK_USING_PUGIXML
 	using namespace trezanik::core;
 
+	TZK_PROFILE_ZONE("Workspace::Load");
+
 	/*
 	 * If we're already a loaded workspace, bail.
 	 * Better to use an interlocked exchange but it's not like this method can
@@ -765,7 +768,10 @@ Workspace::Load(
 
 	TZK_LOG_FORMAT(LogLevel::Info, "Loading workspace from filepath: %s", fpath());
 
-	res = doc.load_file(fpath.String().c_str());
+	{
+		TZK_PROFILE_ZONE("Workspace::Load::Parse");
+		res = doc.load_file(fpath.String().c_str());
+	}
 
 	if ( res.status != pugi::status_ok )
 	{
@@ -854,7 +860,10 @@ Workspace::Load(
 	loader.wksp_data = &my_wksp_data;
 
 	// doesn't currently return anything except ErrNONE, do check if altering
-	my_impl->Load(loader);
+	{
+		TZK_PROFILE_ZONE("Workspace::Load::Populate");
+		my_impl->Load(loader);
+	}
 
 
 	/*
@@ -919,6 +928,8 @@ Workspace::Save(
 {
 	using namespace trezanik::core;
 
+	TZK_PROFILE_ZONE("Workspace::Save");
+
 #if 0 // Code Disabled: Non-existent file names are now impossible, so autosave only for temporaries
 	/*
 	 * Expect this to be the case ONLY when a new workspace has been created, and
@@ -999,13 +1010,19 @@ Workspace::Save(
 	wksp_save  saver;
 	saver.xml_workspace = &xml_wksproot;
 	saver.wksp_data = &my_wksp_data;
-	if ( my_impl->Save(saver) != 0 )
 	{
-		return ErrFAILED;
+		TZK_PROFILE_ZONE("Workspace::Save::Generate");
+		if ( my_impl->Save(saver) != 0 )
+		{
+			return ErrFAILED;
+		}
 	}
 
 
-	success = doc.save_file(my_file_path());
+	{
+		TZK_PROFILE_ZONE("Workspace::Save::Write");
+		success = doc.save_file(my_file_path());
+	}
 	
 	if ( !success )
 	{
@@ -82,6 +82,16 @@ struct wksp_load_configs
 #endif
 };
 
+struct wksp_load_groups
+{
+	workspace_data*  wksp_data;
+#if TZK_USING_PUGIXML
+	pugi::xml_node*  xml_groups_root;
+#else
+	void*  dummy;
+#endif
+};
+
 struct wksp_load_links
 {
 	workspace_data*  wksp_data;
@@ -174,6 +184,16 @@ struct wksp_save_configs
 #endif
 };
 
+struct wksp_save_groups
+{
+	workspace_data*  wksp_data;
+#if TZK_USING_PUGIXML
+	pugi::xml_node*  xml_groups_root;
+#else
+	void*  dummy;
+#endif
+};
+
 struct wksp_save_links
 {
 	workspace_data*  wksp_data;
@@ -1444,6 +1464,38 @@ struct workspace_node
 };
 
 
+/**
+ * A set of workspace nodes presentable as a single node in the topology
+ *
+ * While collapsed, no graph objects exist for the members; a proxy node is
+ * shown in their place, with links to members drawn to the proxy instead. This
+ * is what permits workspaces far larger than the graph could otherwise draw at
+ * interactive rates, as only expanded members are ever instantiated.
+ *
+ * A workspace node can be a member of no more than one group.
+ */
+struct node_group
+{
+	/** Unique group identifier; also used for the proxy node in the graph */
+	trezanik::core::UUID  id = trezanik::core::blank_uuid;
+
+	/** Human-readable name, as displayed in the proxy node header */
+	std::string  name;
+
+	/** IDs of the member workspace_nodes */
+	std::vector<trezanik::core::UUID>  members;
+
+	/** If true, the proxy node is displayed instead of the members */
+	bool  collapsed = true;
+
+	/** Position of the proxy node in the graph */
+	ImVec2  position;
+
+	/** Size of the proxy node in the graph; zero for automatic */
+	ImVec2  size;
+};
+
+
 /**
  * Holds the workspace data utilized by the ImGuiWorkspace
  * 
@@ -1491,6 +1543,9 @@ struct workspace_data
 	/** All links in the graph */
 	std::unordered_set<std::shared_ptr<link>>  links;
 
+	/** All node groups, in creation order */
+	std::vector<std::shared_ptr<node_group>>  groups;
+
 	/** All node styles available for use */
 	std::vector<std::pair<std::string, std::shared_ptr<trezanik::imgui::NodeStyle>>>  node_styles;
 
@@ -1540,10 +1595,12 @@ TZK_DECLARE_SETTING(grid_draworigin, "grid.draw_origin");
 TZK_DECLARE_SETTING(grid_size, "grid.size");
 TZK_DECLARE_SETTING(grid_subdivisions, "grid.subdivisions");
 TZK_DECLARE_SETTING(link_defaultmethod, "link.default_method");
+TZK_DECLARE_SETTING(minimap_draw, "minimap.draw");
 TZK_DECLARE_SETTING(nodelist_overrideappstyle, "nodelist.override_app_style");
 TZK_DECLARE_SETTING(nodelist_sortorder, "nodelist.sort_order");
 TZK_DECLARE_SETTING(node_dragfromheadersonly, "node.drag_from_headers_only");
 TZK_DECLARE_SETTING(node_drawheaders, "node.draw_headers");
+TZK_DECLARE_SETTING(node_healthcheckservices, "node.health_check_services");
 TZK_DECLARE_SETTING(node_trackonlinestate, "node.track_online_state");
 // setting types
 constexpr char  strtype_bool[] = "boolean";
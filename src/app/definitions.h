@@ -41,6 +41,11 @@
 #	define TZK_CONFIG_FILENAME         "app.cfg"
 #endif
 
+#if !defined(TZK_EXTRACT_EMBEDDED_ASSETS)
+	// Write embedded assets to disk at startup, instead of serving from memory
+#	define TZK_EXTRACT_EMBEDDED_ASSETS  0
+#endif
+
 #if !defined(TZK_FILEDIALOG_AUTO_REFRESH_MS)
 	// The duration before the dialog will refresh directory contents
 #	define TZK_FILEDIALOG_AUTO_REFRESH_MS   5000
@@ -57,8 +62,8 @@
 #endif
 
 #if !defined(TZK_MAX_NODES)
-	// Number of nodes that can be added; arbritrary, no real limit
-#	define TZK_MAX_NODES     1024
+	// Number of nodes that can be added; only those outside collapsed groups are instantiated in the graph
+#	define TZK_MAX_NODES     32768
 #endif
 
 #if !defined(TZK_MAX_NUM_STYLES)
@@ -14,6 +14,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 
 namespace trezanik {
@@ -53,6 +54,7 @@ static trezanik::core::UUID  uuid_listnode_clearselected("da83f5c1-04cf-4690-ae5
 static trezanik::core::UUID  uuid_listnode_updated("201ff46b-a4a0-42f0-ac3e-549902bcf474");
 
 static trezanik::core::UUID  uuid_nodetarget_state("9236996c-09ad-4706-ba54-9ae059a58d62");
+static trezanik::core::UUID  uuid_healthcheck_result("5e0c1b7a-3f42-4d8e-9a61-c27d84b0f913");
 
 static trezanik::core::UUID  uuid_task_update("02d649ae-db37-4c11-bad9-2fbe578bc9fd");
 
@@ -338,6 +340,41 @@ struct node_target_state
 };
 
 
+/**
+ * Health check result for a single server pin
+ */
+struct pin_health_state
+{
+	/** The server pin UUID */
+	trezanik::core::UUID   pin_id;
+	/** The 'up' state of the service(s) behind the pin */
+	UpState  up_state;
+	/** The HTTP status code received; 0 if no response */
+	uint16_t  status_code;
+	/** Time to first byte, in milliseconds */
+	uint32_t  ttfb_ms;
+	/** Time to the complete response, in milliseconds */
+	uint32_t  total_ms;
+	/** Description of the outcome; the failure reason if down */
+	std::string  detail;
+};
+
+
+/**
+ * A health check cycle result event data
+ *
+ * Delayed dispatch, as the results are applied to the node graph. Covers every
+ * probed pin, not only state changes, so the latency values remain current
+ */
+struct health_check_result
+{
+	/** The workspace the health check task belongs to */
+	trezanik::core::UUID  workspace_id;
+	/** Results for each pin */
+	std::vector<pin_health_state>  pins;
+};
+
+
 /**
  * A tasks update event data
  *
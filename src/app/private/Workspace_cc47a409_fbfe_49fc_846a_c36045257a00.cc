@@ -32,6 +32,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <set>
+#include <unordered_set>
 
 
 namespace trezanik {
@@ -45,6 +47,7 @@ extern size_t  num_inbuilt_pinstyles;
 
  */
 const char  xmlstr_root_configs[] = "configurations";
+const char  xmlstr_root_groups[] = "groups";
 const char  xmlstr_root_links[] = "links";
 const char  xmlstr_root_nodes[] = "nodes";
 const char  xmlstr_root_services[] = "services";
@@ -55,6 +58,7 @@ const char  xmlstr_root_styles[] = "styles";
 const char  xmlstr_components[] = "components";
 const char  xmlstr_components_child[] = "component";
 const char  xmlstr_configurations_child[] = "component";
+const char  xmlstr_groups_child[] = "group";
 const char  xmlstr_links[] = "links";
 const char  xmlstr_links_child[] = "link";
 const char  xmlstr_nameservers[] = "nameservers";
@@ -95,6 +99,7 @@ const char  xmlstr_link[] = "link";
 const char  xmlstr_link_dragged[] = "link_dragged";
 const char  xmlstr_link_hovered_extra[] = "link_hovered_extra";
 const char  xmlstr_link_selected[] = "link_selected";
+const char  xmlstr_member[] = "member";
 const char  xmlstr_memory[] = "memory";
 const char  xmlstr_motherboard[] = "motherboard";
 const char  xmlstr_node[] = "node";
@@ -138,6 +143,7 @@ const char  xmlstr_attr_b[] = "b";
 const char  xmlstr_attr_bios[] = "bios";
 const char  xmlstr_attr_capacity[] = "capacity";
 const char  xmlstr_attr_code[] = "code";
+const char  xmlstr_attr_collapsed[] = "collapsed";
 const char  xmlstr_attr_comment[] = "comment";
 const char  xmlstr_attr_description[] = "description";
 const char  xmlstr_attr_disabled[] = "disabled";
@@ -219,8 +225,10 @@ std::map<std::string, std::string>  typemap {
 	{settingname_grid_size, strtype_uint},
 	{settingname_grid_subdivisions, strtype_uint},
 	{settingname_link_defaultmethod, strtype_string},
+	{settingname_minimap_draw, strtype_bool},
 	{settingname_node_dragfromheadersonly, strtype_bool},
 	{settingname_node_drawheaders, strtype_bool},
+	{settingname_node_healthcheckservices, strtype_bool},
 	{settingname_node_trackonlinestate, strtype_bool},
 	{settingname_nodelist_overrideappstyle, strtype_bool},
 	{settingname_nodelist_sortorder, strtype_string}
@@ -1004,6 +1012,15 @@ Workspace_cc47a409_fbfe_49fc_846a_c36045257a00::Load(
 	 *     </link>
 	 *     ...more links...
 	 *   </links>
+	 *   <groups>
+	 *     <group id="" name="" collapsed="">
+	 *       <position x="" y="" />
+	 *       <size h="" w="" />
+	 *       <member id="" />
+	 *       ...more members...
+	 *     </group>
+	 *     ...more groups...
+	 *   </groups>
 	 *   <styles>
 	 *     <node name="">
 	 *       ...child elements...
@@ -1033,6 +1050,7 @@ Workspace_cc47a409_fbfe_49fc_846a_c36045257a00::Load(
 	pugi::xml_node&  xml_wksproot = *loader.xml_root;
 	pugi::xml_node  xml_nodes = xml_wksproot.child(xmlstr_root_nodes);
 	pugi::xml_node  xml_links = xml_wksproot.child(xmlstr_root_links);
+	pugi::xml_node  xml_groups = xml_wksproot.child(xmlstr_root_groups);
 	pugi::xml_node  xml_services = xml_wksproot.child(xmlstr_root_services);
 	pugi::xml_node  xml_service_groups = xml_wksproot.child(xmlstr_root_servicegroups);
 	pugi::xml_node  xml_settings = xml_wksproot.child(xmlstr_root_settings);
@@ -1064,6 +1082,12 @@ Workspace_cc47a409_fbfe_49fc_846a_c36045257a00::Load(
 		wksp_load_links  links_ldr { loader.wksp_data, &xml_links };
 		LoadLinks(links_ldr);
 	}
+	if ( xml_groups )
+	{
+		// must load after nodes, membership is validated against them
+		wksp_load_groups  groups_ldr { loader.wksp_data, &xml_groups };
+		LoadGroups(groups_ldr);
+	}
 	if ( xml_styles )
 	{
 		wksp_load_styles  styles_ldr { loader.wksp_data, &xml_styles };
@@ -1195,6 +1219,130 @@ Workspace_cc47a409_fbfe_49fc_846a_c36045257a00::LoadConfigs(
 }
 
 
+int
+Workspace_cc47a409_fbfe_49fc_846a_c36045257a00::LoadGroups(
+	struct wksp_load_groups& loader
+)
+{
+	using namespace trezanik::core;
+
+	pugi::xml_node&  xml_groups = *loader.xml_groups_root;
+	size_t  num_groups = 0;
+	bool    case_sens = true;
+
+	if ( !xml_groups )
+	{
+		return ErrNONE;
+	}
+
+	/*
+	 * Groups exist for workspaces with tens of thousands of nodes, so member
+	 * validation is done by lookup rather than scanning the nodes each time
+	 */
+	std::unordered_set<UUID>  node_ids;
+	std::unordered_set<UUID>  grouped_ids;
+
+	for ( auto& n : loader.wksp_data->nodes )
+	{
+		node_ids.insert(n->id);
+	}
+
+	for ( auto& xml_group : xml_groups.children() )
+	{
+		if ( STR_compare(xml_group.name(), xmlstr_groups_child, case_sens) != 0 )
+		{
+			TZK_LOG_FORMAT(LogLevel::Warning, "Ignoring non-%s in %s: %s", xmlstr_groups_child, xmlstr_root_groups, xml_group.name());
+			continue;
+		}
+
+		num_groups++;
+
+		TZK_LOG_FORMAT(LogLevel::Trace, "Parsing %s %zu", xmlstr_groups_child, num_groups);
+
+		pugi::xml_attribute  attr_id = xml_group.attribute(xmlstr_attr_id);
+		pugi::xml_attribute  attr_name = xml_group.attribute(xmlstr_attr_name);
+		pugi::xml_attribute  attr_collapsed = xml_group.attribute(xmlstr_attr_collapsed);
+
+		char  failfmt[] = "Fail: %s %zu is invalid - %s";
+
+		if ( !attr_id )
+		{
+			TZK_LOG_FORMAT(LogLevel::Warning, failfmt, xmlstr_groups_child, num_groups, "no id");
+			continue;
+		}
+		if ( !UUID::IsStringUUID(attr_id.value()) )
+		{
+			TZK_LOG_FORMAT(LogLevel::Warning, failfmt, xmlstr_groups_child, num_groups, "malformed id");
+			continue;
+		}
+
+		auto  grp = std::make_shared<node_group>();
+
+		grp->id = attr_id.value();
+		grp->name = attr_name.value();
+		grp->collapsed = attr_collapsed ? attr_collapsed.as_bool() : true;
+
+		pugi::xml_node  xml_position = xml_group.child(xmlstr_position);
+		pugi::xml_node  xml_size = xml_group.child(xmlstr_size);
+
+		// both optional; new proxies are placed at the member centroid
+		if ( xml_position )
+		{
+			grp->position.x = xml_position.attribute(xmlstr_attr_x).as_float();
+			grp->position.y = xml_position.attribute(xmlstr_attr_y).as_float();
+		}
+		if ( xml_size )
+		{
+			grp->size.y = xml_size.attribute(xmlstr_attr_h).as_float();
+			grp->size.x = xml_size.attribute(xmlstr_attr_w).as_float();
+		}
+
+		for ( auto& xml_member : xml_group.children(xmlstr_member) )
+		{
+			pugi::xml_attribute  attr_member = xml_member.attribute(xmlstr_attr_id);
+
+			if ( !attr_member || !UUID::IsStringUUID(attr_member.value()) )
+			{
+				TZK_LOG_FORMAT(LogLevel::Warning, "Ignoring malformed %s in %s %zu", xmlstr_member, xmlstr_groups_child, num_groups);
+				continue;
+			}
+
+			UUID  member(attr_member.value());
+
+			if ( node_ids.count(member) == 0 )
+			{
+				TZK_LOG_FORMAT(LogLevel::Warning, "Ignoring non-existent %s %s in %s %zu", xmlstr_member, member.GetCanonical(), xmlstr_groups_child, num_groups);
+				continue;
+			}
+			if ( !grouped_ids.insert(member).second )
+			{
+				TZK_LOG_FORMAT(LogLevel::Warning, "Ignoring %s %s in %s %zu; already in another group", xmlstr_member, member.GetCanonical(), xmlstr_groups_child, num_groups);
+				continue;
+			}
+
+			grp->members.push_back(member);
+		}
+
+		if ( grp->members.empty() )
+		{
+			TZK_LOG_FORMAT(LogLevel::Warning, failfmt, xmlstr_groups_child, num_groups, "no valid members");
+			continue;
+		}
+
+		TZK_LOG_FORMAT(LogLevel::Debug, "%s %zu = %s : %s (%zu members)", xmlstr_groups_child, num_groups, grp->id.GetCanonical(), grp->name.c_str(), grp->members.size());
+		TZK_LOG_FORMAT(LogLevel::Trace, "Parsing %s %zu complete", xmlstr_groups_child, num_groups);
+
+		/*
+		 * Direct addition, as with component configs; nothing has an interest
+		 * in groups until the topology is created from the workspace data
+		 */
+		loader.wksp_data->groups.push_back(grp);
+	}
+
+	return ErrNONE;
+}
+
+
 int
 Workspace_cc47a409_fbfe_49fc_846a_c36045257a00::LoadLinks(
 	struct wksp_load_links& loader
@@ -1212,6 +1360,27 @@ Workspace_cc47a409_fbfe_49fc_846a_c36045257a00::LoadLinks(
 		return ErrNONE;
 	}
 
+	/*
+	 * Endpoint and duplicate lookups for every link; gathered once, rather
+	 * than walking all node pins and prior links per link
+	 */
+	std::unordered_set<UUID>  pin_ids;
+	std::unordered_set<UUID>  link_ids;
+	std::set<std::pair<UUID, UUID>>  link_endpoints;
+
+	for ( const auto& n : loader.wksp_data->nodes )
+	{
+		for ( auto& p : n->graph.pins )
+		{
+			pin_ids.insert(p.id);
+		}
+	}
+	for ( auto& l : loader.wksp_data->links )
+	{
+		link_ids.insert(l->id);
+		link_endpoints.emplace(l->source, l->target);
+	}
+
 	for ( auto& xml_link : xml_links.children() )
 	{
 		if ( STR_compare(xml_link.name(), xmlstr_links_child, case_sens) != 0 )
@@ -1297,22 +1466,7 @@ Workspace_cc47a409_fbfe_49fc_846a_c36045257a00::LoadLinks(
 
 		TZK_LOG_FORMAT(LogLevel::Debug, "Link %zu: [%s] %s -> %s", num_links, id.GetCanonical(), source.GetCanonical(), target.GetCanonical());
 
-		bool  source_found = false;
-		bool  target_found = false;
-		
-		for ( const auto& n : loader.wksp_data->nodes )
-		{
-			for ( auto& p : n->graph.pins )
-			{
-				if ( !source_found && p.id == source )
-					source_found = true;
-				if ( !target_found && p.id == target )
-					target_found = true;
-				if ( target_found && source_found )
-					break;
-			}
-		}
-		if ( !target_found || !source_found )
+		if ( pin_ids.count(source) == 0 || pin_ids.count(target) == 0 )
 		{
 			TZK_LOG_FORMAT(LogLevel::Warning, failfmt, xmlstr_links_child, num_links, "non-existent source and/or target");
 			continue;
@@ -1359,18 +1513,9 @@ Workspace_cc47a409_fbfe_49fc_846a_c36045257a00::LoadLinks(
 		TZK_LOG_FORMAT(LogLevel::Trace, "Parsing %s %zu complete", xmlstr_links_child, num_links);
 
 		// detect duplicate links from manual XML manipulation
-		bool  skip = false;
-		for ( auto& l : loader.wksp_data->links )
-		{
-			if ( l->id == id || (l->source == source && l->target == target) )
-			{
-				TZK_LOG(LogLevel::Warning, "Duplicate link; skipping");
-				skip = true;
-				break;
-			}
-		}
-		if ( skip )
+		if ( !link_ids.insert(id).second || !link_endpoints.emplace(source, target).second )
 		{
+			TZK_LOG(LogLevel::Warning, "Duplicate link; skipping");
 			--valid_links;
 			continue;
 		}
@@ -1413,6 +1558,11 @@ Workspace_cc47a409_fbfe_49fc_846a_c36045257a00::LoadNodes(
 			TZK_LOG_FORMAT(LogLevel::Warning, "Ignoring non-%s in %s: %s", xmlstr_nodes_child, xmlstr_nodes, xml_node.name());
 			continue;
 		}
+		if ( valid_nodes >= static_cast<size_t>(TZK_MAX_NODES) )
+		{
+			TZK_LOG_FORMAT(LogLevel::Warning, "Maximum of %d %s reached; ignoring the remainder", TZK_MAX_NODES, xmlstr_nodes_child);
+			break;
+		}
 
 		num_nodes++;
 
@@ -2552,6 +2702,17 @@ Workspace_cc47a409_fbfe_49fc_846a_c36045257a00::Save(
 		SaveLinks(wsl);
 	}
 
+	if ( !saver.wksp_data->groups.empty() )
+	{
+		wksp_save_groups  wsg;
+		pugi::xml_node    child = xml_workspace.append_child(xmlstr_root_groups);
+
+		wsg.xml_groups_root = &child;
+		wsg.wksp_data = saver.wksp_data;
+
+		SaveGroups(wsg);
+	}
+
 	size_t  saveables = 0;
 	nodelist_style  default_nlstyle;
 	saveables += (saver.wksp_data->node_styles.size() - num_inbuilt_nodestyles);
@@ -2633,6 +2794,41 @@ Workspace_cc47a409_fbfe_49fc_846a_c36045257a00::SaveConfigs(
 }
 
 
+int
+Workspace_cc47a409_fbfe_49fc_846a_c36045257a00::SaveGroups(
+	struct wksp_save_groups& saver
+)
+{
+	for ( auto& grp : saver.wksp_data->groups )
+	{
+		pugi::xml_node  xmlgroup = saver.xml_groups_root->append_child(xmlstr_groups_child);
+
+		xmlgroup.append_attribute(xmlstr_attr_id).set_value(grp->id.GetCanonical());
+		xmlgroup.append_attribute(xmlstr_attr_name).set_value(grp->name.c_str());
+		xmlgroup.append_attribute(xmlstr_attr_collapsed).set_value(grp->collapsed);
+
+		pugi::xml_node  xmlpos = xmlgroup.append_child(xmlstr_position);
+		xmlpos.append_attribute(xmlstr_attr_x).set_value(static_cast<int>(grp->position.x));
+		xmlpos.append_attribute(xmlstr_attr_y).set_value(static_cast<int>(grp->position.y));
+
+		if ( grp->size.x != 0.f && grp->size.y != 0.f )
+		{
+			pugi::xml_node  xmlsize = xmlgroup.append_child(xmlstr_size);
+			xmlsize.append_attribute(xmlstr_attr_h).set_value(static_cast<int>(grp->size.y));
+			xmlsize.append_attribute(xmlstr_attr_w).set_value(static_cast<int>(grp->size.x));
+		}
+
+		for ( auto& member : grp->members )
+		{
+			pugi::xml_node  xmlmember = xmlgroup.append_child(xmlstr_member);
+			xmlmember.append_attribute(xmlstr_attr_id).set_value(member.GetCanonical());
+		}
+	}
+
+	return ErrNONE;
+}
+
+
 int
 Workspace_cc47a409_fbfe_49fc_846a_c36045257a00::SaveLinks(
 	struct wksp_save_links& saver
@@ -44,6 +44,14 @@ protected:
 		struct wksp_load_configs& loader
 	) override;
 
+	/**
+	 * Implementation of IWorkspacePimpl::LoadGroups
+	 */
+	virtual int
+	LoadGroups(
+		struct wksp_load_groups& loader
+	) override;
+
 	/**
 	 * Implementation of IWorkspacePimpl::LoadLinks
 	 */
@@ -101,6 +109,14 @@ protected:
 		struct wksp_save_configs& saver
 	) override;
 
+	/**
+	 * Implementation of IWorkspacePimpl::SaveGroups
+	 */
+	virtual int
+	SaveGroups(
+		struct wksp_save_groups& saver
+	) override;
+
 	/**
 	 * Implementation of IWorkspacePimpl::SaveLinks
 	 */
@@ -18,6 +18,7 @@
 #include "core/services/memory/Memory.h"
 #include "core/services/ServiceLocator.h"
 #include "core/util/filesystem/file.h"
+#include "core/util/Profiler.h"
 #include "core/util/string/string.h"
 #include "core/error.h"
 
@@ -363,6 +364,8 @@ WindowsPrefetchParser::Parse(
 	using namespace trezanik::core;
 	using namespace trezanik::core::aux;
 
+	TZK_PROFILE_ZONE("WindowsPrefetchParser::Parse");
+
 	auto  ptr = std::dynamic_pointer_cast<prefetch_data>(objdata);
 
 	bool  case_sens = true;
@@ -895,6 +898,8 @@ BrowserDataParser::Parse(
 	using namespace trezanik::core;
 	using namespace trezanik::core::aux;
 
+	TZK_PROFILE_ZONE("BrowserDataParser::Parse");
+
 	auto  ptr = std::dynamic_pointer_cast<browser_data>(objdata);
 
 	return ErrIMPL;
@@ -0,0 +1,191 @@
+/**
+ * @file        src/app/tasks/HealthCheck.cc
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "app/definitions.h"
+
+#include "app/tasks/HealthCheck.h"
+#include "app/tasks/PingMonitor.h"  // UpState
+#include "app/event/AppEvent.h"
+
+#include "core/error.h"
+#include "core/services/ServiceLocator.h"
+#include "core/services/event/EventDispatcher.h"
+#include "core/services/log/Log.h"
+
+#include <algorithm>
+#include <map>
+
+
+namespace trezanik {
+namespace app {
+
+
+HealthCheck::HealthCheck(
+	const trezanik::core::UUID& wksp_id,
+	uint16_t interval,
+	uint32_t timeout_ms
+)
+: Task(std::bind(&HealthCheck::Invoke, this))
+, my_interval(std::max<uint16_t>(interval, 1))
+, my_timeout_ms(std::max<uint32_t>(timeout_ms, 100))
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Constructor starting");
+	{
+		_wksp_id = wksp_id;
+		_detail = "Service health check";
+	}
+	TZK_LOG(LogLevel::Trace, "Constructor finished");
+}
+
+
+HealthCheck::~HealthCheck()
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Destructor starting");
+	{
+	}
+	TZK_LOG(LogLevel::Trace, "Destructor finished");
+}
+
+
+int
+HealthCheck::Invoke()
+{
+	using namespace trezanik::core;
+	using namespace trezanik::engine::net;
+
+	auto  wait = std::chrono::seconds(my_interval);
+
+	TZK_LOG_FORMAT(LogLevel::Info, "Health check running; interval=%u seconds, timeout=%u ms", my_interval, my_timeout_ms);
+
+	while ( !_stop )
+	{
+		std::vector<health_check_target>  targets;
+		{
+			std::lock_guard<std::mutex>  lock(my_targets_lock);
+			targets = my_targets;
+		}
+
+		if ( !targets.empty() )
+		{
+			std::vector<http_probe>  probes;
+			std::vector<http_probe_result>  results;
+
+			probes.reserve(targets.size());
+
+			for ( auto& t : targets )
+			{
+				http_probe  p;
+				p.host = t.host;
+				p.port = t.port;
+				p.tls = t.http && t.tls;
+				p.connect_only = !t.http;
+				p.timeout_ms = my_timeout_ms;
+				probes.push_back(p);
+			}
+
+			if ( my_prober.Run(probes, results, &_stop) == ECANCELED )
+			{
+				break;
+			}
+
+			/*
+			 * Aggregate per pin; the reported result is the first failure, or
+			 * the slowest success if all are up
+			 */
+			std::map<UUID, EventData::pin_health_state>  pins;
+
+			for ( size_t i = 0; i < targets.size(); i++ )
+			{
+				const http_probe_result&  res = results[i];
+				bool  up = res.outcome == ProbeOutcome::Success && res.status_code < 500;
+				auto  iter = pins.find(targets[i].pin_id);
+
+				if ( iter != pins.end() )
+				{
+					bool  replace = iter->second.up_state == UpState::Up
+						&& (!up || res.total_ms > iter->second.total_ms);
+
+					if ( !replace )
+						continue;
+				}
+
+				EventData::pin_health_state  state;
+				state.pin_id = targets[i].pin_id;
+				state.up_state = up ? UpState::Up : UpState::Down;
+				state.status_code = res.status_code;
+				state.ttfb_ms = res.ttfb_ms;
+				state.total_ms = res.total_ms;
+				state.detail = targets[i].host + ":" + std::to_string(targets[i].port) + " - ";
+				if ( res.outcome != ProbeOutcome::Success )
+				{
+					state.detail += ProbeOutcomeString(res.outcome);
+				}
+				else if ( targets[i].http )
+				{
+					state.detail += "HTTP " + std::to_string(res.status_code);
+				}
+				else
+				{
+					state.detail += "Connected in " + std::to_string(res.connect_ms) + " ms";
+				}
+
+				if ( !up )
+				{
+					TZK_LOG_FORMAT(LogLevel::Debug, "Health check failed for %s", state.detail.c_str());
+				}
+
+				pins[state.pin_id] = state;
+			}
+
+			auto  evtdata = std::make_shared<EventData::health_check_result>();
+			evtdata->workspace_id = _wksp_id;
+			evtdata->pins.reserve(pins.size());
+			for ( auto& p : pins )
+			{
+				evtdata->pins.push_back(p.second);
+			}
+			ServiceLocator::EventDispatcher()->DelayedDispatch(uuid_healthcheck_result, evtdata);
+		}
+
+		/*
+		 * Halts the thread until the interval expires or the task is stopped.
+		 * Predicate determines spurious wakeup
+		 */
+		std::unique_lock<std::mutex> lock(_condvar_mtx);
+		if ( _condvar.wait_for(lock, wait, [this]{ return _stop == true; }) )
+		{
+			break;
+		}
+	}
+
+	TZK_LOG(LogLevel::Info, "Health check stopped");
+
+	return ErrNONE;
+}
+
+
+void
+HealthCheck::SetTargets(
+	std::vector<health_check_target> targets
+)
+{
+	using namespace trezanik::core;
+
+	std::lock_guard<std::mutex>  lock(my_targets_lock);
+
+	TZK_LOG_FORMAT(LogLevel::Debug, "Health check targets updated; %zu services", targets.size());
+
+	my_targets = std::move(targets);
+}
+
+
+} // namespace app
+} // namespace trezanik
@@ -0,0 +1,145 @@
+#pragma once
+
+/**
+ * @file        src/app/tasks/HealthCheck.h
+ * @brief       A service health check task, probing HTTP services on server pins
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "app/definitions.h"
+
+#include "app/tasks/Task.h"
+
+#include "engine/services/net/HTTPProbe.h"
+
+#include "core/UUID.h"
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+namespace trezanik {
+namespace app {
+
+
+constexpr uint16_t  health_check_default_interval = 30;
+constexpr uint32_t  health_check_default_timeout_ms = 5000;
+
+
+/**
+ * A single service to probe, and the pin it is reported against
+ *
+ * A pin referencing a service group will have one entry per TCP service in
+ * the group; its state is the aggregate of all
+ */
+struct health_check_target
+{
+	/** The server pin the service is exposed on */
+	trezanik::core::UUID  pin_id = trezanik::core::blank_uuid;
+
+	/** Hostname or IP address of the node */
+	std::string  host;
+
+	/** The service TCP port */
+	uint16_t  port = 0;
+
+	/** Flag to make an HTTP request; otherwise establishing a connection suffices */
+	bool  http = false;
+
+	/** Flag to use TLS (HTTPS); only applicable to HTTP */
+	bool  tls = false;
+};
+
+
+/**
+ * Periodically probes the TCP services of server pins
+ *
+ * Every interval, all targets are probed concurrently by a single HTTPProber
+ * on the task thread; an HTTP service is Up if it returns any response status
+ * below 500 within the timeout - authentication or missing resource errors
+ * still demonstrate a functioning server. Any other service is Up if its
+ * connection is established within the timeout. A pin is Up only if all of
+ * its services are.
+ *
+ * Results for all pins are dispatched as a single delayed health_check_result
+ * event each cycle.
+ *
+ * Stop flag is inherited from Task, set via {Task}->Stop()
+ */
+class HealthCheck : public Task
+{
+private:
+	/** Seconds between each round of probes */
+	uint16_t  my_interval;
+
+	/** Milliseconds each probe must complete within */
+	uint32_t  my_timeout_ms;
+
+	/** All services to probe */
+	std::vector<health_check_target>  my_targets;
+
+	/** Protection lock for modifying the targets */
+	mutable std::mutex  my_targets_lock;
+
+	/** The probe engine; only used from the task thread */
+	trezanik::engine::net::HTTPProber  my_prober;
+
+
+	/**
+	 * Task method invoked from Execute
+	 *
+	 * Runs until the task is marked for stopping, probing all targets each
+	 * interval
+	 *
+	 * @return
+	 *  - ErrNONE once stopped
+	 */
+	int
+	Invoke();
+
+protected:
+
+public:
+	/**
+	 * Standard constructor
+	 *
+	 * @param[in] wksp_id
+	 *  The workspace the pins reside in, included in result events
+	 * @param[in] interval
+	 *  Seconds between each round of probes; minimum of 1
+	 * @param[in] timeout_ms
+	 *  Milliseconds each probe must complete within; minimum of 100
+	 */
+	HealthCheck(
+		const trezanik::core::UUID& wksp_id,
+		uint16_t interval = health_check_default_interval,
+		uint32_t timeout_ms = health_check_default_timeout_ms
+	);
+
+
+	/**
+	 * Standard destructor
+	 */
+	~HealthCheck();
+
+
+	/**
+	 * Replaces the services to probe
+	 *
+	 * Takes effect from the next round
+	 *
+	 * @param[in] targets
+	 *  The new targets
+	 */
+	void
+	SetTargets(
+		std::vector<health_check_target> targets
+	);
+};
+
+
+} // namespace app
+} // namespace trezanik
@@ -20,6 +20,7 @@
 #include "core/services/memory/Memory.h"
 #include "core/services/ServiceLocator.h"
 #include "core/util/filesystem/file.h"
+#include "core/util/Profiler.h"
 #include "core/util/string/string.h"
 
 #if TZK_USING_PUGIXML
@@ -290,6 +291,8 @@ WindowsRegistryAutostartsParser::Parse(
 	using namespace trezanik::core;
 	using namespace trezanik::core::aux;
 
+	TZK_PROFILE_ZONE("WindowsRegistryAutostartsParser::Parse");
+
 	auto  ptr = std::dynamic_pointer_cast<registry_autostarts>(objdata);
 
 	std::shared_ptr<registry_autostart>  entry;
@@ -805,6 +808,8 @@ WindowsFileAutostartsParser::Parse(
 	using namespace trezanik::core;
 	using namespace trezanik::core::aux;
 
+	TZK_PROFILE_ZONE("WindowsFileAutostartsParser::Parse");
+
 	auto  ptr = std::dynamic_pointer_cast<file_autostarts>(objdata);
 
 #if TZK_USING_PUGIXML
@@ -1040,6 +1045,8 @@ FolderContentParser::Parse(
 	using namespace trezanik::core;
 	using namespace trezanik::core::aux;
 
+	TZK_PROFILE_ZONE("FolderContentParser::Parse");
+
 	auto  ptr = std::dynamic_pointer_cast<folder_contents>(objdata);
 
 	std::shared_ptr<folder_content>  entry;
@@ -1442,6 +1449,8 @@ ScheduledTasksParser::Parse(
 	using namespace trezanik::core;
 	using namespace trezanik::core::aux;
 
+	TZK_PROFILE_ZONE("ScheduledTasksParser::Parse");
+
 	auto  ptr = std::dynamic_pointer_cast<scheduled_tasks>(objdata);
 
 	pugi::xml_document  doc;
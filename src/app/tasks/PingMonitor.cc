@@ -19,6 +19,7 @@
 #include "core/services/event/EventDispatcher.h"
 #include "core/services/log/Log.h"
 #include "core/services/memory/Memory.h"
+#include "core/services/metrics/Metrics.h"
 #include "core/services/threading/Threading.h"
 #if TZK_IS_WIN32
 #	include "core/util/winerror.h"
@@ -68,6 +69,12 @@ PingMonitor::PingMonitor(
 		// proper initialization, initializer-list won't cover
 		memset(&my_self_saddr, '\0', sizeof(my_self_saddr));
 
+		auto  metrics = ServiceLocator::Metrics();
+		my_metric_replies = &metrics->Counter("icmp_echo_replies_total", "ICMP echo replies received");
+		my_metric_errors = &metrics->Counter("icmp_echo_errors_total", "ICMP errors received in place of an echo reply");
+		my_metric_timeouts = &metrics->Counter("icmp_echo_timeouts_total", "ICMP echo requests that timed out");
+		my_metric_rtt = &metrics->Histogram("icmp_echo_rtt_ms", "ICMP echo round-trip time in milliseconds");
+
 		/*
 		 * This must be constructor based!
 		 * Cannot have anything invoking AddTarget until we've determined if
@@ -628,6 +635,11 @@ PingMonitor::ProcessPacket()
 				sys.stats.last_response = core::aux::get_ms_since_epoch();
 				sys.stats.last_sequence_recv = icmphdr->icmp_sequence;
 				sys.stats.success_count++;
+				my_metric_replies->Increment();
+				if ( sys.stats.last_response >= sys.stats.last_send )
+				{
+					my_metric_rtt->Record(sys.stats.last_response - sys.stats.last_send);
+				}
 				sys.sequential_failures = 0;
 				if ( sys.up_state != UpState::Up )
 				{
@@ -715,6 +727,7 @@ PingMonitor::ProcessPacket()
 					}
 				}
 				sys.stats.failures.push(sys.stats.last_send);
+				my_metric_errors->Increment();
 			}
 		}
 	}
@@ -950,6 +963,7 @@ PingMonitor::SelectLoop()
 							}
 						}
 						ms.stats.failures.push(ms.stats.last_send);
+						my_metric_timeouts->Increment();
 					}
 				}
 			}
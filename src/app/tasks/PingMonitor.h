@@ -24,6 +24,10 @@
 
 
 namespace trezanik {
+namespace core {
+	class MetricCounter;
+	class MetricHistogram;
+} // namespace core
 namespace app {
 
 
@@ -408,6 +412,18 @@ private:
 	 */
 	mutable std::mutex  my_monitored_lock;
 
+	/** Echo replies received, across all monitored systems; registry owned */
+	trezanik::core::MetricCounter*  my_metric_replies = nullptr;
+
+	/** ICMP errors received in place of echo replies; registry owned */
+	trezanik::core::MetricCounter*  my_metric_errors = nullptr;
+
+	/** Echo requests that received no response in time; registry owned */
+	trezanik::core::MetricCounter*  my_metric_timeouts = nullptr;
+
+	/** Round-trip time of echo replies, in milliseconds; registry owned */
+	trezanik::core::MetricHistogram*  my_metric_rtt = nullptr;
+
 	/**
 	 * ICMP ID for raw sockets - not used for datagram ones
 	 *
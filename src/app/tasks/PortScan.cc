@@ -16,6 +16,7 @@
 #include "core/services/ServiceLocator.h"
 #include "core/util/filesystem/file.h"
 #include "core/util/hash/compile_time_hash.h"
+#include "core/util/Profiler.h"
 #include "core/error.h"
 
 #if TZK_USING_PUGIXML
@@ -525,6 +526,8 @@ PortScanParser::Parse(
 	using namespace trezanik::core;
 	using namespace trezanik::core::aux;
 
+	TZK_PROFILE_ZONE("PortScanParser::Parse");
+
 	auto  ptr = std::dynamic_pointer_cast<port_scan_data>(objdata);
 
 #if TZK_USING_PUGIXML
@@ -22,6 +22,7 @@
 #include "core/util/string/string.h"
 #include "core/util/hash/compile_time_hash.h"
 #include "core/util/net/net.h"
+#include "core/util/Profiler.h"
 
 #if TZK_USING_PUGIXML
 #	include <pugixml.hpp>
@@ -293,6 +294,8 @@ SoftwareInventoryParser::Parse(
 	using namespace trezanik::core;
 	using namespace trezanik::core::aux;
 
+	TZK_PROFILE_ZONE("SoftwareInventoryParser::Parse");
+
 	const auto  dn_hash = TZK_COMPILE_TIME_HASH("DisplayName");
 	const auto  ds_hash = TZK_COMPILE_TIME_HASH("DisplayString");
 	const auto  dv_hash = TZK_COMPILE_TIME_HASH("DisplayVersion");
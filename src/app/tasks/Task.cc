@@ -15,6 +15,7 @@
 #include "core/services/memory/Memory.h"
 #include "core/services/ServiceLocator.h"
 #include "core/util/filesystem/file.h"
+#include "core/util/Profiler.h"
 #include "core/util/time.h"
 #include "core/error.h"
 
@@ -167,6 +168,8 @@ Task::Execute()
 		throw std::runtime_error("No command or bound function to execute");
 	}
 
+	TZK_PROFILE_ZONE("Task::Execute");
+
 	int  retval = ErrIMPL;
 
 	my_start = core::aux::get_ms_since_epoch();
@@ -394,6 +397,8 @@ CommonExec::Exec(
 	using namespace trezanik::core;
 	using namespace trezanik::core::aux;
 
+	TZK_PROFILE_ZONE("CommonExec::Exec");
+
 	my_task->_detail = executable;
 	if ( !args.empty() )
 	{
@@ -415,7 +420,12 @@ CommonExec::Exec(
 	}
 	wcscpy_s(wbuf, wbuf_cnt, wargs.c_str());
 
-	if ( spawn(INFINITE, exit_code, entry_file, wexec.c_str(), wbuf) == ErrNONE && exit_code == 0 )
+	uint64_t  spawn_start = Profiler::Now();
+	int       spawn_rc = spawn(INFINITE, exit_code, entry_file, wexec.c_str(), wbuf);
+
+	Profiler::TraceSpan("process", "Process", spawn_start, my_task->_detail);
+
+	if ( spawn_rc == ErrNONE && exit_code == 0 )
 	{
 		if ( redirect_output )
 		{
@@ -484,6 +494,8 @@ CommonExec::Exec(
 {
 	using namespace trezanik::core;
 
+	TZK_PROFILE_ZONE("CommonExec::Exec");
+
 	int    rc;
 	pid_t  pid;
 
@@ -569,12 +581,16 @@ CommonExec::Exec(
 
 	TZK_LOG_FORMAT(LogLevel::Info, "Executing process: '%s'", my_task->_detail.c_str());
 
+	uint64_t  spawn_start = Profiler::Now();
+
 	if ( (rc = posix_spawn(&pid, executable.c_str(), &action, nullptr, spawn_args, environ)) == 0 )
 	{
 		siginfo_t  si;
 
 		waitid(P_PID, pid, &si, WEXITED);
 
+		Profiler::TraceSpan("process", "Process", spawn_start, my_task->_detail);
+
 		fp = core::aux::file::open(fpath.c_str(), aux::file::OpenFlag_ReadOnly);
 		if ( fp == nullptr )
 		{
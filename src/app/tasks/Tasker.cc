@@ -14,12 +14,16 @@
 #include "core/services/ServiceLocator.h"
 #include "core/services/event/EventDispatcher.h"
 #include "core/services/log/Log.h"
+#include "core/services/metrics/Metrics.h"
+#include "core/util/Profiler.h"
 #include "core/error.h"
 
 #if TZK_IS_WIN32
 #	include <Windows.h>
 #endif
 
+#include <chrono>
+
 
 namespace trezanik {
 namespace app {
@@ -29,11 +33,23 @@ Tasker::Tasker()
 : my_evtmgr(*core::ServiceLocator::EventDispatcher())
 , my_stop_trigger(false)
 , my_queue_if_full(false)  // unused so far
+, my_metric_queued(nullptr)
+, my_metric_running(nullptr)
+, my_metric_completed(nullptr)
+, my_metric_failed(nullptr)
+, my_metric_duration(nullptr)
 {
 	using namespace trezanik::core;
 
 	TZK_LOG(LogLevel::Trace, "Constructor starting");
 	{
+		auto  metrics = ServiceLocator::Metrics();
+		my_metric_queued = &metrics->Gauge("tasks_queued", "Tasks awaiting a worker");
+		my_metric_running = &metrics->Gauge("tasks_running", "Tasks presently executing");
+		my_metric_completed = &metrics->Counter("tasks_completed_total", "Tasks that executed successfully");
+		my_metric_failed = &metrics->Counter("tasks_failed_total", "Tasks that returned failure or raised an exception");
+		my_metric_duration = &metrics->Histogram("task_duration_us", "Task execution duration in microseconds");
+
 		my_reg_ids.emplace(my_evtmgr.Register(std::make_shared<core::Event<app::EventData::task_update>>(uuid_task_update, std::bind(&Tasker::HandleTaskUpdate, this, std::placeholders::_1))));
 
 		my_sync_event = ServiceLocator::Threading()->SyncEventCreate();
@@ -154,6 +170,10 @@ Tasker::AddTask(
 	my_all_tasks.push_back(task);
 
 	task->_owner_id = owner_id;
+	my_metric_queued->Add(1);
+
+	// span covers the queued time as well as execution
+	Profiler::TraceAsyncBegin("task", "Task", task->GetID().GetCanonical());
 
 	return ErrNONE;
 }
@@ -195,6 +215,7 @@ Tasker::GetTask()
 
 	auto  r = std::move(my_tasks.front());
 	my_tasks.pop();
+	my_metric_queued->Add(-1);
 	return { false, r };
 }
 
@@ -358,15 +379,38 @@ Tasker::Run()
 		evt.stopped = false;
 		my_evtmgr.DispatchEvent(uuid_task_update, evt);
 
+		auto  exec_start = std::chrono::steady_clock::now();
+		bool  executed = false;
+
+		my_metric_running->Add(1);
+
 		try
 		{
-			if ( (evt.result = task->Execute()) == ErrNONE )
+			evt.result = task->Execute();
+			executed = true;
+
+			my_metric_running->Add(-1);
+			my_metric_duration->Record(static_cast<uint64_t>(
+				std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - exec_start).count()
+			));
+
+			if ( evt.result == ErrNONE )
 			{
 				TZK_LOG_FORMAT(LogLevel::Debug, "Task %s execution complete", task->GetID().GetCanonical());
+				my_metric_completed->Increment();
 			}
 			else
 			{
 				TZK_LOG_FORMAT(LogLevel::Warning, "Task %s returned failure: %d", task->GetID().GetCanonical(), evt.result);
+				my_metric_failed->Increment();
+			}
+
+			// detail is only populated once executed
+			if ( Profiler::IsTracing() )
+			{
+				Profiler::TraceAsyncEnd("task", "Task", task->GetID().GetCanonical(),
+					task->TaskDetail() + " [result=" + std::to_string(evt.result) + "]"
+				);
 			}
 
 			evt.stopped = true;
@@ -379,6 +423,12 @@ Tasker::Run()
 				"%s caught unhandled exception: %s",
 				prefix.c_str(), e.what()
 			);
+
+			if ( !executed )
+			{
+				my_metric_running->Add(-1);
+				my_metric_failed->Increment();
+			}
 		}
 	}
 
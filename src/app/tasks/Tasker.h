@@ -30,6 +30,9 @@
 namespace trezanik {
 namespace core {
 	class EventDispatcher;
+	class MetricCounter;
+	class MetricGauge;
+	class MetricHistogram;
 } // namespace core
 namespace app {
 
@@ -122,6 +125,21 @@ private:
 	 */
 	std::set<uint64_t>  my_reg_ids;
 
+	/** Tasks added but not yet picked up by a worker; registry owned */
+	trezanik::core::MetricGauge*  my_metric_queued;
+
+	/** Tasks presently executing; registry owned */
+	trezanik::core::MetricGauge*  my_metric_running;
+
+	/** Tasks that executed successfully; registry owned */
+	trezanik::core::MetricCounter*  my_metric_completed;
+
+	/** Tasks that returned failure or threw; registry owned */
+	trezanik::core::MetricCounter*  my_metric_failed;
+
+	/** Task execution durations in microseconds; registry owned */
+	trezanik::core::MetricHistogram*  my_metric_duration;
+
 
 	/**
 	 * Retrieves a new task
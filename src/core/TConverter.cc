@@ -11,6 +11,7 @@
 #include "core/util/string/STR_funcs.h"
 #include "core/util/string/typeconv.h"
 #include "core/services/log/LogLevel.h"
+#include "core/services/metrics/Metrics.h"
 
 
 namespace trezanik {
@@ -286,5 +287,48 @@ TConverter<LogLevel>::ToUint8(
 }
 
 
+template<>
+MetricsFormat
+TConverter<MetricsFormat>::FromString(
+	const char* str
+)
+{
+	if ( STR_compare(str, "Prometheus", false) == 0 )
+		return MetricsFormat::Prometheus;
+	if ( STR_compare(str, "JSON", false) == 0 )
+		return MetricsFormat::JSON;
+
+	return MetricsFormat::Invalid;
+}
+
+
+template<>
+MetricsFormat
+TConverter<MetricsFormat>::FromString(
+	const std::string& str
+)
+{
+	return FromString(str.c_str());
+}
+
+
+template<>
+std::string
+TConverter<MetricsFormat>::ToString(
+	MetricsFormat type
+)
+{
+	switch ( type )
+	{
+	case MetricsFormat::Prometheus:  return "Prometheus";
+	case MetricsFormat::JSON:        return "JSON";
+	default:
+		break;
+	}
+
+	return "Invalid";
+}
+
+
 } // namespace core
 } // namespace trezanik
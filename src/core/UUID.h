@@ -369,12 +369,23 @@ static const trezanik::core::UUID        blank_uuid(blank_uuid_bytes);
 
 /**
  * Hash value to be used for STL unordered collections
+ *
+ * Folds the raw bytes rather than hashing the canonical string; lookups are
+ * frequent enough (node graph ID maps) that a string construction each time
+ * is measurable.
  */
 template<>
 struct std::hash<trezanik::core::UUID>
 {
 	size_t operator()(const trezanik::core::UUID& uuid) const noexcept
 	{
-		return std::hash<std::string>{}(uuid.GetCanonical());
+		trezanik::core::uuid_bytes  raw = uuid.GetRaw();
+		uint64_t  hi;
+		uint64_t  lo;
+
+		memcpy(&hi, raw.uuid, sizeof(hi));
+		memcpy(&lo, raw.uuid + sizeof(hi), sizeof(lo));
+
+		return std::hash<uint64_t>{}(hi ^ (lo * 0x9E3779B97F4A7C15ull));
 	}
 };
@@ -52,3 +52,33 @@
 	// number of bytes for the buffer holding function/file name in mem alloc info
 #	define TZK_ALLOCINFO_MAX_SIZE  64 // 64 is sufficient except for Visual Studio lambdas
 #endif
+
+#if !defined(TZK_PROFILER)
+	// compile in profiler zones; recording remains off until enabled at runtime
+#	define TZK_PROFILER  1  // true
+#endif
+
+#if !defined(TZK_PROFILER_RING_SIZE)
+	// number of zones each thread can buffer between frames; must be a power of 2
+#	define TZK_PROFILER_RING_SIZE  8192
+#endif
+
+#if !defined(TZK_PROFILER_FRAME_HISTORY)
+	// number of frames retained for inspection
+#	define TZK_PROFILER_FRAME_HISTORY  300
+#endif
+
+#if !defined(TZK_METRICS_SHARDS)
+	// number of per-thread shards for each counter; must be a power of 2
+#	define TZK_METRICS_SHARDS  16
+#endif
+
+#if !defined(TZK_METRICS_HISTOGRAM_SHARDS)
+	// number of per-thread shards for each histogram, each holding all buckets; must be a power of 2
+#	define TZK_METRICS_HISTOGRAM_SHARDS  4
+#endif
+
+#if !defined(TZK_METRICS_HISTOGRAM_SUB_BITS)
+	// histogram sub-buckets per power of two, as bits; 3 is 8 sub-buckets, 12.5% precision
+#	define TZK_METRICS_HISTOGRAM_SUB_BITS  3
+#endif
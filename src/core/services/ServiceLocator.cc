@@ -12,6 +12,7 @@
 #include "core/services/event/EventDispatcher.h"
 #include "core/services/log/Log.h"
 #include "core/services/memory/Memory.h"
+#include "core/services/metrics/Metrics.h"
 #include "core/services/threading/Threading.h"
 #include "core/services/NullServices.h"
 #include "core/services/ServiceLocator.h"
@@ -36,6 +37,7 @@ std::unique_ptr<IConfig> ServiceLocator::my_config = nullptr;
 std::unique_ptr<EventDispatcher> ServiceLocator::my_evt_dispatcher = nullptr;
 std::unique_ptr<Log> ServiceLocator::my_log = nullptr;
 std::unique_ptr<IMemory> ServiceLocator::my_memory = nullptr;
+std::unique_ptr<Metrics> ServiceLocator::my_metrics = nullptr;
 std::unique_ptr<IThreading> ServiceLocator::my_threading = nullptr;
 
 
@@ -128,6 +130,7 @@ ServiceLocator::CreateDefaultServices()
 
 	/*
 	 * creation ordering here is crucial:
+	 * 0) Metrics (no dependencies; everything else may register metrics)
 	 * 1) Log
 	 * 2) Memory (custom memory allocations, log not affected if events are small up to now)
 	 * 3) The others can be created in any order
@@ -137,6 +140,7 @@ ServiceLocator::CreateDefaultServices()
 	 * a non-logging option would be good for future as a null service for both
 	 * performance and live image use...
 	 */
+	my_metrics = std::make_unique<trezanik::core::Metrics>();
 	my_log = std::make_unique<trezanik::core::Log>();
 	my_evt_dispatcher = std::make_unique<trezanik::core::EventDispatcher>();
 	my_memory = std::make_unique<trezanik::core::Memory>();
@@ -156,6 +160,8 @@ ServiceLocator::DestroyAllServices()
 	my_evt_dispatcher.reset();
 	// log must always be last, as the others log
 	my_log.reset();
+	// metric references are held by all of the above
+	my_metrics.reset();
 }
 
 
@@ -180,6 +186,13 @@ ServiceLocator::Log()
 }
 
 
+trezanik::core::Metrics*
+ServiceLocator::Metrics()
+{
+	return my_metrics.get();
+}
+
+
 trezanik::core::IThreading*
 ServiceLocator::Threading()
 {
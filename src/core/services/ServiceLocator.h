@@ -23,6 +23,7 @@ class IConfig;
 class IMemory;
 class IThreading;
 class Log;
+class Metrics;
 class EventDispatcher;
 
 
@@ -61,6 +62,8 @@ private:
 	static std::unique_ptr<trezanik::core::IMemory>  my_memory;
 	/// Interface to a Threading service
 	static std::unique_ptr<trezanik::core::IThreading>  my_threading;
+	/// Metrics registry - cannot be replaced
+	static std::unique_ptr<trezanik::core::Metrics>  my_metrics;
 
 protected:
 public:
@@ -142,6 +145,20 @@ public:
 	Log();
 
 
+	/**
+	 * Obtains the metrics registry
+	 * 
+	 * This is a mandatory service; it is created before, and destroyed after,
+	 * all the other services so that any of them can hold metric references
+	 * for their entire lifetime
+	 *
+	 * @return
+	 *  A raw pointer to the metrics registry
+	 */
+	static trezanik::core::Metrics*
+	Metrics();
+
+
 	/**
 	 * Obtains the threading service
 	 * 
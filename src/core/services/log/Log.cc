@@ -11,6 +11,7 @@
 #include "core/services/log/LogEvent.h"
 #include "core/services/log/LogTarget.h"
 #include "core/services/memory/Memory.h"
+#include "core/services/metrics/Metrics.h"
 #include "core/error.h"
 
 #include <algorithm>
@@ -377,6 +378,12 @@ private:
 	/// Callback invoked when a loglevel == fatal is received
 	fatal_callback  my_fatal_callback;
 
+	/// Events pushed out to targets; registry owned
+	MetricCounter*  my_metric_events;
+
+	/// Events no target accepted, or stored events discarded; registry owned
+	MetricCounter*  my_metric_dropped;
+
 #if TZK_LOGEVENT_POOL
 	/**
 	 * A vector of LogEvents, if storage is enabled
@@ -415,6 +422,8 @@ public:
 	, my_abort_on_fatal(true)
 	, my_error_callback(nullptr)
 	, my_fatal_callback(nullptr)
+	, my_metric_events(&ServiceLocator::Metrics()->Counter("log_events_total", "Log events pushed out to targets"))
+	, my_metric_dropped(&ServiceLocator::Metrics()->Counter("log_events_dropped_total", "Log events accepted by no target, or discarded from storage"))
 #if TZK_LOGEVENT_POOL
 	, my_log_event_pool(log_pool_initial_size)
 #endif
@@ -449,6 +458,8 @@ public:
 	void
 	DiscardStoredEvents()
 	{
+		my_metric_dropped->Increment(my_log_events.size());
+
 		for ( auto& evt : my_log_events )
 		{
 #if TZK_LOGEVENT_POOL
@@ -509,6 +520,7 @@ public:
 		}
 
 		LogLevel  level = evt->GetLevel();
+		bool      accepted = false;
 
 		// pass the log event to all registered targets
 		for ( auto& target : my_targets )
@@ -516,9 +528,16 @@ public:
 			if ( target->AllowLog(level) )
 			{
 				target->ProcessEvent(evt);
+				accepted = true;
 			}
 		}
 
+		my_metric_events->Increment();
+		if ( !accepted )
+		{
+			my_metric_dropped->Increment();
+		}
+
 		// Release back to the pool now, no longer needed
 		 my_log_event_pool.Release(evt);
 
@@ -0,0 +1,665 @@
+/**
+ * @file        src/core/services/metrics/Metrics.cc
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "core/definitions.h"
+
+#include "core/services/metrics/Metrics.h"
+#include "core/services/log/Log.h"
+#include "core/services/threading/Threading.h"
+#include "core/services/ServiceLocator.h"
+#include "core/util/filesystem/file.h"
+#include "core/error.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+
+
+namespace trezanik {
+namespace core {
+
+
+static_assert((TZK_METRICS_SHARDS & (TZK_METRICS_SHARDS - 1)) == 0, "TZK_METRICS_SHARDS must be a power of 2");
+static_assert((TZK_METRICS_HISTOGRAM_SHARDS & (TZK_METRICS_HISTOGRAM_SHARDS - 1)) == 0, "TZK_METRICS_HISTOGRAM_SHARDS must be a power of 2");
+static_assert(TZK_METRICS_HISTOGRAM_SUB_BITS >= 1 && TZK_METRICS_HISTOGRAM_SUB_BITS <= 8, "TZK_METRICS_HISTOGRAM_SUB_BITS out of range");
+
+
+/** Source of shard indexes, handed out to threads in turn */
+static std::atomic<unsigned int>  metrics_next_shard{0};
+
+/** This threads shard index, assigned on first use; masked by each metric */
+static thread_local unsigned int  tls_shard = metrics_next_shard.fetch_add(1, std::memory_order_relaxed);
+
+
+/**
+ * Appends a string to a JSON string value, escaping as required
+ *
+ * @param[in,out] out
+ *  The string to append to
+ * @param[in] str
+ *  The string to escape
+ */
+static void
+json_append_escaped(
+	std::string& out,
+	const std::string& str
+)
+{
+	for ( char c : str )
+	{
+		switch ( c )
+		{
+		case '"':  out += "\\\""; break;
+		case '\\': out += "\\\\"; break;
+		case '\n': out += "\\n"; break;
+		case '\r': out += "\\r"; break;
+		case '\t': out += "\\t"; break;
+		default:
+			if ( static_cast<unsigned char>(c) < 0x20 )
+			{
+				char  buf[8];
+				std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned int>(c));
+				out += buf;
+			}
+			else
+			{
+				out += c;
+			}
+			break;
+		}
+	}
+}
+
+
+/**
+ * Appends help text for the Prometheus format, escaping as required
+ *
+ * @param[in,out] out
+ *  The string to append to
+ * @param[in] str
+ *  The help text
+ */
+static void
+prometheus_append_help(
+	std::string& out,
+	const std::string& str
+)
+{
+	for ( char c : str )
+	{
+		switch ( c )
+		{
+		case '\\': out += "\\\\"; break;
+		case '\n': out += "\\n"; break;
+		default:   out += c; break;
+		}
+	}
+}
+
+
+/**
+ * Appends the HELP and TYPE lines preceding each Prometheus metric
+ *
+ * @param[in,out] out
+ *  The string to append to
+ * @param[in] metric
+ *  The metric
+ * @param[in] type
+ *  The Prometheus metric type
+ */
+static void
+prometheus_append_header(
+	std::string& out,
+	const Metric& metric,
+	const char* type
+)
+{
+	out += "# HELP " + metric.Name() + " ";
+	prometheus_append_help(out, metric.Help());
+	out += "\n# TYPE " + metric.Name() + " " + type + "\n";
+}
+
+
+MetricCounter::MetricCounter(
+	const char* name,
+	const char* help
+)
+: Metric(name, help)
+{
+}
+
+
+void
+MetricCounter::Increment(
+	uint64_t amount
+)
+{
+	my_shards[tls_shard & (TZK_METRICS_SHARDS - 1)].value.fetch_add(amount, std::memory_order_relaxed);
+}
+
+
+uint64_t
+MetricCounter::Value() const
+{
+	uint64_t  retval = 0;
+
+	for ( auto& s : my_shards )
+	{
+		retval += s.value.load(std::memory_order_relaxed);
+	}
+
+	return retval;
+}
+
+
+MetricGauge::MetricGauge(
+	const char* name,
+	const char* help
+)
+: Metric(name, help)
+, my_value(0)
+{
+}
+
+
+uint64_t
+metric_histogram_snapshot::Percentile(
+	double percentile
+) const
+{
+	if ( count == 0 )
+		return 0;
+
+	// rank of the value sought, 1-based
+	uint64_t  rank = static_cast<uint64_t>((percentile / 100.0) * static_cast<double>(count) + 0.5);
+	uint64_t  seen = 0;
+
+	if ( rank < 1 )
+		rank = 1;
+
+	for ( size_t i = 0; i < buckets.size(); i++ )
+	{
+		seen += buckets[i];
+
+		if ( seen >= rank )
+		{
+			return std::min(MetricHistogram::BucketUpperBound(i), max);
+		}
+	}
+
+	return max;
+}
+
+
+MetricHistogram::MetricHistogram(
+	const char* name,
+	const char* help
+)
+: Metric(name, help)
+, my_shards(std::make_unique<shard[]>(TZK_METRICS_HISTOGRAM_SHARDS))
+, my_max(0)
+{
+	for ( size_t i = 0; i < TZK_METRICS_HISTOGRAM_SHARDS; i++ )
+	{
+		for ( auto& b : my_shards[i].buckets )
+		{
+			b.store(0, std::memory_order_relaxed);
+		}
+	}
+}
+
+
+size_t
+MetricHistogram::BucketIndex(
+	uint64_t value
+)
+{
+	if ( value < metrics_histogram_sub_buckets )
+		return static_cast<size_t>(value);
+
+	// position of the highest set bit; at least TZK_METRICS_HISTOGRAM_SUB_BITS
+	unsigned int  exponent = 63;
+	while ( (value & (uint64_t(1) << exponent)) == 0 )
+	{
+		exponent--;
+	}
+
+	unsigned int  shift = exponent - TZK_METRICS_HISTOGRAM_SUB_BITS;
+	size_t        sub = static_cast<size_t>(value >> shift) & (metrics_histogram_sub_buckets - 1);
+
+	return (shift + 1) * metrics_histogram_sub_buckets + sub;
+}
+
+
+uint64_t
+MetricHistogram::BucketUpperBound(
+	size_t index
+)
+{
+	if ( index < metrics_histogram_sub_buckets )
+		return index;
+
+	unsigned int  shift = static_cast<unsigned int>(index / metrics_histogram_sub_buckets) - 1;
+	uint64_t      sub = index % metrics_histogram_sub_buckets;
+	uint64_t      lower = (metrics_histogram_sub_buckets + sub) << shift;
+
+	return lower + ((uint64_t(1) << shift) - 1);
+}
+
+
+void
+MetricHistogram::Record(
+	uint64_t value
+)
+{
+	shard&  s = my_shards[tls_shard & (TZK_METRICS_HISTOGRAM_SHARDS - 1)];
+
+	s.buckets[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+	s.sum.fetch_add(value, std::memory_order_relaxed);
+	s.count.fetch_add(1, std::memory_order_relaxed);
+
+	uint64_t  cur = my_max.load(std::memory_order_relaxed);
+	while ( value > cur && !my_max.compare_exchange_weak(cur, value, std::memory_order_relaxed) )
+	{
+		// cur reloaded by the failed exchange
+	}
+}
+
+
+void
+MetricHistogram::Snapshot(
+	metric_histogram_snapshot& snapshot
+) const
+{
+	snapshot.count = 0;
+	snapshot.sum = 0;
+	snapshot.max = my_max.load(std::memory_order_relaxed);
+	snapshot.buckets.assign(metrics_histogram_buckets, 0);
+
+	for ( size_t i = 0; i < TZK_METRICS_HISTOGRAM_SHARDS; i++ )
+	{
+		const shard&  s = my_shards[i];
+
+		snapshot.count += s.count.load(std::memory_order_relaxed);
+		snapshot.sum += s.sum.load(std::memory_order_relaxed);
+
+		for ( size_t b = 0; b < metrics_histogram_buckets; b++ )
+		{
+			snapshot.buckets[b] += s.buckets[b].load(std::memory_order_relaxed);
+		}
+	}
+}
+
+
+Metrics::Metrics()
+: my_dump_stop(false)
+, my_dump_final(true)
+, my_dump_format(MetricsFormat::Invalid)
+, my_dump_interval(0)
+{
+	// no logging; we are created before the log service
+}
+
+
+Metrics::~Metrics()
+{
+	if ( my_dump_thread.joinable() )
+	{
+		{
+			std::lock_guard<std::mutex>  lock(my_dump_lock);
+			my_dump_stop = true;
+			my_dump_final = false;
+		}
+		my_dump_cv.notify_all();
+		my_dump_thread.join();
+	}
+}
+
+
+MetricCounter&
+Metrics::Counter(
+	const char* name,
+	const char* help
+)
+{
+	std::lock_guard<std::mutex>  lock(my_lock);
+
+	auto&  entry = my_counters[name];
+
+	if ( entry == nullptr )
+	{
+		entry = std::make_unique<MetricCounter>(name, help);
+	}
+
+	return *entry;
+}
+
+
+void
+Metrics::DumpThread()
+{
+	auto  tss = ServiceLocator::Threading();
+
+	if ( tss != nullptr )
+	{
+		tss->SetThreadName("Metrics Dump");
+	}
+
+	std::unique_lock<std::mutex>  lock(my_dump_lock);
+
+	while ( !my_dump_stop )
+	{
+		my_dump_cv.wait_for(lock, std::chrono::seconds(my_dump_interval), [this]{ return my_dump_stop; });
+
+		if ( my_dump_stop && !my_dump_final )
+			break;
+
+		// copy, so the write is performed without holding the lock
+		std::string    path = my_dump_path;
+		MetricsFormat  format = my_dump_format;
+
+		lock.unlock();
+		int  rc = Write(path, format);
+		lock.lock();
+
+		if ( rc != ErrNONE )
+		{
+			// don't repeat the same failure every interval
+			TZK_LOG_FORMAT(LogLevel::Warning, "Metrics dump to '%s' failed; periodic dump stopped", path.c_str());
+			my_dump_stop = true;
+			break;
+		}
+	}
+}
+
+
+MetricGauge&
+Metrics::Gauge(
+	const char* name,
+	const char* help
+)
+{
+	std::lock_guard<std::mutex>  lock(my_lock);
+
+	auto&  entry = my_gauges[name];
+
+	if ( entry == nullptr )
+	{
+		entry = std::make_unique<MetricGauge>(name, help);
+	}
+
+	return *entry;
+}
+
+
+void
+Metrics::GetCounters(
+	std::vector<const MetricCounter*>& counters
+) const
+{
+	std::lock_guard<std::mutex>  lock(my_lock);
+
+	counters.clear();
+	for ( auto& c : my_counters )
+	{
+		counters.push_back(c.second.get());
+	}
+}
+
+
+void
+Metrics::GetGauges(
+	std::vector<const MetricGauge*>& gauges
+) const
+{
+	std::lock_guard<std::mutex>  lock(my_lock);
+
+	gauges.clear();
+	for ( auto& g : my_gauges )
+	{
+		gauges.push_back(g.second.get());
+	}
+}
+
+
+void
+Metrics::GetHistograms(
+	std::vector<const MetricHistogram*>& histograms
+) const
+{
+	std::lock_guard<std::mutex>  lock(my_lock);
+
+	histograms.clear();
+	for ( auto& h : my_histograms )
+	{
+		histograms.push_back(h.second.get());
+	}
+}
+
+
+MetricHistogram&
+Metrics::Histogram(
+	const char* name,
+	const char* help
+)
+{
+	std::lock_guard<std::mutex>  lock(my_lock);
+
+	auto&  entry = my_histograms[name];
+
+	if ( entry == nullptr )
+	{
+		entry = std::make_unique<MetricHistogram>(name, help);
+	}
+
+	return *entry;
+}
+
+
+bool
+Metrics::IsDumping()
+{
+	std::lock_guard<std::mutex>  lock(my_dump_lock);
+	return my_dump_thread.joinable() && !my_dump_stop;
+}
+
+
+std::string
+Metrics::Serialize(
+	MetricsFormat format
+) const
+{
+	std::vector<const MetricCounter*>    counters;
+	std::vector<const MetricGauge*>      gauges;
+	std::vector<const MetricHistogram*>  histograms;
+	metric_histogram_snapshot  snap;
+	std::string  out;
+	char         buf[64];
+
+	GetCounters(counters);
+	GetGauges(gauges);
+	GetHistograms(histograms);
+
+	if ( format == MetricsFormat::Prometheus )
+	{
+		for ( auto c : counters )
+		{
+			prometheus_append_header(out, *c, "counter");
+			std::snprintf(buf, sizeof(buf), " %" PRIu64 "\n", c->Value());
+			out += c->Name() + buf;
+		}
+		for ( auto g : gauges )
+		{
+			prometheus_append_header(out, *g, "gauge");
+			std::snprintf(buf, sizeof(buf), " %" PRId64 "\n", g->Value());
+			out += g->Name() + buf;
+		}
+		for ( auto h : histograms )
+		{
+			h->Snapshot(snap);
+			prometheus_append_header(out, *h, "histogram");
+
+			// cumulative; only buckets holding values are listed, the rest are implied
+			uint64_t  cumulative = 0;
+			for ( size_t i = 0; i < snap.buckets.size(); i++ )
+			{
+				if ( snap.buckets[i] == 0 )
+					continue;
+
+				cumulative += snap.buckets[i];
+				std::snprintf(buf, sizeof(buf), "_bucket{le=\"%" PRIu64 "\"} %" PRIu64 "\n", MetricHistogram::BucketUpperBound(i), cumulative);
+				out += h->Name() + buf;
+			}
+			std::snprintf(buf, sizeof(buf), "_bucket{le=\"+Inf\"} %" PRIu64 "\n", snap.count);
+			out += h->Name() + buf;
+			std::snprintf(buf, sizeof(buf), "_sum %" PRIu64 "\n", snap.sum);
+			out += h->Name() + buf;
+			std::snprintf(buf, sizeof(buf), "_count %" PRIu64 "\n", snap.count);
+			out += h->Name() + buf;
+		}
+	}
+	else if ( format == MetricsFormat::JSON )
+	{
+		bool  first = true;
+
+		out += "{\n\"counters\":{";
+		for ( auto c : counters )
+		{
+			out += first ? "\n\t\"" : ",\n\t\"";
+			json_append_escaped(out, c->Name());
+			std::snprintf(buf, sizeof(buf), "\":%" PRIu64, c->Value());
+			out += buf;
+			first = false;
+		}
+
+		first = true;
+		out += "\n},\n\"gauges\":{";
+		for ( auto g : gauges )
+		{
+			out += first ? "\n\t\"" : ",\n\t\"";
+			json_append_escaped(out, g->Name());
+			std::snprintf(buf, sizeof(buf), "\":%" PRId64, g->Value());
+			out += buf;
+			first = false;
+		}
+
+		first = true;
+		out += "\n},\n\"histograms\":{";
+		for ( auto h : histograms )
+		{
+			h->Snapshot(snap);
+			out += first ? "\n\t\"" : ",\n\t\"";
+			json_append_escaped(out, h->Name());
+			std::snprintf(buf, sizeof(buf), "\":{\"count\":%" PRIu64 ",\"sum\":%" PRIu64, snap.count, snap.sum);
+			out += buf;
+			std::snprintf(buf, sizeof(buf), ",\"max\":%" PRIu64 ",\"p50\":%" PRIu64, snap.max, snap.Percentile(50.0));
+			out += buf;
+			std::snprintf(buf, sizeof(buf), ",\"p90\":%" PRIu64 ",\"p99\":%" PRIu64 "}", snap.Percentile(90.0), snap.Percentile(99.0));
+			out += buf;
+			first = false;
+		}
+		out += "\n}\n}\n";
+	}
+
+	return out;
+}
+
+
+int
+Metrics::StartDump(
+	const std::string& path,
+	MetricsFormat format,
+	uint32_t interval
+)
+{
+	if ( path.empty() || format == MetricsFormat::Invalid )
+	{
+		return EINVAL;
+	}
+
+	StopDump();
+
+	std::lock_guard<std::mutex>  lock(my_dump_lock);
+
+	my_dump_path = path;
+	my_dump_format = format;
+	my_dump_interval = interval < 1 ? 1 : interval;
+	my_dump_stop = false;
+	my_dump_final = true;
+	my_dump_thread = std::thread(&Metrics::DumpThread, this);
+
+	TZK_LOG_FORMAT(LogLevel::Info, "Metrics dump started: %s, every %u seconds", path.c_str(), my_dump_interval);
+
+	return ErrNONE;
+}
+
+
+void
+Metrics::StopDump()
+{
+	{
+		std::lock_guard<std::mutex>  lock(my_dump_lock);
+
+		if ( !my_dump_thread.joinable() )
+			return;
+
+		my_dump_stop = true;
+	}
+
+	// the thread writes a final time when woken
+	my_dump_cv.notify_all();
+	my_dump_thread.join();
+}
+
+
+int
+Metrics::Write(
+	const std::string& path,
+	MetricsFormat format
+) const
+{
+	std::string  data = Serialize(format);
+	std::string  tmp_path = path + ".tmp";
+	FILE*        fp = aux::file::open(tmp_path.c_str(), "wb");
+
+	if ( fp == nullptr )
+	{
+		return ErrFAILED;
+	}
+
+	bool  ok = aux::file::write(fp, data.c_str(), data.length()) == data.length();
+
+	aux::file::close(fp);
+
+	if ( !ok )
+	{
+		TZK_LOG_FORMAT(LogLevel::Warning, "Failed to write metrics: %s", tmp_path.c_str());
+		aux::file::remove(tmp_path.c_str());
+		return ErrFAILED;
+	}
+
+#if TZK_IS_WIN32
+	// rename will not replace an existing file
+	if ( aux::file::exists(path.c_str()) == EEXIST )
+	{
+		aux::file::remove(path.c_str());
+	}
+#endif
+	if ( std::rename(tmp_path.c_str(), path.c_str()) != 0 )
+	{
+		TZK_LOG_FORMAT(LogLevel::Warning, "Failed to rename metrics file: %s", path.c_str());
+		aux::file::remove(tmp_path.c_str());
+		return ErrFAILED;
+	}
+
+	return ErrNONE;
+}
+
+
+} // namespace core
+} // namespace trezanik
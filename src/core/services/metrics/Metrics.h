@@ -0,0 +1,659 @@
+#pragma once
+
+/**
+ * @file        src/core/services/metrics/Metrics.h
+ * @brief       Metrics registry of counters, gauges and histograms
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "core/definitions.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace trezanik {
+namespace core {
+
+
+/**
+ * Number of histogram buckets covering the full uint64_t range
+ *
+ * Values below the sub-bucket count are exact; above, each power of two is
+ * split into (1 << TZK_METRICS_HISTOGRAM_SUB_BITS) linear sub-buckets
+ */
+constexpr size_t  metrics_histogram_sub_buckets = size_t(1) << TZK_METRICS_HISTOGRAM_SUB_BITS;
+constexpr size_t  metrics_histogram_buckets = (64 - TZK_METRICS_HISTOGRAM_SUB_BITS + 1) * metrics_histogram_sub_buckets;
+
+
+/**
+ * Output formats for metrics exposition
+ */
+enum class MetricsFormat : uint8_t
+{
+	Prometheus,  //< Prometheus text exposition format, version 0.0.4
+	JSON,        //< Single JSON object keyed by metric type then name
+	Invalid
+};
+
+
+/**
+ * Base class for all metrics, holding the identifying details
+ */
+class TZK_CORE_API Metric
+{
+	TZK_NO_CLASS_ASSIGNMENT(Metric);
+	TZK_NO_CLASS_COPY(Metric);
+	TZK_NO_CLASS_MOVEASSIGNMENT(Metric);
+	TZK_NO_CLASS_MOVECOPY(Metric);
+
+private:
+
+	/** Metric name; lowercase with underscores, as per Prometheus naming */
+	std::string  my_name;
+
+	/** Description of what is measured, including the unit */
+	std::string  my_help;
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 *
+	 * @param[in] name
+	 *  The metric name
+	 * @param[in] help
+	 *  The metric description
+	 */
+	Metric(
+		const char* name,
+		const char* help
+	)
+	: my_name(name)
+	, my_help(help)
+	{
+	}
+
+
+	/**
+	 * Standard destructor
+	 */
+	virtual ~Metric() = default;
+
+
+	/**
+	 * Obtains the metric description
+	 *
+	 * @return
+	 *  A const-reference to the help string
+	 */
+	const std::string&
+	Help() const
+	{
+		return my_help;
+	}
+
+
+	/**
+	 * Obtains the metric name
+	 *
+	 * @return
+	 *  A const-reference to the name string
+	 */
+	const std::string&
+	Name() const
+	{
+		return my_name;
+	}
+};
+
+
+/**
+ * Monotonically increasing count, sharded per thread
+ *
+ * Each thread increments its own cache line, so concurrent increments from
+ * many threads never contend; the value is the sum of all shards, and is only
+ * computed when read.
+ */
+class TZK_CORE_API MetricCounter : public Metric
+{
+	TZK_NO_CLASS_ASSIGNMENT(MetricCounter);
+	TZK_NO_CLASS_COPY(MetricCounter);
+	TZK_NO_CLASS_MOVEASSIGNMENT(MetricCounter);
+	TZK_NO_CLASS_MOVECOPY(MetricCounter);
+
+private:
+
+	/** Single shard, padded to a cache line to prevent false sharing */
+	struct alignas(64) shard
+	{
+		std::atomic<uint64_t>  value{0};
+	};
+
+	/** The per-thread shards */
+	shard  my_shards[TZK_METRICS_SHARDS];
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 *
+	 * @param[in] name
+	 *  The metric name; conventionally suffixed with '_total'
+	 * @param[in] help
+	 *  The metric description
+	 */
+	MetricCounter(
+		const char* name,
+		const char* help
+	);
+
+
+	/**
+	 * Adds to the count
+	 *
+	 * @param[in] amount
+	 *  (Optional) The amount to add; default of 1
+	 */
+	void
+	Increment(
+		uint64_t amount = 1
+	);
+
+
+	/**
+	 * Obtains the current count
+	 *
+	 * @return
+	 *  The sum of all shards
+	 */
+	uint64_t
+	Value() const;
+};
+
+
+/**
+ * A value that can rise and fall, such as a queue length or memory size
+ *
+ * Gauges are set far less often than counters are incremented, and a set
+ * cannot be sharded, so this is a single atomic.
+ */
+class TZK_CORE_API MetricGauge : public Metric
+{
+	TZK_NO_CLASS_ASSIGNMENT(MetricGauge);
+	TZK_NO_CLASS_COPY(MetricGauge);
+	TZK_NO_CLASS_MOVEASSIGNMENT(MetricGauge);
+	TZK_NO_CLASS_MOVECOPY(MetricGauge);
+
+private:
+
+	/** The current value */
+	std::atomic<int64_t>  my_value;
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 *
+	 * @param[in] name
+	 *  The metric name
+	 * @param[in] help
+	 *  The metric description
+	 */
+	MetricGauge(
+		const char* name,
+		const char* help
+	);
+
+
+	/**
+	 * Adds to the value
+	 *
+	 * @param[in] amount
+	 *  The amount to add; can be negative
+	 */
+	void
+	Add(
+		int64_t amount
+	)
+	{
+		my_value.fetch_add(amount, std::memory_order_relaxed);
+	}
+
+
+	/**
+	 * Replaces the value
+	 *
+	 * @param[in] value
+	 *  The new value
+	 */
+	void
+	Set(
+		int64_t value
+	)
+	{
+		my_value.store(value, std::memory_order_relaxed);
+	}
+
+
+	/**
+	 * Obtains the current value
+	 *
+	 * @return
+	 *  The value
+	 */
+	int64_t
+	Value() const
+	{
+		return my_value.load(std::memory_order_relaxed);
+	}
+};
+
+
+/**
+ * A merged point-in-time copy of a histogram
+ */
+struct metric_histogram_snapshot
+{
+	/** Number of recorded values */
+	uint64_t  count = 0;
+
+	/** Sum of all recorded values */
+	uint64_t  sum = 0;
+
+	/** Largest recorded value */
+	uint64_t  max = 0;
+
+	/** Count per bucket; see MetricHistogram::BucketIndex */
+	std::vector<uint64_t>  buckets;
+
+
+	/**
+	 * Obtains the value at a percentile
+	 *
+	 * @param[in] percentile
+	 *  The percentile, from 0.0 to 100.0
+	 * @return
+	 *  The upper bound of the bucket holding the percentile, capped at the
+	 *  largest recorded value; 0 if nothing was recorded
+	 */
+	TZK_CORE_API
+	uint64_t
+	Percentile(
+		double percentile
+	) const;
+};
+
+
+/**
+ * Distribution of recorded values, in log-linear buckets
+ *
+ * Modelled on HdrHistogram: each power of two is divided into a fixed number
+ * of linear sub-buckets, giving a constant relative precision (12.5% with the
+ * default of 3 sub-bucket bits) across the entire uint64_t range, with no
+ * configuration of bounds and no allocation when recording.
+ *
+ * As with counters, buckets are sharded per thread; there are fewer shards
+ * than for counters given each holds every bucket.
+ *
+ * The unit of recorded values is at the callers discretion; include it in
+ * the name (e.g. '_us') and help text.
+ */
+class TZK_CORE_API MetricHistogram : public Metric
+{
+	TZK_NO_CLASS_ASSIGNMENT(MetricHistogram);
+	TZK_NO_CLASS_COPY(MetricHistogram);
+	TZK_NO_CLASS_MOVEASSIGNMENT(MetricHistogram);
+	TZK_NO_CLASS_MOVECOPY(MetricHistogram);
+
+private:
+
+	/** Single shard, aligned to a cache line to prevent false sharing */
+	struct alignas(64) shard
+	{
+		std::atomic<uint64_t>  count{0};
+		std::atomic<uint64_t>  sum{0};
+		std::atomic<uint64_t>  buckets[metrics_histogram_buckets];
+	};
+
+	/** The per-thread shards */
+	std::unique_ptr<shard[]>  my_shards;
+
+	/** Largest recorded value, across all shards */
+	std::atomic<uint64_t>  my_max;
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 *
+	 * @param[in] name
+	 *  The metric name, including the unit
+	 * @param[in] help
+	 *  The metric description
+	 */
+	MetricHistogram(
+		const char* name,
+		const char* help
+	);
+
+
+	/**
+	 * Obtains the bucket a value is recorded in
+	 *
+	 * @param[in] value
+	 *  The value
+	 * @return
+	 *  The bucket index, less than metrics_histogram_buckets
+	 */
+	static size_t
+	BucketIndex(
+		uint64_t value
+	);
+
+
+	/**
+	 * Obtains the largest value a bucket holds
+	 *
+	 * @param[in] index
+	 *  The bucket index
+	 * @return
+	 *  The inclusive upper bound
+	 */
+	static uint64_t
+	BucketUpperBound(
+		size_t index
+	);
+
+
+	/**
+	 * Records a value
+	 *
+	 * @param[in] value
+	 *  The value to record
+	 */
+	void
+	Record(
+		uint64_t value
+	);
+
+
+	/**
+	 * Merges all shards into a snapshot
+	 *
+	 * Concurrent records may be partially included; each field is itself
+	 * consistent, but count, sum and buckets are not read atomically together
+	 *
+	 * @param[out] snapshot
+	 *  The destination snapshot
+	 */
+	void
+	Snapshot(
+		metric_histogram_snapshot& snapshot
+	) const;
+};
+
+
+/**
+ * Registry of all application metrics, and their exposition
+ *
+ * Metrics are registered by name, returning a reference that remains valid
+ * for the lifetime of the service. Registration takes a lock, so is intended
+ * to be done once with the result retained (a member or function-local
+ * static); updating a metric is then lock-free, never touching the registry.
+ * Registering an existing name returns the existing metric, permitting
+ * multiple owners to share one.
+ *
+ * The registry can be written to a file periodically from a dedicated thread,
+ * in Prometheus text or JSON format, for external monitoring to collect from
+ * disk. The file is written to a temporary and then renamed over the target,
+ * so a reader never observes a partial write.
+ *
+ * This is created before and destroyed after all other services, so any may
+ * register metrics - the log service included.
+ */
+class TZK_CORE_API Metrics
+{
+	TZK_NO_CLASS_ASSIGNMENT(Metrics);
+	TZK_NO_CLASS_COPY(Metrics);
+	TZK_NO_CLASS_MOVEASSIGNMENT(Metrics);
+	TZK_NO_CLASS_MOVECOPY(Metrics);
+
+private:
+
+	/** Lock protecting the registries */
+	mutable std::mutex  my_lock;
+
+	/** All registered counters, keyed and so sorted by name */
+	std::map<std::string, std::unique_ptr<MetricCounter>>  my_counters;
+
+	/** All registered gauges, keyed and so sorted by name */
+	std::map<std::string, std::unique_ptr<MetricGauge>>  my_gauges;
+
+	/** All registered histograms, keyed and so sorted by name */
+	std::map<std::string, std::unique_ptr<MetricHistogram>>  my_histograms;
+
+	/** The periodic dump thread; not joinable if not running */
+	std::thread  my_dump_thread;
+
+	/** Lock protecting the dump settings and stop flag */
+	std::mutex  my_dump_lock;
+
+	/** Condition variable to wake the dump thread early, for stopping */
+	std::condition_variable  my_dump_cv;
+
+	/** Flag for the dump thread to stop */
+	bool  my_dump_stop;
+
+	/** Flag for the dump thread to write a final time when stopping */
+	bool  my_dump_final;
+
+	/** The file path the dump thread writes to */
+	std::string  my_dump_path;
+
+	/** The format the dump thread writes */
+	MetricsFormat  my_dump_format;
+
+	/** Seconds between each dump */
+	uint32_t  my_dump_interval;
+
+
+	/**
+	 * Dump thread entry point
+	 *
+	 * Writes the file every interval until stopped, and once more on stop
+	 */
+	void
+	DumpThread();
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 */
+	Metrics();
+
+
+	/**
+	 * Standard destructor
+	 *
+	 * Stops the dump thread if still running, without the final write; the
+	 * log service no longer exists at this point. Call StopDump beforehand
+	 */
+	~Metrics();
+
+
+	/**
+	 * Registers or obtains a counter
+	 *
+	 * @param[in] name
+	 *  The metric name; conventionally suffixed with '_total'
+	 * @param[in] help
+	 *  The metric description; ignored if already registered
+	 * @return
+	 *  Reference to the counter
+	 */
+	MetricCounter&
+	Counter(
+		const char* name,
+		const char* help
+	);
+
+
+	/**
+	 * Registers or obtains a gauge
+	 *
+	 * @param[in] name
+	 *  The metric name
+	 * @param[in] help
+	 *  The metric description; ignored if already registered
+	 * @return
+	 *  Reference to the gauge
+	 */
+	MetricGauge&
+	Gauge(
+		const char* name,
+		const char* help
+	);
+
+
+	/**
+	 * Registers or obtains a histogram
+	 *
+	 * @param[in] name
+	 *  The metric name, including the unit
+	 * @param[in] help
+	 *  The metric description; ignored if already registered
+	 * @return
+	 *  Reference to the histogram
+	 */
+	MetricHistogram&
+	Histogram(
+		const char* name,
+		const char* help
+	);
+
+
+	/**
+	 * Determines if the periodic dump is running
+	 *
+	 * @return
+	 *  Boolean state
+	 */
+	bool
+	IsDumping();
+
+
+	/**
+	 * Obtains the registered counters
+	 *
+	 * Pointers remain valid for the lifetime of the service
+	 *
+	 * @param[out] counters
+	 *  Replaced with all counters, sorted by name
+	 */
+	void
+	GetCounters(
+		std::vector<const MetricCounter*>& counters
+	) const;
+
+
+	/**
+	 * Obtains the registered gauges
+	 *
+	 * @param[out] gauges
+	 *  Replaced with all gauges, sorted by name
+	 */
+	void
+	GetGauges(
+		std::vector<const MetricGauge*>& gauges
+	) const;
+
+
+	/**
+	 * Obtains the registered histograms
+	 *
+	 * @param[out] histograms
+	 *  Replaced with all histograms, sorted by name
+	 */
+	void
+	GetHistograms(
+		std::vector<const MetricHistogram*>& histograms
+	) const;
+
+
+	/**
+	 * Generates the exposition of all metrics
+	 *
+	 * @param[in] format
+	 *  The output format
+	 * @return
+	 *  The formatted text; empty if the format is invalid
+	 */
+	std::string
+	Serialize(
+		MetricsFormat format
+	) const;
+
+
+	/**
+	 * Starts writing all metrics to a file periodically
+	 *
+	 * Replaces any existing dump settings, restarting the thread
+	 *
+	 * @param[in] path
+	 *  The file path to write to; environment variables are not expanded
+	 * @param[in] format
+	 *  The output format
+	 * @param[in] interval
+	 *  Seconds between each write; minimum of 1
+	 * @return
+	 *  - ErrNONE on success
+	 *  - EINVAL if the path is empty or format invalid
+	 */
+	int
+	StartDump(
+		const std::string& path,
+		MetricsFormat format,
+		uint32_t interval
+	);
+
+
+	/**
+	 * Stops the periodic dump, writing the file a final time
+	 *
+	 * No-op if not running
+	 */
+	void
+	StopDump();
+
+
+	/**
+	 * Writes all metrics to a file
+	 *
+	 * @param[in] path
+	 *  The file path to write to
+	 * @param[in] format
+	 *  The output format
+	 * @return
+	 *  - ErrNONE on success
+	 *  - ErrFAILED if the file could not be written
+	 */
+	int
+	Write(
+		const std::string& path,
+		MetricsFormat format
+	) const;
+};
+
+
+} // namespace core
+} // namespace trezanik
@@ -9,6 +9,7 @@
 #include "core/services/threading/Threading.h"
 #include "core/services/log/Log.h"
 #include "core/util/hash/compile_time_hash.h"
+#include "core/util/Profiler.h"
 #include "core/error.h"
 
 #include <cstring>
@@ -71,6 +72,9 @@ Threading::SetThreadName(
 	const char* name
 )
 {
+	// no-op beyond retaining the name if the profiler is not in use
+	Profiler::SetThreadName(GetCurrentThreadId(), name);
+
 #if TZK_IS_WIN32
 	// exact copy of: http://msdn.microsoft.com/en-us/library/xcb2z8hs.aspx
 
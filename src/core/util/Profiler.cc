@@ -0,0 +1,849 @@
+/**
+ * @file        src/core/util/Profiler.cc
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "core/definitions.h"
+
+#include "core/util/Profiler.h"
+#include "core/services/log/Log.h"
+#include "core/util/filesystem/file.h"
+#include "core/error.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+
+
+namespace trezanik {
+namespace core {
+
+
+static_assert((TZK_PROFILER_RING_SIZE & (TZK_PROFILER_RING_SIZE - 1)) == 0, "TZK_PROFILER_RING_SIZE must be a power of 2");
+
+
+/**
+ * Per-thread buffer of completed zones
+ *
+ * The owning thread is the only producer, advancing head; Frame() is the only
+ * consumer, advancing tail. Indices wrap naturally as unsigned integers.
+ */
+struct profile_ring
+{
+	/** Completed zone storage */
+	profile_zone  slots[TZK_PROFILER_RING_SIZE];
+
+	/** Next slot to be written; modified by the owning thread only */
+	std::atomic<uint32_t>  head{0};
+
+	/** Next slot to be read; modified by the consumer only */
+	std::atomic<uint32_t>  tail{0};
+
+	/** Current zone nesting depth; owning thread only */
+	uint16_t  depth = 0;
+
+	/** Lock protecting the thread identifiers, which can change at any time */
+	std::mutex  name_lock;
+
+	/** Native thread id, 0 if never named */
+	unsigned int  thread_id = 0;
+
+	/** Unique identifier of the owning thread */
+	uint32_t  track = 0;
+
+	/** Thread name for display */
+	std::string  name;
+};
+
+
+/** Epoch for all timestamps */
+static const std::chrono::steady_clock::time_point  profiler_epoch = std::chrono::steady_clock::now();
+
+/** Lock for the ring registry and frame history */
+static std::mutex  profiler_lock;
+
+/** All rings from threads that have recorded zones; kept beyond thread exit until drained */
+static std::vector<std::shared_ptr<profile_ring>>  profiler_rings;
+
+/** Captured frame history, oldest first */
+static std::deque<profile_frame>  profiler_frames;
+
+/** Number of the last captured frame */
+static uint64_t  profiler_frame_number = 0;
+
+/** End time of the last frame; the start time of the next */
+static uint64_t  profiler_last_frame_end = 0;
+
+/** Zones dropped due to full rings */
+static std::atomic<uint64_t>  profiler_dropped{0};
+
+/** Frame capture paused state */
+static std::atomic<bool>  profiler_paused{false};
+
+/** Number of thread identifiers issued; 0 is reserved for frames */
+static std::atomic<uint32_t>  profiler_track_count{0};
+
+/** Lock for all trace state */
+static std::mutex  trace_lock;
+
+/** Trace capture active state, readable without the lock */
+static std::atomic<bool>  trace_active{false};
+
+/** Trace output file; nullptr if no capture is active */
+static FILE*  trace_fp = nullptr;
+
+/** Flag indicating no event has yet been written, for separators */
+static bool  trace_first = true;
+
+/** Flag to disable the profiler when the capture stops */
+static bool  trace_disable_on_stop = false;
+
+/** Thread identifiers already named in the capture */
+static std::set<uint32_t>  trace_named_tracks;
+
+/** Size of the trace output buffer; events are only written in batches */
+static const size_t  trace_buffer_size = 64 * 1024;
+
+/** This threads ring; created on its first zone */
+static thread_local std::shared_ptr<profile_ring>  tls_ring;
+
+/** This threads id, retained if named before its ring exists */
+static thread_local unsigned int  tls_thread_id = 0;
+
+/** This threads name, retained if named before its ring exists */
+static thread_local std::string  tls_thread_name;
+
+/** This threads unique identifier; 0 until first needed */
+static thread_local uint32_t  tls_track = 0;
+
+
+std::atomic<bool>  Profiler::my_enabled{false};
+
+
+/**
+ * Obtains the unique identifier of the calling thread, assigning if needed
+ *
+ * @return
+ *  The thread identifier; never 0
+ */
+static uint32_t
+get_track()
+{
+	if ( tls_track == 0 )
+	{
+		tls_track = ++profiler_track_count;
+	}
+	return tls_track;
+}
+
+
+/**
+ * Creates and registers the ring for the calling thread
+ *
+ * @return
+ *  The new ring
+ */
+static profile_ring*
+create_ring()
+{
+	auto  ring = std::make_shared<profile_ring>();
+
+	ring->track = get_track();
+	ring->thread_id = tls_thread_id;
+	ring->name = tls_thread_name;
+
+	if ( ring->name.empty() )
+	{
+		ring->name = "Thread " + std::to_string(ring->track);
+	}
+
+	std::lock_guard<std::mutex>  lock(profiler_lock);
+
+	profiler_rings.push_back(ring);
+	tls_ring = ring;
+
+	return ring.get();
+}
+
+
+/**
+ * Appends a string to a JSON string value, escaping as required
+ *
+ * @param[in,out] out
+ *  The string to append to
+ * @param[in] str
+ *  The nul-terminated string to escape
+ */
+static void
+json_append_escaped(
+	std::string& out,
+	const char* str
+)
+{
+	for ( const char* c = str; *c != '\0'; c++ )
+	{
+		switch ( *c )
+		{
+		case '"':  out += "\\\""; break;
+		case '\\': out += "\\\\"; break;
+		case '\n': out += "\\n"; break;
+		case '\r': out += "\\r"; break;
+		case '\t': out += "\\t"; break;
+		default:
+			if ( static_cast<unsigned char>(*c) < 0x20 )
+			{
+				char  buf[8];
+				std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned int>(*c));
+				out += buf;
+			}
+			else
+			{
+				out += *c;
+			}
+			break;
+		}
+	}
+}
+
+
+/**
+ * Starts a trace event, up to and including its timestamp
+ *
+ * The caller appends any further fields, and the closing brace.
+ *
+ * @param[in] phase
+ *  The trace event phase (type)
+ * @param[in] category
+ *  The event category
+ * @param[in] name
+ *  The event name
+ * @param[in] track
+ *  The thread identifier the event belongs to
+ * @param[in] ts
+ *  The event time, in profiler nanoseconds
+ * @return
+ *  The partial event
+ */
+static std::string
+trace_event(
+	const char* phase,
+	const char* category,
+	const char* name,
+	uint32_t track,
+	uint64_t ts
+)
+{
+	char         buf[64];
+	std::string  evt = "{\"ph\":\"";
+
+	evt += phase;
+	evt += "\",\"cat\":\"";
+	json_append_escaped(evt, category);
+	evt += "\",\"name\":\"";
+	json_append_escaped(evt, name);
+	// timestamps are microseconds; retain the nanosecond precision as fraction
+	std::snprintf(buf, sizeof(buf), "\",\"pid\":1,\"tid\":%u,\"ts\":%" PRIu64 ".%03u",
+		track, ts / 1000, static_cast<unsigned int>(ts % 1000)
+	);
+	evt += buf;
+
+	return evt;
+}
+
+
+/**
+ * Appends the detail argument to an event, if not empty
+ *
+ * @param[in,out] evt
+ *  The partial event
+ * @param[in] detail
+ *  The descriptive text
+ */
+static void
+trace_event_detail(
+	std::string& evt,
+	const std::string& detail
+)
+{
+	if ( detail.empty() )
+		return;
+
+	evt += ",\"args\":{\"detail\":\"";
+	json_append_escaped(evt, detail.c_str());
+	evt += "\"}";
+}
+
+
+/**
+ * Writes a complete event to the trace file
+ *
+ * trace_lock must be held by the caller
+ *
+ * @param[in] evt
+ *  The complete event
+ */
+static void
+trace_write(
+	const std::string& evt
+)
+{
+	if ( trace_fp == nullptr )
+		return;
+
+	if ( !trace_first )
+	{
+		std::fwrite(",\n", 1, 2, trace_fp);
+	}
+	trace_first = false;
+
+	std::fwrite(evt.data(), 1, evt.size(), trace_fp);
+}
+
+
+/**
+ * Writes the metadata naming a thread, if not already done in this capture
+ *
+ * trace_lock must be held by the caller
+ *
+ * @param[in] track
+ *  The thread identifier
+ * @param[in] name
+ *  The thread name
+ * @param[in] thread_id
+ *  The native thread id, appended to the name if not 0
+ */
+static void
+trace_name_track(
+	uint32_t track,
+	const std::string& name,
+	unsigned int thread_id
+)
+{
+	if ( !trace_named_tracks.insert(track).second )
+		return;
+
+	std::string  evt = "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":";
+
+	evt += std::to_string(track);
+	evt += ",\"args\":{\"name\":\"";
+	json_append_escaped(evt, name.c_str());
+	if ( thread_id != 0 )
+	{
+		evt += " (" + std::to_string(thread_id) + ")";
+	}
+	evt += "\"}}";
+
+	trace_write(evt);
+}
+
+
+/**
+ * Writes a frame and all of its zones to the trace file
+ *
+ * @param[in] frame
+ *  The drained frame
+ */
+static void
+trace_write_frame(
+	const profile_frame& frame
+)
+{
+	char  buf[64];
+	std::lock_guard<std::mutex>  lock(trace_lock);
+
+	if ( trace_fp == nullptr )
+		return;
+
+	// frames on their own track, so they need not nest with any thread zones
+	trace_name_track(0, "Frames", 0);
+
+	std::string  evt = trace_event("X", "frame", "Frame", 0, frame.start);
+	uint64_t     dur = frame.end - frame.start;
+
+	std::snprintf(buf, sizeof(buf), ",\"dur\":%" PRIu64 ".%03u}", dur / 1000, static_cast<unsigned int>(dur % 1000));
+	evt += buf;
+	trace_write(evt);
+
+	for ( auto& t : frame.threads )
+	{
+		trace_name_track(t.track, t.name, t.thread_id);
+
+		for ( auto& z : t.zones )
+		{
+			evt = trace_event("X", "zone", z.name, t.track, z.start);
+			dur = z.end - z.start;
+			std::snprintf(buf, sizeof(buf), ",\"dur\":%" PRIu64 ".%03u}", dur / 1000, static_cast<unsigned int>(dur % 1000));
+			evt += buf;
+			trace_write(evt);
+		}
+	}
+}
+
+
+uint16_t
+Profiler::BeginZone()
+{
+	profile_ring*  ring = tls_ring.get();
+
+	if ( TZK_UNLIKELY(ring == nullptr) )
+	{
+		ring = create_ring();
+	}
+
+	return ring->depth++;
+}
+
+
+void
+Profiler::Clear()
+{
+	std::lock_guard<std::mutex>  lock(profiler_lock);
+
+	profiler_frames.clear();
+}
+
+
+void
+Profiler::EndZone(
+	const char* name,
+	uint64_t start,
+	uint16_t depth
+)
+{
+	uint64_t       end = Now();
+	profile_ring*  ring = tls_ring.get();
+
+	if ( ring == nullptr )
+	{
+		// BeginZone always precedes; only reachable if misused directly
+		return;
+	}
+
+	ring->depth = depth;
+
+	uint32_t  head = ring->head.load(std::memory_order_relaxed);
+
+	if ( head - ring->tail.load(std::memory_order_acquire) >= TZK_PROFILER_RING_SIZE )
+	{
+		profiler_dropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	profile_zone&  zone = ring->slots[head & (TZK_PROFILER_RING_SIZE - 1)];
+
+	zone.name = name;
+	zone.start = start;
+	zone.end = end;
+	zone.depth = depth;
+
+	ring->head.store(head + 1, std::memory_order_release);
+}
+
+
+void
+Profiler::Frame()
+{
+	if ( !IsEnabled() )
+		return;
+
+	uint64_t       now = Now();
+	bool           paused = profiler_paused.load(std::memory_order_relaxed);
+	bool           tracing = trace_active.load(std::memory_order_relaxed);
+	profile_frame  frame;
+
+	std::lock_guard<std::mutex>  lock(profiler_lock);
+
+	for ( auto iter = profiler_rings.begin(); iter != profiler_rings.end(); )
+	{
+		profile_ring*  ring = iter->get();
+		// sole remaining reference is ours; thread has exited, no more writes
+		bool      orphaned = iter->use_count() == 1;
+		uint32_t  tail = ring->tail.load(std::memory_order_relaxed);
+		uint32_t  head = ring->head.load(std::memory_order_acquire);
+
+		if ( head != tail && (!paused || tracing) )
+		{
+			profile_thread  pt;
+
+			pt.track = ring->track;
+			{
+				std::lock_guard<std::mutex>  name_lock(ring->name_lock);
+				pt.thread_id = ring->thread_id;
+				pt.name = ring->name;
+			}
+
+			pt.zones.reserve(head - tail);
+			for ( uint32_t i = tail; i != head; i++ )
+			{
+				pt.zones.push_back(ring->slots[i & (TZK_PROFILER_RING_SIZE - 1)]);
+			}
+
+			frame.threads.push_back(std::move(pt));
+		}
+
+		ring->tail.store(head, std::memory_order_release);
+
+		if ( orphaned )
+		{
+			iter = profiler_rings.erase(iter);
+			continue;
+		}
+
+		iter++;
+	}
+
+	frame.start = profiler_last_frame_end;
+	frame.end = now;
+	profiler_last_frame_end = now;
+
+	// the capture is unaffected by pausing the history
+	if ( tracing )
+	{
+		trace_write_frame(frame);
+	}
+
+	if ( !paused )
+	{
+		frame.number = ++profiler_frame_number;
+
+		profiler_frames.push_back(std::move(frame));
+
+		while ( profiler_frames.size() > TZK_PROFILER_FRAME_HISTORY )
+		{
+			profiler_frames.pop_front();
+		}
+	}
+}
+
+
+uint64_t
+Profiler::GetDroppedCount()
+{
+	return profiler_dropped.load(std::memory_order_relaxed);
+}
+
+
+bool
+Profiler::GetFrame(
+	size_t index,
+	profile_frame& frame
+)
+{
+	std::lock_guard<std::mutex>  lock(profiler_lock);
+
+	if ( index >= profiler_frames.size() )
+		return false;
+
+	frame = profiler_frames[index];
+	return true;
+}
+
+
+size_t
+Profiler::GetFrameCount()
+{
+	std::lock_guard<std::mutex>  lock(profiler_lock);
+
+	return profiler_frames.size();
+}
+
+
+void
+Profiler::GetFrameDurations(
+	std::vector<float>& durations
+)
+{
+	std::lock_guard<std::mutex>  lock(profiler_lock);
+
+	durations.clear();
+	durations.reserve(profiler_frames.size());
+
+	for ( auto& f : profiler_frames )
+	{
+		durations.push_back(static_cast<float>(f.end - f.start) / 1000000.f);
+	}
+}
+
+
+void
+Profiler::GetZoneStats(
+	size_t frame_count,
+	std::vector<profile_zone_stats>& stats
+)
+{
+	// keyed by content; identical literals in separate modules differ in address
+	std::map<std::string, profile_zone_stats>  agg;
+
+	{
+		std::lock_guard<std::mutex>  lock(profiler_lock);
+
+		size_t  first = 0;
+
+		if ( frame_count != 0 && frame_count < profiler_frames.size() )
+		{
+			first = profiler_frames.size() - frame_count;
+		}
+
+		for ( size_t i = first; i < profiler_frames.size(); i++ )
+		{
+			for ( auto& t : profiler_frames[i].threads )
+			{
+				for ( auto& z : t.zones )
+				{
+					auto&     s = agg[z.name];
+					uint64_t  duration = z.end - z.start;
+
+					s.name = z.name;
+					s.calls++;
+					s.total += duration;
+					s.max = std::max(s.max, duration);
+				}
+			}
+		}
+	}
+
+	stats.clear();
+	stats.reserve(agg.size());
+
+	for ( auto& a : agg )
+	{
+		stats.push_back(a.second);
+	}
+
+	std::sort(stats.begin(), stats.end(), [](const profile_zone_stats& a, const profile_zone_stats& b) {
+		return a.total > b.total;
+	});
+}
+
+
+bool
+Profiler::IsPaused()
+{
+	return profiler_paused.load(std::memory_order_relaxed);
+}
+
+
+bool
+Profiler::IsTracing()
+{
+	return trace_active.load(std::memory_order_relaxed);
+}
+
+
+uint64_t
+Profiler::Now()
+{
+	return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now() - profiler_epoch
+	).count());
+}
+
+
+void
+Profiler::SetEnabled(
+	bool enabled
+)
+{
+	if ( enabled && !IsEnabled() )
+	{
+		std::lock_guard<std::mutex>  lock(profiler_lock);
+
+		profiler_dropped = 0;
+		profiler_last_frame_end = Now();
+	}
+
+	my_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+
+void
+Profiler::SetPaused(
+	bool paused
+)
+{
+	profiler_paused.store(paused, std::memory_order_relaxed);
+}
+
+
+void
+Profiler::SetThreadName(
+	unsigned int thread_id,
+	const char* name
+)
+{
+	tls_thread_id = thread_id;
+	tls_thread_name = name;
+
+	if ( tls_ring != nullptr )
+	{
+		std::lock_guard<std::mutex>  lock(tls_ring->name_lock);
+		tls_ring->thread_id = thread_id;
+		tls_ring->name = name;
+	}
+}
+
+
+int
+Profiler::StartTrace(
+	const char* path
+)
+{
+	bool  enable = false;
+
+	{
+		std::lock_guard<std::mutex>  lock(trace_lock);
+
+		if ( trace_fp != nullptr )
+		{
+			TZK_LOG_FORMAT(LogLevel::Warning, "Trace capture already active; ignoring request for '%s'", path);
+			return EALREADY;
+		}
+
+		if ( (trace_fp = aux::file::open(path, "w")) == nullptr )
+		{
+			// already logged
+			return ErrFAILED;
+		}
+
+		std::setvbuf(trace_fp, nullptr, _IOFBF, trace_buffer_size);
+
+		const char  header[] = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+		std::fwrite(header, 1, sizeof(header) - 1, trace_fp);
+
+		trace_first = true;
+		trace_named_tracks.clear();
+		trace_disable_on_stop = !IsEnabled();
+		enable = trace_disable_on_stop;
+		trace_active = true;
+	}
+
+	// outside the trace lock; Frame acquires in the opposite order
+	if ( enable )
+	{
+		SetEnabled(true);
+	}
+
+	TZK_LOG_FORMAT(LogLevel::Info, "Trace capture started: %s", path);
+
+	return ErrNONE;
+}
+
+
+void
+Profiler::StopTrace()
+{
+	bool  disable = false;
+
+	{
+		std::lock_guard<std::mutex>  lock(trace_lock);
+
+		if ( trace_fp == nullptr )
+			return;
+
+		trace_active = false;
+
+		const char  footer[] = "\n]}\n";
+		std::fwrite(footer, 1, sizeof(footer) - 1, trace_fp);
+		aux::file::close(trace_fp);
+		trace_fp = nullptr;
+
+		disable = trace_disable_on_stop;
+	}
+
+	if ( disable )
+	{
+		SetEnabled(false);
+	}
+
+	TZK_LOG(LogLevel::Info, "Trace capture stopped");
+}
+
+
+void
+Profiler::TraceAsyncBegin(
+	const char* category,
+	const char* name,
+	const std::string& id,
+	const std::string& detail
+)
+{
+	if ( !IsTracing() )
+		return;
+
+	std::string  evt = trace_event("b", category, name, get_track(), Now());
+
+	evt += ",\"id\":\"";
+	json_append_escaped(evt, id.c_str());
+	evt += "\"";
+	trace_event_detail(evt, detail);
+	evt += "}";
+
+	std::lock_guard<std::mutex>  lock(trace_lock);
+	trace_write(evt);
+}
+
+
+void
+Profiler::TraceAsyncEnd(
+	const char* category,
+	const char* name,
+	const std::string& id,
+	const std::string& detail
+)
+{
+	if ( !IsTracing() )
+		return;
+
+	std::string  evt = trace_event("e", category, name, get_track(), Now());
+
+	evt += ",\"id\":\"";
+	json_append_escaped(evt, id.c_str());
+	evt += "\"";
+	trace_event_detail(evt, detail);
+	evt += "}";
+
+	std::lock_guard<std::mutex>  lock(trace_lock);
+	trace_write(evt);
+}
+
+
+void
+Profiler::TraceSpan(
+	const char* category,
+	const char* name,
+	uint64_t start,
+	const std::string& detail
+)
+{
+	if ( !IsTracing() )
+		return;
+
+	char         buf[64];
+	uint64_t     end = Now();
+	uint64_t     dur = end > start ? end - start : 0;
+	uint32_t     track = get_track();
+	std::string  evt = trace_event("X", category, name, track, start);
+
+	std::snprintf(buf, sizeof(buf), ",\"dur\":%" PRIu64 ".%03u", dur / 1000, static_cast<unsigned int>(dur % 1000));
+	evt += buf;
+	trace_event_detail(evt, detail);
+	evt += "}";
+
+	std::string  thread_name = tls_thread_name.empty() ? "Thread " + std::to_string(track) : tls_thread_name;
+
+	std::lock_guard<std::mutex>  lock(trace_lock);
+	trace_name_track(track, thread_name, tls_thread_id);
+	trace_write(evt);
+}
+
+
+} // namespace core
+} // namespace trezanik
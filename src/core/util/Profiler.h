@@ -0,0 +1,524 @@
+#pragma once
+
+/**
+ * @file        src/core/util/Profiler.h
+ * @brief       Lightweight scoped-zone profiler with per-thread buffers
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "core/definitions.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+
+namespace trezanik {
+namespace core {
+
+
+/**
+ * A single completed zone
+ *
+ * Timestamps are nanoseconds from the profiler epoch (first use), from a
+ * monotonic clock.
+ */
+struct profile_zone
+{
+	/** Zone name; must be a string literal or otherwise live for the program */
+	const char*  name;
+
+	/** Time the zone was entered */
+	uint64_t  start;
+
+	/** Time the zone was left */
+	uint64_t  end;
+
+	/** Nesting depth within the thread; 0 for outermost */
+	uint16_t  depth;
+};
+
+
+/**
+ * All zones completed by one thread within a frame
+ */
+struct profile_thread
+{
+	/** The native thread id, or 0 if the thread was never named */
+	unsigned int  thread_id = 0;
+
+	/** Unique identifier for the thread, stable for its lifetime */
+	uint32_t  track = 0;
+
+	/** The thread name, as supplied to SetThreadName */
+	std::string  name;
+
+	/** Completed zones, in order of completion */
+	std::vector<profile_zone>  zones;
+};
+
+
+/**
+ * A captured frame; all zones from all threads completed in its duration
+ *
+ * Zones from long-running threads (tasks) can begin long before the frame
+ * itself, and are attributed to the frame in which they finish.
+ */
+struct profile_frame
+{
+	/** Sequential frame number, incrementing for each captured frame */
+	uint64_t  number = 0;
+
+	/** Frame start time; the end of the prior frame */
+	uint64_t  start = 0;
+
+	/** Frame end time */
+	uint64_t  end = 0;
+
+	/** Per-thread zones; threads with no zones in the frame are omitted */
+	std::vector<profile_thread>  threads;
+};
+
+
+/**
+ * Aggregated statistics for all zones sharing a name
+ */
+struct profile_zone_stats
+{
+	/** Zone name */
+	const char*  name = nullptr;
+
+	/** Number of times the zone completed */
+	uint32_t  calls = 0;
+
+	/** Sum of all durations, in nanoseconds */
+	uint64_t  total = 0;
+
+	/** Longest single duration, in nanoseconds */
+	uint64_t  max = 0;
+};
+
+
+/**
+ * Scoped-zone profiler
+ *
+ * Zones are recorded with TZK_PROFILE_ZONE; when the profiler is disabled this
+ * costs a single relaxed atomic load, so instrumentation is left present in
+ * release builds and enabled at runtime when wanted.
+ *
+ * When enabled, each thread writes completed zones into its own fixed-size
+ * single-producer, single-consumer ring buffer - no locks or allocations on
+ * the recording path. Should a ring fill before it is drained, further zones
+ * are dropped and counted rather than blocking the thread.
+ *
+ * The engine calls Frame() once per rendered frame, which drains every ring
+ * and appends a profile_frame to the history, retaining the most recent
+ * TZK_PROFILER_FRAME_HISTORY frames.
+ *
+ * A trace capture can additionally be started, streaming every drained zone
+ * and frame to a file in the Chrome trace-event JSON format, for offline
+ * analysis in Perfetto or chrome://tracing. Memory use is unaffected by the
+ * capture length; events are written as each frame is drained. Explicit
+ * spans carrying runtime detail (task lifetimes, spawned processes) can be
+ * written directly with the Trace* functions, which are no-ops while no
+ * capture is active.
+ *
+ * All members are static, so the single state is shared between modules
+ * without relying on per-module singleton instances.
+ */
+class TZK_CORE_API Profiler
+{
+	TZK_NO_CLASS_ASSIGNMENT(Profiler);
+	TZK_NO_CLASS_COPY(Profiler);
+	TZK_NO_CLASS_MOVEASSIGNMENT(Profiler);
+	TZK_NO_CLASS_MOVECOPY(Profiler);
+
+private:
+
+	/** Static-only; never instantiated */
+	Profiler() = delete;
+
+	/** Runtime toggle; checked on every zone entry */
+	static std::atomic<bool>  my_enabled;
+
+protected:
+public:
+
+	/**
+	 * Enters a zone on the calling thread
+	 *
+	 * Use TZK_PROFILE_ZONE rather than calling directly
+	 *
+	 * @return
+	 *  The nesting depth of the new zone
+	 */
+	static uint16_t
+	BeginZone();
+
+
+	/**
+	 * Removes all captured frames
+	 */
+	static void
+	Clear();
+
+
+	/**
+	 * Leaves a zone on the calling thread, recording it
+	 *
+	 * Use TZK_PROFILE_ZONE rather than calling directly
+	 *
+	 * @param[in] name
+	 *  The zone name
+	 * @param[in] start
+	 *  The zone start time, as returned from Now() on entry
+	 * @param[in] depth
+	 *  The depth returned from BeginZone
+	 */
+	static void
+	EndZone(
+		const char* name,
+		uint64_t start,
+		uint16_t depth
+	);
+
+
+	/**
+	 * Marks the end of a frame, draining all thread buffers into the history
+	 *
+	 * Must only be called from a single thread; the engine does so at the
+	 * start of each rendered frame. Performs no work if disabled.
+	 */
+	static void
+	Frame();
+
+
+	/**
+	 * Obtains the number of zones dropped due to full buffers
+	 *
+	 * @return
+	 *  The count since profiling was last enabled
+	 */
+	static uint64_t
+	GetDroppedCount();
+
+
+	/**
+	 * Copies a captured frame
+	 *
+	 * @param[in] index
+	 *  The frame index; 0 is the oldest retained
+	 * @param[out] frame
+	 *  The destination frame
+	 * @return
+	 *  true if the index was valid and frame populated, otherwise false
+	 */
+	static bool
+	GetFrame(
+		size_t index,
+		profile_frame& frame
+	);
+
+
+	/**
+	 * Obtains the number of retained frames
+	 *
+	 * @return
+	 *  The frame count, up to TZK_PROFILER_FRAME_HISTORY
+	 */
+	static size_t
+	GetFrameCount();
+
+
+	/**
+	 * Obtains the duration of each retained frame
+	 *
+	 * @param[out] durations
+	 *  Replaced with the frame durations in milliseconds, oldest first
+	 */
+	static void
+	GetFrameDurations(
+		std::vector<float>& durations
+	);
+
+
+	/**
+	 * Aggregates zone statistics across the most recent frames
+	 *
+	 * @param[in] frame_count
+	 *  The number of frames to include, from the newest; 0 for all retained
+	 * @param[out] stats
+	 *  Replaced with one entry per distinct zone name, sorted by descending
+	 *  total duration
+	 */
+	static void
+	GetZoneStats(
+		size_t frame_count,
+		std::vector<profile_zone_stats>& stats
+	);
+
+
+	/**
+	 * Determines if the profiler is enabled
+	 *
+	 * @return
+	 *  Boolean state
+	 */
+	static bool
+	IsEnabled()
+	{
+		return my_enabled.load(std::memory_order_relaxed);
+	}
+
+
+	/**
+	 * Determines if frame capture is paused
+	 *
+	 * @return
+	 *  Boolean state
+	 */
+	static bool
+	IsPaused();
+
+
+	/**
+	 * Determines if a trace capture is active
+	 *
+	 * @return
+	 *  Boolean state
+	 */
+	static bool
+	IsTracing();
+
+
+	/**
+	 * Obtains the current profiler time
+	 *
+	 * @return
+	 *  Nanoseconds since the profiler epoch
+	 */
+	static uint64_t
+	Now();
+
+
+	/**
+	 * Enables or disables zone recording
+	 *
+	 * Enabling resets the dropped count; any frames already captured are
+	 * retained until Clear is called.
+	 *
+	 * @param[in] enabled
+	 *  The new state
+	 */
+	static void
+	SetEnabled(
+		bool enabled
+	);
+
+
+	/**
+	 * Pauses or resumes frame capture
+	 *
+	 * While paused, buffers continue to be drained but the results discarded,
+	 * so the history can be examined without it scrolling away.
+	 *
+	 * @param[in] paused
+	 *  The new state
+	 */
+	static void
+	SetPaused(
+		bool paused
+	);
+
+
+	/**
+	 * Names the calling thread for display
+	 *
+	 * Called automatically by the Threading service SetThreadName
+	 *
+	 * @param[in] thread_id
+	 *  The native thread id
+	 * @param[in] name
+	 *  The thread name
+	 */
+	static void
+	SetThreadName(
+		unsigned int thread_id,
+		const char* name
+	);
+
+
+	/**
+	 * Starts a trace capture to the specified file
+	 *
+	 * The profiler is enabled for the duration if it was not already, and
+	 * returned to its prior state when the capture stops. Any existing file is
+	 * overwritten.
+	 *
+	 * @param[in] path
+	 *  The path of the JSON file to write
+	 * @return
+	 *  - ErrNONE on success
+	 *  - EALREADY if a capture is already active
+	 *  - ErrFAILED if the file could not be opened
+	 */
+	static int
+	StartTrace(
+		const char* path
+	);
+
+
+	/**
+	 * Stops the active trace capture, finalizing the file
+	 *
+	 * Zones not yet drained by a frame are not included. No-op if no capture
+	 * is active.
+	 */
+	static void
+	StopTrace();
+
+
+	/**
+	 * Writes the start of an asynchronous span to the trace
+	 *
+	 * Asynchronous spans can begin and end on different threads; a begin and
+	 * end are paired by their category, name and id.
+	 *
+	 * @param[in] category
+	 *  The event category
+	 * @param[in] name
+	 *  The span name
+	 * @param[in] id
+	 *  Identifier unique to this span instance
+	 * @param[in] detail
+	 *  Optional descriptive text, stored as the 'detail' argument
+	 */
+	static void
+	TraceAsyncBegin(
+		const char* category,
+		const char* name,
+		const std::string& id,
+		const std::string& detail = ""
+	);
+
+
+	/**
+	 * Writes the end of an asynchronous span to the trace
+	 *
+	 * @param[in] category
+	 *  The event category, as supplied to TraceAsyncBegin
+	 * @param[in] name
+	 *  The span name, as supplied to TraceAsyncBegin
+	 * @param[in] id
+	 *  The span identifier, as supplied to TraceAsyncBegin
+	 * @param[in] detail
+	 *  Optional descriptive text, stored as the 'detail' argument
+	 */
+	static void
+	TraceAsyncEnd(
+		const char* category,
+		const char* name,
+		const std::string& id,
+		const std::string& detail = ""
+	);
+
+
+	/**
+	 * Writes a completed span on the calling thread to the trace
+	 *
+	 * For spans that need runtime detail a zone cannot carry; ends now.
+	 *
+	 * @param[in] category
+	 *  The event category
+	 * @param[in] name
+	 *  The span name
+	 * @param[in] start
+	 *  The span start time, as returned from Now()
+	 * @param[in] detail
+	 *  Optional descriptive text, stored as the 'detail' argument
+	 */
+	static void
+	TraceSpan(
+		const char* category,
+		const char* name,
+		uint64_t start,
+		const std::string& detail = ""
+	);
+};
+
+
+/**
+ * RAII zone recorder, created by TZK_PROFILE_ZONE
+ */
+class ProfileZone
+{
+	TZK_NO_CLASS_ASSIGNMENT(ProfileZone);
+	TZK_NO_CLASS_COPY(ProfileZone);
+	TZK_NO_CLASS_MOVEASSIGNMENT(ProfileZone);
+	TZK_NO_CLASS_MOVECOPY(ProfileZone);
+
+private:
+
+	/** Zone name; nullptr if the profiler was disabled on entry */
+	const char*  my_name;
+
+	/** Zone entry time */
+	uint64_t  my_start;
+
+	/** Zone nesting depth */
+	uint16_t  my_depth;
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 *
+	 * @param[in] name
+	 *  The zone name; must live for the duration of the program
+	 */
+	ProfileZone(
+		const char* name
+	)
+	: my_name(nullptr)
+	, my_start(0)
+	, my_depth(0)
+	{
+		if ( TZK_UNLIKELY(Profiler::IsEnabled()) )
+		{
+			my_name = name;
+			my_depth = Profiler::BeginZone();
+			my_start = Profiler::Now();
+		}
+	}
+
+
+	/**
+	 * Standard destructor
+	 */
+	~ProfileZone()
+	{
+		if ( TZK_UNLIKELY(my_name != nullptr) )
+		{
+			Profiler::EndZone(my_name, my_start, my_depth);
+		}
+	}
+};
+
+
+} // namespace core
+} // namespace trezanik
+
+
+#if TZK_PROFILER
+#	define TZK_PROFILE_CONCAT_IMPL(a, b)  a##b
+#	define TZK_PROFILE_CONCAT(a, b)       TZK_PROFILE_CONCAT_IMPL(a, b)
+	/// Records the enclosing scope as a zone with the supplied name
+#	define TZK_PROFILE_ZONE(name)         trezanik::core::ProfileZone  TZK_PROFILE_CONCAT(tzk_profile_zone_, __LINE__)(name)
+	/// Marks a frame boundary; call once per frame from one thread only
+#	define TZK_PROFILE_FRAME()            trezanik::core::Profiler::Frame()
+#else
+#	define TZK_PROFILE_ZONE(name)
+#	define TZK_PROFILE_FRAME()
+#endif
@@ -24,6 +24,7 @@
 #		pragma comment ( lib, "Shlwapi.lib" )
 #	endif
 #else
+#	include <sys/mman.h>
 #	include <sys/stat.h>
 #	include <fcntl.h>
 #	include <unistd.h>
@@ -300,6 +301,120 @@ flush(
 }
 
 
+int
+map_readonly(
+	const char* path,
+	mapped_file& mapping
+)
+{
+	if ( path == nullptr )
+	{
+		return EINVAL;
+	}
+
+#if TZK_IS_WIN32
+	int      rc;
+	wchar_t  wpath[MAX_PATH];
+
+	if ( (rc = utf8_to_utf16(path, wpath, _countof(wpath))) != ErrNONE )
+	{
+		// error already reported
+		return rc;
+	}
+
+	convert_wide_path_chars(wpath);
+
+	HANDLE  file = ::CreateFile(wpath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if ( file == INVALID_HANDLE_VALUE )
+	{
+		DWORD  err = ::GetLastError();
+		// absence is normal for caches, so no logging at error level
+		TZK_LOG_FORMAT(LogLevel::Debug,
+			"CreateFile() failed for '%ws'; Win32 error=%u (%s)",
+			wpath, err, error_code_as_string(err).c_str()
+		);
+		return err == ERROR_FILE_NOT_FOUND || err == ERROR_PATH_NOT_FOUND ? ENOENT : ErrSYSAPI;
+	}
+
+	LARGE_INTEGER  fsize;
+
+	if ( !::GetFileSizeEx(file, &fsize) || fsize.QuadPart == 0 )
+	{
+		::CloseHandle(file);
+		return ErrDATA;
+	}
+
+	HANDLE  map = ::CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+	if ( map == nullptr )
+	{
+		DWORD  err = ::GetLastError();
+		TZK_LOG_FORMAT(LogLevel::Error,
+			"CreateFileMapping() failed for '%ws'; Win32 error=%u (%s)",
+			wpath, err, error_code_as_string(err).c_str()
+		);
+		::CloseHandle(file);
+		return ErrSYSAPI;
+	}
+
+	void*  view = ::MapViewOfFile(map, FILE_MAP_READ, 0, 0, 0);
+
+	if ( view == nullptr )
+	{
+		DWORD  err = ::GetLastError();
+		TZK_LOG_FORMAT(LogLevel::Error,
+			"MapViewOfFile() failed for '%ws'; Win32 error=%u (%s)",
+			wpath, err, error_code_as_string(err).c_str()
+		);
+		::CloseHandle(map);
+		::CloseHandle(file);
+		return ErrSYSAPI;
+	}
+
+	mapping.data = static_cast<const unsigned char*>(view);
+	mapping.size = static_cast<size_t>(fsize.QuadPart);
+	mapping.file_handle = file;
+	mapping.map_handle = map;
+#else
+	int  fd = ::open(path, O_RDONLY);
+
+	if ( fd == -1 )
+	{
+		int  err = errno;
+		// absence is normal for caches, so no logging at error level
+		TZK_LOG_FORMAT(LogLevel::Debug, "open() failed for '%s'; errno=%d", path, err);
+		return err;
+	}
+
+	struct stat  st;
+
+	if ( ::fstat(fd, &st) == -1 || st.st_size == 0 )
+	{
+		::close(fd);
+		return ErrDATA;
+	}
+
+	void*  addr = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+	// mapping remains valid after the descriptor is closed
+	::close(fd);
+
+	if ( addr == MAP_FAILED )
+	{
+		int  err = errno;
+		TZK_LOG_FORMAT(LogLevel::Error, "mmap() failed for '%s'; errno=%d", path, err);
+		return err;
+	}
+
+	mapping.data = static_cast<const unsigned char*>(addr);
+	mapping.size = static_cast<size_t>(st.st_size);
+#endif // TZK_IS_WIN32
+
+	return ErrNONE;
+}
+
+
 FILE*
 open(
 	const char* path,
@@ -557,6 +672,55 @@ open(
 }
 
 
+FILE*
+open_memory(
+	const void* data,
+	size_t size
+)
+{
+	if ( data == nullptr || size == 0 )
+	{
+		return nullptr;
+	}
+
+#if TZK_IS_WIN32
+	FILE*  retval = nullptr;
+
+	// tmpfile_s files are removed automatically when closed
+	if ( tmpfile_s(&retval) != 0 || retval == nullptr )
+	{
+		TZK_LOG_FORMAT(LogLevel::Error, "Failed to create temporary file; errno=%d", errno);
+		return nullptr;
+	}
+	if ( fwrite(data, 1, size, retval) != size )
+	{
+		TZK_LOG_FORMAT(LogLevel::Error, "Failed to write %zu bytes to temporary file", size);
+		fclose(retval);
+		return nullptr;
+	}
+	rewind(retval);
+#else
+	FILE*  retval = fmemopen(const_cast<void*>(data), size, "rb");
+
+	if ( retval == nullptr )
+	{
+		TZK_LOG_FORMAT(LogLevel::Error,
+			"Failed to open memory stream of %zu bytes; errno=%d",
+			size, errno
+		);
+		return nullptr;
+	}
+#endif // TZK_IS_WIN32
+
+	TZK_LOG_FORMAT(LogLevel::Debug,
+		"Opened memory stream " TZK_PRIxPTR " over %zu bytes",
+		retval, size
+	);
+
+	return retval;
+}
+
+
 std::fstream
 open_stream(
 	const char* path
@@ -728,6 +892,28 @@ size(
 }
 
 
+void
+unmap(
+	mapped_file& mapping
+)
+{
+	if ( mapping.data == nullptr )
+	{
+		return;
+	}
+
+#if TZK_IS_WIN32
+	::UnmapViewOfFile(mapping.data);
+	::CloseHandle(mapping.map_handle);
+	::CloseHandle(mapping.file_handle);
+#else
+	::munmap(const_cast<unsigned char*>(mapping.data), mapping.size);
+#endif
+
+	mapping = mapped_file();
+}
+
+
 size_t
 write(
 	FILE* fp,
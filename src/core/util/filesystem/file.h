@@ -71,6 +71,29 @@ enum OpenFlag_
 };
 
 
+/**
+ * A read-only memory mapping of an entire file
+ *
+ * Populated by map_readonly, and must be released via unmap
+ */
+struct mapped_file
+{
+	/// Start of the mapped file content; nullptr if not mapped
+	const unsigned char*  data = nullptr;
+
+	/// Size of the mapping, which is the file size
+	size_t  size = 0;
+
+#if TZK_IS_WIN32
+	/// File handle backing the mapping
+	void*  file_handle = nullptr;
+
+	/// File mapping object handle
+	void*  map_handle = nullptr;
+#endif
+};
+
+
 /**
  * Closes an open file handle
  * 
@@ -152,6 +175,29 @@ flush(
 );
 
 
+/**
+ * Maps the file at the specified path into memory for reading
+ *
+ * On Windows, the path will be automatically converted to UTF16, with UTF8
+ * assumed to be the input format.
+ *
+ * Empty files cannot be mapped and will return ErrDATA.
+ *
+ * @param[in] path
+ *  The absolute or relative path of the file
+ * @param[out] mapping
+ *  The mapping details populated on success
+ * @return
+ *  An error code on failure, otherwise ErrNONE
+ */
+TZK_CORE_API
+int
+map_readonly(
+	const char* path,
+	mapped_file& mapping
+);
+
+
 /**
  * Opens the file at the specified path using the supplied text-based modes
  *
@@ -199,6 +245,32 @@ open(
 );
 
 
+/**
+ * Opens a read-only file pointer over a block of memory
+ *
+ * Permits code written against FILE* to consume data that never touches the
+ * filesystem, such as embedded resources. The memory must remain valid and
+ * unmodified until the file pointer is closed.
+ *
+ * POSIX uses fmemopen, which has no underlying descriptor; fileno() will not
+ * return a usable value. Windows has no equivalent, so the data is copied to
+ * a temporary file (deleted on close) instead.
+ *
+ * @param[in] data
+ *  The start of the memory block
+ * @param[in] size
+ *  The number of bytes in the memory block
+ * @return
+ *  A file pointer if opened successfully, otherwise nullptr
+ */
+TZK_CORE_API
+FILE*
+open_memory(
+	const void* data,
+	size_t size
+);
+
+
 /**
  * Opens the file at the specified path in stream form
  *
@@ -285,6 +357,22 @@ size(
 );
 
 
+/**
+ * Releases a mapping created by map_readonly
+ *
+ * Performs no operation if the mapping is not active. All pointers into the
+ * mapped data are invalid once this returns.
+ *
+ * @param[in] mapping
+ *  The mapping to release; reset to defaults on return
+ */
+TZK_CORE_API
+void
+unmap(
+	mapped_file& mapping
+);
+
+
 /**
  * Writes the supplied data to the filestream
  *
@@ -18,9 +18,11 @@
 #include "core/services/config/IConfig.h"
 #include "core/services/event/EventDispatcher.h"
 #include "core/services/log/Log.h"
+#include "core/services/metrics/Metrics.h"
 #include "core/util/filesystem/env.h"
 #include "core/util/string/string.h"
 #include "core/util/time.h"
+#include "core/util/Profiler.h"
 #include "core/error.h"
 #if TZK_IS_WIN32
 #	include "core/util/string/textconv.h"
@@ -56,6 +58,9 @@ Context::Context()
 , my_gc_interval(10000) // 10 seconds
 , my_frame_count(0)
 , my_frames_skipped(0)
+, my_metric_frames(nullptr)
+, my_metric_frames_skipped(nullptr)
+, my_metric_frame_time(nullptr)
 , my_time(core::aux::get_perf_counter())
 , my_time_scale(1.0f)
 , my_resource_loader(my_resource_cache)
@@ -102,6 +107,13 @@ Context::Context()
 		{
 			my_userdata_path += TZK_PATH_CHARSTR;
 		}
+
+		my_image_disk_cache.SetFolder(my_userdata_path + "cache" + TZK_PATH_CHARSTR + "images");
+
+		auto  metrics = core::ServiceLocator::Metrics();
+		my_metric_frames = &metrics->Counter("engine_frames_total", "Frames rendered");
+		my_metric_frames_skipped = &metrics->Counter("engine_frames_skipped_total", "Frames skipped from rendering through no changes");
+		my_metric_frame_time = &metrics->Histogram("engine_frame_time_us", "Microseconds from update start to render completion");
 	}
 	TZK_LOG(LogLevel::Trace, "Constructor finished");
 }
@@ -268,14 +280,19 @@ Context::EngineState() const
 
 void
 Context::GarbageCollect(
-	bool TZK_UNUSED(force)
+	bool force
 )
 {
-#if TZK_TEMP_BASIC_FACTORIES
-	uint64_t  cur = aux::get_ms_since_epoch();
+	uint64_t  cur = core::aux::get_ms_since_epoch();
 	
 	if ( force || (cur - my_last_gc) > my_gc_interval )
 	{
+		TZK_PROFILE_ZONE("Context::GarbageCollect");
+
+		// resources released by all consumers become evictable
+		my_resource_cache.Trim();
+
+#if TZK_TEMP_BASIC_FACTORIES
 		std::printf("Performing garbage collection!\n");
 
 		// object factories
@@ -290,10 +307,10 @@ Context::GarbageCollect(
 		// next
 		{
 		}
+#endif
 
 		my_last_gc = cur;
 	}
-#endif
 }
 
 
@@ -308,6 +325,13 @@ Context::GetDefaultFont() const
 #endif // TZK_USING_SDL_TTF
 
 
+ImageDiskCache&
+Context::GetImageDiskCache()
+{
+	return my_image_disk_cache;
+}
+
+
 #if TZK_USING_IMGUI
 
 std::shared_ptr<trezanik::imgui::IImGuiImpl>
@@ -385,6 +409,20 @@ Context::GetSDLRenderer() const
 #endif
 
 
+TextureAtlas&
+Context::GetTextureAtlas()
+{
+	return my_texture_atlas;
+}
+
+
+VirtualFiles&
+Context::GetVirtualFiles()
+{
+	return my_virtual_files;
+}
+
+
 int
 Context::Initialize()
 {
@@ -412,6 +450,15 @@ Context::Initialize()
 	);
 
 	const char*  errptr;
+	size_t  budget_mb = STR_to_unum(
+		core::ServiceLocator::Config()->Get(TZK_CVAR_SETTING_ENGINE_RESOURCES_CACHE_BUDGET).c_str(),
+		TZK_MAX_RESOURCE_CACHE_BUDGET_MB, &errptr
+	);
+	if ( errptr == nullptr )
+	{
+		my_resource_cache.SetBudget(budget_mb * 1024 * 1024);
+	}
+
 	my_fps_cap = (uint16_t)STR_to_unum(
 		core::ServiceLocator::Config()->Get(TZK_CVAR_SETTING_ENGINE_FPS_CAP).c_str(),
 		UINT16_MAX, &errptr
@@ -722,6 +769,7 @@ Context::Update()
 	if ( my_frame_count != 0 && !my_imgui_impl->WantRender() )
 	{
 		my_frames_skipped++;
+		my_metric_frames_skipped->Increment();
 		ReleaseRenderLock();
 		return;
 	}
@@ -735,8 +783,13 @@ Context::Update()
 		}
 	}
 
+	// frame boundary; must precede the zone, which completes in this frame
+	TZK_PROFILE_FRAME();
+	TZK_PROFILE_ZONE("Context::Update");
+
 	// imgui has its own, just grab that?
 	my_frame_count++;
+	my_metric_frames->Increment();
 
 	// update the time of our last frame
 	time = current_time;
@@ -744,7 +797,10 @@ Context::Update()
 	my_time = (time - start_time) / perf_frequency;
 
 	// setup a new frame
-	my_imgui_impl->NewFrame();
+	{
+		TZK_PROFILE_ZONE("Context::NewFrame");
+		my_imgui_impl->NewFrame();
+	}
 #endif // TZK_USING_IMGUI
 
 	for ( auto& listener : my_frame_listeners )
@@ -755,7 +811,8 @@ Context::Update()
 	// --- render a frame ---
 	// update audio
 	{
-		// files being streamed update, and also handling for pause/resume
+		TZK_PROFILE_ZONE("Audio::Update");
+		// no-op with a dedicated streaming thread, otherwise streams inline
 		ass->Update(ms_since_last_frame);
 	}
 	// update physics
@@ -765,6 +822,7 @@ Context::Update()
 	}
 	// update objects
 	{
+		TZK_PROFILE_ZONE("Context::UpdateListeners");
 		for ( auto& listener : my_update_listeners )
 			listener->Update(ms_since_last_frame);
 	}
@@ -776,6 +834,8 @@ Context::Update()
 	// render
 	//if ( my_gfx_impl != nullptr )
 	{
+		TZK_PROFILE_ZONE("Context::Render");
+
 		for ( auto& listener : my_frame_listeners )
 		{
 			listener->PreEnd();
@@ -799,16 +859,19 @@ Context::Update()
 
 #if TZK_USING_SDL
 		// all actions complete, present back buffer
+		TZK_PROFILE_ZONE("SDL_RenderPresent");
 		SDL_RenderPresent(my_sdl_renderer);
 #endif
 	}
 
 	ReleaseRenderLock();
 
-	// profile
+	// self-limiting to the collection interval
+	GarbageCollect();
 
 	// counter again for render completion, rather than start
 	last_time = aux::get_perf_counter();
+	my_metric_frame_time->Record((last_time - current_time) * 1000000 / perf_frequency);
 }
 
 
@@ -12,7 +12,10 @@
 
 #include "engine/services/event/EngineEvent.h"
 #include "engine/resources/ResourceCache.h"
+#include "engine/resources/ImageDiskCache.h"
 #include "engine/resources/ResourceLoader.h"
+#include "engine/resources/TextureAtlas.h"
+#include "engine/resources/VirtualFiles.h"
 #include "core/util/Singleton.h"
 #include "core/util/filesystem/Path.h"
 #include "imgui/IImGuiImpl.h"
@@ -34,6 +37,11 @@ namespace trezanik {
 class IImGuiImpl;
 #endif
 
+namespace core {
+class MetricCounter;
+class MetricHistogram;
+} // namespace core
+
 namespace engine {
 
 
@@ -130,6 +138,15 @@ private:
 	/** the number of frames skipped from rendering through no changes */
 	uint64_t  my_frames_skipped;
 
+	/** metrics counterpart to my_frame_count; registry owned */
+	trezanik::core::MetricCounter*  my_metric_frames;
+
+	/** metrics counterpart to my_frames_skipped; registry owned */
+	trezanik::core::MetricCounter*  my_metric_frames_skipped;
+
+	/** microseconds from update start to render completion; registry owned */
+	trezanik::core::MetricHistogram*  my_metric_frame_time;
+
 	/** the milliseconds passed in the game world, starting at 0 */
 	uint64_t  my_time;
 
@@ -139,6 +156,15 @@ private:
 	/** the active workspace ID */
 	core::UUID   my_active_workspace;
 
+	/** the in-memory file registry; as with the atlas, must outlive the workers */
+	VirtualFiles    my_virtual_files;
+
+	/** the texture atlas; declared first to outlive the loader workers */
+	TextureAtlas    my_texture_atlas;
+
+	/** the decoded image disk cache; as above, must outlive the workers */
+	ImageDiskCache  my_image_disk_cache;
+
 	/** the resource cache */
 	ResourceCache   my_resource_cache;
 
@@ -510,6 +536,16 @@ public:
 	GetRenderLock();
 
 
+	/**
+	 * Gets the decoded image disk cache
+	 *
+	 * @return
+	 *  A reference to the image disk cache
+	 */
+	ImageDiskCache&
+	GetImageDiskCache();
+
+
 	/**
 	 * Gets the Resource cache
 	 *
@@ -530,6 +566,26 @@ public:
 	GetResourceLoader();
 
 
+	/**
+	 * Gets the texture atlas for small images
+	 *
+	 * @return
+	 *  A reference to the texture atlas
+	 */
+	TextureAtlas&
+	GetTextureAtlas();
+
+
+	/**
+	 * Gets the registry of in-memory files
+	 *
+	 * @return
+	 *  A reference to the virtual files registry
+	 */
+	VirtualFiles&
+	GetVirtualFiles();
+
+
 #if TZK_USING_SDL
 	/**
 	 * Gets the SDL renderer in use
@@ -21,6 +21,7 @@
  * Not all appear here - it depends on the variable/type being validated.
  */
 #define TZK_MAX_AUDIO_VOLUME                        1.f
+#define TZK_MAX_RESOURCE_CACHE_BUDGET_MB            65535
 
 
 /////////////
@@ -32,6 +33,7 @@
 #define TZK_CVAR_SETTING_AUDIO_VOLUME_MUSIC                   "audio.volume.music.value"
 #define TZK_CVAR_SETTING_ENGINE_LICENSING_ENFORCE             "engine.licensing.enforce"
 #define TZK_CVAR_SETTING_ENGINE_FPS_CAP                       "engine.fps_cap.value"
+#define TZK_CVAR_SETTING_ENGINE_RESOURCES_CACHE_BUDGET        "engine.resources.cache_budget_mb"
 #define TZK_CVAR_SETTING_ENGINE_RESOURCES_LOADER_THREADS      "engine.resources.loader_threads"
 
 /////////////
@@ -43,6 +45,7 @@
 #define TZK_CVAR_HASH_AUDIO_VOLUME_MUSIC                      TZK_COMPILE_TIME_HASH(TZK_CVAR_SETTING_AUDIO_VOLUME_MUSIC)
 #define TZK_CVAR_HASH_ENGINE_LICENSING_ENFORCE                TZK_COMPILE_TIME_HASH(TZK_CVAR_SETTING_ENGINE_LICENSING_ENFORCE)
 #define TZK_CVAR_HASH_ENGINE_FPS_CAP                          TZK_COMPILE_TIME_HASH(TZK_CVAR_SETTING_ENGINE_FPS_CAP)
+#define TZK_CVAR_HASH_ENGINE_RESOURCES_CACHE_BUDGET           TZK_COMPILE_TIME_HASH(TZK_CVAR_SETTING_ENGINE_RESOURCES_CACHE_BUDGET)
 #define TZK_CVAR_HASH_ENGINE_RESOURCES_LOADER_THREADS         TZK_COMPILE_TIME_HASH(TZK_CVAR_SETTING_ENGINE_RESOURCES_LOADER_THREADS)
 
 /////////////
@@ -54,5 +57,6 @@
 #define TZK_CVAR_DEFAULT_AUDIO_VOLUME_MUSIC                   "0.75"
 #define TZK_CVAR_DEFAULT_ENGINE_LICENSING_ENFORCE             "true"
 #define TZK_CVAR_DEFAULT_ENGINE_FPS_CAP                       TZK_STRINGIFY(TZK_DEFAULT_FPS_CAP)
-#define TZK_CVAR_DEFAULT_ENGINE_RESOURCES_LOADER_THREADS      "2"
+#define TZK_CVAR_DEFAULT_ENGINE_RESOURCES_CACHE_BUDGET        "256"
+#define TZK_CVAR_DEFAULT_ENGINE_RESOURCES_LOADER_THREADS      "0"
 
@@ -28,6 +28,7 @@ EngineConfigServer::EngineConfigServer()
 	TZK_CVAR(AUDIO_VOLUME_MUSIC, "value");
 	TZK_CVAR(ENGINE_LICENSING_ENFORCE, "value");
 	TZK_CVAR(ENGINE_FPS_CAP, "value");
+	TZK_CVAR(ENGINE_RESOURCES_CACHE_BUDGET, "cache_budget_mb");
 	TZK_CVAR(ENGINE_RESOURCES_LOADER_THREADS, "loader_threads");
 }
 
@@ -97,8 +98,16 @@ EngineConfigServer::ValidateForCvar(
 				return ErrDATA;
 		}
 		return ErrNONE;
+	case TZK_CVAR_HASH_ENGINE_RESOURCES_CACHE_BUDGET:
+		{
+			// 0 is valid, and disables the budget
+			if ( STR_to_unum(setting, TZK_MAX_RESOURCE_CACHE_BUDGET_MB, &errstr) == 0 && errstr != nullptr )
+				return ErrFORMAT;
+		}
+		return ErrNONE;
 	case TZK_CVAR_HASH_ENGINE_RESOURCES_LOADER_THREADS:
 		{
+			// 0 is valid, and uses the logical processor count
 			if ( STR_to_unum(setting, TZK_RESOURCES_MAX_LOADER_THREADS, &errstr) == 0 && errstr != nullptr )
 				return ErrFORMAT;// may be others, but not critical
 		}
@@ -28,6 +28,21 @@
 
 // --- Best not to modify these unless you know exactly what you're doing!
 
+#if !defined(TZK_AUDIO_CLIP_CACHE_THRESHOLD)
+	// sound effects decoding within this many PCM bytes are held in a single shared buffer, played by the voice pool
+#	define TZK_AUDIO_CLIP_CACHE_THRESHOLD  524288
+#endif
+
+#if !defined(TZK_AUDIO_CLIP_RETRIGGER_INTERVAL)
+	// milliseconds within which repeat plays of the same clip are coalesced into one
+#	define TZK_AUDIO_CLIP_RETRIGGER_INTERVAL  30
+#endif
+
+#if !defined(TZK_AUDIO_COMMAND_QUEUE_SIZE)
+	// capacity of the audio command queue; must be a power of two. Absorbs notification bursts between streaming passes
+#	define TZK_AUDIO_COMMAND_QUEUE_SIZE  512
+#endif
+
 #if !defined(TZK_AUDIO_LOG_TRACING)
 	// trace log level to include audio operations, such as with ring buffer [re]population
 #	define TZK_AUDIO_LOG_TRACING  0  // false
@@ -48,11 +63,26 @@
 #	define TZK_AUDIO_RINGBUFFER_TARGET_DURATION  200
 #endif
 
+#if !defined(TZK_AUDIO_VOICE_COUNT)
+	// number of OpenAL sources pooled for playing cached clips, in addition to TZK_OPENAL_SOURCE_COUNT
+#	define TZK_AUDIO_VOICE_COUNT  16
+#endif
+
 #if !defined(TZK_AUDIO_WAV_STREAM_THRESHOLD)
 	// size of a wav file PCM that will trigger a stream read rather than full memory store
 #	define TZK_AUDIO_WAV_STREAM_THRESHOLD  32768
 #endif
 
+#if !defined(TZK_AUDIO_STREAM_INTERVAL)
+	// milliseconds the audio streaming thread sleeps between buffer refills
+#	define TZK_AUDIO_STREAM_INTERVAL  5
+#endif
+
+#if !defined(TZK_AUDIO_STREAM_THREAD)
+	// decode and queue audio on a dedicated thread, rather than the frame update
+#	define TZK_AUDIO_STREAM_THREAD  1  // true
+#endif
+
 #if !defined(TZK_DEFAULT_FPS_CAP)
 	// maximum FPS before frames are skipped from rendering. Only applies if failing to load from config
 #	define TZK_DEFAULT_FPS_CAP  240
@@ -73,6 +103,21 @@
 #	define TZK_IMAGE_MAX_FILE_SIZE  10000000  // 10 MB
 #endif
 
+#if !defined(TZK_IMAGE_DISK_CACHE)
+	// store decoded images in the userdata cache folder, skipping decoding on subsequent loads
+#	define TZK_IMAGE_DISK_CACHE  1  // true
+#endif
+
+#if !defined(TZK_TEXTURE_ATLAS_PAGE_SIZE)
+	// width and height, in pixels, of each texture atlas page
+#	define TZK_TEXTURE_ATLAS_PAGE_SIZE  1024
+#endif
+
+#if !defined(TZK_TEXTURE_ATLAS_MAX_IMAGE_SIZE)
+	// images with a width and height at or below this are packed into the texture atlas; 0 disables
+#	define TZK_TEXTURE_ATLAS_MAX_IMAGE_SIZE  64
+#endif
+
 #if !defined(TZK_MOUSEMOVE_LOGS)
 	// log mouse movement input events; heavy on spam as can be imagined
 #	define TZK_MOUSEMOVE_LOGS  0  // false
@@ -93,11 +138,36 @@
 #	define TZK_THREADED_RENDER  0  // false
 #endif
 
+#if !defined(TZK_HTTP_CACHE)
+	// store validated HTTP responses in the userdata cache folder, enabling conditional requests
+#	define TZK_HTTP_CACHE  1  // true
+#endif
+
+#if !defined(TZK_HTTP_KEEPALIVE_TIMEOUT)
+	// seconds an idle pooled HTTP connection is retained for reuse
+#	define TZK_HTTP_KEEPALIVE_TIMEOUT  30
+#endif
+
 #if !defined(TZK_HTTP_MAX_RESPONSE)
-	// maximum number of bytes that can be received in an HTTP response
+	// maximum number of bytes that can be buffered for an HTTP response; bodies streamed to a callback are exempt
 #	define TZK_HTTP_MAX_RESPONSE  1024 * 1024 * 14  // 14MB
 #endif
 
+#if !defined(TZK_HTTP_POOL_MAX_IDLE)
+	// maximum idle pooled HTTP connections retained per host
+#	define TZK_HTTP_POOL_MAX_IDLE  4
+#endif
+
+#if !defined(TZK_HTTP_PROBE_MAX_CONCURRENT)
+	// maximum HTTP health probes in flight at once; further probes start as others complete
+#	define TZK_HTTP_PROBE_MAX_CONCURRENT  256
+#endif
+
+#if !defined(TZK_HTTP_READ_SIZE)
+	// number of bytes requested per HTTP socket read; matches the maximum TLS record size
+#	define TZK_HTTP_READ_SIZE  16384  // 16K
+#endif
+
 #if !defined(TZK_HTTP_MAX_SEND)
 	// maximum number of bytes that can be sent in an HTTP request
 #	define TZK_HTTP_MAX_SEND  8192  // 8K
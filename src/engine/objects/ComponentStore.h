@@ -0,0 +1,294 @@
+#pragma once
+
+/**
+ * @file        src/engine/objects/ComponentStore.h
+ * @brief       Sparse-set storage of a single component type
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "engine/definitions.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+namespace trezanik {
+namespace engine {
+
+
+/** Sparse array value for an entity index without a component */
+constexpr uint32_t  component_store_npos = UINT32_MAX;
+
+
+/**
+ * Type-erased base for component stores
+ *
+ * Permits the EntityRegistry to remove all components of a destroyed entity
+ * without knowing the types involved.
+ */
+class IComponentStore
+{
+private:
+protected:
+public:
+	virtual ~IComponentStore() = default;
+
+
+	/**
+	 * Removes the component of an entity, if it has one
+	 *
+	 * @param[in] entity_index
+	 *  The entity index
+	 */
+	virtual void
+	Remove(
+		uint32_t entity_index
+	) = 0;
+
+
+	/**
+	 * Obtains the number of components held
+	 *
+	 * @return
+	 *  The component count
+	 */
+	virtual size_t
+	Size() const = 0;
+};
+
+
+/**
+ * Holds all components of one type in a contiguous array
+ *
+ * A sparse set: the sparse array maps an entity index to a position in the
+ * dense arrays, and the dense arrays hold the components alongside the owning
+ * entity index. Lookup, insertion and removal are constant time; removal
+ * swaps the last element into the vacated slot, so iteration order is not
+ * stable across removals.
+ *
+ * Iteration through Each (or Data/Entities) walks only the dense arrays,
+ * touching no memory for entities that lack the component.
+ *
+ * @warning
+ *  References and pointers to components are invalidated by any insertion or
+ *  removal; hold entity handles instead.
+ */
+template<typename T>
+class ComponentStore : public IComponentStore
+{
+	TZK_NO_CLASS_ASSIGNMENT(ComponentStore);
+	TZK_NO_CLASS_COPY(ComponentStore);
+	TZK_NO_CLASS_MOVEASSIGNMENT(ComponentStore);
+	TZK_NO_CLASS_MOVECOPY(ComponentStore);
+
+private:
+
+	/** Entity index to dense index; component_store_npos if absent */
+	std::vector<uint32_t>  my_sparse;
+
+	/** Dense index to owning entity index */
+	std::vector<uint32_t>  my_dense;
+
+	/** The components, in the same order as my_dense */
+	std::vector<T>  my_components;
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 */
+	ComponentStore() = default;
+
+
+	/**
+	 * Standard destructor
+	 */
+	~ComponentStore() = default;
+
+
+	/**
+	 * Obtains the component array
+	 *
+	 * @return
+	 *  Pointer to the first of Size() contiguous components
+	 */
+	T*
+	Data()
+	{
+		return my_components.data();
+	}
+
+
+	/**
+	 * Invokes a function for every component held
+	 *
+	 * The function must not add or remove components of this type.
+	 *
+	 * @param[in] func
+	 *  Callable with the signature (uint32_t entity_index, T& component)
+	 */
+	template<typename Func>
+	void
+	Each(
+		Func&& func
+	)
+	{
+		const size_t  count = my_components.size();
+		T*  components = my_components.data();
+		const uint32_t*  entities = my_dense.data();
+
+		for ( size_t i = 0; i < count; i++ )
+		{
+			func(entities[i], components[i]);
+		}
+	}
+
+
+	/**
+	 * Adds a component to an entity, constructing it in place
+	 *
+	 * If the entity already has a component of this type, it is replaced.
+	 *
+	 * @param[in] entity_index
+	 *  The entity index
+	 * @param[in] args
+	 *  Arguments forwarded to the component constructor
+	 * @return
+	 *  Reference to the component
+	 */
+	template<typename... Args>
+	T&
+	Emplace(
+		uint32_t entity_index,
+		Args&&... args
+	)
+	{
+		if ( entity_index >= my_sparse.size() )
+		{
+			my_sparse.resize(static_cast<size_t>(entity_index) + 1, component_store_npos);
+		}
+
+		uint32_t&  slot = my_sparse[entity_index];
+
+		if ( slot != component_store_npos )
+		{
+			my_components[slot] = T(std::forward<Args>(args)...);
+			return my_components[slot];
+		}
+
+		slot = static_cast<uint32_t>(my_components.size());
+		my_dense.push_back(entity_index);
+		my_components.emplace_back(std::forward<Args>(args)...);
+		return my_components.back();
+	}
+
+
+	/**
+	 * Obtains the owning entity index array
+	 *
+	 * @return
+	 *  Pointer to the first of Size() entity indices, matching Data()
+	 */
+	const uint32_t*
+	Entities() const
+	{
+		return my_dense.data();
+	}
+
+
+	/**
+	 * Obtains the component of an entity
+	 *
+	 * @param[in] entity_index
+	 *  The entity index
+	 * @return
+	 *  Pointer to the component, or nullptr if the entity has none
+	 */
+	T*
+	Get(
+		uint32_t entity_index
+	)
+	{
+		if ( entity_index >= my_sparse.size() || my_sparse[entity_index] == component_store_npos )
+			return nullptr;
+
+		return &my_components[my_sparse[entity_index]];
+	}
+
+
+	/**
+	 * Determines if an entity has a component of this type
+	 *
+	 * @param[in] entity_index
+	 *  The entity index
+	 * @return
+	 *  Boolean state; true if present
+	 */
+	bool
+	Has(
+		uint32_t entity_index
+	) const
+	{
+		return entity_index < my_sparse.size() && my_sparse[entity_index] != component_store_npos;
+	}
+
+
+	/**
+	 * Implementation of IComponentStore::Remove
+	 */
+	virtual void
+	Remove(
+		uint32_t entity_index
+	) override
+	{
+		if ( !Has(entity_index) )
+			return;
+
+		uint32_t  slot = my_sparse[entity_index];
+		uint32_t  last = static_cast<uint32_t>(my_components.size() - 1);
+
+		if ( slot != last )
+		{
+			my_components[slot] = std::move(my_components[last]);
+			my_dense[slot] = my_dense[last];
+			my_sparse[my_dense[slot]] = slot;
+		}
+
+		my_components.pop_back();
+		my_dense.pop_back();
+		my_sparse[entity_index] = component_store_npos;
+	}
+
+
+	/**
+	 * Reserves capacity for a number of components
+	 *
+	 * @param[in] count
+	 *  The number of components expected
+	 */
+	void
+	Reserve(
+		size_t count
+	)
+	{
+		my_dense.reserve(count);
+		my_components.reserve(count);
+	}
+
+
+	/**
+	 * Implementation of IComponentStore::Size
+	 */
+	virtual size_t
+	Size() const override
+	{
+		return my_components.size();
+	}
+};
+
+
+} // namespace engine
+} // namespace trezanik
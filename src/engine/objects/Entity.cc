@@ -1 +1,114 @@
+/**
+ * @file        src/engine/objects/Entity.cc
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "engine/definitions.h"
+
 #include "engine/objects/Entity.h"
+
+#include "core/services/log/Log.h"
+
+
+namespace trezanik {
+namespace engine {
+
+
+EntityRegistry::EntityRegistry()
+: my_alive_count(0)
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Constructor starting");
+	{
+
+	}
+	TZK_LOG(LogLevel::Trace, "Constructor finished");
+}
+
+
+EntityRegistry::~EntityRegistry()
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Destructor starting");
+	{
+		TZK_LOG_FORMAT(LogLevel::Trace, "Entities remaining: %zu", my_alive_count);
+	}
+	TZK_LOG(LogLevel::Trace, "Destructor finished");
+}
+
+
+size_t
+EntityRegistry::Count() const
+{
+	return my_alive_count;
+}
+
+
+entity_handle
+EntityRegistry::Create()
+{
+	entity_handle  retval;
+
+	if ( !my_free_indices.empty() )
+	{
+		retval.index = my_free_indices.back();
+		my_free_indices.pop_back();
+	}
+	else
+	{
+		retval.index = static_cast<uint32_t>(my_generations.size());
+		my_generations.push_back(0);
+	}
+
+	retval.generation = my_generations[retval.index];
+	my_alive_count++;
+
+	return retval;
+}
+
+
+void
+EntityRegistry::Destroy(
+	entity_handle entity
+)
+{
+	if ( !IsAlive(entity) )
+		return;
+
+	for ( auto& store : my_stores )
+	{
+		store.second->Remove(entity.index);
+	}
+
+	// invalidates all outstanding handles to this index
+	my_generations[entity.index]++;
+	my_free_indices.push_back(entity.index);
+	my_alive_count--;
+}
+
+
+bool
+EntityRegistry::IsAlive(
+	entity_handle entity
+) const
+{
+	if ( entity.index >= my_generations.size() )
+		return false;
+
+	if ( my_generations[entity.index] != entity.generation )
+		return false;
+
+	/*
+	 * A freed index keeps its bumped generation until reissued, so a handle
+	 * can only match if it was issued after the last destruction
+	 */
+	return true;
+}
+
+
+} // namespace engine
+} // namespace trezanik
@@ -1,3 +1,261 @@
 #pragma once
 
+/**
+ * @file        src/engine/objects/Entity.h
+ * @brief       Entity handles and the registry owning their components
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
 #include "engine/definitions.h"
+
+#include "engine/objects/ComponentStore.h"
+
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+
+namespace trezanik {
+namespace engine {
+
+
+/**
+ * Handle to an entity within an EntityRegistry
+ *
+ * The index addresses the component stores directly; the generation is
+ * incremented each time the index is reused, so a handle to a destroyed
+ * entity is detected rather than silently aliasing its replacement.
+ */
+struct entity_handle
+{
+	/// index into the registry and component stores
+	uint32_t  index = component_store_npos;
+	/// generation of the index this handle was issued for
+	uint32_t  generation = 0;
+
+	bool
+	operator==(
+		const entity_handle& rhs
+	) const
+	{
+		return index == rhs.index && generation == rhs.generation;
+	}
+
+	bool
+	operator!=(
+		const entity_handle& rhs
+	) const
+	{
+		return !(*this == rhs);
+	}
+};
+
+
+/**
+ * Owns entities and their components, stored by type
+ *
+ * Entities are nothing more than an index; each component type lives in its
+ * own ComponentStore as a contiguous array, so systems iterate one type at a
+ * time over dense memory with no per-entity pointer chasing or virtual calls.
+ * Existing component classes are used unmodified - any type with an
+ * Update(float) method can be driven by Update<T>.
+ *
+ * Destroyed entity indices are recycled, keeping the sparse arrays compact.
+ *
+ * Not thread-safe; intended for use from the thread running the systems.
+ */
+class TZK_ENGINE_API EntityRegistry
+{
+	TZK_NO_CLASS_ASSIGNMENT(EntityRegistry);
+	TZK_NO_CLASS_COPY(EntityRegistry);
+	TZK_NO_CLASS_MOVEASSIGNMENT(EntityRegistry);
+	TZK_NO_CLASS_MOVECOPY(EntityRegistry);
+
+private:
+
+	/** Current generation of each entity index */
+	std::vector<uint32_t>  my_generations;
+
+	/** Destroyed entity indices available for reuse */
+	std::vector<uint32_t>  my_free_indices;
+
+	/** Number of live entities */
+	size_t  my_alive_count;
+
+	/** Component stores, keyed by component type */
+	std::unordered_map<std::type_index, std::unique_ptr<IComponentStore>>  my_stores;
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 */
+	EntityRegistry();
+
+
+	/**
+	 * Standard destructor
+	 */
+	~EntityRegistry();
+
+
+	/**
+	 * Adds a component to an entity, constructing it in place
+	 *
+	 * @param[in] entity
+	 *  The entity handle; must be alive
+	 * @param[in] args
+	 *  Arguments forwarded to the component constructor
+	 * @return
+	 *  Reference to the component, valid until the next insertion or removal
+	 *  of this component type
+	 */
+	template<typename T, typename... Args>
+	T&
+	Add(
+		entity_handle entity,
+		Args&&... args
+	)
+	{
+		return Store<T>().Emplace(entity.index, std::forward<Args>(args)...);
+	}
+
+
+	/**
+	 * Obtains the number of live entities
+	 *
+	 * @return
+	 *  The entity count
+	 */
+	size_t
+	Count() const;
+
+
+	/**
+	 * Creates a new entity with no components
+	 *
+	 * @return
+	 *  The handle to the new entity
+	 */
+	entity_handle
+	Create();
+
+
+	/**
+	 * Destroys an entity, removing all of its components
+	 *
+	 * Stale handles are ignored.
+	 *
+	 * @param[in] entity
+	 *  The entity handle
+	 */
+	void
+	Destroy(
+		entity_handle entity
+	);
+
+
+	/**
+	 * Obtains the component of an entity
+	 *
+	 * @param[in] entity
+	 *  The entity handle
+	 * @return
+	 *  Pointer to the component, or nullptr if the handle is stale or the
+	 *  entity has no component of this type
+	 */
+	template<typename T>
+	T*
+	Get(
+		entity_handle entity
+	)
+	{
+		if ( !IsAlive(entity) )
+			return nullptr;
+
+		return Store<T>().Get(entity.index);
+	}
+
+
+	/**
+	 * Determines if the handle refers to a live entity
+	 *
+	 * @param[in] entity
+	 *  The entity handle
+	 * @return
+	 *  Boolean state; false if destroyed or never created
+	 */
+	bool
+	IsAlive(
+		entity_handle entity
+	) const;
+
+
+	/**
+	 * Removes a component from an entity, if it has one
+	 *
+	 * @param[in] entity
+	 *  The entity handle
+	 */
+	template<typename T>
+	void
+	Remove(
+		entity_handle entity
+	)
+	{
+		if ( IsAlive(entity) )
+		{
+			Store<T>().Remove(entity.index);
+		}
+	}
+
+
+	/**
+	 * Obtains the store for a component type, creating it if needed
+	 *
+	 * Systems performing repeated iteration should retain the reference
+	 * rather than perform the type lookup each time; it remains valid for the
+	 * lifetime of the registry.
+	 *
+	 * @return
+	 *  Reference to the component store
+	 */
+	template<typename T>
+	ComponentStore<T>&
+	Store()
+	{
+		auto&  store = my_stores[std::type_index(typeid(T))];
+
+		if ( store == nullptr )
+		{
+			store = std::make_unique<ComponentStore<T>>();
+		}
+
+		return *static_cast<ComponentStore<T>*>(store.get());
+	}
+
+
+	/**
+	 * Runs the update handler of every component of a type
+	 *
+	 * @param[in] delta_time
+	 *  The milliseconds elapsed since the last frame
+	 */
+	template<typename T>
+	void
+	Update(
+		float delta_time
+	)
+	{
+		Store<T>().Each([delta_time](uint32_t, T& component) {
+			component.Update(delta_time);
+		});
+	}
+};
+
+
+} // namespace engine
+} // namespace trezanik
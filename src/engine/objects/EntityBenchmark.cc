@@ -0,0 +1,219 @@
+/**
+ * @file        src/engine/objects/EntityBenchmark.cc
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "engine/definitions.h"
+
+#include "engine/objects/EntityBenchmark.h"
+#include "engine/objects/Entity.h"
+#include "engine/objects/IComponent.h"
+
+#include "core/services/log/Log.h"
+#include "core/util/time.h"
+
+#include <cinttypes>
+#include <memory>
+#include <vector>
+
+
+namespace trezanik {
+namespace engine {
+
+
+/**
+ * Benchmark component; position integration
+ */
+struct bench_motion
+{
+	float  x = 0.f;
+	float  y = 0.f;
+	float  vx = 1.f;
+	float  vy = 0.5f;
+
+	void
+	Update(
+		float delta_time
+	)
+	{
+		x += vx * delta_time;
+		y += vy * delta_time;
+	}
+};
+
+
+/**
+ * Benchmark component; clamped regeneration
+ */
+struct bench_health
+{
+	float  current = 50.f;
+	float  maximum = 100.f;
+	float  regen = 0.25f;
+
+	void
+	Update(
+		float delta_time
+	)
+	{
+		current += regen * delta_time;
+		if ( current > maximum )
+			current = maximum;
+	}
+};
+
+
+/**
+ * IComponent wrapper for the pointer layout, so both layouts run identical
+ * update code
+ */
+template<typename T>
+class BenchComponent : public IComponent
+{
+public:
+	T  data;
+
+	virtual void
+	Update(
+		float delta_time
+	) override
+	{
+		data.Update(delta_time);
+	}
+};
+
+
+/**
+ * An entity in the pointer layout; separately allocated, owning its
+ * separately allocated components
+ */
+struct bench_pointer_entity
+{
+	std::vector<std::unique_ptr<IComponent>>  components;
+};
+
+
+/**
+ * Converts a performance counter difference to microseconds
+ *
+ * @param[in] start
+ *  The counter at the start of the timed period
+ * @param[in] end
+ *  The counter at the end of the timed period
+ * @return
+ *  The elapsed microseconds
+ */
+static uint64_t
+elapsed_us(
+	uint64_t start,
+	uint64_t end
+)
+{
+	return (end - start) * 1000000 / core::aux::get_perf_frequency();
+}
+
+
+entity_benchmark_result
+benchmark_entity_storage(
+	size_t entity_count,
+	size_t iterations
+)
+{
+	using namespace trezanik::core;
+
+	entity_benchmark_result  retval;
+	const float  delta_time = 16.f;
+	uint64_t  start;
+
+	retval.entity_count = entity_count;
+	retval.iterations = iterations;
+
+	// --- pointer layout ---
+
+	std::vector<std::unique_ptr<bench_pointer_entity>>  pointer_entities;
+
+	start = aux::get_perf_counter();
+	pointer_entities.reserve(entity_count);
+	for ( size_t i = 0; i < entity_count; i++ )
+	{
+		auto  entity = std::make_unique<bench_pointer_entity>();
+
+		entity->components.emplace_back(std::make_unique<BenchComponent<bench_motion>>());
+		if ( (i & 1) == 0 )
+		{
+			entity->components.emplace_back(std::make_unique<BenchComponent<bench_health>>());
+		}
+		pointer_entities.emplace_back(std::move(entity));
+	}
+	retval.pointer_create_us = elapsed_us(start, aux::get_perf_counter());
+
+	start = aux::get_perf_counter();
+	for ( size_t n = 0; n < iterations; n++ )
+	{
+		for ( auto& entity : pointer_entities )
+		{
+			for ( auto& component : entity->components )
+			{
+				component->Update(delta_time);
+			}
+		}
+	}
+	retval.pointer_update_us = elapsed_us(start, aux::get_perf_counter());
+
+	// --- registry layout ---
+
+	EntityRegistry  registry;
+
+	start = aux::get_perf_counter();
+	auto&  motion = registry.Store<bench_motion>();
+	auto&  health = registry.Store<bench_health>();
+	motion.Reserve(entity_count);
+	health.Reserve(entity_count / 2 + 1);
+	for ( size_t i = 0; i < entity_count; i++ )
+	{
+		entity_handle  entity = registry.Create();
+
+		motion.Emplace(entity.index);
+		if ( (i & 1) == 0 )
+		{
+			health.Emplace(entity.index);
+		}
+	}
+	retval.registry_create_us = elapsed_us(start, aux::get_perf_counter());
+
+	start = aux::get_perf_counter();
+	for ( size_t n = 0; n < iterations; n++ )
+	{
+		registry.Update<bench_motion>(delta_time);
+		registry.Update<bench_health>(delta_time);
+	}
+	retval.registry_update_us = elapsed_us(start, aux::get_perf_counter());
+
+	// confirm equivalent work was done; also keeps the updates observable
+	retval.results_match = motion.Size() == entity_count;
+	for ( size_t i = 0; retval.results_match && i < entity_count; i++ )
+	{
+		auto  ptr_motion = static_cast<BenchComponent<bench_motion>*>(pointer_entities[i]->components[0].get());
+		auto  reg_motion = motion.Get(static_cast<uint32_t>(i));
+
+		if ( reg_motion == nullptr || reg_motion->x != ptr_motion->data.x || reg_motion->y != ptr_motion->data.y )
+		{
+			retval.results_match = false;
+		}
+	}
+
+	TZK_LOG_FORMAT(LogLevel::Info,
+		"Entity storage benchmark (%zu entities, %zu iterations): pointer create=%" PRIu64 "us update=%" PRIu64 "us; registry create=%" PRIu64 "us update=%" PRIu64 "us",
+		entity_count, iterations,
+		retval.pointer_create_us, retval.pointer_update_us,
+		retval.registry_create_us, retval.registry_update_us
+	);
+
+	return retval;
+}
+
+
+} // namespace engine
+} // namespace trezanik
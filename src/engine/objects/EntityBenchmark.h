@@ -0,0 +1,72 @@
+#pragma once
+
+/**
+ * @file        src/engine/objects/EntityBenchmark.h
+ * @brief       Compares pointer-based and registry-based component layouts
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "engine/definitions.h"
+
+#include <cstdint>
+
+
+namespace trezanik {
+namespace engine {
+
+
+/**
+ * Timings from a benchmark_entity_storage run, in microseconds
+ */
+struct entity_benchmark_result
+{
+	/// number of entities created in each layout
+	size_t    entity_count = 0;
+	/// number of full update passes timed
+	size_t    iterations = 0;
+	/// creation of all entities and components, pointer layout
+	uint64_t  pointer_create_us = 0;
+	/// all update passes, pointer layout
+	uint64_t  pointer_update_us = 0;
+	/// creation of all entities and components, registry layout
+	uint64_t  registry_create_us = 0;
+	/// all update passes, registry layout
+	uint64_t  registry_update_us = 0;
+	/// true if both layouts produced identical component state
+	bool      results_match = false;
+};
+
+
+/**
+ * Times entity creation and update across both component layouts
+ *
+ * The pointer layout is the original model: each entity is a separate
+ * allocation holding IComponent pointers, updated by virtual dispatch. The
+ * registry layout holds the same components by value in an EntityRegistry,
+ * updated by iterating each ComponentStore.
+ *
+ * Every entity receives a motion component; every other entity also receives
+ * a health component, so the registry has to handle partial coverage.
+ *
+ * Runs synchronously on the calling thread; 100,000 entities over 100
+ * iterations completes in well under a second on current hardware.
+ *
+ * @param[in] entity_count
+ *  The number of entities to create in each layout
+ * @param[in] iterations
+ *  The number of update passes to time
+ * @return
+ *  The timings
+ */
+TZK_ENGINE_API
+entity_benchmark_result
+benchmark_entity_storage(
+	size_t entity_count,
+	size_t iterations
+);
+
+
+} // namespace engine
+} // namespace trezanik
@@ -1 +1,48 @@
+#pragma once
 
+/**
+ * @file        src/engine/objects/IComponent.h
+ * @brief       Interface for individually allocated entity components
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "engine/definitions.h"
+
+
+namespace trezanik {
+namespace engine {
+
+
+/**
+ * Interface for components held by pointer and updated via virtual dispatch
+ *
+ * This is the original object model; each component is a separate heap
+ * allocation owned by its entity. Components stored in an EntityRegistry do
+ * not need to derive from this - they are plain types held by value in a
+ * ComponentStore, and only need to provide a compatible Update method.
+ */
+class IComponent
+{
+private:
+protected:
+public:
+	virtual ~IComponent() = default;
+
+
+	/**
+	 * Periodic update handler
+	 *
+	 * @param[in] delta_time
+	 *  The milliseconds elapsed since the last frame
+	 */
+	virtual void
+	Update(
+		float delta_time
+	) = 0;
+};
+
+
+} // namespace engine
+} // namespace trezanik
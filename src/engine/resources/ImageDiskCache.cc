@@ -0,0 +1,329 @@
+/**
+ * @file        src/engine/resources/ImageDiskCache.cc
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "engine/definitions.h"
+
+#include "engine/resources/ImageDiskCache.h"
+
+#include "core/services/log/Log.h"
+#include "core/services/threading/Threading.h"
+#include "core/services/ServiceLocator.h"
+#include "core/util/filesystem/folder.h"
+#include "core/error.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+
+namespace trezanik {
+namespace engine {
+
+
+/// Increment on any change to the file layout or decoded output
+constexpr uint32_t  image_cache_version = 1;
+
+/// Identifies an image cache file
+constexpr char  image_cache_magic[4] = { 'T', 'Z', 'K', 'I' };
+
+/// Cache file extension
+constexpr char  image_cache_ext[] = ".rgba";
+
+
+/**
+ * Header prefixing each cache file; pixel data immediately follows
+ *
+ * Written in native byte order; the cache is per-machine
+ */
+struct image_cache_header
+{
+	char      magic[4];
+	uint32_t  version;
+	uint64_t  content_hash;
+	uint64_t  content_size;
+	int32_t   width;
+	int32_t   height;
+	int32_t   bytes_per_pixel;
+	uint32_t  reserved;
+};
+
+
+cached_image::~cached_image()
+{
+	core::aux::file::unmap(mapping);
+}
+
+
+ImageDiskCache::ImageDiskCache()
+: my_folder_exists(false)
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Constructor starting");
+	{
+	}
+	TZK_LOG(LogLevel::Trace, "Constructor finished");
+}
+
+
+ImageDiskCache::~ImageDiskCache()
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Destructor starting");
+	{
+		TZK_LOG_FORMAT(LogLevel::Info,
+			"Image disk cache: %zu hits (%lld microseconds), %zu misses (%lld microseconds), %zu stores",
+			my_hits.load(), static_cast<long long>(my_hit_time.load()),
+			my_misses.load(), static_cast<long long>(my_miss_time.load()),
+			my_stores.load()
+		);
+	}
+	TZK_LOG(LogLevel::Trace, "Destructor finished");
+}
+
+
+uint64_t
+ImageDiskCache::ContentHash(
+	const unsigned char* data,
+	size_t len
+)
+{
+	uint64_t  hash = 0xcbf29ce484222325;
+	const uint64_t  prime = 0x00000100000001b3;
+
+	for ( size_t i = 0; i < len; i++ )
+	{
+		hash ^= data[i];
+		hash *= prime;
+	}
+
+	return hash;
+}
+
+
+std::string
+ImageDiskCache::EntryPath(
+	uint64_t content_hash,
+	size_t content_size
+) const
+{
+	std::lock_guard<std::mutex>  lock(my_lock);
+
+	if ( my_folder.empty() )
+	{
+		return std::string();
+	}
+
+	char  name[64];
+	std::snprintf(name, sizeof(name), "%016" PRIx64 "-%zx%s", content_hash, content_size, image_cache_ext);
+
+	return my_folder + name;
+}
+
+
+bool
+ImageDiskCache::IsEnabled() const
+{
+#if TZK_IMAGE_DISK_CACHE
+	std::lock_guard<std::mutex>  lock(my_lock);
+	return !my_folder.empty();
+#else
+	return false;
+#endif
+}
+
+
+std::unique_ptr<cached_image>
+ImageDiskCache::Lookup(
+	uint64_t content_hash,
+	size_t content_size
+)
+{
+	using namespace trezanik::core;
+
+	std::string  path = EntryPath(content_hash, content_size);
+
+	if ( path.empty() )
+	{
+		return nullptr;
+	}
+
+	auto  retval = std::make_unique<cached_image>();
+
+	if ( aux::file::map_readonly(path.c_str(), retval->mapping) != ErrNONE )
+	{
+		my_misses++;
+		return nullptr;
+	}
+
+	image_cache_header  hdr;
+	const auto&  mapping = retval->mapping;
+
+	if ( mapping.size < sizeof(hdr) )
+	{
+		TZK_LOG_FORMAT(LogLevel::Warning, "Image cache entry truncated: %s", path.c_str());
+		my_misses++;
+		return nullptr;
+	}
+
+	std::memcpy(&hdr, mapping.data, sizeof(hdr));
+
+	size_t  pixel_bytes = static_cast<size_t>(hdr.width) * hdr.height * hdr.bytes_per_pixel;
+
+	if ( std::memcmp(hdr.magic, image_cache_magic, sizeof(hdr.magic)) != 0
+	  || hdr.version != image_cache_version
+	  || hdr.content_hash != content_hash
+	  || hdr.content_size != content_size
+	  || hdr.width <= 0 || hdr.height <= 0 || hdr.bytes_per_pixel <= 0
+	  || mapping.size != sizeof(hdr) + pixel_bytes )
+	{
+		// outdated or corrupt; will be replaced on the next store
+		TZK_LOG_FORMAT(LogLevel::Debug, "Image cache entry invalid or outdated: %s", path.c_str());
+		my_misses++;
+		return nullptr;
+	}
+
+	retval->pixels = mapping.data + sizeof(hdr);
+	retval->width = hdr.width;
+	retval->height = hdr.height;
+	retval->bytes_per_pixel = hdr.bytes_per_pixel;
+
+	my_hits++;
+
+	return retval;
+}
+
+
+void
+ImageDiskCache::RecordLoad(
+	bool hit,
+	std::chrono::microseconds elapsed
+)
+{
+	if ( hit )
+		my_hit_time += static_cast<int64_t>(elapsed.count());
+	else
+		my_miss_time += static_cast<int64_t>(elapsed.count());
+}
+
+
+void
+ImageDiskCache::SetFolder(
+	const std::string& folder
+)
+{
+	std::lock_guard<std::mutex>  lock(my_lock);
+
+	my_folder = folder;
+	if ( !my_folder.empty() && my_folder.back() != TZK_PATH_CHAR )
+	{
+		my_folder += TZK_PATH_CHARSTR;
+	}
+	my_folder_exists = false;
+}
+
+
+int
+ImageDiskCache::Store(
+	uint64_t content_hash,
+	size_t content_size,
+	int width,
+	int height,
+	int bytes_per_pixel,
+	const unsigned char* pixels
+)
+{
+	using namespace trezanik::core;
+
+	if ( pixels == nullptr || width <= 0 || height <= 0 || bytes_per_pixel <= 0 )
+	{
+		return EINVAL;
+	}
+
+	std::string  path = EntryPath(content_hash, content_size);
+
+	if ( path.empty() )
+	{
+		return ENOENT;
+	}
+
+	{
+		std::lock_guard<std::mutex>  lock(my_lock);
+
+		if ( !my_folder_exists )
+		{
+			if ( aux::folder::exists(my_folder.c_str()) == ENOENT )
+			{
+				aux::folder::make_path(my_folder.c_str());
+			}
+			if ( aux::folder::exists(my_folder.c_str()) != EEXIST )
+			{
+				TZK_LOG_FORMAT(LogLevel::Warning, "Image cache folder unavailable: %s", my_folder.c_str());
+				return ENOENT;
+			}
+			my_folder_exists = true;
+		}
+	}
+
+	image_cache_header  hdr;
+
+	std::memcpy(hdr.magic, image_cache_magic, sizeof(hdr.magic));
+	hdr.version = image_cache_version;
+	hdr.content_hash = content_hash;
+	hdr.content_size = content_size;
+	hdr.width = width;
+	hdr.height = height;
+	hdr.bytes_per_pixel = bytes_per_pixel;
+	hdr.reserved = 0;
+
+	size_t  pixel_bytes = static_cast<size_t>(width) * height * bytes_per_pixel;
+	// unique per writer, as two workers may be storing the same content
+	std::string  tmp_path = path + "." + std::to_string(ServiceLocator::Threading()->GetCurrentThreadId()) + ".tmp";
+	int    openflags = aux::file::OpenFlag_WriteOnly | aux::file::OpenFlag_Binary | aux::file::OpenFlag_CreateUserR | aux::file::OpenFlag_CreateUserW;
+	FILE*  fp = aux::file::open(tmp_path.c_str(), openflags);
+
+	if ( fp == nullptr )
+	{
+		return ErrFAILED;
+	}
+
+	bool  ok = aux::file::write(fp, &hdr, sizeof(hdr)) == sizeof(hdr)
+		&& aux::file::write(fp, pixels, pixel_bytes) == pixel_bytes;
+
+	aux::file::close(fp);
+
+	if ( !ok )
+	{
+		TZK_LOG_FORMAT(LogLevel::Warning, "Failed to write image cache entry: %s", tmp_path.c_str());
+		aux::file::remove(tmp_path.c_str());
+		return ErrFAILED;
+	}
+
+#if TZK_IS_WIN32
+	// rename will not replace an existing file
+	if ( aux::file::exists(path.c_str()) == EEXIST )
+	{
+		aux::file::remove(path.c_str());
+	}
+#endif
+	if ( std::rename(tmp_path.c_str(), path.c_str()) != 0 )
+	{
+		TZK_LOG_FORMAT(LogLevel::Warning, "Failed to rename image cache entry: %s", path.c_str());
+		aux::file::remove(tmp_path.c_str());
+		return ErrFAILED;
+	}
+
+	TZK_LOG_FORMAT(LogLevel::Debug, "Image cache entry stored: %s", path.c_str());
+	my_stores++;
+
+	return ErrNONE;
+}
+
+
+} // namespace engine
+} // namespace trezanik
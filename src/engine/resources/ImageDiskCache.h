@@ -0,0 +1,245 @@
+#pragma once
+
+/**
+ * @file        src/engine/resources/ImageDiskCache.h
+ * @brief       On-disk cache of decoded image pixel data
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "engine/definitions.h"
+
+#include "core/util/filesystem/file.h"
+#include "core/util/SingularInstance.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+
+
+namespace trezanik {
+namespace engine {
+
+
+/**
+ * A decoded image obtained from the disk cache
+ *
+ * The pixel data is memory-mapped directly from the cache file, and remains
+ * valid only for the lifetime of this object.
+ */
+struct cached_image
+{
+	/// The cache file mapping; released on destruction
+	core::aux::file::mapped_file  mapping;
+
+	/// Start of the pixel data, within the mapping
+	const unsigned char*  pixels = nullptr;
+
+	int  width = 0;  //< image width
+	int  height = 0;  //< image height
+	int  bytes_per_pixel = 0;  //< bytes per pixel of the pixel data
+
+	/**
+	 * Standard destructor; unmaps the cache file
+	 */
+	~cached_image();
+};
+
+
+/**
+ * Disk cache for decoded images
+ *
+ * Decoding compressed images is the dominant cost of image loading; since the
+ * assets rarely change, the decoded pixels are written to the userdata cache
+ * folder and memory-mapped on subsequent launches.
+ *
+ * Entries are keyed on a hash of the source file content and its size, so
+ * modified or replaced assets naturally miss. Each file carries a format
+ * version; bump image_cache_version whenever the layout or decoder output
+ * changes, and stale entries will be ignored and overwritten.
+ *
+ * Thread-safe; lookups and stores are performed from the resource workers.
+ */
+class TZK_ENGINE_API ImageDiskCache
+	: private trezanik::core::SingularInstance<ImageDiskCache>
+{
+	TZK_NO_CLASS_ASSIGNMENT(ImageDiskCache);
+	TZK_NO_CLASS_COPY(ImageDiskCache);
+	TZK_NO_CLASS_MOVEASSIGNMENT(ImageDiskCache);
+	TZK_NO_CLASS_MOVECOPY(ImageDiskCache);
+
+private:
+
+	/// Guards the folder path and its creation
+	mutable std::mutex  my_lock;
+
+	/// Folder cache files reside in, including trailing path separator
+	std::string  my_folder;
+
+	/// Flag indicating the folder has been created (or confirmed to exist)
+	bool  my_folder_exists;
+
+	/// Number of successful lookups
+	std::atomic<size_t>  my_hits = ATOMIC_VAR_INIT(0);
+
+	/// Number of lookups with no valid entry
+	std::atomic<size_t>  my_misses = ATOMIC_VAR_INIT(0);
+
+	/// Number of entries written
+	std::atomic<size_t>  my_stores = ATOMIC_VAR_INIT(0);
+
+	/// Total microseconds taken to obtain pixels for loads that hit
+	std::atomic<int64_t>  my_hit_time = ATOMIC_VAR_INIT(0);
+
+	/// Total microseconds taken to obtain pixels for loads that missed
+	std::atomic<int64_t>  my_miss_time = ATOMIC_VAR_INIT(0);
+
+
+	/**
+	 * Builds the cache file path for the key
+	 *
+	 * @param[in] content_hash
+	 *  The source content hash
+	 * @param[in] content_size
+	 *  The source content size
+	 * @return
+	 *  The absolute file path; empty if no folder is configured
+	 */
+	std::string
+	EntryPath(
+		uint64_t content_hash,
+		size_t content_size
+	) const;
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 */
+	ImageDiskCache();
+
+
+	/**
+	 * Standard destructor
+	 */
+	~ImageDiskCache();
+
+
+	/**
+	 * Generates the content hash used as the cache key
+	 *
+	 * 64-bit FNV-1a; speed over strength, as only accidental collisions need
+	 * avoiding, and the source size forms part of the key too.
+	 *
+	 * @param[in] data
+	 *  The source file content
+	 * @param[in] len
+	 *  The number of bytes in data
+	 * @return
+	 *  The hash value
+	 */
+	static uint64_t
+	ContentHash(
+		const unsigned char* data,
+		size_t len
+	);
+
+
+	/**
+	 * Determines if the cache is usable
+	 *
+	 * @return
+	 *  true if compiled in and a folder has been set, otherwise false
+	 */
+	bool
+	IsEnabled() const;
+
+
+	/**
+	 * Looks up a decoded image
+	 *
+	 * @param[in] content_hash
+	 *  The hash of the source file content, from ContentHash
+	 * @param[in] content_size
+	 *  The size of the source file content
+	 * @return
+	 *  The mapped image on a hit, or nullptr if absent or invalid
+	 */
+	std::unique_ptr<cached_image>
+	Lookup(
+		uint64_t content_hash,
+		size_t content_size
+	);
+
+
+	/**
+	 * Records how long a load took to obtain its pixel data
+	 *
+	 * The totals for hits and misses are logged on destruction, giving the
+	 * time saved by the cache over a run; compare a cold run (empty cache
+	 * folder) with a warm one.
+	 *
+	 * @param[in] hit
+	 *  true if the pixels came from the cache, false if decoded
+	 * @param[in] elapsed
+	 *  The time taken, including hashing and lookup
+	 */
+	void
+	RecordLoad(
+		bool hit,
+		std::chrono::microseconds elapsed
+	);
+
+
+	/**
+	 * Sets the folder cache files are stored in
+	 *
+	 * The folder is created on the first store, not here.
+	 *
+	 * @param[in] folder
+	 *  The absolute folder path
+	 */
+	void
+	SetFolder(
+		const std::string& folder
+	);
+
+
+	/**
+	 * Writes a decoded image to the cache
+	 *
+	 * Written to a temporary file and renamed, so concurrent readers never
+	 * observe a partial entry.
+	 *
+	 * @param[in] content_hash
+	 *  The hash of the source file content, from ContentHash
+	 * @param[in] content_size
+	 *  The size of the source file content
+	 * @param[in] width
+	 *  The image width
+	 * @param[in] height
+	 *  The image height
+	 * @param[in] bytes_per_pixel
+	 *  The bytes per pixel of the pixel data
+	 * @param[in] pixels
+	 *  The decoded pixel data, width * height * bytes_per_pixel in size
+	 * @return
+	 *  An error code on failure, otherwise ErrNONE
+	 */
+	int
+	Store(
+		uint64_t content_hash,
+		size_t content_size,
+		int width,
+		int height,
+		int bytes_per_pixel,
+		const unsigned char* pixels
+	);
+};
+
+
+} // namespace engine
+} // namespace trezanik
@@ -73,6 +73,13 @@ Resource::GetFilepath() const
 }
 
 
+size_t
+Resource::GetMemoryUsage() const
+{
+	return 0;
+}
+
+
 const MediaType&
 Resource::GetMediaType() const
 {
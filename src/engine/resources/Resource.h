@@ -136,6 +136,20 @@ public:
 	GetResourceID() const override;
 
 
+	/**
+	 * Obtains the number of bytes of loaded data this resource holds
+	 *
+	 * Used by the ResourceCache for budget accounting. This is an estimate of
+	 * the decoded data (e.g. texture pixels, PCM samples), not the size of the
+	 * source file or the object itself.
+	 *
+	 * @return
+	 *  The byte count; 0 if not loaded or the type is not accounted
+	 */
+	virtual size_t
+	GetMemoryUsage() const;
+
+
 	/// @todo add IsLoaded/IsReady to obtain readystate?
 
 
@@ -16,6 +16,7 @@
 #include "core/services/event/EventDispatcher.h"
 #include "core/services/log/Log.h"
 #include "core/services/log/LogEvent.h"
+#include "core/services/metrics/Metrics.h"
 #include "core/error.h"
 
 #include <algorithm>
@@ -26,6 +27,9 @@ namespace engine {
 
 
 ResourceCache::ResourceCache()
+: my_metric_bytes(&core::ServiceLocator::Metrics()->Gauge("resource_cache_bytes", "Bytes of resource data held in the cache"))
+, my_metric_entries(&core::ServiceLocator::Metrics()->Gauge("resource_cache_entries", "Resources presently cached"))
+, my_metric_evictions(&core::ServiceLocator::Metrics()->Counter("resource_cache_evictions_total", "Resources removed to remain within budget"))
 {
 	using namespace trezanik::core;
 
@@ -49,14 +53,93 @@ ResourceCache::~ResourceCache()
 }
 
 
+void
+ResourceCache::Account(
+	const cache_entry& entry,
+	bool adding
+)
+{
+	size_t*  target = nullptr;
+
+	switch ( entry.memclass )
+	{
+	case ResourceMemoryClass::Texture: target = &my_stats.texture_bytes; break;
+	case ResourceMemoryClass::PCM:     target = &my_stats.pcm_bytes; break;
+	case ResourceMemoryClass::Font:    target = &my_stats.font_bytes; break;
+	case ResourceMemoryClass::Other:
+	default:
+		target = &my_stats.other_bytes;
+		break;
+	}
+
+	if ( adding )
+	{
+		*target += entry.bytes;
+	}
+	else
+	{
+		*target -= std::min(*target, entry.bytes);
+	}
+
+	my_metric_bytes->Set(static_cast<int64_t>(my_stats.TotalBytes()));
+}
+
+
 void
 ResourceCache::Add(
 	std::shared_ptr<Resource> resource
 )
 {
+	using namespace trezanik::core;
+
 	std::lock_guard<std::mutex>  lock_guard(my_lock);
 
-	my_cache.push_back(resource);
+	const ResourceID&  rid = resource->GetResourceID();
+
+	if ( my_cache.find(rid) != my_cache.end() )
+	{
+		TZK_LOG_FORMAT(LogLevel::Warning, "Resource %s already cached", rid.GetCanonical());
+		return;
+	}
+
+	cache_entry  entry;
+
+	switch ( resource->GetMediaType() )
+	{
+	case MediaType::image_png:
+	case MediaType::image_tga:
+	case MediaType::image_spritesheet:
+		entry.memclass = ResourceMemoryClass::Texture;
+		break;
+	case MediaType::audio_flac:
+	case MediaType::audio_opus:
+	case MediaType::audio_vorbis:
+	case MediaType::audio_wave:
+		entry.memclass = ResourceMemoryClass::PCM;
+		break;
+	case MediaType::font_ttf:
+		entry.memclass = ResourceMemoryClass::Font;
+		break;
+	default:
+		entry.memclass = ResourceMemoryClass::Other;
+		break;
+	}
+
+	entry.resource = resource;
+	entry.bytes = resource->GetMemoryUsage();
+	my_lru.push_front(rid);
+	entry.lru_pos = my_lru.begin();
+
+	Account(entry, true);
+	my_cache.emplace(rid, entry);
+	if ( !resource->GetFilepath().empty() )
+	{
+		my_path_index[resource->GetFilepath()] = rid;
+	}
+	my_stats.count = my_cache.size();
+	my_metric_entries->Set(static_cast<int64_t>(my_stats.count));
+
+	EvictToBudget();
 }
 
 
@@ -70,27 +153,107 @@ ResourceCache::Dump() const
 	TZK_LOG_FORMAT(
 		LogLevel::Mandatory,
 		"Dumping Resource Cache contents\n"
-		"\tResource Cache: [size/capacity = %zu/%zu]",
-		my_cache.size(), my_cache.capacity()
+		"\tResource Cache: [size/buckets = %zu/%zu]\n"
+		"\tMemory: [texture=%zu, pcm=%zu, font=%zu, other=%zu, budget=%zu]\n"
+		"\tLookups: [hits=%zu, misses=%zu, evictions=%zu]",
+		my_cache.size(), my_cache.bucket_count(),
+		my_stats.texture_bytes, my_stats.pcm_bytes, my_stats.font_bytes,
+		my_stats.other_bytes, my_stats.budget,
+		my_stats.hits, my_stats.misses, my_stats.evictions
 	);
 
 	size_t  counter = 0;
 
-	for ( auto& r : my_cache )
+	// dumped in usage order, most recent first
+	for ( auto& rid : my_lru )
 	{
+		auto&  r = my_cache.at(rid).resource;
+
 		TZK_LOG_FORMAT_HINT(
 			LogLevel::Mandatory, LogHints_NoHeader,
-			"\t[%zu] %s (%s) = %s (held by %ld)",
+			"\t[%zu] %s (%s) = %s (held by %ld, %zu bytes)",
 			counter++,
 			r->GetResourceID().GetCanonical(),
 			TConverter<MediaType>::ToString(r->GetMediaType()).c_str(),
 			r->GetFilepath().c_str(),
-			r.use_count()
+			r.use_count(),
+			my_cache.at(rid).bytes
+		);
+	}
+}
+
+
+void
+ResourceCache::Erase(
+	std::unordered_map<ResourceID, cache_entry>::iterator iter
+)
+{
+	auto  path = my_path_index.find(iter->second.resource->GetFilepath());
+
+	if ( path != my_path_index.end() && path->second == iter->first )
+	{
+		my_path_index.erase(path);
+	}
+
+	Account(iter->second, false);
+	my_lru.erase(iter->second.lru_pos);
+	my_cache.erase(iter);
+	my_stats.count = my_cache.size();
+	my_metric_entries->Set(static_cast<int64_t>(my_stats.count));
+}
+
+
+void
+ResourceCache::EvictToBudget()
+{
+	using namespace trezanik::core;
+
+	if ( my_stats.budget == 0 )
+		return;
+
+	auto  pos = my_lru.end();
+
+	// walk from least recently used, skipping anything still in use
+	while ( my_stats.TotalBytes() > my_stats.budget && pos != my_lru.begin() )
+	{
+		--pos;
+
+		auto  iter = my_cache.find(*pos);
+
+		if ( iter->second.bytes == 0
+		  || iter->second.memclass == ResourceMemoryClass::Other
+		  || iter->second.resource.use_count() > 1 )
+			continue;
+
+		TZK_LOG_FORMAT(LogLevel::Debug,
+			"Evicting resource %s (%zu bytes) to remain within budget",
+			iter->first.GetCanonical(), iter->second.bytes
 		);
+
+		EventData::resource_state  state_data{
+			iter->second.resource, ResourceState::Unloaded
+		};
+		core::ServiceLocator::EventDispatcher()->DispatchEvent(uuid_resourcestate, state_data);
+
+		// erasure invalidates pos; resume from its successor, which remains valid
+		auto  resume = std::next(pos);
+		Erase(iter);
+		pos = resume;
+		my_stats.evictions++;
+		my_metric_evictions->Increment();
 	}
 }
 
 
+resource_cache_stats
+ResourceCache::GetStatistics() const
+{
+	std::lock_guard<std::mutex>  lock_guard(my_lock);
+
+	return my_stats;
+}
+
+
 std::shared_ptr<Resource>
 ResourceCache::GetResource(
 	ResourceID& rid
@@ -98,13 +261,19 @@ ResourceCache::GetResource(
 {
 	std::lock_guard<std::mutex>  lock_guard(my_lock);
 
-	for ( auto& r : my_cache )
+	auto  iter = my_cache.find(rid);
+
+	if ( iter == my_cache.end() )
 	{
-		if ( r->GetResourceID() == rid )
-			return r;
+		my_stats.misses++;
+		return nullptr;
 	}
 
-	return nullptr;
+	my_stats.hits++;
+	// promote to most recently used
+	my_lru.splice(my_lru.begin(), my_lru, iter->second.lru_pos);
+
+	return iter->second.resource;
 }
 
 
@@ -115,13 +284,16 @@ ResourceCache::GetResourceID(
 {
 	std::lock_guard<std::mutex>  lock_guard(my_lock);
 
-	for ( auto& r : my_cache )
+	auto  iter = my_path_index.find(fpath);
+
+	if ( iter == my_path_index.end() )
 	{
-		if ( r->GetFilepath().compare(fpath) == 0 )
-			return r->GetResourceID();
+		my_stats.misses++;
+		return null_id;
 	}
 
-	return null_id;
+	my_stats.hits++;
+	return iter->second;
 }
 
 
@@ -131,6 +303,15 @@ ResourceCache::Purge()
 	std::lock_guard<std::mutex>  lock_guard(my_lock);
 
 	my_cache.clear();
+	my_path_index.clear();
+	my_lru.clear();
+	my_stats.count = 0;
+	my_stats.texture_bytes = 0;
+	my_stats.pcm_bytes = 0;
+	my_stats.font_bytes = 0;
+	my_stats.other_bytes = 0;
+	my_metric_bytes->Set(0);
+	my_metric_entries->Set(0);
 }
 
 
@@ -147,9 +328,7 @@ ResourceCache::Remove(
 	{
 		std::lock_guard<std::mutex>  lock_guard(my_lock);
 
-		auto  res = std::find_if(my_cache.begin(), my_cache.end(), [&rid](std::shared_ptr<Resource> res){
-			return res->GetResourceID() == rid;
-		});
+		auto  res = my_cache.find(rid);
 	
 		if ( res == my_cache.end() )
 		{
@@ -159,20 +338,46 @@ ResourceCache::Remove(
 		
 		TZK_LOG_FORMAT(LogLevel::Info,
 			"Resource %s has %ld active users, including self",
-			rid.GetCanonical(), res->use_count()
+			rid.GetCanonical(), res->second.resource.use_count()
 		);
 
 		EventData::resource_state  state_data{
-			(*res), ResourceState::Unloaded
+			res->second.resource, ResourceState::Unloaded
 		};
 		core::ServiceLocator::EventDispatcher()->DispatchEvent(uuid_resourcestate, state_data);
 
-		my_cache.erase(res);
+		Erase(res);
 	}
 
 	return ErrNONE;
 }
 
 
+void
+ResourceCache::SetBudget(
+	size_t bytes
+)
+{
+	using namespace trezanik::core;
+
+	std::lock_guard<std::mutex>  lock_guard(my_lock);
+
+	TZK_LOG_FORMAT(LogLevel::Debug, "Resource cache budget set to %zu bytes", bytes);
+
+	my_stats.budget = bytes;
+
+	EvictToBudget();
+}
+
+
+void
+ResourceCache::Trim()
+{
+	std::lock_guard<std::mutex>  lock_guard(my_lock);
+
+	EvictToBudget();
+}
+
+
 } // namespace engine
 } // namespace trezanik
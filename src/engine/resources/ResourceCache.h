@@ -13,22 +13,88 @@
 #include "engine/resources/ResourceTypes.h"
 #include "core/util/SingularInstance.h"
 
+#include <list>
 #include <memory>
 #include <mutex>
-#include <vector>
+#include <string>
+#include <unordered_map>
 
 
 namespace trezanik {
+namespace core {
+	class MetricCounter;
+	class MetricGauge;
+} // namespace core
 namespace engine {
 
 
 class Resource;
 
 
+/**
+ * The memory category a cached resource is accounted against
+ */
+enum class ResourceMemoryClass : uint8_t
+{
+	Texture = 0,  //< decoded image/texture data
+	PCM,          //< decoded audio samples
+	Font,         //< font faces and glyph data
+	Other         //< anything else; not eligible for budget eviction
+};
+
+
+/**
+ * Snapshot of the cache usage and effectiveness
+ *
+ * Returned by value, so is safe to retain and read without locking
+ */
+struct resource_cache_stats
+{
+	/// number of lookups that found the resource
+	size_t  hits = 0;
+	/// number of lookups that did not find the resource
+	size_t  misses = 0;
+	/// number of resources removed to remain within budget
+	size_t  evictions = 0;
+	/// number of resources presently cached
+	size_t  count = 0;
+	/// the configured budget in bytes; 0 if unlimited
+	size_t  budget = 0;
+	/// bytes of texture data held
+	size_t  texture_bytes = 0;
+	/// bytes of decoded audio held
+	size_t  pcm_bytes = 0;
+	/// bytes of font data held
+	size_t  font_bytes = 0;
+	/// bytes of any other resource data held
+	size_t  other_bytes = 0;
+
+	/**
+	 * Obtains the sum of all accounted memory
+	 *
+	 * @return
+	 *  The total number of bytes held across all categories
+	 */
+	size_t
+	TotalBytes() const
+	{
+		return texture_bytes + pcm_bytes + font_bytes + other_bytes;
+	}
+};
+
+
 /**
  * Holds loaded resources that consumers can get by ID/filepath
  * 
  * Multi-threaded access. All operations wrapped around lock guard.
+ *
+ * Resources are indexed by both their ID and their filepath, so lookups are
+ * constant time regardless of the number of resources loaded. Each resource
+ * has its memory footprint accounted against its class at the time of
+ * addition, and if the total exceeds the configured budget, the least
+ * recently used resources that have no holders beyond this cache are evicted
+ * until back within budget.
+ * Resources reporting no memory usage (e.g. workspaces) are never evicted.
  */
 class TZK_ENGINE_API ResourceCache
 	: private trezanik::core::SingularInstance<ResourceCache>
@@ -40,11 +106,84 @@ class TZK_ENGINE_API ResourceCache
 
 private:
 
+	/**
+	 * Tracking data for each cached resource
+	 */
+	struct cache_entry
+	{
+		/// the cached resource
+		std::shared_ptr<Resource>  resource;
+		/// position in the LRU list, for constant-time promotion
+		std::list<ResourceID>::iterator  lru_pos;
+		/// bytes accounted for this resource upon addition
+		size_t  bytes;
+		/// the category the bytes are accounted against
+		ResourceMemoryClass  memclass;
+	};
+
 	/** Multi-threaded mutex safeguard */
 	mutable std::mutex  my_lock;
 
-	/** All loaded resources */
-	std::vector<std::shared_ptr<Resource>>  my_cache;
+	/** All loaded resources, keyed by their ID */
+	std::unordered_map<ResourceID, cache_entry>  my_cache;
+
+	/** Filepath to resource ID index, for filepath lookups */
+	std::unordered_map<std::string, ResourceID>  my_path_index;
+
+	/** Resource IDs in usage order; front is the most recently used */
+	std::list<ResourceID>  my_lru;
+
+	/** Usage, effectiveness and budget details */
+	resource_cache_stats  my_stats;
+
+	/** metrics counterpart to my_stats.TotalBytes(); registry owned */
+	trezanik::core::MetricGauge*  my_metric_bytes;
+
+	/** metrics counterpart to my_stats.count; registry owned */
+	trezanik::core::MetricGauge*  my_metric_entries;
+
+	/** metrics counterpart to my_stats.evictions; registry owned */
+	trezanik::core::MetricCounter*  my_metric_evictions;
+
+
+	/**
+	 * Adjusts the memory class accounting by the supplied entry
+	 *
+	 * @param[in] entry
+	 *  The cache entry being added or removed
+	 * @param[in] adding
+	 *  true if the entry is being added, false if being removed
+	 */
+	void
+	Account(
+		const cache_entry& entry,
+		bool adding
+	);
+
+
+	/**
+	 * Evicts least recently used resources until within budget
+	 *
+	 * Caller must be holding the lock. Only resources with no other holders,
+	 * a non-zero memory footprint, and a memory class other than Other are
+	 * candidates.
+	 */
+	void
+	EvictToBudget();
+
+
+	/**
+	 * Removes the entry from all indexes and accounting
+	 *
+	 * Caller must be holding the lock, and the iterator must be valid
+	 *
+	 * @param[in] iter
+	 *  Iterator to the entry within my_cache
+	 */
+	void
+	Erase(
+		std::unordered_map<ResourceID, cache_entry>::iterator iter
+	);
 
 protected:
 public:
@@ -84,9 +223,21 @@ public:
 	Dump() const;
 
 
+	/**
+	 * Obtains the cache statistics
+	 *
+	 * @return
+	 *  A copy of the statistics at the time of the call
+	 */
+	resource_cache_stats
+	GetStatistics() const;
+
+
 	/**
 	 * Obtains a resource based on its ResourceID
 	 *
+	 * Marks the resource as the most recently used
+	 *
 	 * @param[in] rid
 	 *  The resource id to lookup
 	 * @return
@@ -151,6 +302,31 @@ public:
 	Remove(
 		const ResourceID& rid
 	);
+
+
+	/**
+	 * Sets the memory budget for all cached resources
+	 *
+	 * If the current usage exceeds the new budget, eviction is performed
+	 * immediately.
+	 *
+	 * @param[in] bytes
+	 *  The number of bytes permitted; 0 disables the budget
+	 */
+	void
+	SetBudget(
+		size_t bytes
+	);
+
+
+	/**
+	 * Evicts unreferenced resources if the cache exceeds its budget
+	 *
+	 * Intended for periodic invocation (e.g. garbage collection), since
+	 * resources only become eligible once all external holders release them
+	 */
+	void
+	Trim();
 };
 
 
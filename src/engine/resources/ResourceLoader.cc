@@ -26,6 +26,8 @@
 #	include <Windows.h>
 #endif
 
+#include <algorithm>
+
 
 namespace trezanik {
 namespace engine {
@@ -36,6 +38,9 @@ ResourceLoader::ResourceLoader(
 )
 : my_cache(cache)
 , my_stop_trigger(false)
+, my_batch_loaded(0)
+, my_batch_failed(0)
+, my_batch_merged(0)
 , my_max_thread_count(minimum_thread_count)
 {
 	using namespace trezanik::core;
@@ -73,8 +78,8 @@ ResourceLoader::~ResourceLoader()
 		if ( my_loader.joinable() )
 		{
 			// these won't be touched regardless, but I like to cleanup
-			while ( !my_tasks.empty() )
-				my_tasks.pop();
+			for ( auto& queue : my_tasks )
+				queue.clear();
 
 			my_loader.join();
 		}
@@ -140,29 +145,16 @@ ResourceLoader::AddExternalTypeLoader(
 
 int
 ResourceLoader::AddResource(
-	std::shared_ptr<Resource> resource
+	std::shared_ptr<Resource> resource,
+	LoadPriority priority
 )
 {
 	using namespace trezanik::core;
 
 	// Prevent duplicate resources of the same file
 	ResourceID  existing = my_cache.GetResourceID(resource->GetFilepath().c_str());
-	bool  duplicated = false;
 
 	if ( existing != null_id )
-	{
-		duplicated = true;
-	}
-	for ( auto& rtl : my_resources_to_load )
-	{
-		if ( rtl.second->GetFilepath() == resource->GetFilepath() )
-		{
-			existing = rtl.second->GetResourceID();
-			duplicated = true;
-			break;
-		}
-	}
-	if ( duplicated )
 	{
 		TZK_LOG_FORMAT(
 			LogLevel::Warning,
@@ -198,65 +190,139 @@ ResourceLoader::AddResource(
 		}
 	}
 
+	async_task  task;
+	bool  handled = false;
+
 	// loop all inbuilt initially
 	for ( auto& ldr : my_resource_loaders )
 	{
 		if ( ldr->HandlesMediaType(mediatype) )
 		{
-			auto  task = ldr->GetLoadFunction(resource);
-
-			if ( task )
+			task = ldr->GetLoadFunction(resource);
+			handled = true;
+			break;
+		}
+	}
+	// loop all external additions
+	if ( !handled )
+	{
+		for ( auto& ldr : my_external_resource_loaders )
+		{
+			if ( ldr.second->HandlesMediaType(mediatype) )
 			{
-				std::lock_guard<std::mutex>  lock(my_loader_lock);
+				task = ldr.second->GetLoadFunction(resource);
+				handled = true;
+				break;
+			}
+		}
+	}
 
-				my_resources_to_load.emplace_back(task, resource);
+	if ( !handled )
+	{
+		TZK_LOG_FORMAT(
+			LogLevel::Warning,
+			"No resource handler available for media type '%s', resource %s",
+			TConverter<MediaType>::ToString(resource->GetMediaType()).c_str(),
+			resource->GetResourceID().GetCanonical()
+		);
+		return ENOENT;
+	}
+	if ( !task )
+	{
+		TZK_LOG_FORMAT(
+			LogLevel::Warning,
+			"Failed to obtain task from loader function for resource %s",
+			resource->GetResourceID().GetCanonical()
+		);
+		return EFAULT;
+	}
 
-				return ErrNONE;
-			}
 
+	std::lock_guard<std::mutex>  lock(my_loader_lock);
+	inflight_key  key(resource->GetFilepath(), mediatype);
+
+	if ( !key.first.empty() )
+	{
+		auto  iter = my_inflight_files.find(key);
+
+		if ( iter != my_inflight_files.end() )
+		{
+			// merge into the existing load rather than reading the file twice
 			TZK_LOG_FORMAT(
-				LogLevel::Warning,
-				"Failed to obtain task from loader function for resource %s",
-				resource->GetResourceID().GetCanonical()
+				LogLevel::Debug,
+				"Resource '%s' for path '%s' merged into pending load '%s'",
+				resource->GetResourceID().GetCanonical(), key.first.c_str(),
+				iter->second->resource->GetResourceID().GetCanonical()
 			);
-			return EFAULT;
+			Promote(iter->second, priority);
+			iter->second->merged++;
+			my_batch_merged++;
+			return EEXIST;
 		}
 	}
 
-	// loop all external additions
-	for ( auto& ldr : my_external_resource_loaders )
+	auto  request = std::make_shared<load_request>();
+
+	request->task = task;
+	request->resource = resource;
+	request->priority = priority;
+	request->future = request->promise.get_future().share();
+	request->requested = std::chrono::steady_clock::now();
+
+	if ( my_inflight.empty() )
 	{
-		// could be a lambda but it looks fucking awful, so this is a copy of above + mapped
-		if ( ldr.second->HandlesMediaType(mediatype) )
-		{
-			auto  task = ldr.second->GetLoadFunction(resource);
+		my_batch_start = request->requested;
+	}
 
-			if ( task )
-			{
-				std::lock_guard<std::mutex>  lock(my_loader_lock);
+	my_inflight[resource->GetResourceID()] = request;
+	if ( !key.first.empty() )
+	{
+		my_inflight_files[key] = request;
+	}
+	my_resources_to_load.emplace_back(request);
 
-				my_resources_to_load.emplace_back(task, resource);
+	return ErrNONE;
+}
 
-				return ErrNONE;
-			}
 
-			TZK_LOG_FORMAT(
-				LogLevel::Warning,
-				"Failed to obtain task from loader function for resource %s",
-				resource->GetResourceID().GetCanonical()
-			);
-			return EFAULT;
+void
+ResourceLoader::Complete(
+	std::shared_ptr<load_request> request,
+	std::shared_ptr<Resource> result
+)
+{
+	using namespace trezanik::core;
+
+	auto  elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - request->requested);
+
+	{
+		std::lock_guard<std::mutex>  lock(my_loader_lock);
+
+		my_inflight.erase(request->resource->GetResourceID());
+
+		auto  fiter = my_inflight_files.find(inflight_key(request->resource->GetFilepath(), request->resource->GetMediaType()));
+		if ( fiter != my_inflight_files.end() && fiter->second == request )
+		{
+			my_inflight_files.erase(fiter);
 		}
-	}
 
+		TZK_LOG_FORMAT(LogLevel::Debug,
+			"Resource load %s for '%s' in %lld microseconds from request (priority %u, %zu merged)",
+			result != nullptr ? "completed" : "failed",
+			request->resource->GetFilepath().c_str(), static_cast<long long>(elapsed.count()),
+			static_cast<unsigned>(request->priority), request->merged
+		);
 
-	TZK_LOG_FORMAT(
-		LogLevel::Warning,
-		"No resource handler available for media type '%s', resource %s",
-		TConverter<MediaType>::ToString(resource->GetMediaType()).c_str(),
-		resource->GetResourceID().GetCanonical()
-	);
-	return ENOENT;
+		if ( result != nullptr )
+			my_batch_loaded++;
+		else
+			my_batch_failed++;
+
+		ReportBatch();
+	}
+
+	// anyone waiting on the future is released
+	request->promise.set_value(result);
 }
 
 
@@ -313,26 +379,99 @@ ResourceLoader::GetTask()
 {
 	std::unique_lock<std::mutex>  lock(my_tasks_lock);
 
-	my_tasks_condvar.wait(
-		lock, [&] {
-			return (my_running_thread_count > my_max_thread_count) || my_stop_trigger || !my_tasks.empty();
+	auto  has_tasks = [this]() {
+		for ( auto& queue : my_tasks )
+		{
+			if ( !queue.empty() )
+				return true;
 		}
-	);
+		return false;
+	};
 
-	if ( my_stop_trigger )
+	for ( ;; )
 	{
-		return { true, nullptr, nullptr };
+		my_tasks_condvar.wait(
+			lock, [&] {
+				return (my_running_thread_count > my_max_thread_count) || my_stop_trigger || has_tasks();
+			}
+		);
+
+		if ( my_stop_trigger )
+		{
+			return { true, nullptr };
+		}
+
+		if ( my_running_thread_count > my_max_thread_count )
+		{
+			my_running_thread_count--;
+			return { true, nullptr };
+		}
+
+		// highest priority class first; claimed entries were promoted
+		for ( auto& queue : my_tasks )
+		{
+			while ( !queue.empty() )
+			{
+				auto  r = std::move(queue.front());
+				queue.pop_front();
+
+				if ( !r->claimed.exchange(true) )
+				{
+					return { false, r };
+				}
+			}
+		}
 	}
+}
 
-	if ( my_running_thread_count > my_max_thread_count )
+
+load_future
+ResourceLoader::Load(
+	std::shared_ptr<Resource> resource,
+	LoadPriority priority
+)
+{
+	using namespace trezanik::core;
+
+	auto  ready = [](std::shared_ptr<Resource> res) {
+		std::promise<std::shared_ptr<Resource>>  p;
+		p.set_value(res);
+		return p.get_future().share();
+	};
+
+	ResourceID  existing = my_cache.GetResourceID(resource->GetFilepath().c_str());
+
+	if ( existing != null_id )
+	{
+		return ready(my_cache.GetResource(existing));
+	}
+
+	int  rc = AddResource(resource, priority);
+
+	if ( rc != ErrNONE && rc != EEXIST )
 	{
-		my_running_thread_count--;
-		return { true, nullptr, nullptr };
+		return ready(nullptr);
 	}
 
-	auto  r = std::move(my_tasks.front());
-	my_tasks.pop();
-	return { false, r.first, r.second };
+	{
+		std::lock_guard<std::mutex>  lock(my_loader_lock);
+
+		auto  iter = my_inflight_files.find(inflight_key(resource->GetFilepath(), resource->GetMediaType()));
+		if ( iter != my_inflight_files.end() )
+		{
+			return iter->second->future;
+		}
+
+		auto  riter = my_inflight.find(resource->GetResourceID());
+		if ( riter != my_inflight.end() )
+		{
+			return riter->second->future;
+		}
+	}
+
+	// completed between addition and lookup, or was already cached
+	existing = my_cache.GetResourceID(resource->GetFilepath().c_str());
+	return ready(existing != null_id ? my_cache.GetResource(existing) : nullptr);
 }
 
 
@@ -392,9 +531,14 @@ ResourceLoader::LoaderThread()
 
 		if ( !my_resources_to_load.empty() )
 		{
-			for ( auto& tr_pair : my_resources_to_load )
 			{
-				my_tasks.push(tr_pair);
+				std::lock_guard<std::mutex>  lock(my_tasks_lock);
+
+				for ( auto& request : my_resources_to_load )
+				{
+					request->queued = true;
+					my_tasks[static_cast<size_t>(request->priority)].push_back(request);
+				}
 			}
 
 			TZK_LOG_FORMAT(LogLevel::Debug,
@@ -446,6 +590,40 @@ ResourceLoader::LoaderThread()
 }
 
 
+void
+ResourceLoader::Promote(
+	std::shared_ptr<load_request> request,
+	LoadPriority priority
+)
+{
+	using namespace trezanik::core;
+
+	if ( priority >= request->priority )
+		return;
+
+	TZK_LOG_FORMAT(LogLevel::Debug,
+		"Promoting resource load %s to priority %u",
+		request->resource->GetResourceID().GetCanonical(), static_cast<unsigned>(priority)
+	);
+
+	request->priority = priority;
+
+	if ( request->queued )
+	{
+		/*
+		 * The existing entry remains in the lower queue; whichever is reached
+		 * first claims the request and the other is discarded
+		 */
+		{
+			std::lock_guard<std::mutex>  lock(my_tasks_lock);
+			my_tasks[static_cast<size_t>(priority)].push_back(request);
+		}
+		my_tasks_condvar.notify_one();
+	}
+	// else: still staged, and will be queued with the new priority on sync
+}
+
+
 int
 ResourceLoader::RemoveExternalTypeLoader(
 	trezanik::core::UUID& uuid
@@ -466,6 +644,27 @@ ResourceLoader::RemoveExternalTypeLoader(
 }
 
 
+void
+ResourceLoader::ReportBatch()
+{
+	using namespace trezanik::core;
+
+	if ( !my_inflight.empty() )
+		return;
+
+	auto  elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - my_batch_start);
+
+	TZK_LOG_FORMAT(LogLevel::Info,
+		"Resource loads settled: %zu loaded, %zu failed, %zu duplicate requests merged, in %lld microseconds",
+		my_batch_loaded, my_batch_failed, my_batch_merged, static_cast<long long>(elapsed.count())
+	);
+
+	my_batch_loaded = 0;
+	my_batch_failed = 0;
+	my_batch_merged = 0;
+}
+
+
 void
 ResourceLoader::Run()
 {
@@ -485,8 +684,7 @@ ResourceLoader::Run()
 	{
 		auto  task_status = GetTask(); // blocks until available
 		bool  stopped    = std::get<0>(task_status);
-		async_task  task = std::get<1>(task_status);
-		auto  resource   = std::get<2>(task_status);
+		auto  request    = std::get<1>(task_status);
 
 		// if thread has been requested to stop, stop it here
 		if ( stopped )
@@ -494,17 +692,21 @@ ResourceLoader::Run()
 			break;
 		}
 
-		if ( task )
+		if ( request != nullptr && request->task )
 		{
+			auto  resource = request->resource;
+			std::shared_ptr<Resource>  result;
+
 			TZK_LOG(LogLevel::Debug, "Executing task");
 
 			try
 			{
 				// execute the task
-				if ( task(resource) == ErrNONE )
+				if ( request->task(resource) == ErrNONE )
 				{
 					// add to cache
 					my_cache.Add(resource);
+					result = resource;
 				}
 			}
 			catch ( const std::exception& e )
@@ -526,6 +728,8 @@ ResourceLoader::Run()
 				core::ServiceLocator::EventDispatcher()->DispatchEvent(uuid_resourcestate, state_data);
 			}
 
+			Complete(request, result);
+
 			TZK_LOG(LogLevel::Debug, "Task execution complete");
 		}
 	}
@@ -562,9 +766,18 @@ ResourceLoader::SetThreadPoolCount(
 {
 	using namespace trezanik::core;
 
+	if ( count == automatic_thread_count )
+	{
+		// may return 0 if not computable
+		count = static_cast<uint16_t>(std::min(std::thread::hardware_concurrency(), static_cast<unsigned>(UINT16_MAX - 1)));
+	}
 	if ( count == 0 || count >= UINT16_MAX )
 	{
-		count = 1;
+		count = minimum_thread_count;
+	}
+	if ( count > TZK_RESOURCES_MAX_LOADER_THREADS )
+	{
+		count = TZK_RESOURCES_MAX_LOADER_THREADS;
 	}
 
 	TZK_LOG_FORMAT(LogLevel::Debug, "Thread pool count updated to %u", count);
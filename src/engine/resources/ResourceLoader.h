@@ -14,14 +14,19 @@
 #include "core/services/threading/Threading.h"
 #include "core/util/SingularInstance.h"
 
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <deque>
 #include <functional>
+#include <future>
 #include <mutex>
-#include <queue>
 #include <map>
 #include <set>
+#include <string>
 #include <thread>
 #include <tuple>
+#include <utility>
 #include <vector>
 #include <condition_variable>
 
@@ -35,9 +40,90 @@ class TypeLoader;
 
 /// 65535 maximum threads
 constexpr uint16_t  minimum_thread_count = 1;
+/// Thread count requesting one worker per logical processor
+constexpr uint16_t  automatic_thread_count = 0;
 
-using task_status = std::tuple<bool, async_task, std::shared_ptr<Resource>>;
-using task_resource_pair = std::pair<async_task, std::shared_ptr<Resource>>;
+
+/**
+ * Priority classes for resource loading
+ *
+ * Workers always take the highest priority request available; within a class,
+ * requests are processed in submission order.
+ */
+enum class LoadPriority : uint8_t
+{
+	Blocking = 0,  //< User interface is waiting on this resource
+	Visible,       //< Displayed or used imminently, but not blocking
+	Prefetch,      //< Speculative; load when nothing else is pending
+	Count          //< Number of priority classes; not a valid priority
+};
+
+
+/// The result of a load request; the loaded resource, or nullptr on failure
+using load_future = std::shared_future<std::shared_ptr<Resource>>;
+
+
+/**
+ * Obtains the result of a load request without blocking
+ *
+ * Suited to polling each frame until the resource is available.
+ *
+ * @param[in] load
+ *  The future acquired from ResourceLoader::Load; may be default constructed
+ * @return
+ *  The loaded resource, or nullptr if the load failed or is not yet complete
+ */
+inline std::shared_ptr<Resource>
+load_result(
+	const load_future& load
+)
+{
+	if ( !load.valid() || load.wait_for(std::chrono::seconds(0)) != std::future_status::ready )
+		return nullptr;
+
+	return load.get();
+}
+
+
+/**
+ * A single pending resource load
+ *
+ * Shared between the in-flight index and the priority queues. A promoted
+ * request is present in more than one queue; the claimed flag ensures only
+ * the first worker to reach it executes the task.
+ */
+struct load_request
+{
+	/// The type loader function to execute
+	async_task  task;
+
+	/// The resource being loaded
+	std::shared_ptr<Resource>  resource;
+
+	/// The current priority class; only raised, never lowered
+	LoadPriority  priority;
+
+	/// Set by the first worker to take ownership
+	std::atomic<bool>  claimed = ATOMIC_VAR_INIT(false);
+
+	/// Moved from the staging vector into the task queues; my_loader_lock
+	bool  queued = false;
+
+	/// When the request was first made
+	std::chrono::steady_clock::time_point  requested;
+
+	/// Number of duplicate requests merged into this one; my_loader_lock
+	size_t  merged = 0;
+
+	/// Fulfilled on completion or failure
+	std::promise<std::shared_ptr<Resource>>  promise;
+
+	/// Future handed out to every requestor of this load
+	load_future  future;
+};
+
+using task_status = std::tuple<bool, std::shared_ptr<load_request>>;
+using inflight_key = std::pair<std::string, MediaType>;
 
 
 /**
@@ -47,15 +133,18 @@ using task_resource_pair = std::pair<async_task, std::shared_ptr<Resource>>;
  * type loader class to perform the actual loading. This class is merely the
  * recipient of load requests and handles the hand-off to the type loaders.
  * 
- * The number of threads to use should be around the number of CPU engines minus
- * two. Most resources will attempt to be loaded when little-to-no other
- * activity is ongoing; one engine should be reserved for rendering, and another
- * for the GUI (input) thread.
+ * The number of threads defaults to the number of logical processors. Most
+ * resources will attempt to be loaded when little-to-no other activity is
+ * ongoing, and workers spend much of their time blocked on I/O.
  *
  * As always, this depends on the system. A 24-engine CPU with a 5.4k rpm HDD
  * should not have as many worker threads as a 4-engine CPU with a SSD, since
  * there's an I/O bottleneck. We choose reasonable defaults, but they can be
  * tuned for the system in use if desired.
+ *
+ * Requests for a file that is already being loaded are merged into the
+ * existing request rather than loading it twice; the merged request is raised
+ * to the highest priority asked for, and all requestors share the same future.
  */
 class TZK_ENGINE_API ResourceLoader
 	: private trezanik::core::SingularInstance<ResourceLoader>
@@ -85,8 +174,8 @@ private:
 	/// Thread lock for tasks
 	std::mutex  my_tasks_lock;
 
-	/// All pending tasks
-	std::queue<task_resource_pair>  my_tasks;
+	/// All pending tasks, one queue per LoadPriority class
+	std::array<std::deque<std::shared_ptr<load_request>>, static_cast<size_t>(LoadPriority::Count)>  my_tasks;
 
 	/// Task conditional to sync on tasks changes
 	std::condition_variable  my_tasks_condvar;
@@ -95,7 +184,25 @@ private:
 	std::unique_ptr<trezanik::core::sync_event>  my_sync_event;
 
 	/// Used by the thread to perform loading
-	std::vector<task_resource_pair>  my_resources_to_load;
+	std::vector<std::shared_ptr<load_request>>  my_resources_to_load;
+
+	/// Every request not yet completed, keyed on resource ID; my_loader_lock
+	std::map<ResourceID, std::shared_ptr<load_request>>  my_inflight;
+
+	/// Requests not yet completed, keyed on filepath and media type; my_loader_lock
+	std::map<inflight_key, std::shared_ptr<load_request>>  my_inflight_files;
+
+	/// When the in-flight index last went from empty to populated; my_loader_lock
+	std::chrono::steady_clock::time_point  my_batch_start;
+
+	/// Loads completed successfully since my_batch_start; my_loader_lock
+	size_t  my_batch_loaded;
+
+	/// Loads failed since my_batch_start; my_loader_lock
+	size_t  my_batch_failed;
+
+	/// Duplicate requests merged since my_batch_start; my_loader_lock
+	size_t  my_batch_merged;
 
 	/// Maximum number of threads to be pooled
 	std::atomic<uint16_t>  my_max_thread_count = ATOMIC_VAR_INIT(minimum_thread_count);
@@ -110,6 +217,51 @@ private:
 	std::map<trezanik::core::UUID, std::shared_ptr<TypeLoader>>  my_external_resource_loaders;
 
 
+	/**
+	 * Completes a load request, removing it from the in-flight index
+	 *
+	 * @param[in] request
+	 *  The request to complete
+	 * @param[in] result
+	 *  The resource to provide to waiting futures; nullptr on failure
+	 */
+	void
+	Complete(
+		std::shared_ptr<load_request> request,
+		std::shared_ptr<Resource> result
+	);
+
+
+	/**
+	 * Logs the totals for the current batch of loads, if it has finished
+	 *
+	 * Caller must hold my_loader_lock. A batch spans from the first request
+	 * made while nothing was in flight, to the in-flight index emptying again;
+	 * the first such batch is application startup, so the elapsed time logged
+	 * is the figure to compare when tuning deduplication and priorities.
+	 */
+	void
+	ReportBatch();
+
+
+	/**
+	 * Raises the priority of a pending request
+	 *
+	 * Caller must hold my_loader_lock. If the request has already been queued
+	 * for workers, it is additionally queued in the higher priority class.
+	 *
+	 * @param[in] request
+	 *  The request to promote
+	 * @param[in] priority
+	 *  The new priority class; no change if not higher than the current
+	 */
+	void
+	Promote(
+		std::shared_ptr<load_request> request,
+		LoadPriority priority
+	);
+
+
 	/**
 	 * Determines the mediatype from available file information
 	 *
@@ -130,12 +282,14 @@ private:
 	/**
 	 * Retrieves a new task
 	 *
-	 * Gets the first element queued, or blocks until a task is available
+	 * Gets the first element queued in the highest priority class, or blocks
+	 * until a task is available. Requests already claimed (promoted to a
+	 * higher class) are discarded.
 	 *
 	 * @return
-	 *  A task status - a tuple containing {stopped, task, resource}
-	 *  	pair.first indicated whether the thread has been marked for stop and should return immediately
-	 *		pair.second contains the task to be executed
+	 *  A task status - a tuple containing {stopped, request}
+	 *  	first indicates whether the thread has been marked for stop and should return immediately
+	 *		second contains the request to be executed
 	 */
 	task_status
 	GetTask();
@@ -206,9 +360,15 @@ public:
 	/**
 	 * Adds a resource to the loader queue
 	 *
+	 * If the same file is already queued, no new load is created; the pending
+	 * request is raised to the supplied priority if higher, and EEXIST is
+	 * returned. Use Load to obtain the shared result in this situation.
+	 *
 	 * @param[in] resource
 	 *  The base class resource to be loaded. Requires all parameters to be
 	 *  suitably prepared
+	 * @param[in] priority
+	 *  The priority class for this load
 	 * @return
 	 *  - ErrNONE on successful addition
 	 *  - ENOENT if no resource handler is available for the media type
@@ -218,7 +378,33 @@ public:
 	 */
 	int
 	AddResource(
-		std::shared_ptr<Resource> resource
+		std::shared_ptr<Resource> resource,
+		LoadPriority priority = LoadPriority::Visible
+	);
+
+
+	/**
+	 * Requests a resource load, sharing any existing load of the same file
+	 *
+	 * If the file is already in the cache, the returned future is immediately
+	 * ready with the cached resource. If already being loaded, the future of
+	 * that load is returned (and its priority raised if needed). Otherwise,
+	 * the resource is added as per AddResource.
+	 *
+	 * The loader still requires a Sync() call to begin processing.
+	 *
+	 * @param[in] resource
+	 *  The base class resource to be loaded
+	 * @param[in] priority
+	 *  The priority class for this load
+	 * @return
+	 *  A future providing the loaded resource, which may be a different object
+	 *  to the one supplied if merged. nullptr is provided on failure.
+	 */
+	load_future
+	Load(
+		std::shared_ptr<Resource> resource,
+		LoadPriority priority = LoadPriority::Visible
 	);
 
 
@@ -256,12 +442,13 @@ public:
 	 * Sets the (maximum) number of threads to have in the worker pool
 	 *
 	 * @param[in] count
-	 *  The new number of threads; minimum of one, which will use the main
-	 *  loader thread and no pooling
+	 *  The new number of threads; minimum of one. automatic_thread_count (0)
+	 *  uses the number of logical processors, capped to
+	 *  TZK_RESOURCES_MAX_LOADER_THREADS
 	 */
 	void
 	SetThreadPoolCount(
-		uint16_t count = minimum_thread_count
+		uint16_t count = automatic_thread_count
 	);
 
 
@@ -62,6 +62,16 @@ Resource_Audio::GetFiletype() const
 }
 
 
+size_t
+Resource_Audio::GetMemoryUsage() const
+{
+	if ( !_readystate || my_file == nullptr )
+		return 0;
+
+	return my_file->GetRingBuffer()->MemoryUsage();
+}
+
+
 bool
 Resource_Audio::IsMusicTrack() const
 {
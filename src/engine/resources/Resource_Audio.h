@@ -88,6 +88,15 @@ public:
 	GetAudioFile() const;
 
 
+	/**
+	 * Reimplementation of Resource::GetMemoryUsage
+	 *
+	 * Accounts the PCM data held in the ring buffer of the audio file
+	 */
+	virtual size_t
+	GetMemoryUsage() const override;
+
+
 	/**
 	 * Gets the audio file type this resource contains
 	 *
@@ -46,6 +46,20 @@ Resource_Font::~Resource_Font()
 }
 
 
+size_t
+Resource_Font::GetMemoryUsage() const
+{
+#if TZK_USING_FREETYPE
+	if ( my_fnt != nullptr && my_fnt->stream != nullptr )
+	{
+		return my_fnt->stream->size;
+	}
+#endif // TZK_USING_FREETYPE
+
+	return 0;
+}
+
+
 #if TZK_USING_FREETYPE
 FT_Face
 Resource_Font::GetFont_Freetype()
@@ -56,6 +56,15 @@ public:
 	~Resource_Font();
 
 
+	/**
+	 * Reimplementation of Resource::GetMemoryUsage
+	 *
+	 * Accounts the font face data held by the font library
+	 */
+	virtual size_t
+	GetMemoryUsage() const override;
+
+
 #if TZK_USING_FREETYPE
 	FT_Face
 	GetFont_Freetype();
@@ -77,6 +77,8 @@ Resource_Image::~Resource_Image()
 				stbi_image_free(my_container.data);
 #endif
 				break;
+			case LoaderMethod::DiskCache: // mapping is released by the loader
+				break;
 			case LoaderMethod::SDLImage:  // no-op, should be unreachable
 			default:
 				TZK_DEBUG_BREAK;
@@ -94,11 +96,53 @@ Resource_Image::AsSDLTexture()
 {
 	// we could regen if data non-null, but why would it ever be deleted early?
 
+	if ( my_container.atlas.page != nullptr )
+	{
+		return my_container.atlas.page;
+	}
+
 	return my_container.texture;
 }
 #endif
 
 
+const atlas_region&
+Resource_Image::AtlasRegion() const
+{
+	return my_container.atlas;
+}
+
+
+size_t
+Resource_Image::GetMemoryUsage() const
+{
+	size_t  bytes_per_pixel = 0;
+
+	if ( IsAtlased() )
+	{
+		return 0;
+	}
+
+#if TZK_USING_SDL
+	if ( my_container.pixel_format != SDL_PIXELFORMAT_UNKNOWN )
+	{
+		bytes_per_pixel = SDL_BYTESPERPIXEL(my_container.pixel_format);
+	}
+#endif
+	if ( bytes_per_pixel == 0 )
+	{
+		bytes_per_pixel = my_container.bits_per_pixel / 8;
+	}
+	if ( bytes_per_pixel == 0 )
+	{
+		// assume RGBA, as near-all textures will be uploaded as
+		bytes_per_pixel = 4;
+	}
+
+	return static_cast<size_t>(my_container.width) * my_container.height * bytes_per_pixel;
+}
+
+
 int
 Resource_Image::Height() const
 {
@@ -113,6 +157,17 @@ Resource_Image::ImageContainer()
 }
 
 
+bool
+Resource_Image::IsAtlased() const
+{
+#if TZK_USING_SDL
+	return my_container.atlas.page != nullptr;
+#else
+	return false;
+#endif
+}
+
+
 uint32_t
 Resource_Image::PixelFormat() const
 {
@@ -120,6 +175,22 @@ Resource_Image::PixelFormat() const
 }
 
 
+void
+Resource_Image::TextureCoordinates(
+	float& u0,
+	float& v0,
+	float& u1,
+	float& v1
+) const
+{
+	// defaults to the full texture when not atlased
+	u0 = my_container.atlas.u0;
+	v0 = my_container.atlas.v0;
+	u1 = my_container.atlas.u1;
+	v1 = my_container.atlas.v1;
+}
+
+
 int
 Resource_Image::Width() const
 {
@@ -11,6 +11,7 @@
 #include "engine/definitions.h"
 
 #include "engine/resources/Resource.h"
+#include "engine/resources/TextureAtlas.h"
 
 #include <memory>
 
@@ -35,7 +36,8 @@ enum class LoaderMethod : uint8_t
 	Unset = 0,
 	Internal,
 	STBI,
-	SDLImage
+	SDLImage,
+	DiskCache
 };
 
 
@@ -51,9 +53,9 @@ struct image_container
 
 	/**
 	 * Raw image data, if retained and used by the loader.
-	 * SDL_Image will bypass usage, and otherwise expected to be used as a
-	 * temporary for loading until it is mapped to a texture, where it can then
-	 * be freed.
+	 * For SDL_Image this refers to the surface pixels and is not owned;
+	 * otherwise expected to be used as a temporary for loading until it is
+	 * mapped to a texture, where it can then be freed.
 	 */
 	unsigned char*  data = nullptr;
 
@@ -69,10 +71,16 @@ struct image_container
 
 	/**
 	 * The actual texture object passed into the graphics APIs, and stored in
-	 * GPU memory
+	 * GPU memory. Remains nullptr if the image was packed into the atlas
 	 */
 	SDL_Texture*  texture = nullptr;
 #endif
+
+	/**
+	 * The region within the texture atlas, if packed. The page texture is
+	 * owned by the atlas, not this image
+	 */
+	atlas_region  atlas;
 };
 
 
@@ -117,6 +125,10 @@ public:
 	 * 
 	 * If the SDL texture has already been created, this performs no action
 	 * beyond returning the object previously created.
+	 *
+	 * For images packed into the texture atlas, this is the shared page
+	 * texture; the coordinates from TextureCoordinates must be used to draw
+	 * only this image.
 	 * 
 	 * @return
 	 *  A pointer to the SDL Texture generated from the raw image data
@@ -126,6 +138,26 @@ public:
 #endif
 
 
+	/**
+	 * Gets the texture atlas region
+	 *
+	 * @return
+	 *  The region this image occupies; only meaningful if IsAtlased()
+	 */
+	const atlas_region&
+	AtlasRegion() const;
+
+
+	/**
+	 * Reimplementation of Resource::GetMemoryUsage
+	 *
+	 * Accounts the texture dimensions multiplied by the pixel size. Atlased
+	 * images report 0, as the page memory belongs to the atlas
+	 */
+	virtual size_t
+	GetMemoryUsage() const override;
+
+
 	/**
 	 * Gets the number of vertical pixels in the image
 	 * 
@@ -150,6 +182,16 @@ public:
 	ImageContainer();
 
 
+	/**
+	 * Determines if this image was packed into the texture atlas
+	 *
+	 * @return
+	 *  Boolean state
+	 */
+	bool
+	IsAtlased() const;
+
+
 	/**
 	 * Gets the image pixel format
 	 *
@@ -162,6 +204,29 @@ public:
 	PixelFormat() const;
 
 
+	/**
+	 * Gets the texture coordinates to draw this image from its texture
+	 *
+	 * Non-atlased images always occupy the full texture, 0,0 to 1,1.
+	 *
+	 * @param[out] u0
+	 *  The left coordinate
+	 * @param[out] v0
+	 *  The top coordinate
+	 * @param[out] u1
+	 *  The right coordinate
+	 * @param[out] v1
+	 *  The bottom coordinate
+	 */
+	void
+	TextureCoordinates(
+		float& u0,
+		float& v0,
+		float& u1,
+		float& v1
+	) const;
+
+
 	/**
 	 * Gets the number of horizontal pixels in the image
 	 * 
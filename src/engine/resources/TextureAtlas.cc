@@ -0,0 +1,258 @@
+/**
+ * @file        src/engine/resources/TextureAtlas.cc
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "engine/definitions.h"
+
+#include "engine/resources/TextureAtlas.h"
+
+#include "core/services/log/Log.h"
+#include "core/error.h"
+
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "imgui/dear_imgui/imstb_rectpack.h"
+#undef STB_RECT_PACK_IMPLEMENTATION
+
+#if TZK_USING_SDL
+#	include <SDL.h>
+#endif
+
+#include <vector>
+
+
+namespace trezanik {
+namespace engine {
+
+
+/// Transparent border around each packed image, preventing filter bleed
+constexpr int  atlas_padding = 1;
+
+#if TZK_USING_SDL
+/// Pixel format of all pages; matches the 32-bit format used by TypeLoader_Image
+constexpr uint32_t  atlas_pixel_format = SDL_PIXELFORMAT_ARGB8888;
+#endif
+
+
+/**
+ * A single atlas page and its packer state
+ */
+struct atlas_page
+{
+#if TZK_USING_SDL
+	/// The page texture all packed images are drawn from
+	SDL_Texture*  texture = nullptr;
+#endif
+
+	/// Packer context for this page
+	stbrp_context  packer;
+
+	/// Packer working storage; must remain valid for the page lifetime
+	std::vector<stbrp_node>  nodes;
+};
+
+
+TextureAtlas::TextureAtlas()
+: my_page_size(TZK_TEXTURE_ATLAS_PAGE_SIZE)
+, my_packed_count(0)
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Constructor starting");
+	{
+	}
+	TZK_LOG(LogLevel::Trace, "Constructor finished");
+}
+
+
+TextureAtlas::~TextureAtlas()
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Destructor starting");
+	{
+		TZK_LOG_FORMAT(LogLevel::Debug,
+			"Texture atlas held %zu images across %zu pages",
+			my_packed_count, my_pages.size()
+		);
+
+#if TZK_USING_SDL
+		for ( auto& page : my_pages )
+		{
+			if ( page->texture != nullptr )
+			{
+				SDL_DestroyTexture(page->texture);
+			}
+		}
+#endif
+		my_pages.clear();
+	}
+	TZK_LOG(LogLevel::Trace, "Destructor finished");
+}
+
+
+bool
+TextureAtlas::Accepts(
+	int width,
+	int height
+) const
+{
+	if ( TZK_TEXTURE_ATLAS_MAX_IMAGE_SIZE == 0 )
+		return false;
+	if ( width <= 0 || height <= 0 )
+		return false;
+	if ( width > TZK_TEXTURE_ATLAS_MAX_IMAGE_SIZE || height > TZK_TEXTURE_ATLAS_MAX_IMAGE_SIZE )
+		return false;
+
+	return (width + (atlas_padding * 2)) <= my_page_size && (height + (atlas_padding * 2)) <= my_page_size;
+}
+
+
+#if TZK_USING_SDL
+int
+TextureAtlas::Insert(
+	SDL_Renderer* renderer,
+	SDL_Surface* surface,
+	atlas_region& region
+)
+{
+	using namespace trezanik::core;
+
+	if ( surface == nullptr || !Accepts(surface->w, surface->h) )
+	{
+		return EINVAL;
+	}
+
+	SDL_Surface*  converted = nullptr;
+	SDL_Surface*  src = surface;
+
+	if ( surface->format->format != atlas_pixel_format )
+	{
+		if ( (converted = SDL_ConvertSurfaceFormat(surface, atlas_pixel_format, 0)) == nullptr )
+		{
+			TZK_LOG_FORMAT(LogLevel::Warning, "[SDL] SDL_ConvertSurfaceFormat failed: %s", SDL_GetError());
+			return ErrEXTERN;
+		}
+		src = converted;
+	}
+
+	std::lock_guard<std::mutex>  lock(my_lock);
+
+	stbrp_rect   rect = { };
+	atlas_page*  target = nullptr;
+	size_t       page_index = 0;
+
+	rect.w = src->w + (atlas_padding * 2);
+	rect.h = src->h + (atlas_padding * 2);
+
+	for ( ; page_index < my_pages.size(); page_index++ )
+	{
+		if ( stbrp_pack_rects(&my_pages[page_index]->packer, &rect, 1) && rect.was_packed )
+		{
+			target = my_pages[page_index].get();
+			break;
+		}
+	}
+
+	if ( target == nullptr )
+	{
+		// all existing pages full (or none exist); create a new one
+		auto  page = std::make_unique<atlas_page>();
+
+		page->texture = SDL_CreateTexture(renderer, atlas_pixel_format, SDL_TEXTUREACCESS_STATIC, my_page_size, my_page_size);
+		if ( page->texture == nullptr )
+		{
+			TZK_LOG_FORMAT(LogLevel::Warning, "[SDL] SDL_CreateTexture failed: %s", SDL_GetError());
+			if ( converted != nullptr )
+				SDL_FreeSurface(converted);
+			return ErrEXTERN;
+		}
+
+		SDL_SetTextureBlendMode(page->texture, SDL_BLENDMODE_BLEND);
+
+		// static textures have undefined initial content; padding must be transparent
+		std::vector<uint32_t>  blank(static_cast<size_t>(my_page_size) * my_page_size, 0);
+		SDL_UpdateTexture(page->texture, nullptr, blank.data(), my_page_size * static_cast<int>(sizeof(uint32_t)));
+
+		page->nodes.resize(static_cast<size_t>(my_page_size));
+		stbrp_init_target(&page->packer, my_page_size, my_page_size, page->nodes.data(), static_cast<int>(page->nodes.size()));
+
+		if ( !stbrp_pack_rects(&page->packer, &rect, 1) || !rect.was_packed )
+		{
+			// Accepts() guarantees fit in an empty page
+			TZK_DEBUG_BREAK;
+			SDL_DestroyTexture(page->texture);
+			if ( converted != nullptr )
+				SDL_FreeSurface(converted);
+			return ErrINTERN;
+		}
+
+		TZK_LOG_FORMAT(LogLevel::Debug, "Texture atlas page %zu created (%dx%d)", my_pages.size(), my_page_size, my_page_size);
+
+		page_index = my_pages.size();
+		target = page.get();
+		my_pages.emplace_back(std::move(page));
+	}
+
+	SDL_Rect  dst;
+	dst.x = rect.x + atlas_padding;
+	dst.y = rect.y + atlas_padding;
+	dst.w = src->w;
+	dst.h = src->h;
+
+	int  rc = ErrNONE;
+
+	if ( SDL_UpdateTexture(target->texture, &dst, src->pixels, src->pitch) != 0 )
+	{
+		// the packed space is lost, but otherwise harmless
+		TZK_LOG_FORMAT(LogLevel::Warning, "[SDL] SDL_UpdateTexture failed: %s", SDL_GetError());
+		rc = ErrEXTERN;
+	}
+	else
+	{
+		float  size = static_cast<float>(my_page_size);
+
+		region.page = target->texture;
+		region.page_index = page_index;
+		region.x = dst.x;
+		region.y = dst.y;
+		region.w = dst.w;
+		region.h = dst.h;
+		region.u0 = dst.x / size;
+		region.v0 = dst.y / size;
+		region.u1 = (dst.x + dst.w) / size;
+		region.v1 = (dst.y + dst.h) / size;
+
+		my_packed_count++;
+	}
+
+	if ( converted != nullptr )
+	{
+		SDL_FreeSurface(converted);
+	}
+
+	return rc;
+}
+#endif  // TZK_USING_SDL
+
+
+size_t
+TextureAtlas::PackedCount() const
+{
+	std::lock_guard<std::mutex>  lock(my_lock);
+	return my_packed_count;
+}
+
+
+size_t
+TextureAtlas::PageCount() const
+{
+	std::lock_guard<std::mutex>  lock(my_lock);
+	return my_pages.size();
+}
+
+
+} // namespace engine
+} // namespace trezanik
@@ -0,0 +1,179 @@
+#pragma once
+
+/**
+ * @file        src/engine/resources/TextureAtlas.h
+ * @brief       Packs small images into shared texture pages
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "engine/definitions.h"
+
+#include "core/util/SingularInstance.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+#if TZK_USING_SDL
+struct SDL_Renderer;
+struct SDL_Surface;
+struct SDL_Texture;
+#endif
+
+
+namespace trezanik {
+namespace engine {
+
+
+/**
+ * A sub-rectangle of a texture atlas page
+ *
+ * Images packed into the atlas are drawn using the page texture with these
+ * texture coordinates, rather than the full 0,0 - 1,1 range.
+ */
+struct atlas_region
+{
+#if TZK_USING_SDL
+	/// The page texture holding the image; nullptr if not atlased
+	SDL_Texture*  page = nullptr;
+#endif
+
+	/// Index of the page within the atlas
+	size_t  page_index = 0;
+
+	int  x = 0;  //< left pixel offset within the page
+	int  y = 0;  //< top pixel offset within the page
+	int  w = 0;  //< width in pixels
+	int  h = 0;  //< height in pixels
+
+	float  u0 = 0.f;  //< left texture coordinate
+	float  v0 = 0.f;  //< top texture coordinate
+	float  u1 = 1.f;  //< right texture coordinate
+	float  v1 = 1.f;  //< bottom texture coordinate
+};
+
+
+struct atlas_page;
+
+
+/**
+ * Texture atlas for small images
+ *
+ * Images loaded for UI usage (icons, node style images) are typically tiny,
+ * and as individual textures each one results in a texture switch and its own
+ * draw command. Packing them into shared pages lets ImGui merge consecutive
+ * draws from the same page into a single command.
+ *
+ * Packing uses the stb rectangle packer vendored with Dear ImGui. Pages are
+ * created on demand; space is never reclaimed, as these images are expected
+ * to live for the duration of the application.
+ *
+ * Thread-safe; type loaders invoke this from the resource worker threads.
+ */
+class TZK_ENGINE_API TextureAtlas
+	: private trezanik::core::SingularInstance<TextureAtlas>
+{
+	TZK_NO_CLASS_ASSIGNMENT(TextureAtlas);
+	TZK_NO_CLASS_COPY(TextureAtlas);
+	TZK_NO_CLASS_MOVEASSIGNMENT(TextureAtlas);
+	TZK_NO_CLASS_MOVECOPY(TextureAtlas);
+
+private:
+
+	/// Protects the page collection and packer state
+	mutable std::mutex  my_lock;
+
+	/// All pages created to date
+	std::vector<std::unique_ptr<atlas_page>>  my_pages;
+
+	/// Width and height of each page
+	int  my_page_size;
+
+	/// Number of images packed across all pages
+	size_t  my_packed_count;
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 */
+	TextureAtlas();
+
+
+	/**
+	 * Standard destructor
+	 */
+	~TextureAtlas();
+
+
+	/**
+	 * Determines if an image of the supplied dimensions is eligible for packing
+	 *
+	 * @param[in] width
+	 *  The image width in pixels
+	 * @param[in] height
+	 *  The image height in pixels
+	 * @return
+	 *  Boolean result; true if within TZK_TEXTURE_ATLAS_MAX_IMAGE_SIZE
+	 */
+	bool
+	Accepts(
+		int width,
+		int height
+	) const;
+
+
+#if TZK_USING_SDL
+	/**
+	 * Packs the surface into an atlas page
+	 *
+	 * A new page is created if no existing page has the space available. The
+	 * surface is converted to the page pixel format if required; it is not
+	 * modified or freed.
+	 *
+	 * @param[in] renderer
+	 *  The renderer used to create page textures
+	 * @param[in] surface
+	 *  The source image surface
+	 * @param[out] region
+	 *  The region populated on success
+	 * @return
+	 *  - ErrNONE on success
+	 *  - EINVAL if the image is not eligible
+	 *  - ErrEXTERN if an SDL operation failed
+	 */
+	int
+	Insert(
+		SDL_Renderer* renderer,
+		SDL_Surface* surface,
+		atlas_region& region
+	);
+#endif
+
+
+	/**
+	 * Gets the number of images packed
+	 *
+	 * @return
+	 *  The image count across all pages
+	 */
+	size_t
+	PackedCount() const;
+
+
+	/**
+	 * Gets the number of atlas pages created
+	 *
+	 * @return
+	 *  The page count
+	 */
+	size_t
+	PageCount() const;
+};
+
+
+} // namespace engine
+} // namespace trezanik
@@ -7,6 +7,7 @@
 
 #include "engine/definitions.h"
 
+#include "engine/Context.h"
 #include "engine/resources/TypeLoader.h"
 #include "engine/resources/Resource.h"
 #include "engine/services/ServiceLocator.h"
@@ -140,6 +141,41 @@ TypeLoader::NotifySuccess(
 }
 
 
+FILE*
+TypeLoader::OpenSource(
+	const std::string& filepath,
+	memory_span* embedded
+)
+{
+	using namespace trezanik::core;
+
+	if ( aux::file::exists(filepath.c_str()) == EEXIST )
+	{
+		int  openflags = aux::file::OpenFlag_ReadOnly | aux::file::OpenFlag_Binary | aux::file::OpenFlag_DenyW;
+
+		return aux::file::open(filepath.c_str(), openflags);
+	}
+
+	VirtualFiles&  vfiles = Context::GetSingleton().GetVirtualFiles();
+	memory_span    span = vfiles.Find(filepath);
+
+	if ( span.empty() )
+	{
+		TZK_LOG_FORMAT(LogLevel::Error, "Resource source not found on disk or in memory: %s", filepath.c_str());
+		return nullptr;
+	}
+
+	if ( embedded != nullptr )
+	{
+		*embedded = span;
+	}
+
+	TZK_LOG_FORMAT(LogLevel::Debug, "Serving '%s' from memory", filepath.c_str());
+
+	return aux::file::open_memory(span.data, span.size);
+}
+
+
 bool
 TypeLoader::ValidateLicense(
 	const std::string& filepath
@@ -170,6 +206,23 @@ TypeLoader::ValidateLicense(
 	{
 		const char  lic[] = "license";
 		auto   license_path = aux::ReplaceFileExtension(filepath, lic);
+
+		if ( aux::file::exists(license_path.c_str()) != EEXIST )
+		{
+			// no need to open a stream for the embedded license, just check it
+			memory_span  span = Context::GetSingleton().GetVirtualFiles().Find(license_path);
+
+			if ( !span.empty() )
+			{
+				if ( span.size < 3 )
+				{
+					TZK_LOG_FORMAT(LogLevel::Error, "Invalid %s file for %s", lic, filepath.c_str());
+					return false;
+				}
+				return true;
+			}
+		}
+
 		FILE*  lic_fp = aux::file::open(license_path.c_str(), aux::file::OpenFlag_ReadOnly | aux::file::OpenFlag_DenyW);
 
 		if ( lic_fp == nullptr )
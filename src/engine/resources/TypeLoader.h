@@ -12,6 +12,7 @@
 
 #include "engine/resources/IResourceLoader.h"
 #include "engine/resources/ResourceTypes.h"
+#include "engine/resources/VirtualFiles.h"
 #include "engine/services/event/EngineEvent.h"
 
 #include <set>
@@ -41,11 +42,35 @@ private:
 
 protected:
 
+	/**
+	 * Opens the source data for a resource
+	 *
+	 * A file on disk always takes precedence, permitting users to override
+	 * the embedded assets; otherwise the virtual files registry is consulted,
+	 * and the in-memory content opened as a file pointer.
+	 *
+	 * @param[in] filepath
+	 *  The absolute or relative path to the resource file
+	 * @param[out] embedded
+	 *  (Optional) Populated with the in-memory content if the source is a
+	 *  virtual file; left empty if opened from disk
+	 * @return
+	 *  A file pointer the caller is responsible for closing, or nullptr if
+	 *  the source could not be found or opened
+	 */
+	FILE*
+	OpenSource(
+		const std::string& filepath,
+		memory_span* embedded = nullptr
+	);
+
+
 	/**
 	 * Validates the license file for the associated resource
 	 * 
 	 * Licenses must be stored alongside the resource (same directory) with the
-	 * same name, only with the file extension '.license' instead.
+	 * same name, only with the file extension '.license' instead. Embedded
+	 * resources register their license as a virtual file in the same manner.
 	 * 
 	 * @param[in] filepath
 	 *  The absolute or relative path to the resource file
@@ -90,7 +90,6 @@ TypeLoader_Audio::Load(
 
 	auto   filepath = resource->GetFilepath();
 	auto   al = trezanik::engine::ServiceLocator::Audio();
-	int    openflags = aux::file::OpenFlag_ReadOnly | aux::file::OpenFlag_Binary | aux::file::OpenFlag_DenyW;
 
 	if ( !ValidateLicense(filepath) )
 	{
@@ -98,7 +97,8 @@ TypeLoader_Audio::Load(
 		return ErrFAILED;
 	}
 
-	FILE*  fp = aux::file::open(filepath.c_str(), openflags);
+	// embedded sounds are streamed from memory exactly as a disk file would be
+	FILE*  fp = OpenSource(filepath);
 
 	if ( fp == nullptr )
 	{
@@ -11,9 +11,11 @@
 #include "engine/resources/Resource.h"
 #include "engine/resources/Resource_Font.h"
 #include "engine/services/event/EngineEvent.h"
+#include "engine/Context.h"
 
 #include "core/services/event/EventDispatcher.h"
 #include "core/services/log/Log.h"
+#include "core/util/filesystem/file.h"
 #include "core/error.h"
 
 #include <chrono>
@@ -105,7 +107,23 @@ TypeLoader_Font::Load(
 	// freetype load from file
 	// determine num faces by setting to -1, then using ftface->num_faces
 	FT_Face   ftface;
-	FT_Error  err = FT_New_Face(my_library, resource->GetFilepath().c_str(), 0, &ftface);
+	FT_Error  err;
+	std::string  filepath = resource->GetFilepath();
+	memory_span  embedded;
+
+	if ( aux::file::exists(filepath.c_str()) != EEXIST )
+	{
+		embedded = engine::Context::GetSingleton().GetVirtualFiles().Find(filepath);
+	}
+	if ( !embedded.empty() )
+	{
+		// memory is not copied; the registry data outlives the face
+		err = FT_New_Memory_Face(my_library, embedded.data, static_cast<FT_Long>(embedded.size), 0, &ftface);
+	}
+	else
+	{
+		err = FT_New_Face(my_library, filepath.c_str(), 0, &ftface);
+	}
 	if ( err )
 	{
 		//FT_Err_Cannot_Open_Resource
@@ -116,14 +134,6 @@ TypeLoader_Font::Load(
 		return ErrEXTERN;
 	}
 	
-#if 0  // to implement at some point in more advanced resource handling: freetype load from memory
-	FT_Byte* buffer; // first byte in memory
-	FT_Long  size;  // size in bytes
-	FT_Long  faceindex = 0;
-	err = FT_New_Memory_Face(my_library, buffer, size, faceindex, &ftface);
-	FT_Done_Face(ftface);
-#endif
-
 #if 0  // devnotes
 	ftface->size;  // modelled info related to character size for this face
 	error = FT_Set_Char_Size(
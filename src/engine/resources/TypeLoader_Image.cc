@@ -9,7 +9,9 @@
 
 #include "engine/resources/TypeLoader_Image.h"
 #include "engine/resources/IResource.h"
+#include "engine/resources/ImageDiskCache.h"
 #include "engine/resources/Resource_Image.h"
+#include "engine/resources/TextureAtlas.h"
 #include "engine/services/event/EngineEvent.h"
 #include "engine/Context.h"
 
@@ -34,7 +36,9 @@
 #endif
 #include "engine/resources/tga/tga.h"
 
+#include <chrono>
 #include <functional>
+#include <vector>
 
 
 namespace trezanik {
@@ -122,6 +126,7 @@ TypeLoader_Image::Load(
 	using namespace trezanik::core;
 
 	EventData::resource_state  data{ resource, ResourceState::Loading };
+	auto  start = std::chrono::steady_clock::now();
 
 	NotifyLoad(&data);
 
@@ -143,8 +148,8 @@ TypeLoader_Image::Load(
 	}
 
 	Context&  ctx = engine::Context::GetSingleton();
-	int    openflags = aux::file::OpenFlag_ReadOnly | aux::file::OpenFlag_Binary | aux::file::OpenFlag_DenyW;
-	FILE*  fp = aux::file::open(filepath.c_str(), openflags);
+	memory_span  embedded;
+	FILE*  fp = OpenSource(filepath, &embedded);
 
 	if ( fp == nullptr )
 	{
@@ -157,6 +162,72 @@ TypeLoader_Image::Load(
 	std::queue<LoaderMethod>  trymethods = my_mpri;
 	int  retval = ErrIMPL;
 	int  bytes_per_pixel = 0;
+	ImageDiskCache&  diskcache = ctx.GetImageDiskCache();
+	std::unique_ptr<cached_image>  cached;
+	std::vector<unsigned char>  content;
+	uint64_t  content_hash = 0;
+	size_t    content_size = 0;
+
+	/*
+	 * Hashing the file content is far cheaper than decoding it; if a decoded
+	 * copy exists from a prior run, use it directly (still memory-mapped).
+	 * On a miss, the content read for hashing is what gets decoded
+	 */
+	if ( diskcache.IsEnabled() )
+	{
+		content_size = embedded.empty() ? aux::file::size(fp) : embedded.size;
+
+		if ( !embedded.empty() )
+		{
+			// already in memory, no need to read it out
+			content_hash = ImageDiskCache::ContentHash(embedded.data, embedded.size);
+			cached = diskcache.Lookup(content_hash, content_size);
+		}
+		else if ( content_size > 0 && content_size <= TZK_IMAGE_MAX_FILE_SIZE )
+		{
+			content.resize(content_size);
+
+			if ( fread(content.data(), 1, content_size, fp) == content_size )
+			{
+				content_hash = ImageDiskCache::ContentHash(content.data(), content_size);
+				cached = diskcache.Lookup(content_hash, content_size);
+			}
+			else
+			{
+				content_size = 0;
+			}
+			fseek(fp, 0, SEEK_SET);
+
+			FILE*  memfp = nullptr;
+
+			// decoders read from memory as for embedded content; no second read
+			if ( content_size != 0 && cached == nullptr
+			  && (memfp = aux::file::open_memory(content.data(), content_size)) != nullptr )
+			{
+				aux::file::close(fp);
+				fp = memfp;
+				embedded.data = content.data();
+				embedded.size = content_size;
+			}
+		}
+		else
+		{
+			content_size = 0;
+		}
+	}
+	if ( cached != nullptr )
+	{
+		imgcon->width = cached->width;
+		imgcon->height = cached->height;
+		imgcon->bits_per_pixel = cached->bytes_per_pixel * 8;
+		// read-only mapping; only ever read by surface creation
+		imgcon->data = const_cast<unsigned char*>(cached->pixels);
+		imgcon->method = LoaderMethod::DiskCache;
+		bytes_per_pixel = cached->bytes_per_pixel;
+		retval = ErrNONE;
+
+		TZK_LOG_FORMAT(LogLevel::Debug, "Image decode skipped, disk cache hit for '%s'", filepath.c_str());
+	}
 
 	while ( retval != ErrNONE && !trymethods.empty() )
 	{
@@ -180,25 +251,49 @@ TypeLoader_Image::Load(
 				break;
 #if TZK_USING_SDLIMAGE
 			{
-				if ( (imgcon->texture = IMG_LoadTexture(ctx.GetSDLRenderer(), filepath.c_str())) != nullptr )
+				SDL_Surface*  loaded = nullptr;
+
+				if ( !embedded.empty() )
 				{
-					if ( SDL_QueryTexture(imgcon->texture, &imgcon->pixel_format, nullptr, &imgcon->width, &imgcon->height) == 0 )
-					{
-						imgcon->method = LoaderMethod::SDLImage;
-						retval = ErrNONE;
-					}
-					else
-					{
-						TZK_LOG_FORMAT(LogLevel::Warning, "SDL_QueryTexture() failed: %s", SDL_GetError());
-						retval = ErrEXTERN;
-					}
+					// freesrc=1; the RWops is closed by SDL_image regardless of outcome
+					loaded = IMG_Load_RW(SDL_RWFromConstMem(embedded.data, static_cast<int>(embedded.size)), 1);
 				}
 				else
 				{
-					TZK_LOG_FORMAT(LogLevel::Warning, "IMG_LoadTexture() failed: %s", IMG_GetError());
+					loaded = IMG_Load(filepath.c_str());
+				}
+
+				if ( loaded == nullptr )
+				{
+					TZK_LOG_FORMAT(LogLevel::Warning, "IMG_Load() failed: %s", IMG_GetError());
 					retval = ErrEXTERN;
 					// Can try a different method, but one failing should imply the rest do too
+					break;
+				}
+
+				/*
+				 * The surface is in whatever format the file dictates, possibly
+				 * paletted; convert to that used for the other loaders so it is
+				 * handled identically from here, atlas included
+				 */
+				imgcon->surface = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_ARGB8888, 0);
+				SDL_FreeSurface(loaded);
+
+				if ( imgcon->surface == nullptr )
+				{
+					TZK_LOG_FORMAT(LogLevel::Warning, "SDL_ConvertSurfaceFormat() failed: %s", SDL_GetError());
+					retval = ErrEXTERN;
+					break;
 				}
+
+				imgcon->width = imgcon->surface->w;
+				imgcon->height = imgcon->surface->h;
+				imgcon->bits_per_pixel = 32;
+				// owned by the surface; exposed for the disk cache
+				imgcon->data = static_cast<unsigned char*>(imgcon->surface->pixels);
+				imgcon->method = LoaderMethod::SDLImage;
+				bytes_per_pixel = 4;
+				retval = ErrNONE;
 			}
 #endif  // TZK_USING_SDLIMAGE
 			break;
@@ -235,14 +330,30 @@ TypeLoader_Image::Load(
 		return ErrFAILED;
 	}
 
+	auto  elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
 
-#if TZK_USING_SDL
-	if ( imgcon->texture != nullptr )
+	TZK_LOG_FORMAT(LogLevel::Debug,
+		"Image pixels for '%s' obtained in %lld microseconds (%s)",
+		filepath.c_str(), static_cast<long long>(elapsed.count()),
+		cached != nullptr ? "disk cache hit" : (content_size != 0 ? "disk cache miss" : "not cacheable")
+	);
+	if ( content_size != 0 )
+	{
+		diskcache.RecordLoad(cached != nullptr, elapsed);
+	}
+
+	// freshly decoded pixels are retained for the next run
+	if ( content_size != 0 && imgcon->data != nullptr && imgcon->method != LoaderMethod::DiskCache )
 	{
-		NotifySuccess(&data);
-		return retval;
+		diskcache.Store(
+			content_hash, content_size, imgcon->width, imgcon->height,
+			bytes_per_pixel != 0 ? bytes_per_pixel : (imgcon->bits_per_pixel / 8),
+			imgcon->data
+		);
 	}
 
+
+#if TZK_USING_SDL
 	if ( bytes_per_pixel == 0 )
 		bytes_per_pixel = imgcon->bits_per_pixel / 8;
 	if ( imgcon->bits_per_pixel == 0 )
@@ -258,6 +369,7 @@ TypeLoader_Image::Load(
 	}
 	TZK_LOG_FORMAT(LogLevel::Trace, "Using pixel format: %u", imgcon->pixel_format);
 
+	// SDL_image supplies its own surface; all others are created over the pixels
 #if 1
 	if ( imgcon->surface == nullptr && (imgcon->surface = SDL_CreateRGBSurfaceWithFormatFrom(
 		imgcon->data, imgcon->width, imgcon->height,
@@ -277,7 +389,18 @@ TypeLoader_Image::Load(
 	}
 	else
 	{
-		if ( (imgcon->texture = SDL_CreateTextureFromSurface(ctx.GetSDLRenderer(), imgcon->surface)) == nullptr )
+		TextureAtlas&  atlas = ctx.GetTextureAtlas();
+
+		// small images share atlas pages, permitting batched draws
+		if ( atlas.Accepts(imgcon->width, imgcon->height)
+		  && atlas.Insert(ctx.GetSDLRenderer(), imgcon->surface, imgcon->atlas) == ErrNONE )
+		{
+			TZK_LOG_FORMAT(LogLevel::Debug,
+				"[SDL] Image packed into atlas page %zu at %d,%d",
+				imgcon->atlas.page_index, imgcon->atlas.x, imgcon->atlas.y
+			);
+		}
+		else if ( (imgcon->texture = SDL_CreateTextureFromSurface(ctx.GetSDLRenderer(), imgcon->surface)) == nullptr )
 		{
 			TZK_LOG_FORMAT(LogLevel::Error, "[SDL] SDL_CreateTextureFromSurface failed: %s", SDL_GetError());
 			retval = ErrEXTERN;
@@ -287,7 +410,11 @@ TypeLoader_Image::Load(
 		uint32_t  format;
 		int  w;
 		int  h;
-		if ( SDL_QueryTexture(imgcon->texture, &format, &ta, &w, &h) != 0 )
+		if ( imgcon->texture == nullptr )
+		{
+			// packed into the atlas, or creation failure already logged
+		}
+		else if ( SDL_QueryTexture(imgcon->texture, &format, &ta, &w, &h) != 0 )
 		{
 			TZK_LOG_FORMAT(LogLevel::Error, "[SDL] SDL_QueryTexture failed: %s", SDL_GetError());
 		}
@@ -316,7 +443,10 @@ TypeLoader_Image::Load(
 			stbi_image_free(imgcon->data);
 #endif
 			break;
-		case LoaderMethod::SDLImage:  // no-op, should be unreachable
+		case LoaderMethod::DiskCache:  // unmapped when cached goes out of scope
+			break;
+		case LoaderMethod::SDLImage:  // freed with the surface
+			break;
 		default: TZK_DEBUG_BREAK;
 			break;
 		};
@@ -0,0 +1,185 @@
+/**
+ * @file        src/engine/resources/VirtualFiles.cc
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "engine/definitions.h"
+
+#include "engine/resources/VirtualFiles.h"
+
+#include "core/services/log/Log.h"
+#include "core/util/filesystem/file.h"
+#include "core/util/string/string.h"
+#include "core/error.h"
+
+
+namespace trezanik {
+namespace engine {
+
+
+VirtualFiles::VirtualFiles()
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Constructor starting");
+	{
+	}
+	TZK_LOG(LogLevel::Trace, "Constructor finished");
+}
+
+
+VirtualFiles::~VirtualFiles()
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Destructor starting");
+	{
+		my_files.clear();
+	}
+	TZK_LOG(LogLevel::Trace, "Destructor finished");
+}
+
+
+size_t
+VirtualFiles::Count() const
+{
+	std::lock_guard<std::mutex>  lock(my_lock);
+	return my_files.size();
+}
+
+
+memory_span
+VirtualFiles::Find(
+	const std::string& path
+) const
+{
+	std::string  key = Normalize(path);
+	std::lock_guard<std::mutex>  lock(my_lock);
+
+	auto  iter = my_files.find(key);
+
+	if ( iter == my_files.end() )
+	{
+		return memory_span();
+	}
+
+	return iter->second;
+}
+
+
+std::vector<std::string>
+VirtualFiles::List(
+	const std::string& directory
+) const
+{
+	std::vector<std::string>  retval;
+	std::string  prefix = Normalize(directory);
+
+	if ( prefix.empty() )
+	{
+		return retval;
+	}
+	if ( prefix.back() != TZK_PATH_CHAR )
+	{
+		prefix += TZK_PATH_CHAR;
+	}
+
+	std::lock_guard<std::mutex>  lock(my_lock);
+
+	// ordered map; every entry within the directory is contiguous from prefix
+	for ( auto iter = my_files.lower_bound(prefix); iter != my_files.end(); iter++ )
+	{
+		if ( iter->first.compare(0, prefix.length(), prefix) != 0 )
+			break;
+
+		std::string  name = iter->first.substr(prefix.length());
+
+		if ( name.find(TZK_PATH_CHAR) == std::string::npos )
+		{
+			retval.push_back(name);
+		}
+	}
+
+	return retval;
+}
+
+
+std::string
+VirtualFiles::Normalize(
+	const std::string& path
+)
+{
+	std::string  retval;
+
+	retval.reserve(path.length());
+
+	for ( char c : path )
+	{
+		if ( c == '/' || c == '\\' )
+		{
+			c = TZK_PATH_CHAR;
+
+			if ( !retval.empty() && retval.back() == TZK_PATH_CHAR )
+				continue;
+		}
+		retval += c;
+	}
+
+	return retval;
+}
+
+
+FILE*
+VirtualFiles::Open(
+	const std::string& path
+) const
+{
+	memory_span  span = Find(path);
+
+	if ( span.empty() )
+	{
+		return nullptr;
+	}
+
+	return core::aux::file::open_memory(span.data, span.size);
+}
+
+
+int
+VirtualFiles::Register(
+	const std::string& directory,
+	const std::string& name,
+	const unsigned char* data,
+	size_t size
+)
+{
+	using namespace trezanik::core;
+
+	if ( directory.empty() || name.empty() || data == nullptr || size == 0 )
+	{
+		return EINVAL;
+	}
+
+	std::string  key = Normalize(aux::BuildPath(directory, name));
+	std::lock_guard<std::mutex>  lock(my_lock);
+
+	memory_span  span;
+	span.data = data;
+	span.size = size;
+
+	if ( !my_files.emplace(key, span).second )
+	{
+		TZK_LOG_FORMAT(LogLevel::Warning, "Virtual file already registered: %s", key.c_str());
+		return EEXIST;
+	}
+
+	TZK_LOG_FORMAT(LogLevel::Trace, "Virtual file registered: %s (%zu bytes)", key.c_str(), size);
+
+	return ErrNONE;
+}
+
+
+} // namespace engine
+} // namespace trezanik
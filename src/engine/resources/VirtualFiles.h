@@ -0,0 +1,197 @@
+#pragma once
+
+/**
+ * @file        src/engine/resources/VirtualFiles.h
+ * @brief       Registry of in-memory files, served in place of disk files
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "engine/definitions.h"
+
+#include "core/util/SingularInstance.h"
+
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+namespace trezanik {
+namespace engine {
+
+
+/**
+ * A read-only block of memory holding the content of a virtual file
+ */
+struct memory_span
+{
+	/// Start of the file content; nullptr if the span is empty
+	const unsigned char*  data = nullptr;
+
+	/// The number of bytes in the file content
+	size_t  size = 0;
+
+	/**
+	 * Determines if this span refers to any content
+	 *
+	 * @return
+	 *  true if data is available, otherwise false
+	 */
+	bool
+	empty() const
+	{
+		return data == nullptr || size == 0;
+	}
+};
+
+
+/**
+ * Registry of files that exist only in memory
+ *
+ * Embedded resources (fonts, icons, sounds and their licenses) are compiled
+ * into the binary; rather than writing them out to the assets directories at
+ * startup to be read back in again, they are registered here against the path
+ * they would otherwise have occupied.
+ *
+ * Type loaders consult the filesystem first, so a user-supplied file of the
+ * same name overrides the embedded version, falling back to this registry.
+ * Paths are compared after separator normalization only; they are otherwise
+ * expected to be built the same way (asset path + asset dir + name).
+ *
+ * The memory is never copied nor freed; registered data must outlive this
+ * object, which is a given for static embedded arrays.
+ *
+ * Thread-safe; lookups are performed from the resource workers.
+ */
+class TZK_ENGINE_API VirtualFiles
+	: private trezanik::core::SingularInstance<VirtualFiles>
+{
+	TZK_NO_CLASS_ASSIGNMENT(VirtualFiles);
+	TZK_NO_CLASS_COPY(VirtualFiles);
+	TZK_NO_CLASS_MOVEASSIGNMENT(VirtualFiles);
+	TZK_NO_CLASS_MOVECOPY(VirtualFiles);
+
+private:
+
+	/// Guards the file map
+	mutable std::mutex  my_lock;
+
+	/// All registered files, keyed on their normalized full path
+	std::map<std::string, memory_span>  my_files;
+
+
+	/**
+	 * Converts a path into the form used as a map key
+	 *
+	 * @param[in] path
+	 *  The file or directory path
+	 * @return
+	 *  The path with native separators and no repeated separators
+	 */
+	static std::string
+	Normalize(
+		const std::string& path
+	);
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 */
+	VirtualFiles();
+
+
+	/**
+	 * Standard destructor
+	 */
+	~VirtualFiles();
+
+
+	/**
+	 * Gets the number of registered files
+	 *
+	 * @return
+	 *  The file count
+	 */
+	size_t
+	Count() const;
+
+
+	/**
+	 * Looks up a registered file
+	 *
+	 * @param[in] path
+	 *  The full path of the file
+	 * @return
+	 *  The file content, or an empty span if not registered
+	 */
+	memory_span
+	Find(
+		const std::string& path
+	) const;
+
+
+	/**
+	 * Lists the names of the files registered within a directory
+	 *
+	 * Not recursive; only files immediately within the directory are returned,
+	 * matching the form of folder::scan_directory so the results can be merged.
+	 *
+	 * @param[in] directory
+	 *  The directory path
+	 * @return
+	 *  The file names, without the directory
+	 */
+	std::vector<std::string>
+	List(
+		const std::string& directory
+	) const;
+
+
+	/**
+	 * Opens a registered file as a read-only file pointer
+	 *
+	 * @sa core::aux::file::open_memory
+	 * @param[in] path
+	 *  The full path of the file
+	 * @return
+	 *  A file pointer to be closed by the caller, or nullptr if not registered
+	 *  or the stream could not be created
+	 */
+	FILE*
+	Open(
+		const std::string& path
+	) const;
+
+
+	/**
+	 * Registers a file
+	 *
+	 * @param[in] directory
+	 *  The directory the file is to appear in
+	 * @param[in] name
+	 *  The file name
+	 * @param[in] data
+	 *  The file content; must remain valid for the lifetime of this object
+	 * @param[in] size
+	 *  The number of bytes in data
+	 * @return
+	 *  - ErrNONE on success
+	 *  - EINVAL if any argument is empty
+	 *  - EEXIST if the path is already registered
+	 */
+	int
+	Register(
+		const std::string& directory,
+		const std::string& name,
+		const unsigned char* data,
+		size_t size
+	);
+};
+
+
+} // namespace engine
+} // namespace trezanik
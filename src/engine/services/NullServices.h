@@ -122,6 +122,17 @@ public:
 	}
 
 
+	/**
+	 * Implementation of IAudio::PauseSound
+	 */
+	virtual void
+	PauseSound(
+		std::shared_ptr<ALSound> TZK_UNUSED(sound)
+	) override
+	{
+	}
+
+
 	/**
 	 * Implementation of IAudio::SetSoundGain
 	 */
@@ -134,6 +145,28 @@ public:
 	}
 
 
+	/**
+	 * Implementation of IAudio::StartSound
+	 */
+	virtual void
+	StartSound(
+		std::shared_ptr<ALSound> TZK_UNUSED(sound)
+	) override
+	{
+	}
+
+
+	/**
+	 * Implementation of IAudio::StopSound
+	 */
+	virtual void
+	StopSound(
+		std::shared_ptr<ALSound> TZK_UNUSED(sound)
+	) override
+	{
+	}
+
+
 	/**
 	 * Implementation of IAudio::Update
 	 */
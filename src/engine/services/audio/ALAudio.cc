@@ -28,6 +28,7 @@
 #include "core/services/log/LogEvent.h"
 #include "core/services/log/LogLevel.h"
 #include "core/services/memory/Memory.h"
+#include "core/services/threading/Threading.h"
 #include "core/util/filesystem/env.h"
 #include "core/util/filesystem/file.h"
 #include "core/util/string/string.h"
@@ -144,7 +145,9 @@ bool is_wave_signature(const unsigned char* data, size_t size)
 
 
 ALAudio::ALAudio()
-: my_al_device(nullptr)
+: my_dropped_commands(0)
+, my_stream_stop(false)
+, my_al_device(nullptr)
 , my_al_context(nullptr)
 {
 	using namespace trezanik::core;
@@ -199,9 +202,21 @@ ALAudio::~ALAudio()
 
 	TZK_LOG(LogLevel::Trace, "Destructor starting");
 	{
+		StopStreaming();
+
+		// discard anything still pending; releases the sound references held
+		audio_command  cmd;
+		while ( my_commands.Pop(cmd) )
+		{
+		}
+
 		if ( my_al_context != nullptr )
 		{
-			GlobalStop();
+			audio_command  stop_cmd;
+			stop_cmd.type = AudioCommandType::GlobalStop;
+			ExecuteCommand(stop_cmd);
+			DestroyVoices();
+			DestroyClips();
 		}
 
 		auto  evtmgr = core::ServiceLocator::EventDispatcher();
@@ -300,6 +315,314 @@ ALAudio::CreateSound(
 }
 
 
+void
+ALAudio::CreateVoices()
+{
+	using namespace trezanik::core;
+
+	size_t  created = 0;
+
+	for ( auto& voice : my_voices )
+	{
+		if ( voice.source != 0 )
+			continue;
+
+		alGetError();
+		alGenSources(1, &voice.source);
+
+		ALenum  err;
+
+		if ( (err = alGetError()) != AL_NO_ERROR )
+		{
+			TZK_LOG_FORMAT(LogLevel::Warning, "[OpenAL] alGenSources failed: %i - %s", err, alcGetErrorString(err));
+			voice.source = 0;
+			break;
+		}
+
+		voice.clip = nullptr;
+		voice.priority = UINT8_MAX;
+		created++;
+	}
+
+	TZK_LOG_FORMAT(LogLevel::Debug, "Created %zu of %u voices for clip playback", created, TZK_AUDIO_VOICE_COUNT);
+}
+
+
+void
+ALAudio::DestroyClips()
+{
+	using namespace trezanik::core;
+
+	size_t  total = 0;
+
+	for ( auto& entry : my_clips )
+	{
+		if ( entry.second.buffer == 0 )
+			continue;
+
+		total += entry.second.size;
+		alDeleteBuffers(1, &entry.second.buffer);
+	}
+
+	TZK_LOG_FORMAT(LogLevel::Debug, "Releasing %zu clip cache entries, %zu bytes", my_clips.size(), total);
+
+	my_clips.clear();
+}
+
+
+void
+ALAudio::DestroyVoices()
+{
+	for ( auto& voice : my_voices )
+	{
+		if ( voice.source == 0 )
+			continue;
+
+		alSourceStop(voice.source);
+		alDeleteSources(1, &voice.source);
+		voice.source = 0;
+		voice.clip = nullptr;
+	}
+}
+
+
+bool
+ALAudio::Enqueue(
+	audio_command&& command
+)
+{
+	if ( !my_commands.Push(std::move(command)) )
+	{
+		/*
+		 * Logging here would be per command, on the caller thread, and a
+		 * burst that fills the queue would flood the log; reported in
+		 * aggregate by the streaming thread instead
+		 */
+		my_dropped_commands++;
+		return false;
+	}
+
+	return true;
+}
+
+
+void
+ALAudio::ExecuteCommand(
+	audio_command& command
+)
+{
+	using namespace trezanik::core;
+
+	switch ( command.type )
+	{
+	case AudioCommandType::Use:
+		{
+			if ( my_al_device == nullptr || command.sound == nullptr )
+				break;
+
+			AudioClip*  clip = LoadClip(command.sound);
+
+			if ( clip != nullptr )
+			{
+				// played by the voice pool; no record is held
+				clip->priority = command.priority;
+				command.sound->SetEmitter(command.emitter);
+				break;
+			}
+
+			uint8_t  slot = invalid_slot;
+
+			FindRecordForSound(command.priority, slot);
+
+			if ( slot == invalid_slot )
+				break;
+
+			if ( my_records[slot].active )
+			{
+				// we're replacing an existing sound of lesser priority
+				my_records[slot].active = false;
+				my_records[slot].sound->GetSource().Stop();
+				my_records[slot].sound->GetSource().RemoveAllQueuedBuffers();
+				my_records[slot].sound.reset();
+			}
+
+			command.sound->SetSoundGain(my_effects_volume, my_music_volume);
+			command.sound->SetEmitter(command.emitter);
+			command.sound->FinishSetup();
+
+			my_records[slot].sound = command.sound;
+			my_records[slot].priority = command.priority;
+			my_records[slot].active = true;
+		}
+		break;
+	case AudioCommandType::Play:
+		if ( my_al_device != nullptr && command.sound != nullptr )
+		{
+			AudioClip*  clip = FindClip(command.sound.get());
+
+			if ( clip != nullptr )
+				PlayClip(*clip);
+			else
+				command.sound->Play();
+		}
+		break;
+	case AudioCommandType::Pause:
+	case AudioCommandType::Stop:
+		if ( my_al_device != nullptr && command.sound != nullptr )
+		{
+			bool  pause = command.type == AudioCommandType::Pause;
+			AudioClip*  clip = FindClip(command.sound.get());
+
+			if ( clip == nullptr )
+			{
+				pause ? command.sound->Pause() : command.sound->Stop();
+				break;
+			}
+
+			// applies to every voice playing the clip
+			for ( auto& voice : my_voices )
+			{
+				if ( voice.source == 0 || voice.clip != clip )
+					continue;
+
+				pause ? alSourcePause(voice.source) : alSourceStop(voice.source);
+			}
+		}
+		break;
+	case AudioCommandType::SetGain:
+		{
+			float  effects = command.effects_gain;
+			float  music = command.music_gain;
+
+			if ( effects < 0.f || effects > 1.f )
+				effects = my_effects_volume;
+			if ( music < 0.f || music > 1.f )
+				music = my_music_volume;
+
+			my_effects_volume = effects;
+			my_music_volume = music;
+
+			for ( auto i = 0; i < al_source_count; i++ )
+			{
+				if ( !my_records[i].active )
+					continue;
+
+				auto& sound = my_records[i].sound;
+
+#if TZK_IS_DEBUG_BUILD
+				if ( sound == nullptr )
+				{
+					TZK_DEBUG_BREAK;
+					continue;
+				}
+#endif
+				sound->SetSoundGain(my_effects_volume, my_music_volume);
+			}
+
+			// clips are only ever sound effects
+			for ( auto& voice : my_voices )
+			{
+				if ( voice.source != 0 )
+					alSourcef(voice.source, AL_GAIN, my_effects_volume);
+			}
+		}
+		break;
+	case AudioCommandType::GlobalPause:
+		alcSuspendContext(my_al_context);
+
+		for ( auto i = 0; i < al_source_count; i++ )
+		{
+			if ( !my_records[i].active )
+				continue;
+
+			my_records[i].sound->Pause();
+		}
+		for ( auto& voice : my_voices )
+		{
+			ALint  state = AL_STOPPED;
+
+			if ( voice.source == 0 )
+				continue;
+
+			alGetSourcei(voice.source, AL_SOURCE_STATE, &state);
+			if ( state == AL_PLAYING )
+				alSourcePause(voice.source);
+		}
+		break;
+	case AudioCommandType::GlobalResume:
+		alcProcessContext(my_al_context);
+
+		for ( auto i = 0; i < al_source_count; i++ )
+		{
+			if ( !my_records[i].active )
+				continue;
+
+			my_records[i].sound->Play();
+		}
+		for ( auto& voice : my_voices )
+		{
+			ALint  state = AL_STOPPED;
+
+			if ( voice.source == 0 )
+				continue;
+
+			alGetSourcei(voice.source, AL_SOURCE_STATE, &state);
+			if ( state == AL_PAUSED )
+				alSourcePlay(voice.source);
+		}
+		break;
+	case AudioCommandType::GlobalStop:
+		// no context stop, so pause for immediate effect, then stop everything normally
+		alcSuspendContext(my_al_context);
+
+		for ( auto i = 0; i < al_source_count; i++ )
+		{
+			if ( !my_records[i].active )
+				continue;
+
+			my_records[i].sound->Stop();
+		}
+		for ( auto& voice : my_voices )
+		{
+			if ( voice.source != 0 )
+				alSourceStop(voice.source);
+		}
+
+		/*
+		 * this event is suited for a single, not global stop - needs expansion.
+		 * plus that refactor for audiofile <-> audioresource mapping.
+		 * We now have an event management replacement ready to go, but don't want
+		 * to integrate pre-alpha since it'd delay it
+		 */
+		/*
+		auto  evtmgr = GetSubsystem<EventManager>();
+
+		EventData::Audio_Action  data{ audioresource->GetResourceID(), AudioActionFlag_Stop, 0 };
+
+		evtmgr->PushEvent(EventType::Domain::Audio, EventType::AudioAction, &data);
+		*/
+		break;
+	default:
+		TZK_DEBUG_BREAK;
+		break;
+	}
+}
+
+
+AudioClip*
+ALAudio::FindClip(
+	const ALSound* sound
+)
+{
+	auto  iter = my_clips.find(sound);
+
+	if ( iter == my_clips.end() || iter->second.buffer == 0 )
+		return nullptr;
+
+	return &iter->second;
+}
+
+
 int
 ALAudio::FindRecordForSound(
 	uint8_t priority,
@@ -307,8 +630,8 @@ ALAudio::FindRecordForSound(
 ) const
 {
 	/*
-	 * Locking here is skipped, as this is only called by UseSound which has
-	 * already obtained a lock. Should this change, locking should be added.
+	 * No locking; only ever called by the streaming thread (or with it
+	 * stopped), which has exclusive ownership of the records.
 	 */
 
 	using namespace trezanik::core;
@@ -366,6 +689,51 @@ ALAudio::FindSound(
 }
 
 
+AudioVoice*
+ALAudio::FindVoice(
+	uint8_t priority
+)
+{
+	using namespace trezanik::core;
+
+	AudioVoice*  best = nullptr;
+
+	for ( auto& voice : my_voices )
+	{
+		if ( voice.source == 0 )
+			continue;
+
+		ALint  state = AL_STOPPED;
+
+		alGetSourcei(voice.source, AL_SOURCE_STATE, &state);
+
+		if ( state != AL_PLAYING && state != AL_PAUSED )
+		{
+			// idle, no better choice possible
+			return &voice;
+		}
+
+		// lesser priorities are higher values; never steal from a greater one
+		if ( voice.priority < priority )
+			continue;
+
+		if ( best == nullptr
+		  || voice.priority > best->priority
+		  || (voice.priority == best->priority && voice.started < best->started) )
+		{
+			best = &voice;
+		}
+	}
+
+	if ( best != nullptr )
+	{
+		TZK_LOG_FORMAT(LogLevel::Trace, "Stealing voice %u of priority %u", best->source, best->priority);
+	}
+
+	return best;
+}
+
+
 AudioFileType
 ALAudio::GetFiletype(
 	FILE* fp
@@ -457,67 +825,6 @@ ALAudio::GetFiletype(
 }
 
 
-void
-ALAudio::GlobalPause()
-{
-	alcSuspendContext(my_al_context);
-
-	for ( auto i = 0; i < al_source_count; i++ )
-	{
-		if ( !my_records[i].active )
-			continue;
-
-		my_records[i].sound->Pause();
-	}
-}
-
-
-void
-ALAudio::GlobalResume()
-{
-	alcProcessContext(my_al_context);
-
-	for ( auto i = 0; i < al_source_count; i++ )
-	{
-		if ( !my_records[i].active )
-			continue;
-
-		my_records[i].sound->Play();
-	}
-}
-
-
-void
-ALAudio::GlobalStop()
-{
-	// no context stop, so pause for immediate effect, then stop everything normally
-	alcSuspendContext(my_al_context);
-
-
-	for ( auto i = 0; i < al_source_count; i++ )
-	{
-		if ( !my_records[i].active )
-			continue;
-
-		my_records[i].sound->Stop();
-	}
-
-	/*
-	 * this event is suited for a single, not global stop - needs expansion.
-	 * plus that refactor for audiofile <-> audioresource mapping.
-	 * We now have an event management replacement ready to go, but don't want
-	 * to integrate pre-alpha since it'd delay it
-	 */
-	/*
-	auto  evtmgr = GetSubsystem<EventManager>();
-
-	EventData::Audio_Action  data{ audioresource->GetResourceID(), AudioActionFlag_Stop, 0 };
-
-	evtmgr->PushEvent(EventType::Domain::Audio, EventType::AudioAction, &data);
-	*/
-}
-
-
 std::vector<std::string>
 ALAudio::GetAllOutputDevices() const
 {
@@ -550,6 +857,33 @@ ALAudio::GetAllOutputDevices() const
 }
 
 
+void
+ALAudio::GlobalPause()
+{
+	audio_command  cmd;
+	cmd.type = AudioCommandType::GlobalPause;
+	Enqueue(std::move(cmd));
+}
+
+
+void
+ALAudio::GlobalResume()
+{
+	audio_command  cmd;
+	cmd.type = AudioCommandType::GlobalResume;
+	Enqueue(std::move(cmd));
+}
+
+
+void
+ALAudio::GlobalStop()
+{
+	audio_command  cmd;
+	cmd.type = AudioCommandType::GlobalStop;
+	Enqueue(std::move(cmd));
+}
+
+
 void
 ALAudio::HandleConfigChange(
 	std::shared_ptr<trezanik::engine::EventData::config_change> cc
@@ -567,9 +901,22 @@ ALAudio::HandleConfigChange(
 		bool  enabled = core::TConverter<bool>::FromString(cc->new_config[TZK_CVAR_SETTING_AUDIO_ENABLED]);
 		if ( !enabled )
 		{
+			// the streaming thread must not touch the context while torn down
+			StopStreaming();
+
+			audio_command  cmd;
+			while ( my_commands.Pop(cmd) )
+			{
+			}
+
 			if ( my_al_context != nullptr )
 			{
-				GlobalStop();
+				audio_command  stop_cmd;
+				stop_cmd.type = AudioCommandType::GlobalStop;
+				ExecuteCommand(stop_cmd);
+				// buffers and sources die with the context
+				DestroyVoices();
+				DestroyClips();
 				alcMakeContextCurrent(nullptr);
 				alcDestroyContext(my_al_context);
 				my_al_context = nullptr;
@@ -590,22 +937,25 @@ ALAudio::HandleConfigChange(
 		}
 	}
 
-	bool  volume_changed = false;
+	bool   volume_changed = false;
+	// out of range values are ignored, retaining the current setting
+	float  effects_volume = -1.f;
+	float  music_volume = -1.f;
 
 	if ( cc->new_config.count(TZK_CVAR_SETTING_AUDIO_VOLUME_EFFECTS) > 0 )
 	{
-		my_effects_volume = core::TConverter<float>::FromString(cc->new_config[TZK_CVAR_SETTING_AUDIO_VOLUME_EFFECTS]);
+		effects_volume = core::TConverter<float>::FromString(cc->new_config[TZK_CVAR_SETTING_AUDIO_VOLUME_EFFECTS]);
 		volume_changed = true;
 	}
 	if ( cc->new_config.count(TZK_CVAR_SETTING_AUDIO_VOLUME_MUSIC) > 0 )
 	{
-		my_music_volume   = core::TConverter<float>::FromString(cc->new_config[TZK_CVAR_SETTING_AUDIO_VOLUME_MUSIC]);
+		music_volume   = core::TConverter<float>::FromString(cc->new_config[TZK_CVAR_SETTING_AUDIO_VOLUME_MUSIC]);
 		volume_changed = true;
 	}
 
 	if ( volume_changed )
 	{
-		SetSoundGain(my_effects_volume, my_music_volume);
+		SetSoundGain(effects_volume, music_volume);
 	}
 }
 
@@ -711,10 +1061,239 @@ ALAudio::Initialize()
 	}
 #endif
 
+	CreateVoices();
+	StartStreaming();
+
 	return ErrNONE;
 }
 
 
+AudioClip*
+ALAudio::LoadClip(
+	const std::shared_ptr<ALSound>& sound
+)
+{
+	using namespace trezanik::core;
+
+	auto  iter = my_clips.find(sound.get());
+
+	if ( iter != my_clips.end() )
+	{
+		return iter->second.buffer == 0 ? nullptr : &iter->second;
+	}
+
+	if ( my_voices[0].source == 0 )
+	{
+		// no voice pool to play it with; remains unevaluated
+		return nullptr;
+	}
+
+	for ( auto i = 0; i < al_source_count; i++ )
+	{
+		if ( my_records[i].active && my_records[i].sound == sound )
+		{
+			// decoding would disrupt playback; remains unevaluated
+			return nullptr;
+		}
+	}
+
+	auto  af = sound->GetAudioFile();
+
+	if ( af == nullptr )
+	{
+		return nullptr;
+	}
+
+	// entry is inserted now, so failures below are not evaluated again
+	AudioClip&  clip = my_clips[sound.get()];
+
+	if ( sound->IsMusicTrack() )
+	{
+		return nullptr;
+	}
+
+	AudioRingBuffer*  rb = af->GetRingBuffer();
+	AudioDataBuffer*  db;
+	std::vector<unsigned char>  pcm;
+	uint32_t  sample_rate = 0;
+	uint8_t   bits_per_sample = 0;
+	uint8_t   num_channels = 0;
+	bool      eligible = true;
+
+	for ( ;; )
+	{
+		while ( eligible && (db = rb->NextRead()) != nullptr )
+		{
+			if ( pcm.empty() )
+			{
+				sample_rate = db->sample_rate;
+				bits_per_sample = db->bits_per_sample;
+				num_channels = db->num_channels;
+			}
+			else if ( db->sample_rate != sample_rate || db->bits_per_sample != bits_per_sample || db->num_channels != num_channels )
+			{
+				eligible = false;
+				break;
+			}
+
+			if ( pcm.size() + db->pcm_data.size() > TZK_AUDIO_CLIP_CACHE_THRESHOLD )
+			{
+				eligible = false;
+				break;
+			}
+
+			pcm.insert(pcm.end(), db->pcm_data.begin(), db->pcm_data.end());
+		}
+
+		if ( !eligible || af->IsEOF() )
+			break;
+
+		af->Update();
+
+		if ( rb->IsEmpty() && !af->IsEOF() )
+		{
+			// decoder made no progress; don't spin
+			eligible = false;
+			break;
+		}
+	}
+
+	// return the file to its initial state, as per ALSound::Stop
+	af->Reset();
+	rb->Reset();
+
+	if ( !eligible || pcm.empty() )
+	{
+		TZK_LOG_FORMAT(LogLevel::Debug, "Sound will be streamed: %s", sound->GetFilepath().c_str());
+		return nullptr;
+	}
+
+	ALenum  err;
+
+	alGetError();
+	alGenBuffers(1, &clip.buffer);
+	if ( (err = alGetError()) != AL_NO_ERROR )
+	{
+		TZK_LOG_FORMAT(LogLevel::Warning, "[OpenAL] alGenBuffers failed: %i - %s", err, alcGetErrorString(err));
+		clip.buffer = 0;
+		return nullptr;
+	}
+
+	alBufferData(clip.buffer,
+		Format(bits_per_sample, num_channels),
+		pcm.data(),
+		static_cast<ALsizei>(pcm.size()),
+		static_cast<ALsizei>(sample_rate)
+	);
+	if ( (err = alGetError()) != AL_NO_ERROR )
+	{
+		TZK_LOG_FORMAT(LogLevel::Warning, "[OpenAL] alBufferData failed: %i - %s", err, alcGetErrorString(err));
+		alDeleteBuffers(1, &clip.buffer);
+		clip.buffer = 0;
+		return nullptr;
+	}
+
+	clip.size = pcm.size();
+
+	TZK_LOG_FORMAT(LogLevel::Debug, "Cached clip of %zu bytes: %s", clip.size, sound->GetFilepath().c_str());
+
+	return &clip;
+}
+
+
+void
+ALAudio::PauseSound(
+	std::shared_ptr<ALSound> sound
+)
+{
+	audio_command  cmd;
+	cmd.type = AudioCommandType::Pause;
+	cmd.sound = sound;
+	Enqueue(std::move(cmd));
+}
+
+
+void
+ALAudio::PlayClip(
+	AudioClip& clip
+)
+{
+	using namespace trezanik::core;
+
+	bool  resumed = false;
+
+	for ( auto& voice : my_voices )
+	{
+		if ( voice.source == 0 || voice.clip != &clip )
+			continue;
+
+		ALint  state = AL_STOPPED;
+
+		alGetSourcei(voice.source, AL_SOURCE_STATE, &state);
+		if ( state == AL_PAUSED )
+		{
+			alSourcePlay(voice.source);
+			resumed = true;
+		}
+	}
+
+	if ( resumed )
+	{
+		return;
+	}
+
+	auto  now = std::chrono::steady_clock::now();
+
+	if ( now - clip.last_start < std::chrono::milliseconds(TZK_AUDIO_CLIP_RETRIGGER_INTERVAL) )
+	{
+#if TZK_AUDIO_LOG_TRACING
+		TZK_LOG(LogLevel::Trace, "Clip retriggered within interval; coalesced");
+#endif
+		return;
+	}
+
+	AudioVoice*  voice = FindVoice(clip.priority);
+
+	if ( voice == nullptr )
+	{
+		TZK_LOG_FORMAT(LogLevel::Debug, "No voice available for clip of priority %u", clip.priority);
+		return;
+	}
+
+	// detach any prior buffer; only possible with the source stopped
+	alSourceStop(voice->source);
+	alSourcei(voice->source, AL_BUFFER, static_cast<ALint>(clip.buffer));
+	alSourcef(voice->source, AL_GAIN, my_effects_volume);
+	alSourcePlay(voice->source);
+
+	voice->clip = &clip;
+	voice->priority = clip.priority;
+	voice->started = now;
+	clip.last_start = now;
+}
+
+
+void
+ALAudio::ProcessCommands()
+{
+	using namespace trezanik::core;
+
+	audio_command  cmd;
+
+	while ( my_commands.Pop(cmd) )
+	{
+		ExecuteCommand(cmd);
+	}
+
+	size_t  dropped = my_dropped_commands.exchange(0);
+
+	if ( dropped > 0 )
+	{
+		TZK_LOG_FORMAT(LogLevel::Warning, "Audio command queue full; %zu commands dropped", dropped);
+	}
+}
+
+
 int
 ALAudio::SetOutputDevice(
 	const ALCchar* device_name
@@ -782,38 +1361,73 @@ ALAudio::SetSoundGain(
 	float music
 )
 {
-	if ( effects < 0.f || effects > 1.f )
-		effects = my_effects_volume;
-	if ( music < 0.f || music > 1.f )
-		music = my_music_volume;
+	// validated on execution, as the current values are owned by the thread
+	audio_command  cmd;
+	cmd.type = AudioCommandType::SetGain;
+	cmd.effects_gain = effects;
+	cmd.music_gain = music;
+	Enqueue(std::move(cmd));
+}
 
-	my_effects_volume = effects;
-	my_music_volume = music;
 
-	for ( auto i = 0; i < al_source_count; i++ )
-	{
-		if ( !my_records[i].active )
-			continue;
+void
+ALAudio::StartSound(
+	std::shared_ptr<ALSound> sound
+)
+{
+	audio_command  cmd;
+	cmd.type = AudioCommandType::Play;
+	cmd.sound = sound;
+	Enqueue(std::move(cmd));
+}
 
-		auto& sound = my_records[i].sound;
 
-#if TZK_IS_DEBUG_BUILD
-		if ( sound == nullptr )
-		{
-			TZK_DEBUG_BREAK;
-			continue;
-		}
+void
+ALAudio::StartStreaming()
+{
+	using namespace trezanik::core;
+
+#if TZK_AUDIO_STREAM_THREAD
+	if ( my_stream_thread.joinable() )
+	{
+		return;
+	}
+
+	my_stream_stop = false;
+	my_stream_thread = std::thread(&ALAudio::StreamThread, this);
+#else
+	TZK_LOG(LogLevel::Debug, "Audio streaming performed inline with the frame update");
 #endif
-		sound->SetSoundGain(my_effects_volume, my_music_volume);
+}
+
+
+void
+ALAudio::StopSound(
+	std::shared_ptr<ALSound> sound
+)
+{
+	audio_command  cmd;
+	cmd.type = AudioCommandType::Stop;
+	cmd.sound = sound;
+	Enqueue(std::move(cmd));
+}
+
+
+void
+ALAudio::StopStreaming()
+{
+	if ( !my_stream_thread.joinable() )
+	{
+		return;
 	}
+
+	my_stream_stop = true;
+	my_stream_thread.join();
 }
 
 
-//================================================
-// Invoked by context within its dedicated thread
-//================================================
 void
-ALAudio::Update(
+ALAudio::Stream(
 	float delta_time
 )
 {
@@ -874,40 +1488,83 @@ ALAudio::Update(
 }
 
 
-int
-ALAudio::UseSound(
-	std::shared_ptr<AudioComponent> emitter,
-	std::shared_ptr<ALSound> sound,
-	uint8_t priority
-)
+void
+ALAudio::StreamThread()
 {
-	uint8_t  slot = invalid_slot;
+	using namespace trezanik::core;
 
-	std::lock_guard<std::mutex>  lock(my_records_lock);
+	auto  tss = core::ServiceLocator::Threading();
+	const char   thread_name[] = "Audio Streaming";
+	std::string  prefix = thread_name;
 
-	FindRecordForSound(priority, slot);
+	prefix += " thread [id=" + std::to_string(tss->GetCurrentThreadId()) + "]";
 
-	if ( slot == invalid_slot )
-		return ErrFAILED;
+	TZK_LOG_FORMAT(LogLevel::Debug, "%s is starting", prefix.c_str());
 
-	if ( my_records[slot].active )
+	tss->SetThreadName(thread_name);
+
+	auto  last = std::chrono::steady_clock::now();
+
+	/*
+	 * Decoupled from the frame loop entirely; a stalled or slow frame has no
+	 * bearing on buffer refills, so the only underrun risk is this thread not
+	 * being scheduled for longer than the queued buffer duration
+	 */
+	while ( !my_stream_stop.load() )
 	{
-		// we're replacing an existing sound of lesser priority
-		my_records[slot].active = false;
-		my_records[slot].sound->GetSource().Stop();
-		my_records[slot].sound->GetSource().RemoveAllQueuedBuffers();
-		my_records[slot].sound.reset();
+		ProcessCommands();
+
+		auto   now = std::chrono::steady_clock::now();
+		float  delta_time = std::chrono::duration<float, std::milli>(now - last).count();
+
+		last = now;
+
+		Stream(delta_time);
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(TZK_AUDIO_STREAM_INTERVAL));
 	}
 
-	sound->SetSoundGain(my_effects_volume, my_music_volume);
-	sound->SetEmitter(emitter);
-	sound->FinishSetup();
+	TZK_LOG_FORMAT(LogLevel::Debug, "%s is stopping", prefix.c_str());
+}
 
-	my_records[slot].sound = sound;
-	my_records[slot].priority = priority;
-	my_records[slot].active = true;
 
-	return ErrNONE;
+//================================================
+// Invoked by context within its dedicated thread
+//================================================
+void
+ALAudio::Update(
+	float delta_time
+)
+{
+	if ( my_stream_thread.joinable() )
+	{
+		// all work performed by the streaming thread
+		return;
+	}
+
+	// no dedicated thread; execute within the frame as a fallback
+	ProcessCommands();
+	Stream(delta_time);
+}
+
+
+int
+ALAudio::UseSound(
+	std::shared_ptr<AudioComponent> emitter,
+	std::shared_ptr<ALSound> sound,
+	uint8_t priority
+)
+{
+	if ( my_al_device == nullptr || sound == nullptr )
+		return ErrFAILED;
+
+	audio_command  cmd;
+	cmd.type = AudioCommandType::Use;
+	cmd.sound = sound;
+	cmd.emitter = emitter;
+	cmd.priority = priority;
+
+	return Enqueue(std::move(cmd)) ? ErrNONE : ErrFAILED;
 }
 
 
@@ -14,6 +14,7 @@
 
 #if TZK_USING_OPENALSOFT
 
+#include "engine/services/audio/AudioCommandQueue.h"
 #include "engine/services/audio/IAudio.h"
 #include "engine/services/event/EngineEvent.h"
 
@@ -22,11 +23,14 @@
 #include "core/services/memory/IMemory.h"
 #include "core/services/ServiceLocator.h"
 
+#include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <set>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -108,6 +112,52 @@ struct AudioRecord
 };
 
 
+/**
+ * A short sound effect, fully decoded into a single shared OpenAL buffer
+ *
+ * Sounds whose decoded PCM fits within TZK_AUDIO_CLIP_CACHE_THRESHOLD are
+ * decoded once on first use; every playback thereafter is served from this
+ * buffer by a pooled voice, with no decoding or streaming involved. Sounds
+ * evaluated and found unsuitable retain an entry with no buffer, so they are
+ * not evaluated again.
+ */
+struct AudioClip
+{
+	/// The OpenAL buffer holding the entire PCM data; 0 if not a clip
+	ALuint  buffer = 0;
+
+	/// The size of the PCM data, in bytes
+	size_t  size = 0;
+
+	/// playback priority, as supplied to the last UseSound
+	uint8_t  priority = UINT8_MAX;
+
+	/// The time this clip last started playback on a voice
+	std::chrono::steady_clock::time_point  last_start;
+};
+
+
+/**
+ * A pooled OpenAL source for clip playback
+ *
+ * Unlike AudioRecord, voices are not bound to a sound; any number of voices
+ * can play the same clip concurrently, sharing its buffer.
+ */
+struct AudioVoice
+{
+	/// The OpenAL source; 0 if the pool has not been created
+	ALuint  source = 0;
+
+	/// The clip last assigned to this voice; nullptr if never used
+	const AudioClip*  clip = nullptr;
+
+	/// playback priority of the assigned clip, as per AudioRecord
+	uint8_t  priority = UINT8_MAX;
+
+	/// The time playback started, to steal the oldest of equal priority
+	std::chrono::steady_clock::time_point  started;
+};
+
 
 // with this known, we can pool the al gen sources and optimize memory locality for Source
 static const uint8_t  al_max_sources = TZK_OPENAL_SOURCE_COUNT;
@@ -133,12 +183,41 @@ class TZK_ENGINE_API ALAudio
 
 private:
 
-	/// Mutex protecting access to the audio records array
-	std::mutex     my_records_lock;
-
-	/// Audio records array, compile-time sized
+	/**
+	 * Audio records array, compile-time sized
+	 *
+	 * Owned by the streaming thread; no other thread may access these while
+	 * it is running, which is why all operations are submitted as commands
+	 */
 	AudioRecord    my_records[al_max_sources];
 
+	/**
+	 * Pool of voices for clip playback
+	 *
+	 * Owned by the streaming thread, as per the records
+	 */
+	AudioVoice  my_voices[TZK_AUDIO_VOICE_COUNT];
+
+	/**
+	 * Cached clips, keyed on their sound
+	 *
+	 * Owned by the streaming thread. Raw pointer keys are safe as my_sounds
+	 * holds every sound until destruction, by which point this is cleared
+	 */
+	std::unordered_map<const ALSound*, AudioClip>  my_clips;
+
+	/// Commands pending execution by the streaming thread
+	AudioCommandQueue  my_commands;
+
+	/// Commands dropped due to a full queue, since last reported
+	std::atomic<size_t>  my_dropped_commands;
+
+	/// The dedicated streaming thread; not joinable if streaming inline
+	std::thread  my_stream_thread;
+
+	/// Flag instructing the streaming thread to exit
+	std::atomic<bool>  my_stream_stop;
+
 	/** The OpenAL device */
 	ALCdevice*   my_al_device;
 
@@ -168,6 +247,77 @@ private:
 	std::set<uint64_t>  my_reg_ids;
 
 
+	/**
+	 * Generates the OpenAL sources for the voice pool
+	 *
+	 * Requires a current context; existing voices are retained
+	 */
+	void
+	CreateVoices();
+
+
+	/**
+	 * Deletes the buffers of all cached clips, and empties the cache
+	 *
+	 * Voices must be destroyed first, as buffers attached to a source cannot
+	 * be deleted. Must only be invoked with the streaming thread stopped.
+	 */
+	void
+	DestroyClips();
+
+
+	/**
+	 * Deletes the OpenAL sources of the voice pool
+	 *
+	 * Must only be invoked with the streaming thread stopped.
+	 */
+	void
+	DestroyVoices();
+
+
+	/**
+	 * Submits a command for the streaming thread
+	 *
+	 * @param[in] command
+	 *  The command to queue
+	 * @return
+	 *  true if queued, false if the queue is full (counted, and reported by
+	 *  the streaming thread rather than per command)
+	 */
+	bool
+	Enqueue(
+		audio_command&& command
+	);
+
+
+	/**
+	 * Performs a command
+	 *
+	 * Must only be invoked by the streaming thread, or with it stopped.
+	 *
+	 * @param[in] command
+	 *  The command to execute
+	 */
+	void
+	ExecuteCommand(
+		audio_command& command
+	);
+
+
+	/**
+	 * Obtains the cached clip for a sound
+	 *
+	 * @param[in] sound
+	 *  The sound to lookup
+	 * @return
+	 *  A pointer to the clip, or nullptr if the sound is not a cached clip
+	 */
+	AudioClip*
+	FindClip(
+		const ALSound* sound
+	);
+
+
 	/**
 	 * Finds an available AudioRecord slot for an added sound
 	 *
@@ -193,6 +343,25 @@ private:
 	) const;
 
 
+	/**
+	 * Finds a voice to play a clip of the supplied priority
+	 *
+	 * Idle voices are used first. If none remain, the voice playing the
+	 * lowest priority clip is stolen, provided it is of equal or lesser
+	 * priority than this one; the oldest is taken among equals, so a burst of
+	 * identical notifications cycles through the pool rather than failing.
+	 *
+	 * @param[in] priority
+	 *  The priority of the clip to play
+	 * @return
+	 *  The voice to use, or nullptr if all are playing greater priorities
+	 */
+	AudioVoice*
+	FindVoice(
+		uint8_t priority
+	);
+
+
 	/**
 	 * Handles configuration change events
 	 * 
@@ -204,6 +373,95 @@ private:
 		std::shared_ptr<trezanik::engine::EventData::config_change> cc
 	);
 
+
+	/**
+	 * Obtains the cached clip for a sound, decoding it if not yet evaluated
+	 *
+	 * Sound effects decoding to no more than TZK_AUDIO_CLIP_CACHE_THRESHOLD
+	 * bytes are read in full and uploaded to a single buffer, with the audio
+	 * file reset afterwards. Music tracks are never cached, and a sound
+	 * presently streaming is not evaluated until it finishes.
+	 *
+	 * Must only be invoked by the streaming thread, or with it stopped.
+	 *
+	 * @param[in] sound
+	 *  The sound to lookup or evaluate
+	 * @return
+	 *  A pointer to the clip, or nullptr if the sound is not to be cached
+	 */
+	AudioClip*
+	LoadClip(
+		const std::shared_ptr<ALSound>& sound
+	);
+
+
+	/**
+	 * Starts playback of a clip on a voice
+	 *
+	 * Resumes paused voices of this clip if any exist, otherwise starts a new
+	 * voice. Repeat starts within TZK_AUDIO_CLIP_RETRIGGER_INTERVAL are
+	 * coalesced, as overlapping identical sounds add nothing but volume.
+	 *
+	 * @param[in] clip
+	 *  The clip to play
+	 */
+	void
+	PlayClip(
+		AudioClip& clip
+	);
+
+
+	/**
+	 * Executes all queued commands
+	 *
+	 * Must only be invoked by the streaming thread, or with it stopped.
+	 */
+	void
+	ProcessCommands();
+
+
+	/**
+	 * Starts the dedicated streaming thread
+	 *
+	 * No-op if TZK_AUDIO_STREAM_THREAD is disabled, or already running.
+	 */
+	void
+	StartStreaming();
+
+
+	/**
+	 * Stops the dedicated streaming thread, waiting for it to exit
+	 *
+	 * Pending commands remain queued.
+	 */
+	void
+	StopStreaming();
+
+
+	/**
+	 * Refills and queues the buffers of all active sounds
+	 *
+	 * This is where all decoding takes place.
+	 *
+	 * @param[in] delta_time
+	 *  Number of milliseconds elapsed since the last invocation
+	 */
+	void
+	Stream(
+		float delta_time
+	);
+
+
+	/**
+	 * Streaming thread entry point
+	 *
+	 * Loops executing commands and refilling buffers every
+	 * TZK_AUDIO_STREAM_INTERVAL milliseconds, independent of the frame rate,
+	 * until StopStreaming is called.
+	 */
+	void
+	StreamThread();
+
 protected:
 
 public:
@@ -290,6 +548,15 @@ public:
 	Initialize() override;
 
 
+	/**
+	 * Implementation of IAudio::PauseSound
+	 */
+	virtual void
+	PauseSound(
+		std::shared_ptr<ALSound> sound
+	) override;
+
+
 	/**
 	 * Changes the output device to the supplied device name
 	 *
@@ -320,6 +587,24 @@ public:
 	) override;
 
 
+	/**
+	 * Implementation of IAudio::StartSound
+	 */
+	virtual void
+	StartSound(
+		std::shared_ptr<ALSound> sound
+	) override;
+
+
+	/**
+	 * Implementation of IAudio::StopSound
+	 */
+	virtual void
+	StopSound(
+		std::shared_ptr<ALSound> sound
+	) override;
+
+
 	/**
 	 * Implementation of IAudio::Update
 	 */
@@ -145,6 +145,13 @@ ALSound::GetSource()
 }
 
 
+bool
+ALSound::IsMusicTrack() const
+{
+	return my_is_music_track;
+}
+
+
 bool
 ALSound::IsStopped()
 {
@@ -293,11 +300,16 @@ ALSound::Update()
 
 void
 ALSound::Update(
-	float TZK_UNUSED(delta_time)
+	float delta_time
 )
 {
 	// also todo: if fade out, update gain as appropriate
 
+	/*
+	 * Gain moves 0.02 per 60Hz frame as originally tuned; scaled by elapsed
+	 * time, as the streaming thread ticks far more often than the frame rate
+	 */
+	const float  gain_step = 0.02f * (delta_time / (1000.f / 60.f));
 	float&  current_gain = my_is_music_track ? my_current_gain_music : my_current_gain_effect;
 	float&  sound_gain   = my_is_music_track ? my_sound_gain_music : my_sound_gain_effect;
 
@@ -310,11 +322,11 @@ ALSound::Update(
 
 	if ( current_gain > sound_gain )
 	{
-		current_gain = std::max(current_gain - 0.02f, sound_gain);
+		current_gain = std::max(current_gain - gain_step, sound_gain);
 	}
 	else if ( current_gain < sound_gain )
 	{
-		current_gain = std::min(current_gain + 0.02f, sound_gain);
+		current_gain = std::min(current_gain + gain_step, sound_gain);
 	}
 
 	my_source.SetGain(current_gain);
@@ -76,6 +76,10 @@ struct sound_loop_params
  * 
  * The ALSource is the only thing tying the header to OpenAL specifics.. not
  * that another library would really ever be used.
+ *
+ * Other than construction, all methods are invoked by the ALAudio streaming
+ * thread; external callers go through IAudio (StartSound, PauseSound, etc.)
+ * which queue the operation for it.
  */
 class TZK_ENGINE_API ALSound
 {
@@ -233,6 +237,16 @@ public:
 	GetSource();
 
 
+	/**
+	 * Determines if this sound is a music track rather than a sound effect
+	 * 
+	 * @return
+	 *  Boolean state, true if a music track
+	 */
+	bool
+	IsMusicTrack() const;
+
+
 	/**
 	 * Gets the playback state of this sound
 	 * 
@@ -42,6 +42,25 @@ class AudioFile;
 class AudioRingBuffer;
 
 
+/**
+ * Helper function to acquire the OpenAL format for data
+ *
+ * @param[in] bits_per_sample
+ *  The number of bits per sample
+ * @param[in] num_channels
+ *  The number of channels; > 1 will result in stereo formatting
+ * @return
+ *  One of AL_FORMAT_MONO8, AL_FORMAT_MONO16, AL_FORMAT_STEREO8, or AL_FORMAT_STEREO16.
+ *  AL_FORMAT_[MONO|STEREO]16 is returned if the bits_per_sample is invalid
+ */
+extern
+ALuint
+Format(
+	int bits_per_sample,
+	int num_channels
+);
+
+
 /**
  * Wrapper class around an OpenAL source to contain operations
  */
@@ -0,0 +1,218 @@
+#pragma once
+
+/**
+ * @file        src/engine/services/audio/AudioCommandQueue.h
+ * @brief       Lock-free queue of commands for the audio streaming thread
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "engine/definitions.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+
+namespace trezanik {
+namespace engine {
+
+
+class ALSound;
+class AudioComponent;
+
+
+/**
+ * Operations requested of the audio streaming thread
+ */
+enum class AudioCommandType : uint8_t
+{
+	Invalid = 0,   //< unset
+	Use,           //< bind a sound to an emitter and assign a source record
+	Play,          //< start or resume playback of a sound
+	Pause,         //< pause playback of a sound
+	Stop,          //< stop playback of a sound, rewinding it
+	SetGain,       //< update the effects and music gain
+	GlobalPause,   //< pause all active sounds
+	GlobalResume,  //< resume all active sounds
+	GlobalStop     //< stop all active sounds
+};
+
+
+/**
+ * A single command, with the parameters for all types
+ *
+ * Only the members relevant to the type are read.
+ */
+struct audio_command
+{
+	/// The operation to perform
+	AudioCommandType  type = AudioCommandType::Invalid;
+
+	/// The target sound, for per-sound operations
+	std::shared_ptr<ALSound>  sound;
+
+	/// The emitter, for Use
+	std::shared_ptr<AudioComponent>  emitter;
+
+	/// The playback priority, for Use
+	uint8_t  priority = UINT8_MAX;
+
+	/// The effects gain, for SetGain
+	float  effects_gain = -1.f;
+
+	/// The music gain, for SetGain
+	float  music_gain = -1.f;
+};
+
+
+/**
+ * Bounded multi-producer, single-consumer command queue
+ *
+ * Any thread (UI, event dispatch, resource loaders) may push; only the audio
+ * streaming thread pops. No mutex is involved, so a producer can never stall
+ * behind the streaming thread performing a decode, and vice versa.
+ *
+ * The classic sequence-numbered ring: each cell carries a sequence that tells
+ * producers and the consumer whether it is free to write or ready to read.
+ * Being bounded, a push fails rather than allocating when full; sized via
+ * TZK_AUDIO_COMMAND_QUEUE_SIZE.
+ */
+class AudioCommandQueue
+{
+	TZK_NO_CLASS_ASSIGNMENT(AudioCommandQueue);
+	TZK_NO_CLASS_COPY(AudioCommandQueue);
+	TZK_NO_CLASS_MOVEASSIGNMENT(AudioCommandQueue);
+	TZK_NO_CLASS_MOVECOPY(AudioCommandQueue);
+
+private:
+
+	static constexpr size_t  capacity = TZK_AUDIO_COMMAND_QUEUE_SIZE;
+	static_assert(capacity >= 2 && (capacity & (capacity - 1)) == 0, "Audio command queue size must be a power of two");
+
+	/**
+	 * A slot within the ring
+	 */
+	struct cell
+	{
+		/// Position this cell is next valid for; see Push/Pop
+		std::atomic<size_t>  sequence;
+
+		/// The command payload
+		audio_command  command;
+	};
+
+	/// The ring of cells
+	cell  my_cells[capacity];
+
+	/// Next position to write; contended between producers
+	alignas(64) std::atomic<size_t>  my_enqueue_pos;
+
+	/// Next position to read; consumer only
+	alignas(64) std::atomic<size_t>  my_dequeue_pos;
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 */
+	AudioCommandQueue()
+	{
+		for ( size_t i = 0; i < capacity; i++ )
+		{
+			my_cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+		my_enqueue_pos.store(0, std::memory_order_relaxed);
+		my_dequeue_pos.store(0, std::memory_order_relaxed);
+	}
+
+
+	/**
+	 * Removes the oldest command
+	 *
+	 * Must only be called from the single consumer thread.
+	 *
+	 * @param[out] command
+	 *  The command, moved out of the queue
+	 * @return
+	 *  true if a command was obtained, false if the queue was empty
+	 */
+	bool
+	Pop(
+		audio_command& command
+	)
+	{
+		size_t  pos = my_dequeue_pos.load(std::memory_order_relaxed);
+		cell&   c = my_cells[pos & (capacity - 1)];
+		size_t  seq = c.sequence.load(std::memory_order_acquire);
+
+		if ( seq != pos + 1 )
+		{
+			// empty, or the producer claiming this cell has not yet published
+			return false;
+		}
+
+		my_dequeue_pos.store(pos + 1, std::memory_order_relaxed);
+		command = std::move(c.command);
+		c.command = audio_command();
+		// free for the producer one lap ahead
+		c.sequence.store(pos + capacity, std::memory_order_release);
+
+		return true;
+	}
+
+
+	/**
+	 * Appends a command
+	 *
+	 * Safe to call from any number of threads concurrently.
+	 *
+	 * @param[in] command
+	 *  The command to add
+	 * @return
+	 *  true if added, false if the queue is full
+	 */
+	bool
+	Push(
+		audio_command&& command
+	)
+	{
+		size_t  pos = my_enqueue_pos.load(std::memory_order_relaxed);
+		cell*   c;
+
+		for ( ;; )
+		{
+			c = &my_cells[pos & (capacity - 1)];
+
+			size_t     seq = c->sequence.load(std::memory_order_acquire);
+			ptrdiff_t  diff = static_cast<ptrdiff_t>(seq) - static_cast<ptrdiff_t>(pos);
+
+			if ( diff == 0 )
+			{
+				// cell free; claim it, unless another producer beat us to it
+				if ( my_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed) )
+					break;
+			}
+			else if ( diff < 0 )
+			{
+				// consumer has not freed this cell yet; full
+				return false;
+			}
+			else
+			{
+				pos = my_enqueue_pos.load(std::memory_order_relaxed);
+			}
+		}
+
+		c->command = std::move(command);
+		// publish to the consumer
+		c->sequence.store(pos + 1, std::memory_order_release);
+
+		return true;
+	}
+};
+
+
+} // namespace engine
+} // namespace trezanik
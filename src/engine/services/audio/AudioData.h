@@ -245,6 +245,28 @@ public:
 	}
 
 
+	/**
+	 * Determines the memory held by all buffers in the ring
+	 *
+	 * @return
+	 *  The total number of bytes allocated for PCM data across all buffers
+	 */
+	size_t
+	MemoryUsage() const
+	{
+		std::lock_guard<std::mutex>  lock(my_lock);
+
+		size_t  retval = 0;
+
+		for ( size_t i = 0; i < my_max_size; i++ )
+		{
+			retval += my_buffers[i].pcm_data.capacity();
+		}
+
+		return retval;
+	}
+
+
 	/**
 	 * Returns the ring buffer to initial state
 	 * 
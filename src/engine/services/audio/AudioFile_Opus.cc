@@ -103,6 +103,13 @@ AudioFile_Opus::Load(
 	 * It will be cleaned up properly and doesn't conflict with anything in
 	 * our usage pattern.
 	 */
+	if ( fileno(fp) < 0 )
+	{
+		// memory streams (virtual files) have no descriptor to hand over
+		TZK_LOG(LogLevel::Error, "[Opus] Stream has no file descriptor; in-memory sources are unsupported");
+		return ErrIMPL;
+	}
+
 	void*  p = (void*)op_fdopen(&opus_callbacks, dup(fileno(fp)), "rb");
 
 	if ( TZK_UNLIKELY(p == nullptr) )
@@ -184,6 +184,22 @@ public:
 	Initialize() = 0;
 
 
+	/**
+	 * Pauses playback of the sound
+	 *
+	 * Like all playback operations, this is queued for the audio streaming
+	 * thread and takes effect asynchronously; safe to call from any thread.
+	 *
+	 * @sa StartSound, StopSound
+	 * @param[in] sound
+	 *  The sound to pause
+	 */
+	virtual void
+	PauseSound(
+		std::shared_ptr<ALSound> sound
+	) = 0;
+
+
 	/**
 	 * Immediate update of all audio items gains
 	 *
@@ -208,12 +224,44 @@ public:
 	) = 0;
 
 
+	/**
+	 * Starts, or resumes, playback of the sound
+	 *
+	 * The sound must have been bound to an emitter via UseSound first; as
+	 * commands are processed in order, this can be called immediately after.
+	 *
+	 * @sa PauseSound, StopSound
+	 * @param[in] sound
+	 *  The sound to play
+	 */
+	virtual void
+	StartSound(
+		std::shared_ptr<ALSound> sound
+	) = 0;
+
+
+	/**
+	 * Stops playback of the sound, rewinding to the start
+	 *
+	 * @sa PauseSound, StartSound
+	 * @param[in] sound
+	 *  The sound to stop
+	 */
+	virtual void
+	StopSound(
+		std::shared_ptr<ALSound> sound
+	) = 0;
+
+
 	/**
 	 * Ticks the object to handle streaming operations
 	 *
 	 * Called by the Context update thread handler. It is not expected to have
 	 * this called by any other item.
 	 *
+	 * Implementations with a dedicated streaming thread need not do anything
+	 * here; it exists for those performing their work in the frame update.
+	 *
 	 * @param[in] delta_time
 	 *  Number of milliseconds elapsed since the last update
 	 */
@@ -243,12 +291,20 @@ public:
 	 *   Priority256 = 255
 	 * };
 	 *
+	 * Source assignment is performed by the audio streaming thread; a sound
+	 * unable to obtain a source at that point is logged and not played.
+	 * Short sound effects are instead decoded once into a shared buffer and
+	 * played by a pool of voices, each play taking a voice of its own; the
+	 * priority then determines which voice is stolen when all are busy.
+	 *
 	 * @param[in] emitter
 	 *  The AudioComponent that emits this sound
 	 * @param[in] sound
 	 *  The sound that will be played
 	 * @param[in] priority
 	 *  The priority of this sound; 0 = highest, 255 = lowest
+	 * @return
+	 *  ErrNONE if the request was accepted, otherwise an error code
 	 */
 	virtual int
 	UseSound(
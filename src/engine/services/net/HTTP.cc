@@ -22,7 +22,10 @@
 #	include <openssl/x509v3.h>
 #endif
 
+#include <algorithm>
+#include <cctype>
 #include <chrono>
+#include <cstring>
 #include <thread>
 
 
@@ -38,26 +41,64 @@ namespace net {
 
 
 HTTPSession::HTTPSession(
-	URI uri
+	URI uri,
+	HTTPConnectionPool* pool,
+	HTTPCache* cache
 )
-: my_keep_alive_secs(4)
+: my_keep_alive_secs(TZK_HTTP_KEEPALIVE_TIMEOUT)
 , my_starting_uri(uri)
 , my_ignore_invalid_certs(true) // TESTING ONLY
+, my_pool(pool)
+, my_reusable(false)
+, my_cache(cache)
 #if TZK_USING_OPENSSL
 , my_ssl_ctx(nullptr)
+, my_owns_ssl_ctx(false)
 , my_ssl_bio(nullptr)
 , my_socket(nullptr)
 #endif
 {
-
+	my_pool_key = my_starting_uri.GetHost();
+	my_pool_key += ":";
+	my_pool_key += my_starting_uri.GetPort();
 }
 
 
 HTTPSession::~HTTPSession()
 {
 #if TZK_USING_OPENSSL
-	BIO_free_all(my_socket);
-	BIO_free_all(my_ssl_bio);
+	if ( my_pool != nullptr && my_ssl_bio != nullptr )
+	{
+		SSL*  sslp = nullptr;
+		BIO_get_ssl(my_ssl_bio, &sslp);
+		if ( sslp != nullptr )
+		{
+			my_pool->StoreTLSSession(my_pool_key, sslp);
+		}
+	}
+
+	if ( my_pool != nullptr && my_reusable )
+	{
+		pooled_connection  conn;
+
+		conn.socket = my_socket;
+		conn.ssl_bio = my_ssl_bio;
+		my_pool->Release(my_pool_key, conn);
+	}
+	else if ( my_ssl_bio != nullptr )
+	{
+		// frees the chained socket too
+		BIO_free_all(my_ssl_bio);
+	}
+	else
+	{
+		BIO_free_all(my_socket);
+	}
+
+	if ( my_owns_ssl_ctx && my_ssl_ctx != nullptr )
+	{
+		SSL_CTX_free(my_ssl_ctx);
+	}
 #endif
 }
 
@@ -67,11 +108,8 @@ HTTPSession::Establish()
 {
 	using namespace trezanik::core;
 
-	std::string  connection;
+	std::string  connection = my_pool_key;
 
-	connection = my_starting_uri.GetHost();
-	connection += ":";
-	connection += my_starting_uri.GetPort();
 #if 0
 	auto  path = my_starting_uri.GetPath();
 	if ( !path.empty() )
@@ -89,28 +127,51 @@ HTTPSession::Establish()
 #endif
 	
 #if TZK_USING_OPENSSL
-	if ( (my_ssl_ctx = SSL_CTX_new(TLS_client_method())) == nullptr )
+	if ( my_pool != nullptr )
+	{
+		pooled_connection  conn;
+
+		if ( my_pool->Acquire(my_pool_key, conn) )
+		{
+			my_socket = conn.socket;
+			my_ssl_bio = conn.ssl_bio;
+			return ErrNONE;
+		}
+
+		my_ssl_ctx = my_pool->GetSSLContext();
+	}
+
+	if ( my_ssl_ctx != nullptr )
+	{
+		// shared context, already configured
+	}
+	else if ( (my_ssl_ctx = SSL_CTX_new(TLS_client_method())) == nullptr )
 	{
 		TZK_LOG(LogLevel::Warning, "Failed to create SSL_CTX");
 		return ErrEXTERN;
 	}
+	else
+	{
+		// private context; no pool, or the pool failed to create its own
+		my_owns_ssl_ctx = true;
 
 #if TZK_ENABLE_XP2003_SUPPORT
-	/*
-	 * Note:
-	 * It IS possible to get TLS 1.1 and 1.2 running on XP, but you'll have to
-	 * go through the POSReady setup and do some tweaks. Rather than enforcing
-	 * this, we'll support XP dropping down to 1.0 - user choice if they still
-	 * want to implement legacy network connectivity.
-	 */
-	SSL_CTX_set_min_proto_version(my_ssl_ctx, TLS1_0_VERSION);
+		/*
+		 * Note:
+		 * It IS possible to get TLS 1.1 and 1.2 running on XP, but you'll have to
+		 * go through the POSReady setup and do some tweaks. Rather than enforcing
+		 * this, we'll support XP dropping down to 1.0 - user choice if they still
+		 * want to implement legacy network connectivity.
+		 */
+		SSL_CTX_set_min_proto_version(my_ssl_ctx, TLS1_0_VERSION);
 #else
-	SSL_CTX_set_min_proto_version(my_ssl_ctx, TLS1_2_VERSION);
+		SSL_CTX_set_min_proto_version(my_ssl_ctx, TLS1_2_VERSION);
 #endif
 
-	if ( SSL_CTX_set_default_verify_paths(my_ssl_ctx) != 1 )
-	{
-		throw std::runtime_error("Unable to load the certificate trust store");
+		if ( SSL_CTX_set_default_verify_paths(my_ssl_ctx) != 1 )
+		{
+			throw std::runtime_error("Unable to load the certificate trust store");
+		}
 	}
 
 	if ( (my_socket = BIO_new_connect(connection.c_str())) == nullptr )
@@ -140,6 +201,11 @@ HTTPSession::Establish()
 	BIO_get_ssl(my_ssl_bio, &sslp);
 	SSL_set_tlsext_host_name(sslp, my_starting_uri.GetHost().c_str());
 
+	if ( my_pool != nullptr )
+	{
+		my_pool->ResumeTLSSession(my_pool_key, sslp);
+	}
+
 	if ( BIO_do_handshake(my_ssl_bio) <= 0 )
 	{
 		/// @todo add error reporting
@@ -147,6 +213,11 @@ HTTPSession::Establish()
 		return ErrEXTERN;
 	}
 
+	if ( SSL_session_reused(sslp) )
+	{
+		TZK_LOG_FORMAT(LogLevel::Debug, "TLS session resumed with: %s", connection.c_str());
+	}
+
 	if ( !my_ignore_invalid_certs )
 	{
 		if ( !VerifyCertificate() )
@@ -280,6 +351,39 @@ HTTPSession::Request(
 
 	my_transactions.push_back(std::make_pair<>(request, std::shared_ptr<HTTPResponse>()));
 
+	if ( my_cache != nullptr && request->my_method == "GET" )
+	{
+		request->my_cache_key = HTTPCache::Key(my_starting_uri.GetHost(), my_starting_uri.GetPort(), request->my_uri);
+		request->my_cached = my_cache->Lookup(request->my_cache_key);
+
+		if ( request->my_cached != nullptr )
+		{
+			if ( HTTPCache::IsFresh(*request->my_cached) )
+			{
+				TZK_LOG_FORMAT(LogLevel::Debug, "Fresh in cache, not sending: %s", request->my_cache_key.c_str());
+				my_cache->RecordFreshHit();
+				request->my_from_cache = true;
+				request->my_req_status = HTTPRequestInternalStatus::Completed;
+
+				// no prior transaction, so the connection is untouched and can be handed on
+				if ( my_transactions.size() == 1 )
+				{
+					my_reusable = true;
+				}
+				return;
+			}
+
+			if ( !request->my_cached->etag.empty() )
+			{
+				request->AddHeader("If-None-Match", request->my_cached->etag);
+			}
+			if ( !request->my_cached->last_modified.empty() )
+			{
+				request->AddHeader("If-Modified-Since", request->my_cached->last_modified);
+			}
+		}
+	}
+
 	if ( request->Send(shared_from_this()) == -1 )
 	{
 		TZK_LOG(LogLevel::Warning, "Request send failed");
@@ -289,7 +393,8 @@ HTTPSession::Request(
 
 std::shared_ptr<HTTPResponse>
 HTTPSession::Response(
-	std::shared_ptr<HTTPRequest> request
+	std::shared_ptr<HTTPRequest> request,
+	HTTPBodyCallback body_callback
 )
 {
 	using namespace trezanik::core;
@@ -325,12 +430,95 @@ HTTPSession::Response(
 		return response;
 	}
 
+	response->my_body_callback = body_callback;
+
+	if ( request->my_from_cache )
+	{
+		response->my_from_cache = true;
+		if ( response->Deliver(request->my_cached->content.data(), request->my_cached->content.length()) == ErrNONE )
+		{
+			response->my_status = HTTPResponseInternalStatus::Completed;
+		}
+		else
+		{
+			response->my_status = HTTPResponseInternalStatus::Failed;
+		}
+		return response;
+	}
+
 	response->Receive(shared_from_this());
 
+	// only the outcome of the latest response determines reuse
+	my_reusable = response->my_connection_reusable;
+
+	if ( my_cache != nullptr && !request->my_cache_key.empty() )
+	{
+		UpdateCache(request, response);
+	}
+
 	return response;
 }
 
 
+void
+HTTPSession::UpdateCache(
+	std::shared_ptr<HTTPRequest> request,
+	std::shared_ptr<HTTPResponse> response
+)
+{
+	using namespace trezanik::core;
+
+	if ( response->my_status != HTTPResponseInternalStatus::Completed )
+	{
+		return;
+	}
+
+	uint64_t  max_age = 0;
+	bool      storable = HTTPCache::ParseCacheControl(response->FindHeader("Cache-Control"), max_age);
+
+	if ( response->my_response_status == HTTP_NOT_MODIFIED )
+	{
+		if ( request->my_cached == nullptr )
+		{
+			// we never sent a conditional request, so have nothing to supply
+			TZK_LOG(LogLevel::Warning, "Unsolicited 304 response");
+			response->my_status = HTTPResponseInternalStatus::Failed;
+			return;
+		}
+
+		auto  entry = my_cache->Revalidate(request->my_cache_key, max_age);
+
+		if ( entry == nullptr )
+		{
+			entry = request->my_cached;
+		}
+
+		response->my_from_cache = true;
+		if ( response->Deliver(entry->content.data(), entry->content.length()) != ErrNONE )
+		{
+			response->my_status = HTTPResponseInternalStatus::Failed;
+		}
+		return;
+	}
+
+	if ( response->my_body_callback != nullptr || !storable )
+	{
+		// content not retained, or not permitted to be
+		return;
+	}
+
+	http_cache_entry  entry;
+
+	entry.key = request->my_cache_key;
+	entry.etag = response->FindHeader("ETag");
+	entry.last_modified = response->FindHeader("Last-Modified");
+	entry.max_age = max_age;
+	entry.content = response->my_content;
+
+	my_cache->Store(std::move(entry));
+}
+
+
 bool
 HTTPSession::VerifyCertificate() const
 {
@@ -387,12 +575,32 @@ HTTPSession::VerifyCertificate() const
 
 HTTPRequest::HTTPRequest()
 : my_req_status(HTTPRequestInternalStatus::Pending)
+, my_locked(false)
 , my_max_send(TZK_HTTP_MAX_SEND)
+, my_from_cache(false)
 {
 	
 }
 
 
+bool
+HTTPRequest::AddHeader(
+	const std::string& name,
+	const std::string& value
+)
+{
+	std::lock_guard<std::mutex>  guard(my_guard);
+
+	if ( my_locked || my_req_status != HTTPRequestInternalStatus::Pending )
+	{
+		return false;
+	}
+
+	my_headers.emplace_back(name, value);
+	return true;
+}
+
+
 const trezanik::core::UUID&
 HTTPRequest::ID() const
 {
@@ -435,6 +643,10 @@ HTTPRequest::Send(
 
 	my_data = my_method + " " + my_uri + " " + my_version + "\r\n";
 	my_data += "Host: " + session->GetURI().GetHost() + "\r\n";
+	for ( auto& hdr : my_headers )
+	{
+		my_data += hdr.first + ": " + hdr.second + "\r\n";
+	}
 	my_data += "\r\n";
 
 	if ( my_data.length() >= my_max_send )
@@ -604,16 +816,123 @@ HTTPRequest::SetVersion(
 
 
 
+HTTPBuffer::HTTPBuffer()
+: my_begin(0)
+, my_end(0)
+{
+}
+
+
+void
+HTTPBuffer::Clear()
+{
+	my_begin = 0;
+	my_end = 0;
+}
+
+
+void
+HTTPBuffer::Commit(
+	size_t count
+)
+{
+	my_end = std::min(my_end + count, my_storage.size());
+}
+
+
+void
+HTTPBuffer::Consume(
+	size_t count
+)
+{
+	my_begin = std::min(my_begin + count, my_end);
+
+	if ( my_begin == my_end )
+	{
+		// everything processed; reuse from the start with no move needed
+		my_begin = 0;
+		my_end = 0;
+	}
+}
+
+
+const char*
+HTTPBuffer::Data() const
+{
+	return my_storage.data() + my_begin;
+}
+
+
+size_t
+HTTPBuffer::Find(
+	const char* needle,
+	size_t needle_len
+) const
+{
+	const char*  start = Data();
+	const char*  end = start + Size();
+	const char*  pos = std::search(start, end, needle, needle + needle_len);
+
+	if ( pos == end )
+		return std::string::npos;
+
+	return static_cast<size_t>(pos - start);
+}
+
+
+char*
+HTTPBuffer::Prepare(
+	size_t count
+)
+{
+	if ( my_storage.size() - my_end < count )
+	{
+		size_t  size = Size();
+
+		if ( my_begin > 0 )
+		{
+			// reclaim the consumed space first
+			std::memmove(my_storage.data(), my_storage.data() + my_begin, size);
+			my_begin = 0;
+			my_end = size;
+		}
+		if ( my_storage.size() - my_end < count )
+		{
+			my_storage.resize(my_end + count);
+		}
+	}
+
+	return my_storage.data() + my_end;
+}
+
+
+size_t
+HTTPBuffer::Size() const
+{
+	return my_end - my_begin;
+}
+
+
+
+
+
+
+
+
+
+
 HTTPResponse::HTTPResponse()
 : my_locked(false)
 , my_max_datalen(TZK_HTTP_MAX_RESPONSE)
 , my_content_length(0)
-, my_recv_size(1024)
+, my_recv_size(0)
 , my_last_recv(0)
 , my_status(HTTPResponseInternalStatus::Pending)
 , my_header_end(nullptr)
 , my_http_start(nullptr)
 , my_http_end(nullptr)
+, my_connection_reusable(false)
+, my_from_cache(false)
 {
 }
 
@@ -632,7 +951,65 @@ HTTPResponse::ContentLength() const
 }
 
 
+int
+HTTPResponse::Deliver(
+	const char* data,
+	size_t len
+)
+{
+	using namespace trezanik::core;
+
+	if ( len == 0 )
+	{
+		return ErrNONE;
+	}
+
+	if ( my_body_callback )
+	{
+		if ( !my_body_callback(data, len) )
+		{
+			TZK_LOG(LogLevel::Debug, "Body callback aborted the transfer");
+			return ECANCELED;
+		}
+		return ErrNONE;
+	}
+
+	if ( my_content.size() + len > my_max_datalen )
+	{
+		TZK_LOG_FORMAT(LogLevel::Warning, "Response content exceeds the maximum of %zu bytes", my_max_datalen);
+		return E2BIG;
+	}
+
+	my_content.append(data, len);
+
+	return ErrNONE;
+}
+
+
 std::string
+HTTPResponse::FindHeader(
+	const std::string& name
+) const
+{
+	for ( auto& hdr : my_headers )
+	{
+		// field names are case-insensitive
+		if ( STR_compare(hdr.first.c_str(), name.c_str(), false) == 0 )
+			return hdr.second;
+	}
+
+	return "";
+}
+
+
+bool
+HTTPResponse::FromCache() const
+{
+	return my_from_cache;
+}
+
+
+const std::string&
 HTTPResponse::GetContent() const
 {
 	return my_content;
@@ -664,23 +1041,36 @@ HTTPResponse::InternalStatus() const
 
 int
 HTTPResponse::Read(
-	BIO* bio,
-	std::string& target
+	BIO* bio
 )
 {
 	using namespace trezanik::core;
 
-	char  buf[4096];
-	int   len;
-
-	len = BIO_read(bio, buf, sizeof(buf));
+	const int  read_size = TZK_HTTP_READ_SIZE;
+	int  len;
 
-	if ( BIO_should_retry(bio) )
+	for ( ;; )
 	{
+		// read straight into the buffer; no intermediate copy
+		len = BIO_read(bio, my_buffer.Prepare(read_size), read_size);
+
+		if ( len > 0 )
+		{
+			my_buffer.Commit(static_cast<size_t>(len));
+			my_recv_size += len;
+			my_last_recv = len;
+			/// @todo SendEvent TcpRecv
+			TZK_LOG_FORMAT(LogLevel::Trace, "Received %i bytes from server", len);
+			return ErrNONE;
+		}
+
+		if ( !BIO_should_retry(bio) )
+			break;
+
 		std::this_thread::sleep_for(std::chrono::milliseconds(75));
-		return Read(bio, target);
 	}
-	else if ( len < 0 )
+
+	if ( len < 0 )
 	{
 		unsigned long  err = ERR_get_error();
 		char  ebuf[256];
@@ -688,25 +1078,12 @@ HTTPResponse::Read(
 		TZK_LOG_FORMAT(LogLevel::Warning, "BIO_read failed with error %u (%s)", err, ebuf);
 		return ErrEXTERN;
 	}
-	else if ( len > 0 )
-	{
-		my_recv_size += len;
-		my_last_recv = len;
-		target.append(buf, len);
-		/// @todo SendEvent TcpRecv
-		//TZK_LOG_FORMAT(LogLevel::Debug, "Received %i bytes from server: %s", len, buf);
-		TZK_LOG_FORMAT(LogLevel::Debug, "Received %i bytes from server", len);
-		return ErrNONE;
-	}
-	else
-	{
-		//target.append("\0", 1);
-		my_last_recv = len;
-		// connection closed
-		/// @todo SendEvent TcpRst
-		TZK_LOG(LogLevel::Info, "Connection closed");
-		return ErrNONE;
-	}
+
+	my_last_recv = 0;
+	// connection closed
+	/// @todo SendEvent TcpRst
+	TZK_LOG(LogLevel::Info, "Connection closed");
+	return ErrNONE;
 }
 
 #endif // TZK_USING_OPENSSL
@@ -747,30 +1124,42 @@ HTTPResponse::Receive(
 
 	my_status = HTTPResponseInternalStatus::Receiving;
 
-	do
+	size_t  header_len;
+
+	while ( (header_len = my_buffer.Find(crlf_term, sizeof(crlf_term) - 1)) == std::string::npos )
 	{
-		if ( Read(bio, my_data) != ErrNONE )
+		if ( my_buffer.Size() >= my_max_datalen )
 		{
+			TZK_LOG(LogLevel::Warning, "No end-of-header received within the maximum data length");
 			my_status = HTTPResponseInternalStatus::Failed;
 			return ErrFAILED;
 		}
 
-		my_header_end = strstr(&my_data[0], crlf_term);
-
-	} while ( my_header_end == nullptr && my_data.size() < my_max_datalen );
+		if ( Read(bio) != ErrNONE )
+		{
+			my_status = HTTPResponseInternalStatus::Failed;
+			return ErrFAILED;
+		}
 
-	if ( my_header_end == nullptr )
-	{
-		TZK_LOG(LogLevel::Warning, "No end-of-header received in initial read");
-		return -1;
+		if ( my_last_recv == 0 )
+		{
+			TZK_LOG(LogLevel::Warning, "Connection closed before end-of-header received");
+			my_status = HTTPResponseInternalStatus::Failed;
+			return ErrFAILED;
+		}
 	}
 
+	// header retained, including the double-crlf for accuracy; the buffer now starts at the content
+	header_len += sizeof(crlf_term) - 1;
+	my_data.assign(my_buffer.Data(), header_len);
+	my_buffer.Consume(header_len);
+
 	size_t  next_end = 0;
 	size_t  sep_pos = 0;
 	char    sep = ':';
 
 	// get http response
-	if ( (next_end = my_data.find_first_of(crlf, 0)) == std::string::npos )
+	if ( (next_end = my_data.find(crlf, 0)) == std::string::npos )
 	{
 		TZK_LOG(LogLevel::Warning, "Abnormal (non-HTTP) response from server");
 		my_status = HTTPResponseInternalStatus::Failed;
@@ -789,7 +1178,7 @@ HTTPResponse::Receive(
 	size_t  last_end = next_end + 2;
 
 	// acquire all headers
-	while ( (next_end = my_data.find_first_of(crlf, last_end)) != std::string::npos )
+	while ( (next_end = my_data.find(crlf, last_end)) != std::string::npos )
 	{
 		size_t  line_len = (next_end - last_end);
 
@@ -810,6 +1199,9 @@ HTTPResponse::Receive(
 			std::string  key = line.substr(0, sep_pos);
 			std::string  value = line.substr(sep_pos + 1, line_len - (sep_pos + 1));
 
+			// optional whitespace surrounds the value
+			aux::Trim(value);
+
 			TZK_LOG_FORMAT(LogLevel::Trace, "Adding header '%s' = '%s'", key.c_str(), value.c_str());
 			my_headers[key] = value;
 		}
@@ -817,92 +1209,329 @@ HTTPResponse::Receive(
 		last_end = next_end + 2;
 	}
 
-	// next/last end is the position of the header end
-	if ( &my_data[next_end] != my_header_end )
-	{
-		TZK_LOG(LogLevel::Warning, "Incorrect internal calculation");
-	}
+	// if 301 or 308, log so the user can update their URI
+	// 407, no current proxy auth support
+
+	bool  until_close = false;
+	int   rc = ErrNONE;
 
 	if ( my_response_status == HTTP_NOT_MODIFIED )
 	{
-		/// @todo handle
+		// never has a body; the session supplies the content from its cache
+		TZK_LOG(LogLevel::Debug, "Resource not modified");
+	}
+	else if ( my_response_status != HTTP_OK )
+	{
+		my_status = HTTPResponseInternalStatus::Failed;
+		return ErrFAILED;
 	}
+	else
+	{
+		/*
+		 * Body framing, per RFC 9112 section 6.3; chunked takes precedence over
+		 * any Content-Length, and with neither, the body runs until close
+		 */
+		std::string  transfer_encoding = FindHeader("Transfer-Encoding");
+		std::string  content_length = FindHeader("Content-Length");
+
+		aux::TrimRight(transfer_encoding);
+		if ( transfer_encoding.size() >= 7
+		  && STR_compare(transfer_encoding.c_str() + transfer_encoding.size() - 7, "chunked", false) == 0 )
+		{
+			rc = ReceiveChunked(bio);
+		}
+		else if ( !content_length.empty() )
+		{
+			const char*  errstr = nullptr;
 
-	// if 301 or 308, log so the user can update their URI
-	// 407, no current proxy auth support
+			my_content_length = static_cast<size_t>(STR_to_unum(content_length.c_str(), SIZE_MAX, &errstr));
 
+			if ( errstr != nullptr )
+			{
+				TZK_LOG_FORMAT(LogLevel::Warning, "Invalid 'Content-Length': %s", content_length.c_str());
+				my_status = HTTPResponseInternalStatus::Failed;
+				return ErrFAILED;
+			}
 
-	my_content_length = std::stoul(my_headers["Content-Length"]);
+			rc = ReceiveContent(bio, false);
+		}
+		else
+		{
+			TZK_LOG(LogLevel::Debug, "No 'Content-Length' provided; reading until connection close");
+			until_close = true;
+			rc = ReceiveContent(bio, until_close);
+		}
+	}
 
-	// legit cases for this, but none our application will ever make use of.. yet
-	if ( my_content_length == 0 )
+	if ( rc != ErrNONE )
 	{
-		TZK_LOG(LogLevel::Warning, "No 'Content-Length' provided");
 		my_status = HTTPResponseInternalStatus::Failed;
 		return ErrFAILED;
 	}
 
-
-	my_content.reserve(my_content_length + 1); // keep nul-terminated
-	my_content = my_data.substr(next_end + 2); // one crlf handled, skip the next one
-	my_data.resize(next_end + 2); // include the double-crlf in the buffer for accuracy
-
-	// data is now the HTTP content
-	// content is now the HTML data
-
 #if 0
-	FILE* dfp = core::aux::file::open("rssfeed-data.xml", "w");
-	if ( dfp != nullptr )
+	FILE* cfp = core::aux::file::open("rssfeed-content.xml", "w");
+	if ( cfp != nullptr )
 	{
-		core::aux::file::write(dfp, my_data.c_str(), my_data.length());
-		core::aux::file::close(dfp);
+		core::aux::file::write(cfp, my_content.c_str(), my_content.length());
+		core::aux::file::close(cfp);
 	}
 #endif
 
+	/*
+	 * Persistent by default in HTTP/1.1 unless the server opts out; anything
+	 * left unread means framing went astray, so never hand it on
+	 */
+	std::string  connection = FindHeader("Connection");
+
+	std::transform(connection.begin(), connection.end(), connection.begin(), ::tolower);
+
+	my_connection_reusable = !until_close
+		&& my_response_status.Version() == "HTTP/1.1"
+		&& my_buffer.Size() == 0
+		&& connection.find("close") == std::string::npos;
+
+	my_status = HTTPResponseInternalStatus::Completed;
+	return ErrNONE;
+
+#else
+
+	return ErrIMPL;
+
+#endif // TZK_USING_OPENSSL
+}
+
+
+#if TZK_USING_OPENSSL
+
+int
+HTTPResponse::ReceiveChunked(
+	BIO* bio
+)
+{
+	using namespace trezanik::core;
+
+	enum class ChunkState
+	{
+		Size,     // awaiting the chunk-size line
+		Data,     // within chunk-data
+		DataEnd,  // awaiting the crlf following chunk-data
+		Trailer   // within the trailer section, after the last chunk
+	};
+
+	const char   crlf[] = "\r\n";
+	const size_t crlf_len = sizeof(crlf) - 1;
+	/*
+	 * Bounds the size and trailer lines; no legitimate use needs more, and
+	 * it prevents an endless line holding us in the buffer
+	 */
+	const size_t max_line = 4096;
+	ChunkState   state = ChunkState::Size;
+	size_t       remaining = 0;
+	size_t       total = 0;
+	int          rc;
 
-	if ( my_response_status != HTTP_OK )
+	for ( ;; )
 	{
-		my_status = HTTPResponseInternalStatus::Failed;
-		return ErrFAILED;
+		bool  need_data = false;
+
+		switch ( state )
+		{
+		case ChunkState::Size:
+			{
+				size_t  eol = my_buffer.Find(crlf, crlf_len);
+
+				if ( eol == std::string::npos )
+				{
+					if ( my_buffer.Size() > max_line )
+					{
+						TZK_LOG(LogLevel::Warning, "Chunk size line exceeds limit");
+						return ErrDATA;
+					}
+					need_data = true;
+					break;
+				}
+
+				std::string  line(my_buffer.Data(), eol);
+				size_t  ext = line.find(';');
+
+				// chunk extensions are not used
+				if ( ext != std::string::npos )
+					line.resize(ext);
+				aux::Trim(line);
+
+				const char*  errstr = nullptr;
+
+				remaining = static_cast<size_t>(STR_to_unum_rad(line.c_str(), SIZE_MAX, &errstr, 16));
+				if ( errstr != nullptr || line.empty() )
+				{
+					TZK_LOG_FORMAT(LogLevel::Warning, "Invalid chunk size: %s", line.c_str());
+					return ErrDATA;
+				}
+
+				my_buffer.Consume(eol + crlf_len);
+				state = remaining == 0 ? ChunkState::Trailer : ChunkState::Data;
+			}
+			break;
+		case ChunkState::Data:
+			{
+				if ( my_buffer.Size() == 0 )
+				{
+					need_data = true;
+					break;
+				}
+
+				size_t  len = std::min(remaining, my_buffer.Size());
+
+				if ( (rc = Deliver(my_buffer.Data(), len)) != ErrNONE )
+					return rc;
+
+				my_buffer.Consume(len);
+				remaining -= len;
+				total += len;
+
+				if ( remaining == 0 )
+					state = ChunkState::DataEnd;
+			}
+			break;
+		case ChunkState::DataEnd:
+			if ( my_buffer.Size() < crlf_len )
+			{
+				need_data = true;
+				break;
+			}
+			if ( std::memcmp(my_buffer.Data(), crlf, crlf_len) != 0 )
+			{
+				TZK_LOG(LogLevel::Warning, "Chunk data not terminated by CRLF");
+				return ErrDATA;
+			}
+			my_buffer.Consume(crlf_len);
+			state = ChunkState::Size;
+			break;
+		case ChunkState::Trailer:
+			{
+				size_t  eol = my_buffer.Find(crlf, crlf_len);
+
+				if ( eol == std::string::npos )
+				{
+					if ( my_buffer.Size() > max_line )
+					{
+						TZK_LOG(LogLevel::Warning, "Chunk trailer line exceeds limit");
+						return ErrDATA;
+					}
+					need_data = true;
+					break;
+				}
+
+				my_buffer.Consume(eol + crlf_len);
+
+				if ( eol == 0 )
+				{
+					// blank line; message complete
+					my_content_length = total;
+					TZK_LOG_FORMAT(LogLevel::Debug, "Chunked transfer complete: %zu bytes", total);
+					return ErrNONE;
+				}
+
+				// trailer fields are not used
+			}
+			break;
+		default:
+			TZK_DEBUG_BREAK;
+			return ErrINTERN;
+		}
+
+		if ( !need_data )
+			continue;
+
+		if ( (rc = Read(bio)) != ErrNONE )
+			return rc;
+
+		if ( my_last_recv == 0 )
+		{
+			TZK_LOG_FORMAT(LogLevel::Warning, "Connection closed mid-transfer after %zu bytes", total);
+			return ErrFAILED;
+		}
 	}
+}
 
-	// keep reading until all the content has been delivered
 
-	while ( my_content.size() < my_content_length )
+int
+HTTPResponse::ReceiveContent(
+	BIO* bio,
+	bool until_close
+)
+{
+	using namespace trezanik::core;
+
+	size_t  received = 0;
+	int     rc;
+
+	if ( !until_close )
 	{
-		if ( Read(bio, my_content) != ErrNONE )
+		// legit cases for this, but none our application will ever make use of.. yet
+		if ( my_content_length == 0 )
 		{
-			TZK_LOG(LogLevel::Warning, "Incomplete read");
-			my_status = HTTPResponseInternalStatus::Failed;
-			return ErrFAILED;
+			TZK_LOG(LogLevel::Warning, "'Content-Length' of 0 provided");
+			return ErrDATA;
 		}
 
-		if ( my_last_recv == 0 && my_content.size() < my_content_length )
+		if ( !my_body_callback && my_content_length > my_max_datalen )
 		{
-			TZK_LOG_FORMAT(LogLevel::Warning, "Incomplete read with no more data presented; %zu of %zu bytes", my_content.size(), my_content_length);
-			break;
+			TZK_LOG_FORMAT(LogLevel::Warning, "Response content of %zu bytes exceeds the maximum", my_content_length);
+			return E2BIG;
+		}
+
+		if ( !my_body_callback )
+		{
+			my_content.reserve(my_content_length + 1); // keep nul-terminated
 		}
 	}
 
-#if 0
-	FILE* cfp = core::aux::file::open("rssfeed-content.xml", "w");
-	if ( cfp != nullptr )
+	// keep reading until all the content has been delivered
+	for ( ;; )
 	{
-		core::aux::file::write(cfp, my_content.c_str(), my_content.length());
-		core::aux::file::close(cfp);
-	}
-#endif
+		size_t  len = my_buffer.Size();
 
-	my_status = HTTPResponseInternalStatus::Completed;
-	return ErrNONE;
+		if ( !until_close )
+		{
+			// anything beyond belongs to a subsequent response
+			len = std::min(len, my_content_length - received);
+		}
 
-#else
+		if ( (rc = Deliver(my_buffer.Data(), len)) != ErrNONE )
+			return rc;
 
-	return ErrIMPL;
+		my_buffer.Consume(len);
+		received += len;
 
-#endif // TZK_USING_OPENSSL
+		if ( !until_close && received == my_content_length )
+			break;
+
+		if ( (rc = Read(bio)) != ErrNONE )
+		{
+			TZK_LOG(LogLevel::Warning, "Incomplete read");
+			return rc;
+		}
+
+		if ( my_last_recv == 0 )
+		{
+			if ( until_close )
+			{
+				my_content_length = received;
+				break;
+			}
+
+			TZK_LOG_FORMAT(LogLevel::Warning, "Incomplete read with no more data presented; %zu of %zu bytes", received, my_content_length);
+			return ErrFAILED;
+		}
+	}
+
+	return ErrNONE;
 }
 
+#endif // TZK_USING_OPENSSL
+
 
 HTTPStatus
 HTTPResponse::ResponseStatus() const
@@ -11,11 +11,14 @@
 
 #include "engine/definitions.h"
 
+#include "engine/services/net/HTTPCache.h"
+#include "engine/services/net/HTTPConnectionPool.h"
 #include "engine/services/net/INet.h"
 
 #include "core/UUID.h"
 
 #include <atomic>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -380,6 +383,18 @@ private:
 	/// The maximum amount of data to send, including protcol aspects (version, method, URI)
 	size_t  my_max_send;
 
+	/// Additional headers to dispatch, in order of addition
+	std::vector<std::pair<std::string, std::string>>  my_headers;
+
+	/// The HTTP cache key for this request; empty if not cacheable
+	std::string  my_cache_key;
+
+	/// The cache entry this request is conditional upon; nullptr if none
+	std::shared_ptr<const http_cache_entry>  my_cached;
+
+	/// Flag set if answered by a fresh cache entry, and never sent
+	bool  my_from_cache;
+
 
 	/**
 	 * Transmits the data to the remote side
@@ -408,6 +423,25 @@ public:
 	HTTPRequest();
 
 
+	/**
+	 * Adds a header to dispatch with the request
+	 *
+	 * The Host header is always generated, and must not be added
+	 *
+	 * @param[in] name
+	 *  The header name
+	 * @param[in] value
+	 *  The header value
+	 * @return
+	 *  false if the request has already been dispatched, otherwise true
+	 */
+	bool
+	AddHeader(
+		const std::string& name,
+		const std::string& value
+	);
+
+
 	/**
 	 * Gets the ID of this request
 	 * 
@@ -658,8 +692,141 @@ public:
 };
 
 
+/**
+ * Receiver of HTTP response body data, as it arrives
+ *
+ * Invoked with each decoded portion of the body (chunk framing removed); the
+ * data is only valid for the duration of the call. Return false to abort the
+ * transfer.
+ */
+typedef std::function<bool(const char* data, size_t len)>  HTTPBodyCallback;
+
+
+/**
+ * Growable byte buffer for socket reads
+ *
+ * Data is read directly into the free space at the end, and consumed from the
+ * front. Consumed space is only reclaimed, by moving the unconsumed remainder
+ * down, when more room is needed; so once grown to the working size, reads
+ * involve no allocation, and only partial protocol elements are ever moved.
+ */
+class TZK_ENGINE_API HTTPBuffer
+{
+	TZK_NO_CLASS_ASSIGNMENT(HTTPBuffer);
+	TZK_NO_CLASS_COPY(HTTPBuffer);
+	TZK_NO_CLASS_MOVEASSIGNMENT(HTTPBuffer);
+	TZK_NO_CLASS_MOVECOPY(HTTPBuffer);
+
+private:
+
+	/// The backing storage; only ever grows
+	std::vector<char>  my_storage;
+
+	/// Offset of the first unconsumed byte
+	size_t  my_begin;
+
+	/// Offset one past the last committed byte
+	size_t  my_end;
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 */
+	HTTPBuffer();
+
+
+	/**
+	 * Discards all content, retaining the storage
+	 */
+	void
+	Clear();
+
+
+	/**
+	 * Marks bytes written into the space from Prepare() as content
+	 *
+	 * @param[in] count
+	 *  The number of bytes written; must not exceed that prepared
+	 */
+	void
+	Commit(
+		size_t count
+	);
+
+
+	/**
+	 * Discards bytes from the front of the content
+	 *
+	 * @param[in] count
+	 *  The number of bytes processed; clamped to the content size
+	 */
+	void
+	Consume(
+		size_t count
+	);
+
+
+	/**
+	 * Obtains the start of the unconsumed content
+	 *
+	 * @return
+	 *  Pointer to the content, valid until the next non-const call
+	 */
+	const char*
+	Data() const;
+
+
+	/**
+	 * Locates a byte sequence within the content
+	 *
+	 * @param[in] needle
+	 *  The bytes to search for
+	 * @param[in] needle_len
+	 *  The number of bytes in needle
+	 * @return
+	 *  The offset of the first occurrence from Data(), or std::string::npos
+	 */
+	size_t
+	Find(
+		const char* needle,
+		size_t needle_len
+	) const;
+
+
+	/**
+	 * Ensures writable space exists at the end of the content
+	 *
+	 * @param[in] count
+	 *  The number of bytes required
+	 * @return
+	 *  Pointer to at least count writable bytes; follow with Commit()
+	 */
+	char*
+	Prepare(
+		size_t count
+	);
+
+
+	/**
+	 * Gets the amount of unconsumed content
+	 *
+	 * @return
+	 *  The content size in bytes
+	 */
+	size_t
+	Size() const;
+};
+
+
 /**
  * Class used to hold an HTTP response
+ *
+ * The body is decoded as it is received, handling Content-Length, chunked
+ * transfer encoding, and connection-close delimited responses. It is either
+ * accumulated for GetContent(), or if a body callback was supplied to
+ * HTTPSession::Response(), handed over incrementally and never buffered as a
+ * whole; suited to large feeds and downloads written straight to disk.
  */
 class TZK_ENGINE_API HTTPResponse
 {
@@ -671,10 +838,10 @@ class TZK_ENGINE_API HTTPResponse
 	friend class HTTPSession;
 
 private:
-	/// The data received over the session socket from the server
+	/// The response header received from the server, including the terminating blank line
 	std::string  my_data;
 
-	/// The HTML content within the data
+	/// The HTML content within the data; empty if delivered to a body callback
 	std::string  my_content;
 
 	/**
@@ -715,25 +882,103 @@ private:
 	/// map of the HTTP headers
 	std::unordered_map<std::string, std::string>  my_headers;
 
+	/// socket read buffer, holding received data not yet processed
+	HTTPBuffer  my_buffer;
+
+	/// optional receiver of the body; if set, my_content is not populated
+	HTTPBodyCallback  my_body_callback;
+
+	/// flag set if the connection may carry another request once complete
+	bool  my_connection_reusable;
+
+	/// flag set if the content was supplied by the HTTP cache
+	bool  my_from_cache;
+
+
+	/**
+	 * Passes decoded body data to the callback, or appends it to the content
+	 *
+	 * @param[in] data
+	 *  The body data
+	 * @param[in] len
+	 *  The number of bytes in data
+	 * @return
+	 *  - ErrNONE on success
+	 *  - ECANCELED if the body callback aborted the transfer
+	 *  - E2BIG if buffering would exceed the maximum data length
+	 */
+	int
+	Deliver(
+		const char* data,
+		size_t len
+	);
+
+
+	/**
+	 * Finds a header value, ignoring the case of the name
+	 *
+	 * @param[in] name
+	 *  The header name
+	 * @return
+	 *  The header value, or an empty string if not present
+	 */
+	std::string
+	FindHeader(
+		const std::string& name
+	) const;
+
+
 #if TZK_USING_OPENSSL
 	/**
-	 * Reads data from the socket, storing in target
+	 * Reads the next available data from the socket into the read buffer
 	 * 
-	 * Reads into a static buffer of 4096 bytes initially, and will retry
-	 * after 75ms if a retry is required
+	 * Reads up to TZK_HTTP_READ_SIZE bytes directly into the buffer, waiting
+	 * 75ms between attempts if a retry is required
 	 * 
 	 * @param[in] bio
 	 *  The connected OpenSSL socket
-	 * @param[in,out] target
-	 *  The data target; will be appended to
 	 * @return
 	 *  - ErrNONE on successful execution, including if the connection closes
+	 *    (my_last_recv will be 0)
 	 *  - ErrEXTERN on OpenSSL API call failure
 	 */
 	int
 	Read(
+		BIO* bio
+	);
+
+
+	/**
+	 * Receives a body using chunked transfer encoding
+	 *
+	 * Chunk framing is removed, chunk extensions and trailers are ignored
+	 *
+	 * @param[in] bio
+	 *  The connected OpenSSL socket
+	 * @return
+	 *  An error code on failure, otherwise ErrNONE
+	 */
+	int
+	ReceiveChunked(
+		BIO* bio
+	);
+
+
+	/**
+	 * Receives a body delimited by Content-Length, or the connection closing
+	 *
+	 * @param[in] bio
+	 *  The connected OpenSSL socket
+	 * @param[in] until_close
+	 *  true if no Content-Length was provided, reading until the server
+	 *  closes the connection
+	 * @return
+	 *  An error code on failure, otherwise ErrNONE
+	 */
+	int
+	ReceiveContent(
 		BIO* bio,
-		std::string& target
+		bool until_close
 	);
 #endif
 
@@ -764,7 +1009,7 @@ public:
 
 
 	/**
-	 * Gets the full response data
+	 * Gets the response header data
 	 * 
 	 * @return
 	 *  Reference to the my_data variable
@@ -777,19 +1022,34 @@ public:
 	 * Gets the content length in bytes
 	 * 
 	 * @return
-	 *  The HTML content length
+	 *  The HTML content length; for chunked or connection-close delimited
+	 *  responses, the total decoded once complete
 	 */
 	size_t
 	ContentLength() const;
 
 
 	/**
-	 * Gets a copy of the HTML content
+	 * Determines if the content was supplied by the HTTP cache
+	 *
+	 * True both when the request was never sent, the cached entry being
+	 * fresh, and when the server responded 304 Not Modified; in the latter
+	 * case, ResponseStatus() reports the 304.
+	 *
+	 * @return
+	 *  true if the content came from the cache, otherwise false
+	 */
+	bool
+	FromCache() const;
+
+
+	/**
+	 * Gets the HTML content
 	 * 
 	 * @return
-	 *  The HTML content string
+	 *  Reference to the HTML content string; empty if a body callback was used
 	 */
-	std::string
+	const std::string&
 	GetContent() const;
 
 
@@ -874,9 +1134,24 @@ private:
 	/// Flag to permit connection even if the remote certificate is invalid
 	bool  my_ignore_invalid_certs;
 
+	/// Optional pool the connection is acquired from and returned to
+	HTTPConnectionPool*  my_pool;
+
+	/// The pool key for this connection, "host:port"
+	std::string  my_pool_key;
+
+	/// Flag set if the last response left the connection fit for reuse
+	bool  my_reusable;
+
+	/// Optional cache for conditional GET requests
+	HTTPCache*  my_cache;
+
 #if TZK_USING_OPENSSL
-	/// Context for SSL/TLS related functions
+	/// Context for SSL/TLS related functions; shared with the pool if it has one
 	SSL_CTX*  my_ssl_ctx;
+
+	/// Flag set if my_ssl_ctx was created by, and must be freed by, this session
+	bool  my_owns_ssl_ctx;
 	
 	/// Encrypted network socket
 	BIO*  my_ssl_bio;
@@ -885,6 +1160,25 @@ private:
 	BIO*  my_socket;
 #endif
 
+
+	/**
+	 * Applies a received response to the HTTP cache
+	 *
+	 * A 304 revalidates the entry the request was conditional upon, and its
+	 * content is delivered to the response. A 200 with a buffered body is
+	 * stored, if the Cache-Control permits.
+	 *
+	 * @param[in] request
+	 *  The request, which must have a cache key
+	 * @param[in] response
+	 *  The completed response
+	 */
+	void
+	UpdateCache(
+		std::shared_ptr<HTTPRequest> request,
+		std::shared_ptr<HTTPResponse> response
+	);
+
 protected:
 public:
 	/**
@@ -892,14 +1186,25 @@ public:
 	 * 
 	 * @param[in] uri
 	 *  The initial URI to begin the session with
+	 * @param[in] pool
+	 *  (Optional) The connection pool to reuse connections and TLS state from.
+	 *  Must outlive this session
+	 * @param[in] cache
+	 *  (Optional) The cache used to make GET requests conditional. Must
+	 *  outlive this session
 	 */
 	HTTPSession(
-		URI uri
+		URI uri,
+		HTTPConnectionPool* pool = nullptr,
+		HTTPCache* cache = nullptr
 	);
 
 
 	/**
 	 * Standard destructor
+	 *
+	 * If a pool is in use, the TLS session is retained for resumption, and the
+	 * connection returned for reuse if the last response permitted it
 	 */
 	~HTTPSession();
 
@@ -914,6 +1219,10 @@ public:
 	 * [OpenSSL] TLS 1.2 is configured for the minimum encryption protocol,
 	 *           unless TZK_ENABLE_XP2003_SUPPORT is defined; then allows TLS 1.0
 	 * 
+	 * With a pool, an idle connection to the same host and port is reused if
+	 * available, skipping the connect and handshake entirely; otherwise the
+	 * shared TLS context is used, resuming the prior TLS session if retained.
+	 * 
 	 * @throw
 	 *  [OpenSSL] std::runtime_error if unable to load the certificate key store
 	 * @return
@@ -1032,6 +1341,11 @@ public:
 	 * If the request already exists in the transaction list, no action is
 	 * performed
 	 * 
+	 * With a cache, a GET for a resource with a fresh entry is not sent at
+	 * all - the request completes immediately, and Response() supplies the
+	 * cached content. A stale entry makes the request conditional, via
+	 * If-None-Match and If-Modified-Since.
+	 * 
 	 * @param[in] request
 	 *  The HTTP Request to send to the server
 	 */
@@ -1052,12 +1366,16 @@ public:
 	 * @sa Request()
 	 * @param[in] request
 	 *  The HTTP request to receive a response against
+	 * @param[in] body_callback
+	 *  (Optional) Receiver of the body as it arrives, instead of buffering it
+	 *  within the response; not invoked unless the status is 200 OK
 	 * @return
 	 *  An empty object on failure, otherwise a populated response
 	 */
 	std::shared_ptr<HTTPResponse>
 	Response(
-		std::shared_ptr<HTTPRequest> request
+		std::shared_ptr<HTTPRequest> request,
+		HTTPBodyCallback body_callback = nullptr
 	);
 
 
@@ -0,0 +1,507 @@
+/**
+ * @file        src/engine/services/net/HTTPCache.cc
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "engine/definitions.h"
+
+#include "engine/services/net/HTTPCache.h"
+
+#include "core/services/log/Log.h"
+#include "core/services/threading/Threading.h"
+#include "core/services/ServiceLocator.h"
+#include "core/util/filesystem/file.h"
+#include "core/util/filesystem/folder.h"
+#include "core/util/string/STR_funcs.h"
+#include "core/util/string/string.h"
+#include "core/util/time.h"
+#include "core/error.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+
+namespace trezanik {
+namespace engine {
+namespace net {
+
+
+/// Increment on any change to the file layout
+constexpr uint32_t  http_cache_version = 1;
+
+/// Identifies an HTTP cache file
+constexpr char  http_cache_magic[4] = { 'T', 'Z', 'K', 'H' };
+
+/// Cache file extension
+constexpr char  http_cache_ext[] = ".http";
+
+
+/**
+ * Header prefixing each cache file
+ *
+ * The key, etag, last-modified and content strings immediately follow, in
+ * that order, with the lengths given here. Native byte order; per-machine.
+ */
+struct http_cache_header
+{
+	char      magic[4];
+	uint32_t  version;
+	uint64_t  stored;
+	uint64_t  max_age;
+	uint32_t  key_len;
+	uint32_t  etag_len;
+	uint32_t  last_modified_len;
+	uint32_t  reserved;
+	uint64_t  content_len;
+};
+
+
+HTTPCache::HTTPCache()
+: my_folder_exists(false)
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Constructor starting");
+	{
+	}
+	TZK_LOG(LogLevel::Trace, "Constructor finished");
+}
+
+
+HTTPCache::~HTTPCache()
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Destructor starting");
+	{
+		TZK_LOG_FORMAT(LogLevel::Debug,
+			"HTTP cache: %zu fresh hits, %zu revalidations, %zu stores",
+			my_fresh_hits.load(), my_revalidations.load(), my_stores.load()
+		);
+	}
+	TZK_LOG(LogLevel::Trace, "Destructor finished");
+}
+
+
+std::string
+HTTPCache::EntryPath(
+	const std::string& key
+) const
+{
+	if ( my_folder.empty() )
+	{
+		return std::string();
+	}
+
+	// 64-bit FNV-1a; the full key is held within the file to detect collisions
+	uint64_t  hash = 0xcbf29ce484222325;
+	const uint64_t  prime = 0x00000100000001b3;
+
+	for ( unsigned char c : key )
+	{
+		hash ^= c;
+		hash *= prime;
+	}
+
+	char  name[32];
+	std::snprintf(name, sizeof(name), "%016" PRIx64 "%s", hash, http_cache_ext);
+
+	return my_folder + name;
+}
+
+
+bool
+HTTPCache::IsFresh(
+	const http_cache_entry& entry
+)
+{
+	if ( entry.max_age == 0 )
+	{
+		return false;
+	}
+
+	uint64_t  now = static_cast<uint64_t>(core::aux::get_secs_since_epoch());
+
+	// clock moved backwards; treat as stale rather than trusting it
+	if ( now < entry.stored )
+	{
+		return false;
+	}
+
+	return (now - entry.stored) < entry.max_age;
+}
+
+
+std::string
+HTTPCache::Key(
+	const std::string& host,
+	const std::string& port,
+	const std::string& target
+)
+{
+	std::string  retval = host;
+
+	retval += ":";
+	retval += port;
+	retval += target.empty() ? "/" : target;
+
+	return retval;
+}
+
+
+std::shared_ptr<const http_cache_entry>
+HTTPCache::Load(
+	const std::string& path,
+	const std::string& key
+) const
+{
+	using namespace trezanik::core;
+
+	aux::file::mapped_file  mapping;
+
+	if ( aux::file::map_readonly(path.c_str(), mapping) != ErrNONE )
+	{
+		return nullptr;
+	}
+
+	http_cache_header  hdr;
+	std::shared_ptr<http_cache_entry>  retval;
+
+	if ( mapping.size >= sizeof(hdr) )
+	{
+		std::memcpy(&hdr, mapping.data, sizeof(hdr));
+
+		uint64_t  expected = sizeof(hdr) + static_cast<uint64_t>(hdr.key_len)
+			+ hdr.etag_len + hdr.last_modified_len + hdr.content_len;
+		const char*  p = reinterpret_cast<const char*>(mapping.data) + sizeof(hdr);
+
+		if ( std::memcmp(hdr.magic, http_cache_magic, sizeof(hdr.magic)) == 0
+		  && hdr.version == http_cache_version
+		  && mapping.size == expected
+		  && hdr.key_len == key.length()
+		  && std::memcmp(p, key.c_str(), key.length()) == 0 )
+		{
+			retval = std::make_shared<http_cache_entry>();
+			retval->key = key;
+			p += hdr.key_len;
+			retval->etag.assign(p, hdr.etag_len);
+			p += hdr.etag_len;
+			retval->last_modified.assign(p, hdr.last_modified_len);
+			p += hdr.last_modified_len;
+			retval->content.assign(p, static_cast<size_t>(hdr.content_len));
+			retval->stored = hdr.stored;
+			retval->max_age = hdr.max_age;
+		}
+	}
+
+	if ( retval == nullptr )
+	{
+		// outdated, corrupt, or a hash collision; replaced on the next store
+		TZK_LOG_FORMAT(LogLevel::Debug, "HTTP cache entry invalid or outdated: %s", path.c_str());
+	}
+
+	aux::file::unmap(mapping);
+
+	return retval;
+}
+
+
+std::shared_ptr<const http_cache_entry>
+HTTPCache::Lookup(
+	const std::string& key
+)
+{
+#if TZK_HTTP_CACHE
+	std::string  path;
+
+	{
+		std::lock_guard<std::mutex>  lock(my_lock);
+
+		auto  iter = my_entries.find(key);
+
+		if ( iter != my_entries.end() )
+		{
+			return iter->second;
+		}
+
+		path = EntryPath(key);
+	}
+
+	if ( path.empty() )
+	{
+		return nullptr;
+	}
+
+	auto  entry = Load(path, key);
+
+	if ( entry != nullptr )
+	{
+		std::lock_guard<std::mutex>  lock(my_lock);
+		// a concurrent store takes precedence over what was on disk
+		return my_entries.emplace(key, entry).first->second;
+	}
+
+	return nullptr;
+#else
+	return nullptr;
+#endif
+}
+
+
+bool
+HTTPCache::ParseCacheControl(
+	const std::string& cache_control,
+	uint64_t& max_age
+)
+{
+	using namespace trezanik::core;
+
+	max_age = 0;
+
+	bool  no_cache = false;
+	auto  directives = aux::Split(cache_control, ",");
+
+	for ( auto& directive : directives )
+	{
+		aux::Trim(directive);
+
+		if ( STR_compare(directive.c_str(), "no-store", false) == 0 )
+		{
+			return false;
+		}
+		if ( STR_compare(directive.c_str(), "no-cache", false) == 0 )
+		{
+			no_cache = true;
+			continue;
+		}
+		if ( directive.length() > 8 && STR_compare(directive.substr(0, 8).c_str(), "max-age=", false) == 0 )
+		{
+			const char*  errstr = nullptr;
+			uint64_t     val = STR_to_unum(directive.c_str() + 8, UINT32_MAX, &errstr);
+
+			if ( errstr == nullptr )
+			{
+				max_age = val;
+			}
+		}
+	}
+
+	if ( no_cache )
+	{
+		// storable, but must always be revalidated
+		max_age = 0;
+	}
+
+	return true;
+}
+
+
+void
+HTTPCache::RecordFreshHit()
+{
+	my_fresh_hits++;
+}
+
+
+std::shared_ptr<const http_cache_entry>
+HTTPCache::Revalidate(
+	const std::string& key,
+	uint64_t max_age
+)
+{
+	std::shared_ptr<http_cache_entry>  updated;
+
+	{
+		std::lock_guard<std::mutex>  lock(my_lock);
+
+		auto  iter = my_entries.find(key);
+
+		if ( iter == my_entries.end() )
+		{
+			return nullptr;
+		}
+
+		// entries are shared with readers, so replace rather than modify
+		updated = std::make_shared<http_cache_entry>(*iter->second);
+		updated->stored = static_cast<uint64_t>(core::aux::get_secs_since_epoch());
+		if ( max_age != 0 )
+		{
+			updated->max_age = max_age;
+		}
+		iter->second = updated;
+	}
+
+	my_revalidations++;
+
+	// only the stored time changes; persist so freshness survives restarts
+	if ( updated->max_age != 0 )
+	{
+		Write(*updated);
+	}
+
+	return updated;
+}
+
+
+void
+HTTPCache::SetFolder(
+	const std::string& folder
+)
+{
+	std::lock_guard<std::mutex>  lock(my_lock);
+
+	my_folder = folder;
+	if ( !my_folder.empty() && my_folder.back() != TZK_PATH_CHAR )
+	{
+		my_folder += TZK_PATH_CHARSTR;
+	}
+	my_folder_exists = false;
+}
+
+
+int
+HTTPCache::Store(
+	http_cache_entry entry
+)
+{
+	using namespace trezanik::core;
+
+#if TZK_HTTP_CACHE
+	if ( entry.etag.empty() && entry.last_modified.empty() && entry.max_age == 0 )
+	{
+		/*
+		 * Nothing to revalidate with, and never fresh. Any existing entry is
+		 * now outdated, and would otherwise be used for conditional requests
+		 */
+		std::string  path;
+
+		{
+			std::lock_guard<std::mutex>  lock(my_lock);
+			my_entries.erase(entry.key);
+			path = EntryPath(entry.key);
+		}
+
+		if ( !path.empty() && aux::file::exists(path.c_str()) == EEXIST )
+		{
+			aux::file::remove(path.c_str());
+		}
+
+		return EINVAL;
+	}
+
+	entry.stored = static_cast<uint64_t>(aux::get_secs_since_epoch());
+
+	auto  shared = std::make_shared<http_cache_entry>(std::move(entry));
+
+	{
+		std::lock_guard<std::mutex>  lock(my_lock);
+		my_entries[shared->key] = shared;
+	}
+
+	my_stores++;
+
+	return Write(*shared);
+#else
+	return ErrNONE;
+#endif
+}
+
+
+int
+HTTPCache::Write(
+	const http_cache_entry& entry
+)
+{
+	using namespace trezanik::core;
+
+	std::string  path;
+
+	{
+		std::lock_guard<std::mutex>  lock(my_lock);
+
+		path = EntryPath(entry.key);
+
+		if ( path.empty() )
+		{
+			// memory only
+			return ErrNONE;
+		}
+
+		if ( !my_folder_exists )
+		{
+			if ( aux::folder::exists(my_folder.c_str()) == ENOENT )
+			{
+				aux::folder::make_path(my_folder.c_str());
+			}
+			if ( aux::folder::exists(my_folder.c_str()) != EEXIST )
+			{
+				TZK_LOG_FORMAT(LogLevel::Warning, "HTTP cache folder unavailable: %s", my_folder.c_str());
+				return ErrFAILED;
+			}
+			my_folder_exists = true;
+		}
+	}
+
+	http_cache_header  hdr;
+
+	std::memcpy(hdr.magic, http_cache_magic, sizeof(hdr.magic));
+	hdr.version = http_cache_version;
+	hdr.stored = entry.stored;
+	hdr.max_age = entry.max_age;
+	hdr.key_len = static_cast<uint32_t>(entry.key.length());
+	hdr.etag_len = static_cast<uint32_t>(entry.etag.length());
+	hdr.last_modified_len = static_cast<uint32_t>(entry.last_modified.length());
+	hdr.reserved = 0;
+	hdr.content_len = entry.content.length();
+
+	// unique per writer, as two sessions may be storing the same resource
+	std::string  tmp_path = path + "." + std::to_string(ServiceLocator::Threading()->GetCurrentThreadId()) + ".tmp";
+	int    openflags = aux::file::OpenFlag_WriteOnly | aux::file::OpenFlag_Binary | aux::file::OpenFlag_CreateUserR | aux::file::OpenFlag_CreateUserW;
+	FILE*  fp = aux::file::open(tmp_path.c_str(), openflags);
+
+	if ( fp == nullptr )
+	{
+		return ErrFAILED;
+	}
+
+	bool  ok = aux::file::write(fp, &hdr, sizeof(hdr)) == sizeof(hdr)
+		&& aux::file::write(fp, entry.key.c_str(), entry.key.length()) == entry.key.length()
+		&& aux::file::write(fp, entry.etag.c_str(), entry.etag.length()) == entry.etag.length()
+		&& aux::file::write(fp, entry.last_modified.c_str(), entry.last_modified.length()) == entry.last_modified.length()
+		&& aux::file::write(fp, entry.content.c_str(), entry.content.length()) == entry.content.length();
+
+	aux::file::close(fp);
+
+	if ( !ok )
+	{
+		TZK_LOG_FORMAT(LogLevel::Warning, "Failed to write HTTP cache entry: %s", tmp_path.c_str());
+		aux::file::remove(tmp_path.c_str());
+		return ErrFAILED;
+	}
+
+#if TZK_IS_WIN32
+	// rename will not replace an existing file
+	if ( aux::file::exists(path.c_str()) == EEXIST )
+	{
+		aux::file::remove(path.c_str());
+	}
+#endif
+	if ( std::rename(tmp_path.c_str(), path.c_str()) != 0 )
+	{
+		TZK_LOG_FORMAT(LogLevel::Warning, "Failed to rename HTTP cache entry: %s", path.c_str());
+		aux::file::remove(tmp_path.c_str());
+		return ErrFAILED;
+	}
+
+	TZK_LOG_FORMAT(LogLevel::Debug, "HTTP cache entry stored: %s", entry.key.c_str());
+
+	return ErrNONE;
+}
+
+
+} // namespace net
+} // namespace engine
+} // namespace trezanik
@@ -0,0 +1,287 @@
+#pragma once
+
+/**
+ * @file        src/engine/services/net/HTTPCache.h
+ * @brief       On-disk cache of HTTP responses, for conditional requests
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "engine/definitions.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+
+namespace trezanik {
+namespace engine {
+namespace net {
+
+
+/**
+ * A cached response body, with the validators needed to revalidate it
+ */
+struct http_cache_entry
+{
+	/// The cache key; see HTTPCache::Key
+	std::string  key;
+
+	/// The ETag header value, verbatim; empty if none was provided
+	std::string  etag;
+
+	/// The Last-Modified header value, verbatim; empty if none was provided
+	std::string  last_modified;
+
+	/// Seconds since the epoch the entry was stored or last revalidated
+	uint64_t  stored = 0;
+
+	/// Seconds from stored the entry is fresh for; 0 requires revalidation
+	uint64_t  max_age = 0;
+
+	/// The response body
+	std::string  content;
+};
+
+
+/**
+ * Cache of HTTP GET responses, enabling conditional requests
+ *
+ * Feeds and release metadata are polled far more often than they change, yet
+ * each poll would transfer and parse the full body. Successful responses
+ * carrying an ETag or Last-Modified validator are stored here; the next
+ * request for the same resource sends If-None-Match/If-Modified-Since, and a
+ * 304 Not Modified is answered with the stored body - one small round trip.
+ * Within the Cache-Control max-age, no request is made at all.
+ *
+ * Entries are held in memory once used, and persisted to the userdata cache
+ * folder so validators survive restarts. Responses marked no-store, or
+ * lacking any validator and max-age, are never stored.
+ *
+ * Thread-safe; sessions on any thread may look up and store.
+ */
+class TZK_ENGINE_API HTTPCache
+{
+	TZK_NO_CLASS_ASSIGNMENT(HTTPCache);
+	TZK_NO_CLASS_COPY(HTTPCache);
+	TZK_NO_CLASS_MOVEASSIGNMENT(HTTPCache);
+	TZK_NO_CLASS_MOVECOPY(HTTPCache);
+
+private:
+
+	/// Guards the folder path, its creation, and the entries
+	mutable std::mutex  my_lock;
+
+	/// Folder cache files reside in, including trailing path separator
+	std::string  my_folder;
+
+	/// Flag indicating the folder has been created (or confirmed to exist)
+	bool  my_folder_exists;
+
+	/// Entries loaded or stored this run, by key
+	std::unordered_map<std::string, std::shared_ptr<const http_cache_entry>>  my_entries;
+
+	/// Number of requests answered without any network traffic
+	std::atomic<size_t>  my_fresh_hits = ATOMIC_VAR_INIT(0);
+
+	/// Number of 304 responses answered from the cache
+	std::atomic<size_t>  my_revalidations = ATOMIC_VAR_INIT(0);
+
+	/// Number of entries written
+	std::atomic<size_t>  my_stores = ATOMIC_VAR_INIT(0);
+
+
+	/**
+	 * Builds the cache file path for the key
+	 *
+	 * Must be called with the lock held
+	 *
+	 * @param[in] key
+	 *  The cache key
+	 * @return
+	 *  The absolute file path; empty if no folder is configured
+	 */
+	std::string
+	EntryPath(
+		const std::string& key
+	) const;
+
+
+	/**
+	 * Loads an entry from disk
+	 *
+	 * @param[in] path
+	 *  The cache file path
+	 * @param[in] key
+	 *  The cache key, which must match that within the file
+	 * @return
+	 *  The entry, or nullptr if absent, outdated or corrupt
+	 */
+	std::shared_ptr<const http_cache_entry>
+	Load(
+		const std::string& path,
+		const std::string& key
+	) const;
+
+
+	/**
+	 * Writes an entry to disk
+	 *
+	 * Written to a temporary file and renamed, so concurrent readers never
+	 * observe a partial entry.
+	 *
+	 * @param[in] entry
+	 *  The entry to write
+	 * @return
+	 *  An error code on failure, otherwise ErrNONE
+	 */
+	int
+	Write(
+		const http_cache_entry& entry
+	);
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 */
+	HTTPCache();
+
+
+	/**
+	 * Standard destructor
+	 */
+	~HTTPCache();
+
+
+	/**
+	 * Determines if an entry can be used without revalidation
+	 *
+	 * @param[in] entry
+	 *  The entry to check
+	 * @return
+	 *  true if within its max-age, otherwise false
+	 */
+	static bool
+	IsFresh(
+		const http_cache_entry& entry
+	);
+
+
+	/**
+	 * Builds the cache key for a resource
+	 *
+	 * @param[in] host
+	 *  The server host
+	 * @param[in] port
+	 *  The server port
+	 * @param[in] target
+	 *  The request target (path and query)
+	 * @return
+	 *  The key
+	 */
+	static std::string
+	Key(
+		const std::string& host,
+		const std::string& port,
+		const std::string& target
+	);
+
+
+	/**
+	 * Looks up an entry, in memory then on disk
+	 *
+	 * @param[in] key
+	 *  The cache key, from Key
+	 * @return
+	 *  The entry, or nullptr if none exists
+	 */
+	std::shared_ptr<const http_cache_entry>
+	Lookup(
+		const std::string& key
+	);
+
+
+	/**
+	 * Interprets a Cache-Control header value
+	 *
+	 * @param[in] cache_control
+	 *  The header value; may be empty
+	 * @param[out] max_age
+	 *  The max-age directive in seconds, or 0 if absent or no-cache
+	 * @return
+	 *  false if the response must not be stored (no-store), otherwise true
+	 */
+	static bool
+	ParseCacheControl(
+		const std::string& cache_control,
+		uint64_t& max_age
+	);
+
+
+	/**
+	 * Records a request satisfied by a fresh entry, without network traffic
+	 */
+	void
+	RecordFreshHit();
+
+
+	/**
+	 * Marks an entry as revalidated, following a 304 Not Modified
+	 *
+	 * The stored time is reset, and the max-age replaced if the 304 carried
+	 * one, as per RFC 9111 section 4.3.4
+	 *
+	 * @param[in] key
+	 *  The cache key
+	 * @param[in] max_age
+	 *  The max-age of the 304 response
+	 * @return
+	 *  The updated entry, or nullptr if the key has no entry
+	 */
+	std::shared_ptr<const http_cache_entry>
+	Revalidate(
+		const std::string& key,
+		uint64_t max_age
+	);
+
+
+	/**
+	 * Sets the folder cache files are stored in
+	 *
+	 * The folder is created on the first store, not here. Without a folder,
+	 * entries are retained in memory only.
+	 *
+	 * @param[in] folder
+	 *  The absolute folder path
+	 */
+	void
+	SetFolder(
+		const std::string& folder
+	);
+
+
+	/**
+	 * Stores a response, replacing any existing entry for the key
+	 *
+	 * @param[in] entry
+	 *  The entry to store; the stored time is assigned here
+	 * @return
+	 *  - ErrNONE on success
+	 *  - EINVAL if the entry has no validator and no max-age; any existing
+	 *    entry for the key is removed, as it no longer reflects the resource
+	 *  - ErrFAILED if the disk write failed; the entry is still held in memory
+	 */
+	int
+	Store(
+		http_cache_entry entry
+	);
+};
+
+
+} // namespace net
+} // namespace engine
+} // namespace trezanik
@@ -0,0 +1,370 @@
+/**
+ * @file        src/engine/services/net/HTTPConnectionPool.cc
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "engine/definitions.h"
+
+#include "engine/services/net/HTTPConnectionPool.h"
+
+#include "core/services/log/Log.h"
+#include "core/error.h"
+
+#if TZK_USING_OPENSSL
+#	include <openssl/err.h>
+#endif
+
+#if TZK_IS_WIN32
+#	include <winsock2.h>
+#else
+#	include <poll.h>
+#endif
+
+
+namespace trezanik {
+namespace engine {
+namespace net {
+
+
+HTTPConnectionPool::HTTPConnectionPool()
+: my_reused(0)
+#if TZK_USING_OPENSSL
+, my_ssl_ctx(nullptr)
+#endif
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Constructor starting");
+	{
+	}
+	TZK_LOG(LogLevel::Trace, "Constructor finished");
+}
+
+
+HTTPConnectionPool::~HTTPConnectionPool()
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Destructor starting");
+	{
+		Clear();
+
+		TZK_LOG_FORMAT(LogLevel::Debug, "HTTP connection pool: %zu connections reused", my_reused.load());
+
+#if TZK_USING_OPENSSL
+		for ( auto& sess : my_tls_sessions )
+		{
+			SSL_SESSION_free(sess.second);
+		}
+		my_tls_sessions.clear();
+
+		if ( my_ssl_ctx != nullptr )
+		{
+			SSL_CTX_free(my_ssl_ctx);
+			my_ssl_ctx = nullptr;
+		}
+#endif
+	}
+	TZK_LOG(LogLevel::Trace, "Destructor finished");
+}
+
+
+bool
+HTTPConnectionPool::Acquire(
+#if TZK_USING_OPENSSL
+	const std::string& key,
+	pooled_connection& conn
+#else
+	const std::string& TZK_UNUSED(key),
+	pooled_connection& TZK_UNUSED(conn)
+#endif
+)
+{
+	using namespace trezanik::core;
+
+#if TZK_USING_OPENSSL
+	std::lock_guard<std::mutex>  lock(my_lock);
+
+	auto  now = std::chrono::steady_clock::now();
+	auto  timeout = std::chrono::seconds(TZK_HTTP_KEEPALIVE_TIMEOUT);
+	auto  range = my_idle.equal_range(key);
+
+	for ( auto iter = range.first; iter != range.second; )
+	{
+		pooled_connection  candidate = iter->second;
+
+		iter = my_idle.erase(iter);
+
+		if ( now - candidate.idle_since > timeout || !IsAlive(candidate) )
+		{
+			TZK_LOG_FORMAT(LogLevel::Trace, "Discarding stale connection to %s", key.c_str());
+			Close(candidate);
+			continue;
+		}
+
+		TZK_LOG_FORMAT(LogLevel::Debug, "Reusing connection to %s", key.c_str());
+		conn = candidate;
+		my_reused++;
+		return true;
+	}
+#endif
+
+	return false;
+}
+
+
+void
+HTTPConnectionPool::Clear()
+{
+	std::lock_guard<std::mutex>  lock(my_lock);
+
+#if TZK_USING_OPENSSL
+	for ( auto& idle : my_idle )
+	{
+		Close(idle.second);
+	}
+#endif
+	my_idle.clear();
+}
+
+
+#if TZK_USING_OPENSSL
+
+void
+HTTPConnectionPool::Close(
+	pooled_connection& conn
+)
+{
+	// the ssl BIO owns the chained socket
+	if ( conn.ssl_bio != nullptr )
+	{
+		BIO_free_all(conn.ssl_bio);
+	}
+	else if ( conn.socket != nullptr )
+	{
+		BIO_free_all(conn.socket);
+	}
+
+	conn.ssl_bio = nullptr;
+	conn.socket = nullptr;
+}
+
+
+SSL_CTX*
+HTTPConnectionPool::GetSSLContext() const
+{
+	std::lock_guard<std::mutex>  lock(my_lock);
+	return my_ssl_ctx;
+}
+
+#endif  // TZK_USING_OPENSSL
+
+
+int
+HTTPConnectionPool::Initialize()
+{
+	using namespace trezanik::core;
+
+#if TZK_USING_OPENSSL
+	std::lock_guard<std::mutex>  lock(my_lock);
+
+	if ( my_ssl_ctx != nullptr )
+	{
+		return ErrNONE;
+	}
+
+	SSL_CTX*  ctx = SSL_CTX_new(TLS_client_method());
+
+	if ( ctx == nullptr )
+	{
+		TZK_LOG(LogLevel::Warning, "Failed to create SSL_CTX");
+		return ErrEXTERN;
+	}
+
+#if TZK_ENABLE_XP2003_SUPPORT
+	// as per HTTPSession::Establish
+	SSL_CTX_set_min_proto_version(ctx, TLS1_0_VERSION);
+#else
+	SSL_CTX_set_min_proto_version(ctx, TLS1_2_VERSION);
+#endif
+
+	if ( SSL_CTX_set_default_verify_paths(ctx) != 1 )
+	{
+		TZK_LOG(LogLevel::Warning, "Unable to load the certificate trust store");
+		SSL_CTX_free(ctx);
+		return ErrEXTERN;
+	}
+
+	/*
+	 * Client-side caching only; we retain sessions per host ourselves, as
+	 * the internal cache is keyed for servers
+	 */
+	SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+
+	my_ssl_ctx = ctx;
+
+	TZK_LOG(LogLevel::Debug, "Shared TLS client context created");
+
+	return ErrNONE;
+#else
+	return ErrIMPL;
+#endif
+}
+
+
+#if TZK_USING_OPENSSL
+
+bool
+HTTPConnectionPool::IsAlive(
+	const pooled_connection& conn
+)
+{
+	int  fd = -1;
+
+	if ( conn.socket == nullptr || BIO_get_fd(conn.socket, &fd) <= 0 || fd < 0 )
+	{
+		return false;
+	}
+
+	// anything pending on an idle connection is an EOF, reset, or garbage
+#if TZK_IS_WIN32
+	WSAPOLLFD  pfd;
+	pfd.fd = static_cast<SOCKET>(fd);
+	pfd.events = POLLRDNORM;
+	pfd.revents = 0;
+
+	return WSAPoll(&pfd, 1, 0) == 0;
+#else
+	struct pollfd  pfd;
+	pfd.fd = fd;
+	pfd.events = POLLIN;
+	pfd.revents = 0;
+
+	return poll(&pfd, 1, 0) == 0;
+#endif
+}
+
+#endif  // TZK_USING_OPENSSL
+
+
+void
+HTTPConnectionPool::Prune()
+{
+	std::lock_guard<std::mutex>  lock(my_lock);
+
+	auto  now = std::chrono::steady_clock::now();
+	auto  timeout = std::chrono::seconds(TZK_HTTP_KEEPALIVE_TIMEOUT);
+
+	for ( auto iter = my_idle.begin(); iter != my_idle.end(); )
+	{
+		if ( now - iter->second.idle_since > timeout )
+		{
+#if TZK_USING_OPENSSL
+			Close(iter->second);
+#endif
+			iter = my_idle.erase(iter);
+			continue;
+		}
+		++iter;
+	}
+}
+
+
+void
+HTTPConnectionPool::Release(
+#if TZK_USING_OPENSSL
+	const std::string& key,
+	pooled_connection& conn
+#else
+	const std::string& TZK_UNUSED(key),
+	pooled_connection& TZK_UNUSED(conn)
+#endif
+)
+{
+	using namespace trezanik::core;
+
+#if TZK_USING_OPENSSL
+	std::lock_guard<std::mutex>  lock(my_lock);
+
+	if ( my_idle.count(key) >= TZK_HTTP_POOL_MAX_IDLE )
+	{
+		Close(conn);
+		return;
+	}
+
+	conn.idle_since = std::chrono::steady_clock::now();
+	my_idle.emplace(key, conn);
+
+	TZK_LOG_FORMAT(LogLevel::Trace, "Connection to %s returned to pool", key.c_str());
+
+	// ownership transferred
+	conn.ssl_bio = nullptr;
+	conn.socket = nullptr;
+#endif
+}
+
+
+#if TZK_USING_OPENSSL
+
+void
+HTTPConnectionPool::ResumeTLSSession(
+	const std::string& key,
+	SSL* ssl
+)
+{
+	std::lock_guard<std::mutex>  lock(my_lock);
+
+	auto  iter = my_tls_sessions.find(key);
+
+	if ( iter == my_tls_sessions.end() )
+	{
+		return;
+	}
+
+	// takes its own reference
+	SSL_set_session(ssl, iter->second);
+}
+
+
+void
+HTTPConnectionPool::StoreTLSSession(
+	const std::string& key,
+	SSL* ssl
+)
+{
+	SSL_SESSION*  sess = SSL_get1_session(ssl);
+
+	if ( sess == nullptr )
+	{
+		return;
+	}
+
+	if ( !SSL_SESSION_is_resumable(sess) )
+	{
+		SSL_SESSION_free(sess);
+		return;
+	}
+
+	std::lock_guard<std::mutex>  lock(my_lock);
+
+	auto  iter = my_tls_sessions.find(key);
+
+	if ( iter != my_tls_sessions.end() )
+	{
+		SSL_SESSION_free(iter->second);
+		iter->second = sess;
+	}
+	else
+	{
+		my_tls_sessions[key] = sess;
+	}
+}
+
+#endif  // TZK_USING_OPENSSL
+
+
+} // namespace net
+} // namespace engine
+} // namespace trezanik
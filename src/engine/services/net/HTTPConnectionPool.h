@@ -0,0 +1,250 @@
+#pragma once
+
+/**
+ * @file        src/engine/services/net/HTTPConnectionPool.h
+ * @brief       Persistent HTTP connections and TLS state shared across sessions
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "engine/definitions.h"
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+
+#if TZK_USING_OPENSSL
+#	include <openssl/bio.h>
+#	include <openssl/ssl.h>
+#endif
+
+
+namespace trezanik {
+namespace engine {
+namespace net {
+
+
+/**
+ * An established connection, idle and awaiting reuse
+ */
+struct pooled_connection
+{
+#if TZK_USING_OPENSSL
+	/// Plain network socket
+	BIO*  socket = nullptr;
+
+	/// Encrypted socket chained to the plain socket; nullptr if unencrypted
+	BIO*  ssl_bio = nullptr;
+#endif
+
+	/// Time the connection was returned to the pool
+	std::chrono::steady_clock::time_point  idle_since;
+};
+
+
+/**
+ * Pool of keep-alive connections, plus the shared TLS client state
+ *
+ * Without this, every HTTPSession performs a full TCP and TLS handshake, and
+ * loads the certificate trust store into its own SSL_CTX. Here:
+ * - One SSL_CTX is created with the trust store loaded once, and used by all
+ *   sessions
+ * - Connections whose response permitted keep-alive are returned on session
+ *   destruction, and handed to the next session for the same host and port
+ *   if not idle beyond TZK_HTTP_KEEPALIVE_TIMEOUT, nor closed by the server
+ * - The TLS session of each host is retained, so a fresh connection to a
+ *   known host resumes via session ticket/ID rather than a full handshake
+ *
+ * Periodic polling of many feeds on one host thereby costs one handshake,
+ * rather than one per fetch.
+ *
+ * Keys are "host:port"; thread-safe.
+ */
+class TZK_ENGINE_API HTTPConnectionPool
+{
+	TZK_NO_CLASS_ASSIGNMENT(HTTPConnectionPool);
+	TZK_NO_CLASS_COPY(HTTPConnectionPool);
+	TZK_NO_CLASS_MOVEASSIGNMENT(HTTPConnectionPool);
+	TZK_NO_CLASS_MOVECOPY(HTTPConnectionPool);
+
+private:
+
+	/// Guards the idle connections and TLS sessions
+	mutable std::mutex  my_lock;
+
+	/// Idle connections, multiple per key permitted
+	std::multimap<std::string, pooled_connection>  my_idle;
+
+	/// Number of connections handed out for reuse
+	std::atomic<size_t>  my_reused;
+
+#if TZK_USING_OPENSSL
+	/// The shared client context; nullptr until Initialize succeeds
+	SSL_CTX*  my_ssl_ctx;
+
+	/// Most recent resumable TLS session per key; we hold a reference on each
+	std::map<std::string, SSL_SESSION*>  my_tls_sessions;
+
+
+	/**
+	 * Closes and frees a connection
+	 *
+	 * @param[in] conn
+	 *  The connection to close
+	 */
+	static void
+	Close(
+		pooled_connection& conn
+	);
+
+
+	/**
+	 * Determines if an idle connection is still usable
+	 *
+	 * A connection readable while idle has either been closed by the server,
+	 * or holds unsolicited data; neither is usable for a new request.
+	 *
+	 * @param[in] conn
+	 *  The connection to check
+	 * @return
+	 *  true if the connection can be reused, otherwise false
+	 */
+	static bool
+	IsAlive(
+		const pooled_connection& conn
+	);
+#endif
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 */
+	HTTPConnectionPool();
+
+
+	/**
+	 * Standard destructor
+	 *
+	 * Closes all idle connections and releases the TLS state
+	 */
+	~HTTPConnectionPool();
+
+
+	/**
+	 * Obtains an idle connection for reuse
+	 *
+	 * Expired or server-closed connections encountered are discarded
+	 *
+	 * @param[in] key
+	 *  The host and port, as "host:port"
+	 * @param[out] conn
+	 *  The connection, if one is available. Ownership transfers to the caller
+	 * @return
+	 *  true if a connection was obtained, otherwise false
+	 */
+	bool
+	Acquire(
+		const std::string& key,
+		pooled_connection& conn
+	);
+
+
+	/**
+	 * Closes all idle connections
+	 */
+	void
+	Clear();
+
+
+	/**
+	 * Creates the shared TLS context, loading the certificate trust store
+	 *
+	 * @return
+	 *  - ErrNONE on success, or if already initialized
+	 *  - ErrEXTERN on OpenSSL failure, including trust store load failure
+	 *  - ErrIMPL if no networking library implementation exists
+	 */
+	int
+	Initialize();
+
+
+	/**
+	 * Closes idle connections that have exceeded the keep-alive timeout
+	 */
+	void
+	Prune();
+
+
+	/**
+	 * Returns a connection to the pool for reuse
+	 *
+	 * If the host already has the maximum idle connections, the connection
+	 * is closed instead.
+	 *
+	 * @param[in] key
+	 *  The host and port, as "host:port"
+	 * @param[in] conn
+	 *  The connection; ownership transfers to the pool
+	 */
+	void
+	Release(
+		const std::string& key,
+		pooled_connection& conn
+	);
+
+
+#if TZK_USING_OPENSSL
+	/**
+	 * Gets the shared TLS client context
+	 *
+	 * @return
+	 *  The SSL_CTX, or nullptr if Initialize has not succeeded
+	 */
+	SSL_CTX*
+	GetSSLContext() const;
+
+
+	/**
+	 * Applies the retained TLS session for a host to a new connection
+	 *
+	 * Must be called prior to the handshake; no-op if none is retained
+	 *
+	 * @param[in] key
+	 *  The host and port, as "host:port"
+	 * @param[in] ssl
+	 *  The SSL object of the new connection
+	 */
+	void
+	ResumeTLSSession(
+		const std::string& key,
+		SSL* ssl
+	);
+
+
+	/**
+	 * Retains the TLS session of a connection for later resumption
+	 *
+	 * Best called once a response has been read; TLS 1.3 session tickets
+	 * are only sent by the server after the handshake completes.
+	 *
+	 * @param[in] key
+	 *  The host and port, as "host:port"
+	 * @param[in] ssl
+	 *  The SSL object of the connection
+	 */
+	void
+	StoreTLSSession(
+		const std::string& key,
+		SSL* ssl
+	);
+#endif
+};
+
+
+} // namespace net
+} // namespace engine
+} // namespace trezanik
@@ -0,0 +1,1045 @@
+/**
+ * @file        src/engine/services/net/HTTPProbe.cc
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "engine/definitions.h"
+
+#include "engine/services/net/HTTPProbe.h"
+
+#include "core/services/log/Log.h"
+#include "core/util/string/STR_funcs.h"
+#include "core/error.h"
+
+#if TZK_USING_OPENSSL
+#	include <openssl/err.h>
+#endif
+
+#if TZK_IS_WIN32
+#	include <winsock2.h>
+#	include <ws2tcpip.h>
+#else
+#	include <arpa/inet.h>
+#	include <fcntl.h>
+#	include <netdb.h>
+#	include <netinet/in.h>
+#	include <sys/socket.h>
+#	include <unistd.h>
+#	if TZK_IS_LINUX
+#		include <sys/epoll.h>
+#	else
+#		include <poll.h>
+#	endif
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <thread>
+
+
+namespace trezanik {
+namespace engine {
+namespace net {
+
+
+#if TZK_IS_WIN32
+typedef SOCKET  probe_socket;
+static const probe_socket  invalid_probe_socket = INVALID_SOCKET;
+#else
+typedef int  probe_socket;
+static const probe_socket  invalid_probe_socket = -1;
+#endif
+
+/// io_read/io_write result: the operation must wait for socket readiness
+static const int  io_wait = -1;
+/// io_read/io_write result: the connection has failed
+static const int  io_error = -2;
+
+/// maximum wait per iteration, so cancellation is noticed promptly
+static const int  max_wait_ms = 100;
+
+/// maximum wait per iteration while any probe awaits its resolution
+static const int  resolve_wait_ms = 10;
+
+/// maximum size of the response status line and headers
+static const size_t  max_header_size = 16384;
+
+
+/**
+ * Resolved address for a host and port
+ */
+struct probe_address
+{
+	sockaddr_storage  storage;
+	socklen_t  len = 0;
+};
+
+
+/**
+ * Resolution of a host and port, shared with the thread performing it
+ *
+ * The lookup cannot be abandoned, so the thread is detached; it will outlive
+ * the run if the lookup is slower than the probes awaiting it.
+ */
+struct probe_resolution
+{
+	/// Flag set once addr has been populated, or the lookup failed
+	std::atomic<bool>  ready{false};
+
+	/// The resolved address; len is 0 if resolution failed
+	probe_address  addr;
+};
+
+
+/**
+ * Progression of a probe connection
+ */
+enum class ProbeStage : uint8_t
+{
+	Resolving,
+	Connecting,
+	Handshaking,
+	Sending,
+	Receiving
+};
+
+
+/**
+ * State of an in-flight probe
+ */
+struct probe_connection
+{
+	/// Index of the probe and its result
+	size_t  index = 0;
+
+	/// The probe details
+	const http_probe*  probe = nullptr;
+
+	/// The address lookup, shared by all probes to the same host and port
+	std::shared_ptr<probe_resolution>  resolution;
+
+	probe_socket  sock = invalid_probe_socket;
+
+#if TZK_USING_OPENSSL
+	/// Context to create the TLS connection from, if the probe uses TLS
+	SSL_CTX*  ssl_ctx = nullptr;
+
+	SSL*  ssl = nullptr;
+#endif
+
+	ProbeStage  stage = ProbeStage::Resolving;
+
+	/// The readiness awaited; writable if true, otherwise readable
+	bool  want_write = true;
+
+	/// Flag set once the probe has reached its outcome
+	bool  done = false;
+
+	/// The request to send
+	std::string  request;
+
+	/// Bytes of the request sent so far
+	size_t  sent = 0;
+
+	/// Response received, up to and including the end of the headers
+	std::string  headers;
+
+	/// Flag set once the end of the headers has been received
+	bool  headers_done = false;
+
+	/// Flag set if the response has a Content-Length
+	bool  have_length = false;
+
+	/// Bytes of the body yet to be received, if have_length
+	uint64_t  remaining = 0;
+
+	std::chrono::steady_clock::time_point  start;
+	std::chrono::steady_clock::time_point  deadline;
+};
+
+
+static void
+close_probe(
+	probe_connection& conn
+)
+{
+#if TZK_USING_OPENSSL
+	if ( conn.ssl != nullptr )
+	{
+		// socket BIO is created without BIO_CLOSE; the socket is ours to close
+		SSL_free(conn.ssl);
+		conn.ssl = nullptr;
+	}
+#endif
+
+	if ( conn.sock != invalid_probe_socket )
+	{
+#if TZK_IS_WIN32
+		::closesocket(conn.sock);
+#else
+		::close(conn.sock);
+#endif
+		conn.sock = invalid_probe_socket;
+	}
+}
+
+
+static uint32_t
+elapsed_ms(
+	const probe_connection& conn
+)
+{
+	auto  diff = std::chrono::steady_clock::now() - conn.start;
+	return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(diff).count());
+}
+
+
+static bool
+last_error_would_block()
+{
+#if TZK_IS_WIN32
+	int  err = ::WSAGetLastError();
+	return err == WSAEWOULDBLOCK || err == WSAEINTR;
+#else
+	return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+#endif
+}
+
+
+/**
+ * Reads from the connection, via TLS if established
+ *
+ * @return
+ *  Bytes read, 0 on orderly closure, or io_wait/io_error
+ */
+static int
+io_read(
+	probe_connection& conn,
+	char* buf,
+	int len
+)
+{
+#if TZK_USING_OPENSSL
+	if ( conn.ssl != nullptr )
+	{
+		int  rc = SSL_read(conn.ssl, buf, len);
+
+		if ( rc > 0 )
+			return rc;
+
+		switch ( SSL_get_error(conn.ssl, rc) )
+		{
+		case SSL_ERROR_WANT_READ:   conn.want_write = false; return io_wait;
+		case SSL_ERROR_WANT_WRITE:  conn.want_write = true;  return io_wait;
+		case SSL_ERROR_ZERO_RETURN: return 0;
+		case SSL_ERROR_SYSCALL:
+			// plenty of servers close without a close_notify
+			return ERR_peek_error() == 0 && rc == 0 ? 0 : io_error;
+		default:
+			return io_error;
+		}
+	}
+#endif
+
+	int  rc = static_cast<int>(::recv(conn.sock, buf, len, 0));
+
+	if ( rc >= 0 )
+		return rc;
+
+	if ( last_error_would_block() )
+	{
+		conn.want_write = false;
+		return io_wait;
+	}
+
+	return io_error;
+}
+
+
+/**
+ * Writes the unsent portion of the request, via TLS if established
+ *
+ * @return
+ *  Bytes written, or io_wait/io_error
+ */
+static int
+io_write(
+	probe_connection& conn
+)
+{
+	const char*  data = conn.request.data() + conn.sent;
+	int  len = static_cast<int>(conn.request.size() - conn.sent);
+
+#if TZK_USING_OPENSSL
+	if ( conn.ssl != nullptr )
+	{
+		int  rc = SSL_write(conn.ssl, data, len);
+
+		if ( rc > 0 )
+			return rc;
+
+		switch ( SSL_get_error(conn.ssl, rc) )
+		{
+		case SSL_ERROR_WANT_READ:   conn.want_write = false; return io_wait;
+		case SSL_ERROR_WANT_WRITE:  conn.want_write = true;  return io_wait;
+		default:
+			return io_error;
+		}
+	}
+#endif
+
+#if defined(MSG_NOSIGNAL)
+	int  rc = static_cast<int>(::send(conn.sock, data, len, MSG_NOSIGNAL));
+#else
+	int  rc = static_cast<int>(::send(conn.sock, data, len, 0));
+#endif
+
+	if ( rc >= 0 )
+		return rc;
+
+	if ( last_error_would_block() )
+	{
+		conn.want_write = true;
+		return io_wait;
+	}
+
+	return io_error;
+}
+
+
+/**
+ * Parses the status line and Content-Length from complete response headers
+ *
+ * @return
+ *  false if the status line is not that of an HTTP response
+ */
+static bool
+parse_headers(
+	probe_connection& conn,
+	http_probe_result& result
+)
+{
+	using namespace trezanik::core;
+
+	const std::string&  hdr = conn.headers;
+
+	// "HTTP/1.1 200 OK"
+	if ( hdr.compare(0, 5, "HTTP/") != 0 )
+		return false;
+
+	size_t  sp = hdr.find(' ');
+
+	if ( sp == std::string::npos || sp + 4 > hdr.size()
+	  || !isdigit(static_cast<unsigned char>(hdr[sp + 1]))
+	  || !isdigit(static_cast<unsigned char>(hdr[sp + 2]))
+	  || !isdigit(static_cast<unsigned char>(hdr[sp + 3])) )
+	{
+		return false;
+	}
+
+	result.status_code = static_cast<uint16_t>(
+		(hdr[sp + 1] - '0') * 100 + (hdr[sp + 2] - '0') * 10 + (hdr[sp + 3] - '0')
+	);
+
+	const char   content_length[] = "Content-Length:";
+	const size_t cl_len = sizeof(content_length) - 1;
+	size_t  pos = hdr.find("\r\n");
+
+	while ( pos != std::string::npos && pos + 2 < hdr.size() )
+	{
+		pos += 2;
+
+		if ( STR_compare_n(hdr.c_str() + pos, content_length, cl_len, false) == 0 )
+		{
+			conn.have_length = true;
+			conn.remaining = std::strtoull(hdr.c_str() + pos + cl_len, nullptr, 10);
+			break;
+		}
+
+		pos = hdr.find("\r\n", pos);
+	}
+
+	// no body possible, regardless of headers
+	if ( result.status_code == 204 || result.status_code == 304 )
+	{
+		conn.have_length = true;
+		conn.remaining = 0;
+	}
+
+	return true;
+}
+
+
+/**
+ * Advances a probe through as many stages as possible without blocking
+ *
+ * @return
+ *  true if the probe has reached its outcome, false if awaiting readiness;
+ *  conn.want_write denotes which
+ */
+static bool
+advance_probe(
+	probe_connection& conn,
+	http_probe_result& result
+)
+{
+	using namespace trezanik::core;
+
+	char  buf[TZK_HTTP_READ_SIZE];
+
+	for ( ;; )
+	{
+		switch ( conn.stage )
+		{
+		case ProbeStage::Connecting:
+			{
+				int  so_err = 0;
+				socklen_t  so_len = sizeof(so_err);
+
+				if ( ::getsockopt(conn.sock, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&so_err), &so_len) != 0 || so_err != 0 )
+				{
+					result.outcome = ProbeOutcome::ConnectFailed;
+					return true;
+				}
+
+				result.connect_ms = elapsed_ms(conn);
+
+				if ( !conn.probe->tls )
+				{
+					if ( conn.probe->connect_only )
+					{
+						result.outcome = ProbeOutcome::Success;
+						result.total_ms = result.connect_ms;
+						return true;
+					}
+					conn.stage = ProbeStage::Sending;
+					break;
+				}
+#if TZK_USING_OPENSSL
+				if ( conn.ssl_ctx == nullptr || (conn.ssl = SSL_new(conn.ssl_ctx)) == nullptr )
+				{
+					result.outcome = ProbeOutcome::TLSFailed;
+					return true;
+				}
+
+				SSL_set_fd(conn.ssl, static_cast<int>(conn.sock));
+
+				// SNI must be a hostname, never an address literal
+				unsigned char  addrbuf[sizeof(in6_addr)];
+				if ( ::inet_pton(AF_INET, conn.probe->host.c_str(), addrbuf) != 1
+				  && ::inet_pton(AF_INET6, conn.probe->host.c_str(), addrbuf) != 1 )
+				{
+					SSL_set_tlsext_host_name(conn.ssl, conn.probe->host.c_str());
+				}
+
+				SSL_set_connect_state(conn.ssl);
+				conn.stage = ProbeStage::Handshaking;
+				break;
+#else
+				result.outcome = ProbeOutcome::TLSFailed;
+				return true;
+#endif
+			}
+		case ProbeStage::Handshaking:
+#if TZK_USING_OPENSSL
+			{
+				int  rc = SSL_do_handshake(conn.ssl);
+
+				if ( rc == 1 )
+				{
+					if ( conn.probe->connect_only )
+					{
+						result.outcome = ProbeOutcome::Success;
+						result.total_ms = std::max(elapsed_ms(conn), result.connect_ms);
+						return true;
+					}
+					conn.stage = ProbeStage::Sending;
+					break;
+				}
+
+				int  err = SSL_get_error(conn.ssl, rc);
+
+				if ( err == SSL_ERROR_WANT_READ || err == SSL_ERROR_WANT_WRITE )
+				{
+					conn.want_write = (err == SSL_ERROR_WANT_WRITE);
+					return false;
+				}
+
+				TZK_LOG_FORMAT(LogLevel::Debug, "TLS handshake with %s:%u failed; %s",
+					conn.probe->host.c_str(), conn.probe->port,
+					ERR_reason_error_string(ERR_get_error())
+				);
+				ERR_clear_error();
+			}
+#endif
+			result.outcome = ProbeOutcome::TLSFailed;
+			return true;
+		case ProbeStage::Sending:
+			{
+				int  rc = io_write(conn);
+
+				if ( rc == io_wait )
+					return false;
+				if ( rc < 0 )
+				{
+					result.outcome = ProbeOutcome::SendFailed;
+					return true;
+				}
+
+				conn.sent += static_cast<size_t>(rc);
+
+				if ( conn.sent == conn.request.size() )
+				{
+					conn.stage = ProbeStage::Receiving;
+					conn.want_write = false;
+				}
+			}
+			break;
+		case ProbeStage::Receiving:
+			{
+				int  rc = io_read(conn, buf, sizeof(buf));
+
+				if ( rc == io_wait )
+					return false;
+
+				if ( rc == io_error )
+				{
+					result.outcome = ProbeOutcome::ReceiveFailed;
+					return true;
+				}
+
+				if ( rc == 0 )
+				{
+					// closure delimits the body when no length is given
+					if ( !conn.headers_done )
+					{
+						result.outcome = conn.headers.empty() ?
+							ProbeOutcome::ReceiveFailed : ProbeOutcome::InvalidResponse;
+					}
+					else if ( conn.have_length && conn.remaining > 0 )
+					{
+						result.outcome = ProbeOutcome::ReceiveFailed;
+					}
+					else
+					{
+						result.outcome = ProbeOutcome::Success;
+						result.total_ms = std::max(elapsed_ms(conn), result.ttfb_ms);
+					}
+					return true;
+				}
+
+				if ( result.ttfb_ms == 0 )
+				{
+					// never report 0 for a response that did arrive
+					result.ttfb_ms = std::max<uint32_t>(elapsed_ms(conn), 1);
+				}
+
+				size_t  body_bytes = static_cast<size_t>(rc);
+
+				if ( !conn.headers_done )
+				{
+					size_t  prev = conn.headers.size();
+					conn.headers.append(buf, static_cast<size_t>(rc));
+
+					size_t  end = conn.headers.find("\r\n\r\n", prev < 3 ? 0 : prev - 3);
+
+					if ( end == std::string::npos )
+					{
+						if ( conn.headers.size() > max_header_size )
+						{
+							result.outcome = ProbeOutcome::InvalidResponse;
+							return true;
+						}
+						break;
+					}
+
+					body_bytes = conn.headers.size() - (end + 4);
+					conn.headers.resize(end + 4);
+					conn.headers_done = true;
+
+					if ( !parse_headers(conn, result) )
+					{
+						result.outcome = ProbeOutcome::InvalidResponse;
+						return true;
+					}
+				}
+
+				if ( conn.have_length )
+				{
+					conn.remaining -= std::min<uint64_t>(conn.remaining, body_bytes);
+
+					if ( conn.remaining == 0 )
+					{
+						result.outcome = ProbeOutcome::Success;
+						result.total_ms = std::max(elapsed_ms(conn), result.ttfb_ms);
+						return true;
+					}
+				}
+			}
+			break;
+		default:
+			result.outcome = ProbeOutcome::InvalidResponse;
+			return true;
+		}
+	}
+}
+
+
+/**
+ * Resolves a host and port; runs on a detached thread
+ *
+ * Nothing else is touched, as the run may have finished before completion.
+ */
+static void
+resolve_probe(
+	std::shared_ptr<probe_resolution> resolution,
+	std::string host,
+	uint16_t port
+)
+{
+	std::string  port_str = std::to_string(port);
+	addrinfo   hints;
+	addrinfo*  res = nullptr;
+
+	std::memset(&hints, 0, sizeof(hints));
+	std::memset(&resolution->addr.storage, 0, sizeof(resolution->addr.storage));
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+	hints.ai_protocol = IPPROTO_TCP;
+
+	int  rc = ::getaddrinfo(host.c_str(), port_str.c_str(), &hints, &res);
+
+	if ( rc == 0 && res != nullptr && res->ai_addrlen <= sizeof(resolution->addr.storage) )
+	{
+		std::memcpy(&resolution->addr.storage, res->ai_addr, res->ai_addrlen);
+		resolution->addr.len = static_cast<socklen_t>(res->ai_addrlen);
+	}
+
+	if ( res != nullptr )
+	{
+		::freeaddrinfo(res);
+	}
+
+	resolution->ready.store(true, std::memory_order_release);
+}
+
+
+/**
+ * Creates a non-blocking socket and begins connecting
+ *
+ * @return
+ *  false if the connection attempt could not be started
+ */
+static bool
+start_probe(
+	probe_connection& conn,
+	const probe_address& addr
+)
+{
+	conn.sock = ::socket(addr.storage.ss_family, SOCK_STREAM, IPPROTO_TCP);
+
+	if ( conn.sock == invalid_probe_socket )
+		return false;
+
+#if TZK_IS_WIN32
+	u_long  nonblocking = 1;
+	if ( ::ioctlsocket(conn.sock, FIONBIO, &nonblocking) != 0 )
+		return false;
+#else
+	int  flags = ::fcntl(conn.sock, F_GETFL, 0);
+	if ( flags == -1 || ::fcntl(conn.sock, F_SETFL, flags | O_NONBLOCK) == -1 )
+		return false;
+#endif
+
+	if ( ::connect(conn.sock, reinterpret_cast<const sockaddr*>(&addr.storage), addr.len) == 0 )
+		return true;
+
+#if TZK_IS_WIN32
+	return ::WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+	return errno == EINPROGRESS;
+#endif
+}
+
+
+HTTPProber::HTTPProber()
+#if TZK_USING_OPENSSL
+: my_ssl_ctx(nullptr)
+#endif
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Constructor starting");
+	{
+	}
+	TZK_LOG(LogLevel::Trace, "Constructor finished");
+}
+
+
+HTTPProber::~HTTPProber()
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Destructor starting");
+	{
+#if TZK_USING_OPENSSL
+		if ( my_ssl_ctx != nullptr )
+		{
+			SSL_CTX_free(my_ssl_ctx);
+			my_ssl_ctx = nullptr;
+		}
+#endif
+	}
+	TZK_LOG(LogLevel::Trace, "Destructor finished");
+}
+
+
+int
+HTTPProber::Run(
+	const std::vector<http_probe>& probes,
+	std::vector<http_probe_result>& results,
+	const bool* cancel
+)
+{
+	using namespace trezanik::core;
+
+	results.assign(probes.size(), http_probe_result());
+
+	if ( probes.empty() )
+	{
+		return ErrNONE;
+	}
+
+	auto  run_start = std::chrono::steady_clock::now();
+
+#if TZK_USING_OPENSSL
+	bool  any_tls = false;
+	for ( auto& p : probes )
+	{
+		any_tls |= p.tls;
+	}
+
+	if ( any_tls && my_ssl_ctx == nullptr )
+	{
+		my_ssl_ctx = SSL_CTX_new(TLS_client_method());
+
+		if ( my_ssl_ctx == nullptr )
+		{
+			TZK_LOG(LogLevel::Warning, "Failed to create SSL_CTX; TLS probes will fail");
+		}
+		else
+		{
+#if TZK_ENABLE_XP2003_SUPPORT
+			SSL_CTX_set_min_proto_version(my_ssl_ctx, TLS1_0_VERSION);
+#else
+			SSL_CTX_set_min_proto_version(my_ssl_ctx, TLS1_2_VERSION);
+#endif
+			// availability check only, see class documentation
+			SSL_CTX_set_verify(my_ssl_ctx, SSL_VERIFY_NONE, nullptr);
+#if defined(SSL_OP_IGNORE_UNEXPECTED_EOF)
+			SSL_CTX_set_options(my_ssl_ctx, SSL_OP_IGNORE_UNEXPECTED_EOF);
+#endif
+		}
+	}
+#endif
+
+	/*
+	 * Each distinct host:port is resolved once; the lookup is started as the
+	 * first probe for it becomes active, so its time is bounded by the probe
+	 * timeouts like every other stage
+	 */
+	std::map<std::string, std::shared_ptr<probe_resolution>>  resolved;
+
+#if TZK_IS_LINUX
+	int  epfd = ::epoll_create1(EPOLL_CLOEXEC);
+
+	if ( epfd == -1 )
+	{
+		int  err = errno;
+		TZK_LOG_FORMAT(LogLevel::Error, "epoll_create1() failed; errno %d (%s)", err, err_as_string(err));
+		return ErrEXTERN;
+	}
+#endif
+
+	int     retval = ErrNONE;
+	size_t  next = 0;
+	std::vector<std::unique_ptr<probe_connection>>  active;
+
+	while ( next < probes.size() || !active.empty() )
+	{
+		if ( cancel != nullptr && *cancel )
+		{
+			retval = ECANCELED;
+			break;
+		}
+
+		while ( next < probes.size() && active.size() < TZK_HTTP_PROBE_MAX_CONCURRENT )
+		{
+			size_t  idx = next++;
+			const http_probe&  p = probes[idx];
+			std::string  key = p.host + ":" + std::to_string(p.port);
+			auto   res = resolved.find(key);
+
+			if ( res == resolved.end() )
+			{
+				auto  resolution = std::make_shared<probe_resolution>();
+
+				std::thread(resolve_probe, resolution, p.host, p.port).detach();
+				res = resolved.emplace(key, resolution).first;
+			}
+
+			auto  conn = std::make_unique<probe_connection>();
+			bool  default_port = p.port == (p.tls ? 443 : 80);
+			// IPv6 literals must be bracketed in the Host header
+			std::string  host = p.host.find(':') == std::string::npos ? p.host : "[" + p.host + "]";
+
+			conn->index = idx;
+			conn->probe = &p;
+			conn->resolution = res->second;
+			conn->start = std::chrono::steady_clock::now();
+			conn->deadline = conn->start + std::chrono::milliseconds(p.timeout_ms);
+#if TZK_USING_OPENSSL
+			conn->ssl_ctx = my_ssl_ctx;
+#endif
+			conn->request = "GET " + (p.path.empty() ? "/" : p.path) + " HTTP/1.1\r\n"
+				"Host: " + host + (default_port ? "" : ":" + std::to_string(p.port)) + "\r\n"
+				"Accept: */*\r\n"
+				"Connection: close\r\n\r\n";
+
+			active.push_back(std::move(conn));
+		}
+
+		if ( active.empty() )
+			continue;
+
+		// begin connecting each probe whose resolution has completed
+		for ( auto& conn : active )
+		{
+			if ( conn->stage != ProbeStage::Resolving || !conn->resolution->ready.load(std::memory_order_acquire) )
+				continue;
+
+			const probe_address&  addr = conn->resolution->addr;
+
+			// cleared once the connection is underway; failures are swept below
+			conn->done = true;
+
+			if ( addr.len == 0 )
+			{
+				TZK_LOG_FORMAT(LogLevel::Debug, "Unable to resolve %s", conn->probe->host.c_str());
+				results[conn->index].outcome = ProbeOutcome::ResolveFailed;
+				continue;
+			}
+
+			// durations exclude the resolution; the deadline still includes it
+			conn->start = std::chrono::steady_clock::now();
+			conn->stage = ProbeStage::Connecting;
+
+			if ( !start_probe(*conn, addr) )
+			{
+				results[conn->index].outcome = ProbeOutcome::ConnectFailed;
+				continue;
+			}
+
+#if TZK_IS_LINUX
+			epoll_event  ev;
+			ev.events = EPOLLOUT;
+			ev.data.ptr = conn.get();
+
+			if ( ::epoll_ctl(epfd, EPOLL_CTL_ADD, conn->sock, &ev) == -1 )
+			{
+				results[conn->index].outcome = ProbeOutcome::ConnectFailed;
+				continue;
+			}
+#endif
+			conn->done = false;
+		}
+
+		/*
+		 * Expire timed out probes, and wait no longer than the nearest
+		 * remaining deadline; or briefly, if any probe is awaiting resolution
+		 */
+		auto  now = std::chrono::steady_clock::now();
+		auto  wait = std::chrono::milliseconds(max_wait_ms);
+
+		for ( auto& conn : active )
+		{
+			if ( conn->done )
+				continue;
+
+			if ( conn->stage == ProbeStage::Resolving )
+			{
+				wait = std::min(wait, std::chrono::milliseconds(resolve_wait_ms));
+			}
+
+			if ( now >= conn->deadline )
+			{
+				results[conn->index].outcome = ProbeOutcome::TimedOut;
+				conn->done = true;
+				continue;
+			}
+
+			auto  remaining = std::chrono::duration_cast<std::chrono::milliseconds>(conn->deadline - now);
+			wait = std::min(wait, remaining + std::chrono::milliseconds(1));
+		}
+
+		int  wait_ms = static_cast<int>(wait.count());
+
+#if TZK_IS_LINUX
+		epoll_event  events[64];
+		int  count = ::epoll_wait(epfd, events, 64, wait_ms);
+
+		if ( count == -1 && errno != EINTR )
+		{
+			int  err = errno;
+			TZK_LOG_FORMAT(LogLevel::Error, "epoll_wait() failed; errno %d (%s)", err, err_as_string(err));
+			retval = ErrEXTERN;
+			break;
+		}
+
+		for ( int i = 0; i < count; i++ )
+		{
+			probe_connection*  conn = static_cast<probe_connection*>(events[i].data.ptr);
+
+			if ( conn->done )
+				continue;
+
+			bool  was_write = conn->want_write;
+
+			if ( advance_probe(*conn, results[conn->index]) )
+			{
+				conn->done = true;
+			}
+			else if ( was_write != conn->want_write )
+			{
+				epoll_event  ev;
+				ev.events = conn->want_write ? EPOLLOUT : EPOLLIN;
+				ev.data.ptr = conn;
+				::epoll_ctl(epfd, EPOLL_CTL_MOD, conn->sock, &ev);
+			}
+		}
+#else
+		// only those with a socket; resolving probes have nothing to poll
+		std::vector<probe_connection*>  polled;
+#	if TZK_IS_WIN32
+		std::vector<WSAPOLLFD>  fds;
+#	else
+		std::vector<pollfd>  fds;
+#	endif
+		for ( auto& conn : active )
+		{
+			if ( conn->done || conn->sock == invalid_probe_socket )
+				continue;
+
+			polled.push_back(conn.get());
+			fds.resize(fds.size() + 1);
+			fds.back().fd = conn->sock;
+			fds.back().events = conn->want_write ? POLLOUT : POLLIN;
+			fds.back().revents = 0;
+		}
+
+		int  count = 0;
+
+		if ( fds.empty() )
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(wait_ms));
+		}
+		else
+		{
+#	if TZK_IS_WIN32
+			count = ::WSAPoll(fds.data(), static_cast<ULONG>(fds.size()), wait_ms);
+#	else
+			count = ::poll(fds.data(), static_cast<nfds_t>(fds.size()), wait_ms);
+#	endif
+		}
+
+		if ( count < 0 && !last_error_would_block() )
+		{
+			TZK_LOG(LogLevel::Error, "poll() failed");
+			retval = ErrEXTERN;
+			break;
+		}
+
+		for ( size_t i = 0; count > 0 && i < polled.size(); i++ )
+		{
+			probe_connection*  conn = polled[i];
+
+			if ( fds[i].revents == 0 || conn->done )
+				continue;
+
+			if ( advance_probe(*conn, results[conn->index]) )
+			{
+				conn->done = true;
+			}
+		}
+#endif
+
+		// closing the socket also removes it from the epoll set
+		for ( auto iter = active.begin(); iter != active.end(); )
+		{
+			if ( (*iter)->done )
+			{
+				close_probe(*(*iter));
+				iter = active.erase(iter);
+				continue;
+			}
+			++iter;
+		}
+	}
+
+	// only populated if cancelled or failed
+	for ( auto& conn : active )
+	{
+		results[conn->index].outcome = ProbeOutcome::Cancelled;
+		close_probe(*conn);
+	}
+	for ( ; next < probes.size(); next++ )
+	{
+		results[next].outcome = ProbeOutcome::Cancelled;
+	}
+
+#if TZK_IS_LINUX
+	::close(epfd);
+#endif
+
+	TZK_LOG_FORMAT(LogLevel::Trace, "%zu HTTP probes completed in %lld ms",
+		probes.size(),
+		static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - run_start).count())
+	);
+
+	return retval;
+}
+
+
+const char*
+ProbeOutcomeString(
+	ProbeOutcome outcome
+)
+{
+	switch ( outcome )
+	{
+	case ProbeOutcome::Pending:         return "Pending";
+	case ProbeOutcome::Success:         return "Success";
+	case ProbeOutcome::ResolveFailed:   return "Resolution failed";
+	case ProbeOutcome::ConnectFailed:   return "Connection failed";
+	case ProbeOutcome::TLSFailed:       return "TLS handshake failed";
+	case ProbeOutcome::SendFailed:      return "Send failed";
+	case ProbeOutcome::ReceiveFailed:   return "Receive failed";
+	case ProbeOutcome::InvalidResponse: return "Invalid response";
+	case ProbeOutcome::TimedOut:        return "Timed out";
+	case ProbeOutcome::Cancelled:       return "Cancelled";
+	default:
+		return "Unknown";
+	}
+}
+
+
+} // namespace net
+} // namespace engine
+} // namespace trezanik
@@ -0,0 +1,195 @@
+#pragma once
+
+/**
+ * @file        src/engine/services/net/HTTPProbe.h
+ * @brief       Concurrent, non-blocking HTTP health probes
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "engine/definitions.h"
+
+#include <string>
+#include <vector>
+
+#if TZK_USING_OPENSSL
+#	include <openssl/ssl.h>
+#endif
+
+
+namespace trezanik {
+namespace engine {
+namespace net {
+
+
+/**
+ * Final outcome of a single probe
+ */
+enum class ProbeOutcome : uint8_t
+{
+	Pending = 0,      //< Not yet run, or still in progress
+	Success,          //< A complete response was received; see status_code
+	ResolveFailed,    //< Hostname resolution failed
+	ConnectFailed,    //< TCP connection refused, reset or unreachable
+	TLSFailed,        //< TLS handshake failed, or TLS unavailable in this build
+	SendFailed,       //< Writing the request failed
+	ReceiveFailed,    //< Connection lost before a status line was received
+	InvalidResponse,  //< Data received was not an HTTP response
+	TimedOut,         //< The probe timeout elapsed before completion
+	Cancelled         //< The run was cancelled by the caller
+};
+
+
+/**
+ * Details of the request to make for a single probe
+ */
+struct http_probe
+{
+	/// Hostname or IP address of the server
+	std::string  host;
+
+	/// TCP port of the server
+	uint16_t  port = 80;
+
+	/// Flag to perform a TLS handshake before the request
+	bool  tls = false;
+
+	/// The request target, including any query
+	std::string  path = "/";
+
+	/// Milliseconds from the start of resolution the probe must complete within
+	uint32_t  timeout_ms = 5000;
+
+	/**
+	 * Flag to succeed once connected, and any TLS handshake is complete; no
+	 * request is made, for services that are not HTTP
+	 */
+	bool  connect_only = false;
+};
+
+
+/**
+ * Results of a single probe
+ *
+ * All durations are in milliseconds from the start of the connection attempt,
+ * and are 0 if the stage was not reached. Resolution time is excluded, though
+ * it does count towards the timeout.
+ */
+struct http_probe_result
+{
+	/// The outcome; status_code is only meaningful on Success of a request
+	ProbeOutcome  outcome = ProbeOutcome::Pending;
+
+	/// The HTTP status code from the response status line
+	uint16_t  status_code = 0;
+
+	/// Time for the TCP connection to be established
+	uint32_t  connect_ms = 0;
+
+	/// Time to first byte; the first response byte received after the request
+	uint32_t  ttfb_ms = 0;
+
+	/// Time for the full response to be received
+	uint32_t  total_ms = 0;
+};
+
+
+/**
+ * Runs many HTTP requests concurrently on a single thread
+ *
+ * Designed for service health checks, where hundreds of endpoints are polled
+ * at intervals; a blocking HTTPSession per endpoint would either serialize
+ * them, with each unresponsive server stalling all others for its timeout, or
+ * need a thread apiece.
+ *
+ * Instead every probe gets a non-blocking socket registered with epoll (poll
+ * or WSAPoll on other platforms), and a state machine advances each through
+ * connect, TLS handshake, send and receive as readiness is signalled. Up to
+ * TZK_HTTP_PROBE_MAX_CONCURRENT probes are in flight at once; the remainder
+ * start as others complete.
+ *
+ * Each request is a GET with 'Connection: close'; the response is read to the
+ * end of its Content-Length or connection closure and discarded, so the total
+ * time reflects the complete response.
+ *
+ * Certificates are not verified - the probe measures availability and
+ * latency, and internal services commonly present self-signed certificates.
+ * Use HTTPSession for any request whose content is to be trusted.
+ *
+ * Not thread-safe; use one instance per thread.
+ */
+class TZK_ENGINE_API HTTPProber
+{
+	TZK_NO_CLASS_ASSIGNMENT(HTTPProber);
+	TZK_NO_CLASS_COPY(HTTPProber);
+	TZK_NO_CLASS_MOVEASSIGNMENT(HTTPProber);
+	TZK_NO_CLASS_MOVECOPY(HTTPProber);
+
+private:
+
+#if TZK_USING_OPENSSL
+	/// Client context for TLS probes, created on first need
+	SSL_CTX*  my_ssl_ctx;
+#endif
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 */
+	HTTPProber();
+
+
+	/**
+	 * Standard destructor
+	 */
+	~HTTPProber();
+
+
+	/**
+	 * Performs all probes, returning once each has completed or failed
+	 *
+	 * Hostnames are resolved once per distinct host and port, each on its own
+	 * thread started as the first probe needing it begins; a slow lookup only
+	 * holds up the probes awaiting it, and all are bounded by their timeouts.
+	 *
+	 * @param[in] probes
+	 *  The probes to perform
+	 * @param[out] results
+	 *  Replaced with one result per probe, in the same order
+	 * @param[in] cancel
+	 *  Optional flag checked at least every 100ms; when true, outstanding
+	 *  probes are abandoned with the Cancelled outcome
+	 * @return
+	 *  - ErrNONE if all probes were run, regardless of their outcomes
+	 *  - ECANCELED if cancelled
+	 *  - ErrEXTERN if the event notification mechanism could not be created
+	 */
+	int
+	Run(
+		const std::vector<http_probe>& probes,
+		std::vector<http_probe_result>& results,
+		const bool* cancel = nullptr
+	);
+};
+
+
+/**
+ * Converts a probe outcome to a short descriptive string
+ *
+ * @param[in] outcome
+ *  The outcome to convert
+ * @return
+ *  A static string
+ */
+TZK_ENGINE_API
+const char*
+ProbeOutcomeString(
+	ProbeOutcome outcome
+);
+
+
+} // namespace net
+} // namespace engine
+} // namespace trezanik
@@ -23,6 +23,7 @@ namespace engine {
 namespace net {
 
 
+class HTTPCache;
 class HTTPRequest;
 class HTTPResponse;
 class HTTPSession;
@@ -71,6 +72,19 @@ public:
 	) = 0;
 
 
+	/**
+	 * Gets the cache used for conditional HTTP requests
+	 *
+	 * Sessions created by CreateHTTPSession use this automatically; exposed to
+	 * configure the storage folder
+	 *
+	 * @return
+	 *  Reference to the HTTP cache
+	 */
+	virtual HTTPCache&
+	GetHTTPCache() = 0;
+
+
 	/**
 	 * Gets the HTTP request object with the unique ID supplied
 	 * 
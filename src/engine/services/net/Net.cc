@@ -16,6 +16,8 @@
 #	include <openssl/ssl.h>
 #endif
 
+#include <algorithm>
+
 
 namespace trezanik {
 namespace engine {
@@ -54,14 +56,32 @@ Net::CreateHTTPSession(
 	URI uri
 )
 {
-	auto session = std::make_shared<HTTPSession>(uri);
+	auto session = std::make_shared<HTTPSession>(uri, &my_connection_pool, &my_http_cache);
+
+	std::lock_guard<std::mutex>  lock(my_http_sessions_lock);
 
-	my_http_sessions.insert(session);
+	my_http_sessions.erase(
+		std::remove_if(my_http_sessions.begin(), my_http_sessions.end(),
+			[](const std::weak_ptr<HTTPSession>& s) { return s.expired(); }
+		),
+		my_http_sessions.end()
+	);
+	my_http_sessions.push_back(session);
+
+	// opportune time to drop connections idle beyond the keep-alive timeout
+	my_connection_pool.Prune();
 
 	return session;
 }
 
 
+HTTPCache&
+Net::GetHTTPCache()
+{
+	return my_http_cache;
+}
+
+
 std::shared_ptr<HTTPRequest>
 Net::GetHTTPRequest(
 	trezanik::core::UUID& TZK_UNUSED(id)
@@ -94,9 +114,13 @@ Net::GetHTTPSession(
 	trezanik::core::UUID& id
 )
 {
-	for ( auto& session : my_http_sessions )
+	std::lock_guard<std::mutex>  lock(my_http_sessions_lock);
+
+	for ( auto& weak : my_http_sessions )
 	{
-		if ( session->ID() == id )
+		auto  session = weak.lock();
+
+		if ( session != nullptr && session->ID() == id )
 			return session;
 	}
 
@@ -129,12 +153,23 @@ Net::IssueHTTPRequest(
 int
 Net::Initialize()
 {
+	using namespace trezanik::core;
+
 #if TZK_USING_OPENSSL
 	OPENSSL_init_ssl(OPENSSL_INIT_NO_LOAD_CONFIG, nullptr);
 	OpenSSL_add_all_algorithms();
 	//ERR_load_CRYPTO_strings();
 
 	//X509_get_default_cert_file();
+
+	/*
+	 * Trust store loaded once here, rather than per session. Failure is not
+	 * fatal; sessions fall back to their own context
+	 */
+	if ( my_connection_pool.Initialize() != ErrNONE )
+	{
+		TZK_LOG(LogLevel::Warning, "HTTP connection pool initialization failed");
+	}
 #endif
 
 	return ErrNONE;
@@ -147,6 +182,8 @@ void
 Net::Terminate()
 {
 	// pending proper implementation
+
+	my_connection_pool.Clear();
 }
 
 
@@ -10,10 +10,13 @@
 
 #include "engine/definitions.h"
 
+#include "engine/services/net/HTTPCache.h"
+#include "engine/services/net/HTTPConnectionPool.h"
 #include "engine/services/net/INet.h"
 
 #include <memory>
-#include <set>
+#include <mutex>
+#include <vector>
 
 
 namespace trezanik {
@@ -32,9 +35,24 @@ class TZK_ENGINE_API Net : public INet
 	TZK_NO_CLASS_MOVECOPY(Net);
 
 private:
-	
-	/// Collection of all added HTTP sessions
-	std::set<std::shared_ptr<HTTPSession>>  my_http_sessions;
+
+	/// Keep-alive connections and TLS state shared by all sessions; must outlive them
+	HTTPConnectionPool  my_connection_pool;
+
+	/// Conditional request cache shared by all sessions; must outlive them
+	HTTPCache  my_http_cache;
+
+	/// Guards the session collection
+	std::mutex  my_http_sessions_lock;
+
+	/**
+	 * Collection of all added HTTP sessions
+	 *
+	 * Not owned, so a session is destroyed - returning its connection to the
+	 * pool - as soon as its creator is done with it; expired entries are
+	 * pruned on each creation
+	 */
+	std::vector<std::weak_ptr<HTTPSession>>  my_http_sessions;
 
 protected:
 public:
@@ -59,6 +77,13 @@ public:
 	) override;
 	
 
+	/**
+	 * Implementation of INet::GetHTTPCache
+	 */
+	virtual HTTPCache&
+	GetHTTPCache() override;
+
+
 	/**
 	 * Implementation of INet::GetHTTPRequest
 	 */
@@ -15,6 +15,7 @@
 #include "core/services/event/EventDispatcher.h"
 #include "core/error.h"
 #include "core/util/time.h"
+#include "core/util/Profiler.h"
 
 #include <algorithm>
 #include <time.h>
@@ -63,6 +64,7 @@ BaseNode::BaseNode(
 , my_node_state(NodeState::Invalid) // not currently using this, consider retention
 , my_ng(nullptr)
 , my_style(trezanik::imgui::NodeStyle::standard())
+, my_status_colour(IM_COL32_BLACK_TRANS)
 , my_active(false)
 , my_was_active(false)
 , my_appearing(false)
@@ -137,7 +139,6 @@ void
 BaseNode::Draw()
 {
 	ImDrawList* draw_list = ImGui::GetWindowDrawList();
-	ImDrawListSplitter&  dl_splitter = my_ng->GetDrawListSplitter();
 	ImVec2   offset = my_ng->GetGridPosOnScreen();
 	ImVec2   header_size(0.f, 0.f);
 	float&   margin_l = my_style->margin.x;
@@ -146,9 +147,41 @@ BaseNode::Draw()
 
 	ImGui::PushID(this);
 
-	dl_splitter.SetCurrentChannel(draw_list, IsSelected() ?
-		NodeGraphChannel_SelectedText : NodeGraphChannel_UnselectedText
+	if ( my_node_flags & NodeFlags_Header )
+	{
+		// prevent header from being larger than node size (and hiding the body, too)
+		header_size.x = my_size.x;
+		header_size.y = ImGui::GetTextLineHeightWithSpacing() + my_style->margin_header.y;
+
+		// validation; 20px must be left for data at minimum
+		{
+			float&  avail = my_size.y;
+			if ( header_size.y > (avail - 20.f) )
+			{
+				header_size.y = (avail - 20.f);
+			}
+		}
+	}
+
+	/*
+	 * Background
+	 * Nodes are drawn bottom to top in z-order, one at a time, so the
+	 * background must precede the content for it to show
+	 */
+	draw_list->AddRectFilled(
+		offset + my_pos,
+		offset + my_pos + my_size,
+		my_style->bg,
+		my_style->radius
 	);
+	draw_list->AddRectFilled(
+		offset + my_pos,
+		offset + my_pos + header_size,
+		my_style->header_bg,
+		my_style->radius,
+		ImDrawFlags_RoundCornersTop
+	);
+
 	ImGui::SetCursorScreenPos(offset + my_pos);
 
 	// container
@@ -163,19 +196,6 @@ BaseNode::Draw()
 		//float   margin_b_header = my_style->margin_header.w;
 		//float   margin_b = my_style->margin.w;
 
-		// prevent header from being larger than node size (and hiding the body, too)
-		header_size.x = my_size.x;
-		header_size.y = ImGui::GetTextLineHeightWithSpacing() + margin_t_header;
-
-		// validation; 20px must be left for data at minimum
-		{
-			float&  avail = my_size.y;
-			if ( header_size.y > (avail - 20.f) )
-			{
-				header_size.y = (avail - 20.f);
-			}
-		}
-
 		// although R is unused, we'll use L*2 to accommodate for what it should/would be
 		float   inner_header_width = header_size.x - (margin_l_header * 2);
 
@@ -273,26 +293,6 @@ BaseNode::Draw()
 	_work_rect.Max = my_pos + my_size;
 
 
-	// Background
-	dl_splitter.SetCurrentChannel(draw_list, IsSelected() ?
-		NodeGraphChannel_Selected : _channel // NodeGraphChannel_Unselected or NodeGraphChannel_Bottom
-	);
-	draw_list->AddRectFilled(
-		offset + my_pos,
-		offset + my_pos + my_size,
-		my_style->bg,
-		my_style->radius
-	);
-	draw_list->AddRectFilled(
-		offset + my_pos,
-		offset + my_pos + header_size,
-		my_style->header_bg,
-		my_style->radius,
-		ImDrawFlags_RoundCornersTop
-	);
-
-
-
 	// Border
 	ImU32   col = my_style->border_colour;
 	float   thickness = my_style->border_thickness;
@@ -394,6 +394,33 @@ BaseNode::DrawResizeCrosses()
 }
 
 
+void
+BaseNode::DrawSimplified()
+{
+	ImDrawList*  draw_list = ImGui::GetWindowDrawList();
+	ImVec2  offset = my_ng->GetGridPosOnScreen();
+	ImRect  rect(offset + my_pos, offset + my_pos + my_size);
+
+	// no rounding or border; four vertices is the point of this
+	draw_list->AddRectFilled(rect.Min, rect.Max,
+		IsSelected() ? my_style->border_selected_colour : my_style->bg
+	);
+
+	/*
+	 * Interaction relies on these being current; with no header drawn, all
+	 * of the node acts as one so header-only dragging remains possible
+	 */
+	_inner_header_rect_clipped = rect;
+	_inner_header_rect = rect;
+	_inner_rect_clipped = rect;
+	_inner_rect = rect;
+
+	my_size_full = my_size;
+	_work_rect.Min = my_pos;
+	_work_rect.Max = my_pos + my_size;
+}
+
+
 std::stringstream
 BaseNode::Dump() const
 {
@@ -512,6 +539,13 @@ BaseNode::GetSize()
 }
 
 
+ImU32
+BaseNode::GetStatusColour() const
+{
+	return my_status_colour;
+}
+
+
 std::shared_ptr<NodeStyle>&
 BaseNode::GetStyle()
 {
@@ -592,6 +626,10 @@ BaseNode::HandleInteraction()
 		  && ImGui::IsMouseDragging(ImGuiMouseButton_Left)
 		  && my_selected )
 		{
+			if ( !my_being_dragged )
+			{
+				my_ng->NodeRaised(this);
+			}
 			my_being_dragged = true;
 			my_ng->DraggingNode(true);
 		}
@@ -611,6 +649,10 @@ BaseNode::HandleInteraction()
 		  && ImGui::IsMouseDragging(ImGuiMouseButton_Left)
 		  && my_selected )
 		{
+			if ( !my_being_dragged )
+			{
+				my_ng->NodeRaised(this);
+			}
 			my_being_dragged = true;
 			my_ng->DraggingNode(true);
 		}
@@ -629,6 +671,7 @@ BaseNode::HandleInteraction()
 		{
 			my_pos.x = newx;
 			my_pos.y = newy;
+			my_ng->NodeBoundsChanged(this);
 
 			// will need to be constantly updated for tracking position output data
 			EventData::node_graph_update  nu{NodeGraphUpdate::NodePosition, my_ng};
@@ -783,6 +826,11 @@ BaseNode::Selected(
 {
 	// don't log this here; do so in the post-update processing
 
+	if ( state != my_selected_next && my_ng != nullptr )
+	{
+		my_ng->NodeSelectionPending(this);
+	}
+
 	my_selected_next = state;
 
 	if ( !state )
@@ -828,13 +876,23 @@ BaseNode::SetNodegraph(
 
 void
 BaseNode::SetPosition(
-	const ImVec2& pos
+	const ImVec2& pos,
+	bool notify
 )
 {
 	using namespace trezanik::core;
 
 	my_pos = my_target_pos = pos;
 
+	// not yet assigned when positioned during node creation
+	if ( my_ng != nullptr )
+	{
+		my_ng->NodeBoundsChanged(this);
+	}
+
+	if ( !notify )
+		return;
+
 	EventData::node_graph_update  nu{NodeGraphUpdate::NodePosition, my_ng};
 	nu.opt.node_uuid = my_uuid;
 	nu.opt.vec2 = my_pos;
@@ -856,6 +914,11 @@ BaseNode::SetStaticSize(
 	}
 	
 	my_size = my_target_size = size;
+
+	if ( my_ng != nullptr )
+	{
+		my_ng->NodeBoundsChanged(this);
+	}
 	
 	EventData::node_graph_update  nu{NodeGraphUpdate::NodeSize, my_ng};
 	nu.opt.node_uuid = my_uuid;
@@ -864,6 +927,23 @@ BaseNode::SetStaticSize(
 }
 
 
+void
+BaseNode::SetStatusColour(
+	ImU32 colour
+)
+{
+	if ( colour == my_status_colour )
+		return;
+
+	my_status_colour = colour;
+
+	if ( my_ng != nullptr )
+	{
+		my_ng->NodeAppearanceChanged(this);
+	}
+}
+
+
 void
 BaseNode::SetStyle(
 	std::shared_ptr<trezanik::imgui::NodeStyle> style
@@ -880,6 +960,11 @@ BaseNode::SetStyle(
 		my_style = style;
 	}
 
+	if ( my_ng != nullptr )
+	{
+		my_ng->NodeAppearanceChanged(this);
+	}
+
 	EventData::node_graph_update  nu{NodeGraphUpdate::NodeStyle, my_ng};
 	nu.opt.node_uuid = my_uuid;
 	nu.opt.node_style = my_style;
@@ -897,6 +982,8 @@ BaseNode::Size()
 void
 BaseNode::Update()
 {
+	TZK_PROFILE_ZONE("BaseNode::Update");
+
 	/*
 	 * Check all valid, mark node as Ok and drawable state
 	 * 
@@ -915,10 +1002,12 @@ BaseNode::Update()
 		if ( my_size.x < node_minimum_width )
 		{
 			my_size.x = node_minimum_width;
+			my_ng->NodeBoundsChanged(this);
 		}
 		if ( my_size.y < node_minimum_height )
 		{
 			my_size.y = node_minimum_height;
+			my_ng->NodeBoundsChanged(this);
 		}
 		
 		if ( my_parent_window == nullptr )
@@ -931,7 +1020,14 @@ BaseNode::Update()
 		}
 	}
 
-	Draw();
+	if ( my_ng->GetDetailLevel(my_size) == NodeGraphDetail::Full )
+	{
+		Draw();
+	}
+	else
+	{
+		DrawSimplified();
+	}
 	HandleInteraction();
 }
 
@@ -964,6 +1060,9 @@ BaseNode::UpdateComplete()
 		EventData::node_graph_update  nu{my_selected_next ? NodeGraphUpdate::NodeSelected : NodeGraphUpdate::NodeUnselected, my_ng};
 		nu.opt.node_uuid = my_uuid;
 		ServiceLocator::EventDispatcher()->DispatchEvent(uuid_nodegraph_update, nu);
+
+		// changes layer; placed on top of the new one
+		my_ng->NodeRaised(this);
 	}
 
 	my_selected = my_selected_next;
@@ -311,10 +311,10 @@ enum class NodeUpdate : uint8_t
  * 
  * Lowest values are overlayed by those with higher values.
  * 
- * The total is used per frame for splitting the draw list, so requires tight
- * integration. Rules:
+ * Only Bottom and Unselected are assigned to nodes; the graph maps these to
+ * its z-order layers (NodeGraphLayer), where the rules are:
  * - Selected nodes must always appear above unselected ones
- * - Text is the level directly above the node
+ * - Text is drawn with its node, so is directly above it
  * 
  * Nodes designed to overlap/encompass will therefore obscure unless they have
  * an alpha applied, and should be set to the Bottom channel.
@@ -350,6 +350,20 @@ enum class NodeGraphChannels : uint8_t
 #endif
 
 
+/**
+ * Level of detail items are drawn at, determined by on-screen node size
+ * 
+ * Thresholds are held in the canvas configuration; once nodes are too small
+ * to make out text or pins, drawing them is pure overhead.
+ */
+enum class NodeGraphDetail : uint8_t
+{
+	Full,        //< Everything drawn; headers, text, pins, styled links
+	Simplified,  //< Nodes as filled rects only, links as straight lines
+	Aggregated   //< As Simplified, with links between a node pair drawn once
+};
+
+
 /**
  * Attribute-style flags for Node objects
  * 
@@ -436,6 +450,9 @@ private:
 	/// The node style applied; cannot be a nullptr (assign valid initialization and override)
 	std::shared_ptr<NodeStyle>  my_style;
 
+	/// Colour representing the node state in summary views; transparent if none
+	ImU32  my_status_colour;
+
 
 #if 0 // for data section scrolling, to add in future
 
@@ -723,6 +740,17 @@ public:
 	DrawContent();
 
 
+	/**
+	 * Draws the node as a plain filled rect, for reduced levels of detail
+	 * 
+	 * Used in place of Draw() once the node is too small on-screen for its
+	 * text and pins to be distinguishable; no pins are updated, and no imgui
+	 * items submitted. Selection is conveyed through the fill colour alone.
+	 */
+	virtual void
+	DrawSimplified();
+
+
 	/**
 	 * Debugging method
 	 * 
@@ -829,6 +857,19 @@ public:
 	GetSize();
 
 
+	/**
+	 * Obtains the colour representing the state of this node
+	 *
+	 * Used where nodes are too small to show their content, such as the
+	 * graph minimap
+	 *
+	 * @return
+	 *  The status colour, or IM_COL32_BLACK_TRANS if none is assigned
+	 */
+	ImU32
+	GetStatusColour() const;
+
+
 	/**
 	 * Accesses the style for this node
 	 *
@@ -992,10 +1033,15 @@ public:
 	 * 
 	 * @param[in] pos
 	 *  The new position on the grid
+	 * @param[in] notify
+	 *  Dispatches the NodePosition update if true. Transient placements (e.g.
+	 *  intermediate automatic layout results) skip it, leaving the owner to
+	 *  commit the final positions itself
 	 */
 	void
 	SetPosition(
-		const ImVec2& pos
+		const ImVec2& pos,
+		bool notify = true
 	);
 
 
@@ -1011,6 +1057,21 @@ public:
 	);
 
 
+	/**
+	 * Assigns the colour representing the state of this node
+	 *
+	 * The node itself is drawn unchanged; the nodegraph is notified so
+	 * summary views reflect it.
+	 *
+	 * @param[in] colour
+	 *  The new status colour, or IM_COL32_BLACK_TRANS to clear
+	 */
+	void
+	SetStatusColour(
+		ImU32 colour
+	);
+
+
 	/**
 	 * Assigns the style this node will be drawn with
 	 *
@@ -34,6 +34,8 @@ Canvas::Canvas()
 		configuration.decrease_zoom_key = ImGuiKey_X;
 		configuration.default_zoom = 1.0f;
 		configuration.increase_zoom_key = ImGuiKey_C;
+		configuration.lod_aggregate_size = 8.f;
+		configuration.lod_simple_size = 24.f;
 		configuration.reset_zoom_key = ImGuiKey_Z;
 		configuration.reset_scroll_key = ImGuiKey_R;
 		configuration.scroll_button = ImGuiMouseButton_Right;
@@ -246,7 +248,12 @@ Canvas::BeginFrame()
 {
 	ImGui::PushID(this);
 	ImGui::PushStyleColor(ImGuiCol_ChildBg, configuration.colour);
-	ImGui::BeginChild("CanvasViewport", ImVec2(0.f, 0.f), ImGuiChildFlags_None, ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoScrollbar);
+	/*
+	 * The mouse wheel zooms; were the child also to scroll with it, content
+	 * extending beyond the viewport would shift the window work rect, and
+	 * everything positioned from it
+	 */
+	ImGui::BeginChild("CanvasViewport", ImVec2(0.f, 0.f), ImGuiChildFlags_None, ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoScrollWithMouse);
 	// EndFrame must always be called, which invokes the requied EndChild() and PopID()
 	ImGui::PopStyleColor();
 	
@@ -49,6 +49,20 @@ struct canvas_config
 	float  zoom_smoothness;
 	/// The default zoom value
 	float  default_zoom;
+	/**
+	 * On-screen node size (shortest side, in pixels) below which nodes are
+	 * drawn as plain filled rects with no text or pins, and links as straight
+	 * lines. 0.f to always draw in full.
+	 * Defaults to 24.f
+	 */
+	float  lod_simple_size;
+	/**
+	 * On-screen node size below which all links between the same pair of
+	 * nodes are drawn as a single line, without interaction. Only effective
+	 * when less than lod_simple_size.
+	 * Defaults to 8.f
+	 */
+	float  lod_aggregate_size;
 	/**
 	 * The imgui key for decreasing the zoom level
 	 * Defaults to ImGuiKey_X
@@ -249,6 +263,23 @@ public:
 	}
 
 
+	/**
+	 * Assigns the scrolling applied to the canvas
+	 *
+	 * Used to jump the view elsewhere on the grid, such as from the minimap
+	 *
+	 * @param[in] scroll
+	 *  The new scroll value, as returned by GetScroll
+	 */
+	void
+	SetScroll(
+		const ImVec2& scroll
+	)
+	{
+		my_scroll = scroll;
+	}
+
+
 	/**
 	 * Gets a copy of the current canvas size
 	 *
@@ -0,0 +1,662 @@
+/**
+ * @file        src/imgui/ForceLayout.cc
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "imgui/definitions.h"
+
+#include "imgui/ForceLayout.h"
+
+#include "core/services/log/Log.h"
+#include "core/services/threading/Threading.h"
+#include "core/services/ServiceLocator.h"
+#include "core/util/Profiler.h"
+#include "core/error.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <string>
+
+
+namespace trezanik {
+namespace imgui {
+
+
+/**
+ * Quadtree subdivision limit; bodies still sharing a cell at this depth are
+ * aggregated rather than split further, bounding the tree for coincident
+ * positions
+ */
+constexpr int    max_tree_depth = 24;
+
+/** Nodes each thread should have at minimum to be worth running */
+constexpr size_t  min_nodes_per_thread = 128;
+
+/** Squared distance below which two bodies are treated as this far apart */
+constexpr float  min_distance_squared = 0.01f;
+
+
+ForceLayout::ForceLayout()
+: my_k_squared(1.f)
+, my_k(1.f)
+, my_work_generation(0)
+, my_work_pending(0)
+, my_work_exit(false)
+, my_thread_count(1)
+, my_published_generation(0)
+, my_iteration(0)
+, my_running(false)
+, my_stop_trigger(false)
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Constructor starting");
+	{
+
+	}
+	TZK_LOG(LogLevel::Trace, "Constructor finished");
+}
+
+
+ForceLayout::~ForceLayout()
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Destructor starting");
+	{
+		Stop();
+	}
+	TZK_LOG(LogLevel::Trace, "Destructor finished");
+}
+
+
+void
+ForceLayout::BuildTree()
+{
+	using namespace trezanik::core;
+
+	TZK_PROFILE_ZONE("ForceLayout::BuildTree");
+
+	float  min_x = FLT_MAX;
+	float  min_y = FLT_MAX;
+	float  max_x = -FLT_MAX;
+	float  max_y = -FLT_MAX;
+
+	for ( auto& n : my_nodes )
+	{
+		min_x = std::min(min_x, n.position.x);
+		min_y = std::min(min_y, n.position.y);
+		max_x = std::max(max_x, n.position.x);
+		max_y = std::max(max_y, n.position.y);
+	}
+
+	// square, and padded so no body lies exactly on the far edges
+	float  size = std::max(max_x - min_x, max_y - min_y) + 1.f;
+
+	my_cells.clear();
+	my_cells.push_back({ min_x, min_y, size, 0.f, 0.f, 0.f, -1, -1 });
+
+	for ( uint32_t i = 0; i < my_nodes.size(); i++ )
+	{
+		InsertBody(i);
+	}
+
+	for ( auto& c : my_cells )
+	{
+		if ( c.mass > 0.f )
+		{
+			c.mass_x /= c.mass;
+			c.mass_y /= c.mass;
+		}
+	}
+}
+
+
+uint32_t
+ForceLayout::GetIteration() const
+{
+	return my_iteration;
+}
+
+
+bool
+ForceLayout::GetPositions(
+	std::vector<ImVec2>& positions,
+	uint64_t& generation
+) const
+{
+	std::lock_guard<std::mutex>  lock(my_publish_lock);
+
+	uint64_t  current = my_published_generation;
+
+	if ( generation != 0 && generation == current )
+		return false;
+
+	positions = my_published;
+	generation = current;
+	return true;
+}
+
+
+void
+ForceLayout::InsertBody(
+	uint32_t body
+)
+{
+	const float  px = my_nodes[body].position.x;
+	const float  py = my_nodes[body].position.y;
+	int32_t  cell = 0;
+	int      depth = 0;
+
+	/*
+	 * Cells are referenced by index throughout, as subdividing appends to
+	 * the vector and invalidates any reference held
+	 */
+	for ( ;; )
+	{
+		my_cells[cell].mass += 1.f;
+		my_cells[cell].mass_x += px;
+		my_cells[cell].mass_y += py;
+
+		if ( my_cells[cell].child >= 0 )
+		{
+			float  half = my_cells[cell].size * 0.5f;
+			int    quadrant = (px >= my_cells[cell].min_x + half ? 1 : 0) + (py >= my_cells[cell].min_y + half ? 2 : 0);
+
+			cell = my_cells[cell].child + quadrant;
+			depth++;
+			continue;
+		}
+
+		if ( my_cells[cell].body < 0 )
+		{
+			my_cells[cell].body = static_cast<int32_t>(body);
+			return;
+		}
+
+		if ( depth >= max_tree_depth )
+		{
+			// retain as an aggregate; the existing body stays the identifier
+			return;
+		}
+
+		// occupied leaf; split it and push the existing body down a level
+		int32_t  existing = my_cells[cell].body;
+		float    half = my_cells[cell].size * 0.5f;
+		float    cx = my_cells[cell].min_x;
+		float    cy = my_cells[cell].min_y;
+		int32_t  first_child = static_cast<int32_t>(my_cells.size());
+
+		my_cells[cell].body = -1;
+		my_cells[cell].child = first_child;
+
+		my_cells.push_back({ cx, cy, half, 0.f, 0.f, 0.f, -1, -1 });
+		my_cells.push_back({ cx + half, cy, half, 0.f, 0.f, 0.f, -1, -1 });
+		my_cells.push_back({ cx, cy + half, half, 0.f, 0.f, 0.f, -1, -1 });
+		my_cells.push_back({ cx + half, cy + half, half, 0.f, 0.f, 0.f, -1, -1 });
+
+		const ImVec2&  ep = my_nodes[existing].position;
+		quad_cell&  ec = my_cells[first_child + (ep.x >= cx + half ? 1 : 0) + (ep.y >= cy + half ? 2 : 0)];
+
+		ec.mass = 1.f;
+		ec.mass_x = ep.x;
+		ec.mass_y = ep.y;
+		ec.body = existing;
+
+		cell = first_child + (px >= cx + half ? 1 : 0) + (py >= cy + half ? 2 : 0);
+		depth++;
+	}
+}
+
+
+bool
+ForceLayout::IsRunning() const
+{
+	return my_running;
+}
+
+
+void
+ForceLayout::Publish()
+{
+	std::lock_guard<std::mutex>  lock(my_publish_lock);
+
+	my_published.resize(my_nodes.size());
+
+	for ( size_t i = 0; i < my_nodes.size(); i++ )
+	{
+		my_published[i].x = my_nodes[i].position.x - my_nodes[i].size.x * 0.5f;
+		my_published[i].y = my_nodes[i].position.y - my_nodes[i].size.y * 0.5f;
+	}
+
+	my_published_generation++;
+}
+
+
+void
+ForceLayout::Repulse(
+	size_t begin,
+	size_t end,
+	ImVec2 centroid
+)
+{
+	using namespace trezanik::core;
+
+	TZK_PROFILE_ZONE("ForceLayout::Repulse");
+
+	const float  theta_squared = my_config.theta * my_config.theta;
+	std::vector<int32_t>  stack;
+
+	stack.reserve(max_tree_depth * 4);
+
+	for ( size_t i = begin; i < end; i++ )
+	{
+		if ( my_nodes[i].pinned )
+		{
+			my_displacement[i] = ImVec2(0.f, 0.f);
+			continue;
+		}
+
+		const float  px = my_nodes[i].position.x;
+		const float  py = my_nodes[i].position.y;
+		float  fx = 0.f;
+		float  fy = 0.f;
+
+		stack.clear();
+		stack.push_back(0);
+
+		while ( !stack.empty() )
+		{
+			const quad_cell&  c = my_cells[stack.back()];
+			stack.pop_back();
+
+			if ( c.mass <= 0.f )
+				continue;
+
+			bool   is_self = c.child < 0 && c.body == static_cast<int32_t>(i);
+			float  mass = is_self ? c.mass - 1.f : c.mass;
+
+			if ( mass <= 0.f )
+				continue;
+
+			float  dx = px - c.mass_x;
+			float  dy = py - c.mass_y;
+			float  d2 = dx * dx + dy * dy;
+
+			// too near (or too large) to treat as one body; open it up
+			if ( c.child >= 0 && c.size * c.size >= theta_squared * d2 )
+			{
+				stack.push_back(c.child);
+				stack.push_back(c.child + 1);
+				stack.push_back(c.child + 2);
+				stack.push_back(c.child + 3);
+				continue;
+			}
+
+			if ( d2 < min_distance_squared )
+			{
+				// coincident; push apart in a direction unique to this node
+				dx = std::cos(static_cast<float>(i));
+				dy = std::sin(static_cast<float>(i));
+				d2 = 1.f;
+			}
+
+			// magnitude k^2/d per body, along the unit vector (dx,dy)/d
+			float  f = my_k_squared * mass / d2;
+
+			fx += dx * f;
+			fy += dy * f;
+		}
+
+		fx -= (px - centroid.x) * my_config.gravity;
+		fy -= (py - centroid.y) * my_config.gravity;
+
+		my_displacement[i] = ImVec2(fx, fy);
+	}
+}
+
+
+void
+ForceLayout::Run()
+{
+	using namespace trezanik::core;
+
+	auto         tss = ServiceLocator::Threading();
+	const char   thread_name[] = "Force Layout";
+	std::string  prefix = thread_name;
+
+	tss->SetThreadName(thread_name);
+	prefix += " thread [id=" + std::to_string(tss->GetCurrentThreadId()) + "]";
+
+	TZK_LOG_FORMAT(LogLevel::Debug, "%s is starting", prefix.c_str());
+
+	const size_t  count = my_nodes.size();
+	uint32_t  thread_count = my_config.threads;
+
+	if ( thread_count == 0 )
+	{
+		thread_count = std::max(1u, std::thread::hardware_concurrency());
+	}
+	thread_count = static_cast<uint32_t>(std::min<size_t>(thread_count, std::max<size_t>(1, count / min_nodes_per_thread)));
+
+	my_thread_count = thread_count;
+	my_work_exit = false;
+	my_work_generation = 0;
+
+	for ( uint32_t t = 1; t < thread_count; t++ )
+	{
+		my_workers.push_back(std::thread(&ForceLayout::Work, this, t));
+	}
+
+	/*
+	 * Initial temperature permits a node to cross a tenth of the graph per
+	 * iteration; it then cools geometrically so that the final iterations
+	 * only make adjustments below the tolerance
+	 */
+	float  min_x = FLT_MAX, min_y = FLT_MAX, max_x = -FLT_MAX, max_y = -FLT_MAX;
+
+	for ( auto& n : my_nodes )
+	{
+		min_x = std::min(min_x, n.position.x);
+		min_y = std::min(min_y, n.position.y);
+		max_x = std::max(max_x, n.position.x);
+		max_y = std::max(max_y, n.position.y);
+	}
+
+	float  temperature = std::max(my_k, std::max(max_x - min_x, max_y - min_y) * 0.1f);
+	float  tolerance = std::max(my_config.tolerance, 0.001f);
+	float  cooling = std::pow(tolerance / temperature, 1.f / static_cast<float>(std::max(1u, my_config.max_iterations)));
+	auto   last_publish = std::chrono::steady_clock::now();
+	auto   started = last_publish;
+	bool   converged = false;
+
+	while ( !my_stop_trigger && my_iteration < my_config.max_iterations )
+	{
+		BuildTree();
+
+		ImVec2  centroid(0.f, 0.f);
+
+		for ( auto& n : my_nodes )
+		{
+			centroid.x += n.position.x;
+			centroid.y += n.position.y;
+		}
+		centroid.x /= static_cast<float>(count);
+		centroid.y /= static_cast<float>(count);
+
+		// hand out the repulsion, taking the first share ourselves
+		{
+			std::lock_guard<std::mutex>  lock(my_work_lock);
+			my_centroid = centroid;
+			my_work_pending = thread_count - 1;
+			my_work_generation++;
+		}
+		my_work_condvar.notify_all();
+
+		Repulse(0, count / thread_count, centroid);
+
+		{
+			std::unique_lock<std::mutex>  lock(my_work_lock);
+			my_work_condvar.wait(lock, [this]() { return my_work_pending == 0; });
+		}
+
+		// attraction; edges are few enough relative to the above to run here
+		for ( auto& e : my_edges )
+		{
+			ImVec2  delta(
+				my_nodes[e.source].position.x - my_nodes[e.target].position.x,
+				my_nodes[e.source].position.y - my_nodes[e.target].position.y
+			);
+			// magnitude d^2/k, along the unit vector delta/d
+			float   f = std::sqrt(delta.x * delta.x + delta.y * delta.y) * e.weight / my_k;
+
+			my_displacement[e.source].x -= delta.x * f;
+			my_displacement[e.source].y -= delta.y * f;
+			my_displacement[e.target].x += delta.x * f;
+			my_displacement[e.target].y += delta.y * f;
+		}
+
+		float  max_move = 0.f;
+
+		for ( size_t i = 0; i < count; i++ )
+		{
+			if ( my_nodes[i].pinned )
+				continue;
+
+			ImVec2&  d = my_displacement[i];
+			float    len = std::sqrt(d.x * d.x + d.y * d.y);
+
+			if ( len < 0.0001f )
+				continue;
+
+			float  step = std::min(len, temperature);
+
+			my_nodes[i].position.x += d.x / len * step;
+			my_nodes[i].position.y += d.y / len * step;
+			max_move = std::max(max_move, step);
+		}
+
+		temperature *= cooling;
+		my_iteration++;
+
+		auto  now = std::chrono::steady_clock::now();
+
+		if ( std::chrono::duration_cast<std::chrono::milliseconds>(now - last_publish).count() >= my_config.publish_interval )
+		{
+			Publish();
+			last_publish = now;
+		}
+
+		if ( max_move < tolerance )
+		{
+			converged = true;
+			break;
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex>  lock(my_work_lock);
+		my_work_exit = true;
+	}
+	my_work_condvar.notify_all();
+
+	for ( auto& worker : my_workers )
+	{
+		if ( worker.joinable() )
+		{
+			worker.join();
+		}
+	}
+	my_workers.clear();
+
+	Publish();
+
+	TZK_LOG_FORMAT(LogLevel::Debug,
+		"Layout of %zu nodes %s after %u iterations in %lld ms on %u threads",
+		count, converged ? "converged" : (my_stop_trigger ? "stopped" : "reached the limit"),
+		my_iteration.load(),
+		static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started).count()),
+		thread_count
+	);
+
+	my_running = false;
+
+	TZK_LOG_FORMAT(LogLevel::Debug, "%s is stopping", prefix.c_str());
+}
+
+
+int
+ForceLayout::Start(
+	std::vector<force_layout_node> nodes,
+	std::vector<force_layout_edge> edges,
+	const force_layout_config& config
+)
+{
+	using namespace trezanik::core;
+
+	Stop();
+
+	if ( nodes.empty() )
+		return EINVAL;
+
+	for ( auto& e : edges )
+	{
+		if ( e.source >= nodes.size() || e.target >= nodes.size() )
+		{
+			TZK_LOG_FORMAT(LogLevel::Warning, "Edge references invalid node: %u-%u", e.source, e.target);
+			return EINVAL;
+		}
+	}
+
+	my_nodes = std::move(nodes);
+	my_edges = std::move(edges);
+	my_config = config;
+	my_displacement.assign(my_nodes.size(), ImVec2(0.f, 0.f));
+
+	// self-links add nothing but a zero-length pull
+	my_edges.erase(std::remove_if(my_edges.begin(), my_edges.end(), [](const force_layout_edge& e) {
+		return e.source == e.target;
+	}), my_edges.end());
+
+	float  total_extent = 0.f;
+
+	for ( auto& n : my_nodes )
+	{
+		// operate on centres; sizes only matter when publishing
+		n.position.x += n.size.x * 0.5f;
+		n.position.y += n.size.y * 0.5f;
+		total_extent += std::sqrt(n.size.x * n.size.x + n.size.y * n.size.y);
+	}
+
+	/*
+	 * Spacing connected node centres by a multiple of the mean diagonal
+	 * leaves a gap between even the largest neighbours for links to route
+	 */
+	my_k = my_config.ideal_length > 0.f ? my_config.ideal_length
+		: std::max(1.f, total_extent / static_cast<float>(my_nodes.size()) * 1.5f);
+	my_k_squared = my_k * my_k;
+
+	/*
+	 * Nodes sharing a position (e.g. all created at the same spot) would
+	 * otherwise only separate along arbitrary directions; spread each set
+	 * onto a spiral first, leaving the first (and any pinned) in place
+	 */
+	std::vector<uint32_t>  order(my_nodes.size());
+
+	std::iota(order.begin(), order.end(), 0);
+	std::sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) {
+		const ImVec2&  pa = my_nodes[a].position;
+		const ImVec2&  pb = my_nodes[b].position;
+		return pa.x < pb.x || (pa.x == pb.x && pa.y < pb.y);
+	});
+
+	for ( size_t i = 1, run = 0; i < order.size(); i++ )
+	{
+		const ImVec2&  prev = my_nodes[order[i - 1]].position;
+		force_layout_node&  n = my_nodes[order[i]];
+
+		if ( n.position.x != prev.x || n.position.y != prev.y || n.pinned )
+		{
+			run = 0;
+			continue;
+		}
+
+		run++;
+
+		// golden angle spiral; even spacing regardless of the count
+		float  angle = static_cast<float>(run) * 2.39996323f;
+		float  radius = my_k * 0.5f * std::sqrt(static_cast<float>(run));
+
+		n.position.x += std::cos(angle) * radius;
+		n.position.y += std::sin(angle) * radius;
+	}
+
+	my_iteration = 0;
+	my_stop_trigger = false;
+	my_running = true;
+
+	Publish();
+
+	TZK_LOG_FORMAT(LogLevel::Debug, "Starting layout of %zu nodes, %zu edges", my_nodes.size(), my_edges.size());
+
+	my_thread = std::thread(&ForceLayout::Run, this);
+
+	return ErrNONE;
+}
+
+
+void
+ForceLayout::Stop()
+{
+	my_stop_trigger = true;
+
+	if ( my_thread.joinable() )
+	{
+		my_thread.join();
+	}
+
+	my_running = false;
+}
+
+
+void
+ForceLayout::Work(
+	uint32_t index
+)
+{
+	using namespace trezanik::core;
+
+	auto         tss = ServiceLocator::Threading();
+	const char   thread_name[] = "Force Layout Worker";
+	std::string  prefix = thread_name;
+
+	tss->SetThreadName(thread_name);
+	prefix += " thread [id=" + std::to_string(tss->GetCurrentThreadId()) + "]";
+
+	TZK_LOG_FORMAT(LogLevel::Debug, "%s is starting", prefix.c_str());
+
+	uint64_t  seen = 0;
+
+	for ( ;; )
+	{
+		ImVec2  centroid;
+
+		{
+			std::unique_lock<std::mutex>  lock(my_work_lock);
+
+			// a batch takes priority over exiting, so the controller never waits on us forever
+			my_work_condvar.wait(lock, [this, &seen]() { return my_work_generation != seen || my_work_exit; });
+
+			if ( my_work_generation == seen )
+				break;
+
+			seen = my_work_generation;
+			centroid = my_centroid;
+		}
+
+		const size_t  count = my_nodes.size();
+
+		Repulse(count * index / my_thread_count, count * (index + 1) / my_thread_count, centroid);
+
+		bool  last;
+		{
+			std::lock_guard<std::mutex>  lock(my_work_lock);
+			last = (--my_work_pending == 0);
+		}
+		if ( last )
+		{
+			my_work_condvar.notify_all();
+		}
+	}
+
+	TZK_LOG_FORMAT(LogLevel::Debug, "%s is stopping", prefix.c_str());
+}
+
+
+} // namespace imgui
+} // namespace trezanik
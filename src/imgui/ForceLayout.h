@@ -0,0 +1,392 @@
+#pragma once
+
+/**
+ * @file        src/imgui/ForceLayout.h
+ * @brief       Multithreaded force-directed automatic node placement
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "imgui/definitions.h"
+
+#include "imgui/dear_imgui/imgui.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace trezanik {
+namespace imgui {
+
+
+constexpr float     default_layout_theta = 0.9f;
+constexpr float     default_layout_gravity = 1.f;
+constexpr float     default_layout_tolerance = 0.5f;
+constexpr uint32_t  default_layout_max_iterations = 1000;
+constexpr uint32_t  default_layout_publish_interval = 33;
+
+
+/**
+ * A node as input to the layout
+ */
+struct force_layout_node
+{
+	/// top-left position of the node, grid co-ordinates
+	ImVec2  position;
+	/// node dimensions
+	ImVec2  size;
+	/// if true, the node exerts force on others but is never moved
+	bool    pinned;
+};
+
+
+/**
+ * A connection between two nodes as input to the layout
+ *
+ * Multiple links between the same pair of nodes should be merged into a
+ * single edge, with the weight reflecting the count.
+ */
+struct force_layout_edge
+{
+	/// index of the first node
+	uint32_t  source;
+	/// index of the second node
+	uint32_t  target;
+	/// attraction multiplier; 1.f for a single link
+	float     weight;
+};
+
+
+/**
+ * Parameters controlling a layout run
+ */
+struct force_layout_config
+{
+	/**
+	 * Barnes-Hut opening criterion; a quadtree cell is treated as a single
+	 * body when its width divided by the distance to it is below this. 0.f
+	 * computes every pair exactly, larger values are faster but coarser.
+	 * Defaults to 0.9f
+	 */
+	float     theta;
+	/**
+	 * Strength of the pull towards the centroid, keeping disconnected nodes
+	 * and subgraphs from drifting apart.
+	 * Defaults to 1.f
+	 */
+	float     gravity;
+	/**
+	 * Preferred distance between the centres of connected nodes. 0.f to
+	 * derive it from the mean node size.
+	 * Defaults to 0.f
+	 */
+	float     ideal_length;
+	/**
+	 * Largest movement of any node within an iteration, in grid units, below
+	 * which the layout is deemed converged.
+	 * Defaults to 0.5f
+	 */
+	float     tolerance;
+	/**
+	 * Iteration limit, reached if the layout fails to converge sooner.
+	 * Defaults to 1000
+	 */
+	uint32_t  max_iterations;
+	/**
+	 * Minimum milliseconds between publishing intermediate positions.
+	 * Defaults to 33
+	 */
+	uint32_t  publish_interval;
+	/**
+	 * Threads to compute with, including the controlling thread. 0 to use
+	 * the hardware concurrency.
+	 * Defaults to 0
+	 */
+	uint32_t  threads;
+
+	force_layout_config()
+	: theta(default_layout_theta)
+	, gravity(default_layout_gravity)
+	, ideal_length(0.f)
+	, tolerance(default_layout_tolerance)
+	, max_iterations(default_layout_max_iterations)
+	, publish_interval(default_layout_publish_interval)
+	, threads(0)
+	{
+	}
+};
+
+
+/**
+ * Positions nodes via force-directed placement, away from the calling thread
+ *
+ * Fruchterman-Reingold: every node repels every other, connected nodes
+ * attract, and movement per iteration is capped by a cooling temperature.
+ * Repulsion, the O(n^2) portion, is approximated with a Barnes-Hut quadtree
+ * rebuilt each iteration and split across worker threads by node range, so a
+ * graph of several thousand nodes settles within a few seconds.
+ *
+ * The caller supplies a copy of the graph to Start, then polls GetPositions
+ * (typically once per frame) for the latest intermediate result; nothing is
+ * ever written back into the caller's objects from the layout threads.
+ */
+class IMGUI_API ForceLayout
+{
+	TZK_NO_CLASS_ASSIGNMENT(ForceLayout);
+	TZK_NO_CLASS_COPY(ForceLayout);
+	TZK_NO_CLASS_MOVEASSIGNMENT(ForceLayout);
+	TZK_NO_CLASS_MOVECOPY(ForceLayout);
+
+private:
+
+	/**
+	 * Quadtree cell, held in a flat array rebuilt every iteration
+	 */
+	struct quad_cell
+	{
+		/// left edge
+		float    min_x;
+		/// top edge
+		float    min_y;
+		/// width and height
+		float    size;
+		/// sum of contained body x positions; centre of mass once finalized
+		float    mass_x;
+		/// sum of contained body y positions; centre of mass once finalized
+		float    mass_y;
+		/// number of bodies contained
+		float    mass;
+		/// index of the first of four consecutive children; -1 if a leaf
+		int32_t  child;
+		/// the body held by a leaf; -1 if empty
+		int32_t  body;
+	};
+
+	/** Copy of the input nodes; positions converted to centres */
+	std::vector<force_layout_node>  my_nodes;
+
+	/** Copy of the input edges */
+	std::vector<force_layout_edge>  my_edges;
+
+	/** The active configuration */
+	force_layout_config  my_config;
+
+	/** Per-node displacement accumulated in the current iteration */
+	std::vector<ImVec2>  my_displacement;
+
+	/** The Barnes-Hut quadtree for the current iteration */
+	std::vector<quad_cell>  my_cells;
+
+	/** Ideal edge length, squared */
+	float  my_k_squared;
+
+	/** Ideal edge length */
+	float  my_k;
+
+	/** The controlling thread */
+	std::thread  my_thread;
+
+	/** Additional threads sharing the repulsion computation */
+	std::vector<std::thread>  my_workers;
+
+	/** Lock for the work dispatch state */
+	std::mutex  my_work_lock;
+
+	/** Signals workers of new work, and the controller of its completion */
+	std::condition_variable  my_work_condvar;
+
+	/** Incremented for each batch of work handed to the workers */
+	uint64_t  my_work_generation;
+
+	/** Workers yet to finish the current batch */
+	uint32_t  my_work_pending;
+
+	/** Flag for the workers to exit once no batch is outstanding */
+	bool  my_work_exit;
+
+	/** Gravity target for the current batch */
+	ImVec2  my_centroid;
+
+	/** Threads sharing the current run, including the controller */
+	uint32_t  my_thread_count;
+
+	/** Lock for the published positions */
+	mutable std::mutex  my_publish_lock;
+
+	/** Top-left node positions, as last published */
+	std::vector<ImVec2>  my_published;
+
+	/** Incremented each time positions are published */
+	std::atomic<uint64_t>  my_published_generation;
+
+	/** Iterations completed in the current run */
+	std::atomic<uint32_t>  my_iteration;
+
+	/** Flag set while a run is in progress */
+	std::atomic<bool>  my_running;
+
+	/** Flag for the threads to abandon the run */
+	std::atomic<bool>  my_stop_trigger;
+
+
+	/**
+	 * Builds the quadtree from the current node positions
+	 */
+	void
+	BuildTree();
+
+
+	/**
+	 * Places a body within the quadtree
+	 *
+	 * @param[in] body
+	 *  The node index
+	 */
+	void
+	InsertBody(
+		uint32_t body
+	);
+
+
+	/**
+	 * Publishes the current positions for GetPositions
+	 */
+	void
+	Publish();
+
+
+	/**
+	 * Computes repulsion and gravity for a range of nodes
+	 *
+	 * Reads only the quadtree and writes only the displacement of nodes in
+	 * the range, so ranges are processed concurrently without locking.
+	 *
+	 * @param[in] begin
+	 *  The first node index
+	 * @param[in] end
+	 *  One past the last node index
+	 * @param[in] centroid
+	 *  The point gravity pulls towards
+	 */
+	void
+	Repulse(
+		size_t begin,
+		size_t end,
+		ImVec2 centroid
+	);
+
+
+	/**
+	 * The controlling thread; runs iterations until converged or stopped
+	 */
+	void
+	Run();
+
+
+	/**
+	 * A worker thread; processes its share of each batch of work
+	 *
+	 * @param[in] index
+	 *  The workers index, 1-based; the controller processes share 0
+	 */
+	void
+	Work(
+		uint32_t index
+	);
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 */
+	ForceLayout();
+
+
+	/**
+	 * Standard destructor
+	 *
+	 * Stops any run in progress.
+	 */
+	~ForceLayout();
+
+
+	/**
+	 * Obtains the iterations completed in the current or last run
+	 *
+	 * @return
+	 *  The iteration count
+	 */
+	uint32_t
+	GetIteration() const;
+
+
+	/**
+	 * Obtains the latest node positions, if newer than those already held
+	 *
+	 * @param[out] positions
+	 *  Receives the top-left position of each node, in input order
+	 * @param[in,out] generation
+	 *  The generation the caller last obtained; updated on retrieval. Pass 0
+	 *  to always retrieve
+	 * @return
+	 *  Boolean state; true if positions were written
+	 */
+	bool
+	GetPositions(
+		std::vector<ImVec2>& positions,
+		uint64_t& generation
+	) const;
+
+
+	/**
+	 * Determines if a layout run is in progress
+	 *
+	 * @return
+	 *  Boolean state; false once converged, stopped, or never started
+	 */
+	bool
+	IsRunning() const;
+
+
+	/**
+	 * Begins laying out a graph in the background
+	 *
+	 * Any run in progress is stopped first. Nodes placed on top of one
+	 * another (such as newly created nodes at the same location) are spread
+	 * apart before the first iteration.
+	 *
+	 * @param[in] nodes
+	 *  The nodes to position
+	 * @param[in] edges
+	 *  The connections between nodes, referencing indices in nodes
+	 * @param[in] config
+	 *  The layout parameters
+	 * @return
+	 *  ErrNONE if the run started, or EINVAL if there are no nodes or an edge
+	 *  references a nonexistent node
+	 */
+	int
+	Start(
+		std::vector<force_layout_node> nodes,
+		std::vector<force_layout_edge> edges,
+		const force_layout_config& config
+	);
+
+
+	/**
+	 * Stops any run in progress, waiting for its threads to finish
+	 *
+	 * The positions last published remain available.
+	 */
+	void
+	Stop();
+};
+
+
+} // namespace imgui
+} // namespace trezanik
@@ -8,6 +8,7 @@
 #include "imgui/definitions.h"
 
 #include "imgui/ImGuiImpl_SDL2.h"
+#include "imgui/UserTexture.h"
 #include "imgui/dear_imgui/imgui.h"
 #include "core/services/log/Log.h"
 #include "core/services/memory/Memory.h"
@@ -558,6 +559,9 @@ ImGuiImpl_SDL2::NewFrame()
 
 	// --== Custom ==--
 
+	// the prior frame has been rendered, so any destruction requests are actioned
+	UserTexture::CollectRetired();
+
 	// all SDL prep complete
 	ImGui::NewFrame();
 }
@@ -936,6 +940,7 @@ ImGuiImpl_SDL2::Shutdown()
 	// --== SDL2 Renderer ==--
 
 	DestroyDeviceObjects();
+	UserTexture::DestroyRetired();
 
 	io.BackendRendererName = nullptr;
 	io.BackendRendererUserData = nullptr;
@@ -14,17 +14,163 @@
 
 #include "core/services/log/Log.h"
 #include "core/services/event/EventDispatcher.h"
+#include "core/util/Profiler.h"
 #include "core/error.h"
 
 #include <algorithm>
+#include <cfloat>
+#include <cinttypes>
 #include <climits>
 #include <cmath>
+#include <unordered_set>
 
 
 namespace trezanik {
 namespace imgui {
 
 
+/**
+ * Composites one colour over another, as alpha blending does on screen
+ *
+ * @param[in] dst
+ *  The colour beneath
+ * @param[in] src
+ *  The colour on top
+ * @return
+ *  The combined colour, with straight (non-premultiplied) alpha
+ */
+static ImU32
+BlendOver(
+	ImU32 dst,
+	ImU32 src
+)
+{
+	float  src_a = ((src >> IM_COL32_A_SHIFT) & 0xFF) / 255.f;
+	float  dst_a = ((dst >> IM_COL32_A_SHIFT) & 0xFF) / 255.f * (1.f - src_a);
+	float  out_a = src_a + dst_a;
+
+	if ( out_a <= 0.f )
+		return IM_COL32_BLACK_TRANS;
+
+	auto  channel = [&](int shift)
+	{
+		float  val = ((src >> shift) & 0xFF) * src_a + ((dst >> shift) & 0xFF) * dst_a;
+		return static_cast<ImU32>(val / out_a + 0.5f);
+	};
+
+	return IM_COL32(
+		channel(IM_COL32_R_SHIFT), channel(IM_COL32_G_SHIFT), channel(IM_COL32_B_SHIFT),
+		static_cast<ImU32>(out_a * 255.f + 0.5f)
+	);
+}
+
+
+/**
+ * Fills a rectangle of pixels, clipped to the image
+ *
+ * @param[in] pixels
+ *  The image pixels, row order
+ * @param[in] width
+ *  The image width
+ * @param[in] height
+ *  The image height
+ * @param[in] rect
+ *  The area to fill, in pixels; at least one pixel is always filled if within
+ *  the image
+ * @param[in] colour
+ *  The colour written; no blending is performed
+ */
+static void
+FillPixels(
+	ImU32* pixels,
+	int width,
+	int height,
+	const ImRect& rect,
+	ImU32 colour
+)
+{
+	int  x0 = std::max(static_cast<int>(rect.Min.x), 0);
+	int  y0 = std::max(static_cast<int>(rect.Min.y), 0);
+	int  x1 = std::min(std::max(static_cast<int>(rect.Max.x), x0 + 1), width);
+	int  y1 = std::min(std::max(static_cast<int>(rect.Max.y), y0 + 1), height);
+
+	for ( int y = y0; y < y1; y++ )
+	{
+		std::fill(pixels + y * width + x0, pixels + y * width + x1, colour);
+	}
+}
+
+
+/**
+ * Plots a single-pixel line, clipped to the image
+ *
+ * @param[in] pixels
+ *  The image pixels, row order
+ * @param[in] width
+ *  The image width
+ * @param[in] height
+ *  The image height
+ * @param[in] p1
+ *  The starting point, in pixels
+ * @param[in] p2
+ *  The ending point, in pixels
+ * @param[in] colour
+ *  The colour written; no blending is performed
+ */
+static void
+PlotLine(
+	ImU32* pixels,
+	int width,
+	int height,
+	const ImVec2& p1,
+	const ImVec2& p2,
+	ImU32 colour
+)
+{
+	ImVec2  delta = p2 - p1;
+	int     steps = static_cast<int>(std::max(std::fabs(delta.x), std::fabs(delta.y)));
+
+	if ( steps == 0 )
+		steps = 1;
+
+	ImVec2  step = delta / static_cast<float>(steps);
+	ImVec2  pos = p1;
+
+	for ( int i = 0; i <= steps; i++, pos += step )
+	{
+		int  x = static_cast<int>(pos.x);
+		int  y = static_cast<int>(pos.y);
+
+		if ( x >= 0 && x < width && y >= 0 && y < height )
+		{
+			pixels[y * width + x] = colour;
+		}
+	}
+}
+
+
+/**
+ * Determines the z-order layer a node belongs in
+ *
+ * @param[in] node
+ *  The node to check
+ * @return
+ *  The NodeGraphLayer for the node, based on its selection and channel
+ */
+static int
+ZLayerOf(
+	BaseNode* node
+)
+{
+	if ( node->IsSelected() )
+		return NodeGraphLayer_Selected;
+	if ( node->GetChannel() == NodeGraphChannel_Bottom )
+		return NodeGraphLayer_Bottom;
+
+	return NodeGraphLayer_Regular;
+}
+
+
 ImNodeGraph::ImNodeGraph()
 : my_hovered_node(nullptr)
 , my_hovered_pin(nullptr)
@@ -41,6 +187,14 @@ ImNodeGraph::ImNodeGraph()
 , my_rclick_dragging(false)
 , my_lclick_was_dragging_prerelease(false)
 , my_rclick_was_dragging_prerelease(false)
+, my_nodes_updated(0)
+, my_links_updated(0)
+, my_generation(0)
+, my_grid_renders(0)
+, my_minimap_generation(0)
+, my_minimap_hovered(false)
+, my_minimap_dragging(false)
+, my_minimap_renders(0)
 {
 	using namespace trezanik::core;
 
@@ -54,6 +208,10 @@ ImNodeGraph::ImNodeGraph()
 		settings.grid_style.colours.origins       = IM_COL32(200,   0,   0, 128);
 		settings.grid_style.colours.selector_rect = IM_COL32( 72, 200, 255, 255);
 		settings.grid_style.colours.link          = IM_COL32(200, 200, 200, 255);
+		settings.minimap_style.colours.background = IM_COL32( 20,  26,  30, 220);
+		settings.minimap_style.colours.border     = IM_COL32(120, 120, 120, 255);
+		settings.minimap_style.colours.link       = IM_COL32(200, 200, 200, 128);
+		settings.minimap_style.colours.viewport   = IM_COL32( 72, 200, 255, 255);
 #else  // Light
 		settings.grid_style.colours.background    = IM_COL32(250, 253, 255, 255);
 		settings.grid_style.colours.primary       = IM_COL32(189, 197,   0,  40);
@@ -61,12 +219,19 @@ ImNodeGraph::ImNodeGraph()
 		settings.grid_style.colours.origins       = IM_COL32(200,   0,   0, 128);
 		settings.grid_style.colours.selector_rect = IM_COL32( 72, 200, 255, 255);
 		settings.grid_style.colours.link          = IM_COL32( 78,  60,  60, 255);
+		settings.minimap_style.colours.background = IM_COL32(240, 243, 245, 220);
+		settings.minimap_style.colours.border     = IM_COL32(120, 120, 120, 255);
+		settings.minimap_style.colours.link       = IM_COL32( 78,  60,  60, 128);
+		settings.minimap_style.colours.viewport   = IM_COL32( 72, 200, 255, 255);
 #endif
 		settings.grid_style.size = 50;
 		settings.grid_style.subdivisions = settings.grid_style.size / 10;
 		settings.grid_style.draw = true;
 		settings.grid_style.draw_origin = false;
 		settings.grid_style.selector_rect_thickness = 1.5f;
+		settings.minimap_style.draw = true;
+		settings.minimap_style.size = 200;
+		settings.minimap_style.margin = 10.f;
 
 		my_canvas.configuration.colour = settings.grid_style.colours.background;
 	}
@@ -74,6 +239,22 @@ ImNodeGraph::ImNodeGraph()
 }
 
 
+ImNodeGraph::~ImNodeGraph()
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Destructor starting");
+	{
+		/*
+		 * Our own textures are retired as members are destroyed after this;
+		 * reclaim anything the backend has finished with in the meantime
+		 */
+		UserTexture::CollectRetired();
+	}
+	TZK_LOG(LogLevel::Trace, "Destructor finished");
+}
+
+
 void
 ImNodeGraph::AddNodeToSelection(
 	std::shared_ptr<BaseNode> node
@@ -122,16 +303,12 @@ ImNodeGraph::DeleteNode(
 	BaseNode* node
 )
 {
-	for ( auto& n : my_nodes )
-	{
-		if ( n.get() == node )
-		{
-			n->Close();
-			return true;
-		}
-	}
+	auto  iter = my_node_ids.find(node->GetID());
+	if ( iter == my_node_ids.end() || my_nodes[iter->second].get() != node )
+		return false;
 
-	return false;
+	node->Close();
+	return true;
 }
 
 
@@ -140,6 +317,8 @@ ImNodeGraph::Draw()
 {
 	using namespace trezanik::core;
 
+	TZK_PROFILE_ZONE("ImNodeGraph::Draw");
+
 	// ImDrawList positions are always in absolute coordinates
 	ImDrawList*  draw_list = ImGui::GetWindowDrawList();
 
@@ -149,44 +328,56 @@ ImNodeGraph::Draw()
 //  Grid
 // ###########
 
-TZK_VC_DISABLE_WARNINGS(4244) // int to float, and float to int conversion data loss - fine here
-
 	// Display grid - default to full current window size
 	ImVec2  origin = my_canvas.GetOrigin(); // == ImGui::GetWindowPos()
 	ImVec2  grid_size = my_canvas.GetSize(); // == ImGui::GetWindowSize()
-	float   grid_sub_step = settings.grid_style.size / settings.grid_style.subdivisions;
 	ImVec2  scroll = my_canvas.GetScroll();
 	
 	// if first time, center the grid origin within the canvas?
 	// akin to my_scroll.x + y = my_size / 2;
 	
-	if ( settings.grid_style.draw )
+	if ( settings.grid_style.draw && settings.grid_style.size > 0 )
 	{
-		int  x_end = grid_size.x + origin.x;
-		int  y_end = grid_size.y + origin.y;
-
-		for ( int x = origin.x + fmodf(scroll.x, settings.grid_style.size); x < x_end; x += settings.grid_style.size )
-		{
-			draw_list->AddLine(ImVec2(x, origin.y), ImVec2(x, y_end), settings.grid_style.colours.primary);
-		}
-		for ( int y = origin.y + fmodf(scroll.y, settings.grid_style.size); y < y_end; y += settings.grid_style.size )
-		{
-			draw_list->AddLine(ImVec2(origin.x, y), ImVec2(x_end, y), settings.grid_style.colours.primary);
-		}
-		if ( my_canvas.Scale() > 0.7f )
+		int  size = settings.grid_style.size;
+		int  length = static_cast<int>(std::ceil(std::max(grid_size.x, grid_size.y))) + size;
+
+		if ( length > my_grid_texture.GetWidth()
+		  || my_grid_texture_style.size != size
+		  || my_grid_texture_style.subdivisions != settings.grid_style.subdivisions
+		  || my_grid_texture_style.colours.primary != settings.grid_style.colours.primary
+		  || my_grid_texture_style.colours.secondary != settings.grid_style.colours.secondary )
 		{
-			for ( int x = origin.x + fmodf(scroll.x, grid_sub_step); x < x_end; x += grid_sub_step )
-			{
-				draw_list->AddLine(ImVec2(x, origin.y), ImVec2(x, y_end), settings.grid_style.colours.secondary);
-			}
-			for ( int y = origin.y + fmodf(scroll.y, grid_sub_step); y < y_end; y += grid_sub_step )
-			{
-				draw_list->AddLine(ImVec2(origin.x, y), ImVec2(x_end, y), settings.grid_style.colours.secondary);
-			}
+			RenderGrid(length);
 		}
 	}
 
-TZK_VC_RESTORE_WARNINGS(4244)
+	if ( settings.grid_style.draw && my_grid_texture.IsCreated() && my_grid_texture_style.size > 0 )
+	{
+		int    size = my_grid_texture_style.size;
+		float  width = static_cast<float>(my_grid_texture.GetWidth());
+		// lines sit on the first pixel of each repeat; start far enough in to line up with the scroll
+		auto   offset_of = [size, width](float scroll_axis)
+		{
+			int  shift = static_cast<int>(std::floor(std::fmod(scroll_axis, static_cast<float>(size))));
+			return static_cast<float>(((-shift % size) + size) % size) / width;
+		};
+		// minor lines only when not zoomed out; sampled between the duplicate rows
+		float  v = my_canvas.Scale() > 0.7f ? 0.75f : 0.25f;
+		float  u_x = offset_of(scroll.x);
+		float  u_y = offset_of(scroll.y);
+		float  u_x_end = u_x + grid_size.x / width;
+		float  u_y_end = u_y + grid_size.y / width;
+		ImVec2  max = origin + grid_size;
+		ImTextureRef  tex = my_grid_texture.GetTexRef();
+
+		// vertical lines; u follows screen x, every screen row samples the same
+		draw_list->AddImage(tex, origin, max, ImVec2(u_x, v), ImVec2(u_x_end, v));
+		// horizontal lines; the same pattern turned on its side, u following screen y
+		draw_list->AddImageQuad(tex,
+			origin, ImVec2(max.x, origin.y), max, ImVec2(origin.x, max.y),
+			ImVec2(u_y, v), ImVec2(u_y, v), ImVec2(u_y_end, v), ImVec2(u_y_end, v)
+		);
+	}
 }
 
 
@@ -262,6 +453,34 @@ ImNodeGraph::DrawDebug()
 			settings.grid_style.selector_rect_thickness = thickness;
 		}
 
+		ImGui::Text("Minimap.Draw");
+		ImGui::SameLine();
+		ImGui::ToggleButton("##Minimap.Draw", &settings.minimap_style.draw);
+
+		ImVec4  mb = ImGui::ColorConvertU32ToFloat4(settings.minimap_style.colours.background);
+		ImVec4  mo = ImGui::ColorConvertU32ToFloat4(settings.minimap_style.colours.border);
+		ImVec4  ml = ImGui::ColorConvertU32ToFloat4(settings.minimap_style.colours.link);
+		ImVec4  mv = ImGui::ColorConvertU32ToFloat4(settings.minimap_style.colours.viewport);
+		if ( ImGui::ColorEdit4("Minimap.Background", &mb.x, ImGuiColorEditFlags_None) )
+		{
+			settings.minimap_style.colours.background = ImGui::ColorConvertFloat4ToU32(mb);
+		}
+		if ( ImGui::ColorEdit4("Minimap.Border", &mo.x, ImGuiColorEditFlags_None) )
+		{
+			settings.minimap_style.colours.border = ImGui::ColorConvertFloat4ToU32(mo);
+		}
+		if ( ImGui::ColorEdit4("Minimap.Link", &ml.x, ImGuiColorEditFlags_None) )
+		{
+			settings.minimap_style.colours.link = ImGui::ColorConvertFloat4ToU32(ml);
+			// baked into the texture
+			my_generation++;
+		}
+		if ( ImGui::ColorEdit4("Minimap.Viewport", &mv.x, ImGuiColorEditFlags_None) )
+		{
+			settings.minimap_style.colours.viewport = ImGui::ColorConvertFloat4ToU32(mv);
+		}
+		ImGui::SliderInt("Minimap.Size", &settings.minimap_style.size, 50, 400);
+
 		ImGui::Unindent();
 	}
 	if ( ImGui::CollapsingHeader("Canvas") )
@@ -277,6 +496,9 @@ ImNodeGraph::DrawDebug()
 		ImVec2  mgridpos;
 		ImVec2  size;
 
+		ImGui::SliderFloat("Canvas.LOD.SimpleSize", &my_canvas.configuration.lod_simple_size, 0.f, 100.f);
+		ImGui::SliderFloat("Canvas.LOD.AggregateSize", &my_canvas.configuration.lod_aggregate_size, 0.f, 50.f);
+
 		ImGui::TextDisabled("Mouse.Position.Application: %g,%g", mouse_pos.x, mouse_pos.y);
 		if ( cmpos == ImVec2(-1, -1) )
 			ImGui::TextDisabled("Mouse.Position.Canvas: NaN,NaN");
@@ -301,6 +523,13 @@ ImNodeGraph::DrawDebug()
 		ImGui::TextDisabled("Canvas.Origin: %g,%g", corigin.x, corigin.y);
 		ImGui::TextDisabled("Canvas.Scroll: %g,%g", cscroll.x, cscroll.y);
 		ImGui::TextDisabled("Canvas.Scale: %g", cscale);
+		ImGui::TextDisabled("Nodes.Updated: %zu/%zu", my_nodes_updated, my_nodes.size());
+		ImGui::TextDisabled("Links.Updated: %zu/%zu", my_links_updated, my_links.size());
+		ImGui::TextDisabled("Links.Aggregated: %zu", my_link_aggregates.size());
+		ImGui::TextDisabled("Links.Proxy: %zu", my_proxy_links.size());
+		ImGui::TextDisabled("Graph.Generation: %" PRIu64, my_generation);
+		ImGui::TextDisabled("Grid.Renders: %zu", my_grid_renders);
+		ImGui::TextDisabled("Minimap.Renders: %zu", my_minimap_renders);
 
 		if ( my_hovered_node != nullptr )
 		{
@@ -348,10 +577,103 @@ ImNodeGraph::DrawDebug()
 }
 
 
-ImDrawListSplitter&
-ImNodeGraph::GetDrawListSplitter()
+void
+ImNodeGraph::DrawLinkAggregates()
+{
+	if ( my_link_aggregates.empty() )
+		return;
+
+	ImDrawList*  draw_list = ImGui::GetWindowDrawList();
+	ImVec2  offset = GetGridPosOnScreen();
+	size_t  count = my_link_aggregates.size();
+
+	std::sort(my_link_aggregates.begin(), my_link_aggregates.end());
+
+	for ( size_t i = 0; i < count; )
+	{
+		const link_aggregate&  agg = my_link_aggregates[i];
+		size_t  num = 1;
+		size_t  links = agg.count;
+
+		while ( i + num < count
+		     && my_link_aggregates[i + num].first == agg.first
+		     && my_link_aggregates[i + num].second == agg.second )
+		{
+			links += my_link_aggregates[i + num].count;
+			num++;
+		}
+
+		ImVec2  p1 = offset + agg.first->GetPosition() + agg.first->GetSize() * 0.5f;
+		ImVec2  p2 = offset + agg.second->GetPosition() + agg.second->GetSize() * 0.5f;
+		float   thickness = std::min(1.f + (links - 1) * 0.5f, 4.f);
+
+		draw_list->AddLine(p1, p2, agg.colour, thickness);
+
+		i += num;
+	}
+}
+
+
+void
+ImNodeGraph::DrawMinimap()
+{
+	if ( my_minimap_rect.GetArea() <= 0.f )
+		return;
+
+	if ( my_minimap_generation != my_generation
+	  || !my_minimap_texture.IsCreated()
+	  || my_minimap_texture.GetWidth() != settings.minimap_style.size )
+	{
+		RenderMinimap();
+	}
+	if ( !my_minimap_texture.IsCreated() )
+		return;
+
+	ImDrawList*  draw_list = ImGui::GetWindowDrawList();
+	auto&        colours = settings.minimap_style.colours;
+
+	draw_list->AddRectFilled(my_minimap_rect.Min, my_minimap_rect.Max, colours.background);
+	draw_list->AddImage(my_minimap_texture.GetTexRef(), my_minimap_rect.Min, my_minimap_rect.Max);
+	draw_list->AddRect(my_minimap_rect.Min, my_minimap_rect.Max, colours.border);
+
+	/*
+	 * The visible area, mapped into the minimap; clipped, as the view can
+	 * extend beyond (or be entirely outside) the nodes
+	 */
+	ImVec2  view_min = my_canvas.GetOrigin() - GetGridPosOnScreen();
+	ImVec2  view_max = view_min + my_canvas.GetSize();
+	float   scale = my_minimap_rect.GetWidth() / my_minimap_area.GetWidth();
+	ImVec2  min = my_minimap_rect.Min + (view_min - my_minimap_area.Min) * scale;
+	ImVec2  max = my_minimap_rect.Min + (view_max - my_minimap_area.Min) * scale;
+
+	min = ImClamp(min, my_minimap_rect.Min, my_minimap_rect.Max);
+	max = ImClamp(max, my_minimap_rect.Min, my_minimap_rect.Max);
+
+	if ( max.x > min.x && max.y > min.y )
+	{
+		draw_list->AddRect(min, max, colours.viewport);
+	}
+}
+
+
+NodeGraphDetail
+ImNodeGraph::GetDetailLevel(
+	const ImVec2& size
+) const
 {
-	return my_dl_splitter;
+	/*
+	 * Without zoom enabled, nodes are drawn at their full size whatever the
+	 * scale (the zoom keys still adjust it), so only account for it if on
+	 */
+	float  scale = my_canvas.configuration.zoom_enabled ? my_canvas.Scale() : 1.f;
+	float  extent = std::min(size.x, size.y) * scale;
+
+	if ( extent < my_canvas.configuration.lod_aggregate_size )
+		return NodeGraphDetail::Aggregated;
+	if ( extent < my_canvas.configuration.lod_simple_size )
+		return NodeGraphDetail::Simplified;
+
+	return NodeGraphDetail::Full;
 }
 
 
@@ -364,6 +686,19 @@ ImNodeGraph::GetGridPosOnScreen(
 }
 
 
+std::shared_ptr<Link>
+ImNodeGraph::GetLink(
+	const trezanik::core::UUID& id
+)
+{
+	auto  iter = my_link_ids.find(id);
+	if ( iter == my_link_ids.end() )
+		return nullptr;
+
+	return my_links[iter->second];
+}
+
+
 bool
 ImNodeGraph::GetMousePosOnGrid(
 	ImVec2& out
@@ -377,6 +712,43 @@ ImNodeGraph::GetMousePosOnGrid(
 }
 
 
+std::shared_ptr<BaseNode>
+ImNodeGraph::GetNode(
+	const trezanik::core::UUID& id
+)
+{
+	auto  iter = my_node_ids.find(id);
+	if ( iter == my_node_ids.end() )
+		return nullptr;
+
+	return my_nodes[iter->second];
+}
+
+
+ImRect
+ImNodeGraph::GetViewOnGrid() const
+{
+	// generous; covers pin sockets, hover capture and link text overhang
+	const float  margin = 64.f;
+
+	/*
+	 * Nodes and pins are drawn at their position plus the grid offset, so the
+	 * inverse is applied here rather than that of GetGridPosOnScreen
+	 */
+	ImVec2  offset = GetGridPosOnScreen();
+	ImVec2  min = my_canvas.GetOrigin() - offset;
+	/*
+	 * The canvas covers its size divided by the scale in grid units; node
+	 * geometry is not yet scaled when drawn though, so never cover less than
+	 * the plain size, or zooming in would cull nodes still on screen
+	 */
+	ImVec2  extent = ImMax(my_canvas.GetSize() / my_canvas.Scale(), my_canvas.GetSize());
+	ImVec2  max = min + extent;
+
+	return ImRect(min.x - margin, min.y - margin, max.x + margin, max.y + margin);
+}
+
+
 bool
 ImNodeGraph::HasFocus() const
 {
@@ -390,25 +762,39 @@ ImNodeGraph::MouseOnFreeSpace()
 	if ( !my_window_has_focus )
 		return false;
 
-	return std::all_of(
-		my_nodes.begin(), my_nodes.end(), [](const auto& n) {
-			// pins count as free space, unless we loop all them here too; debating!
-			return !n->IsHovered();
-		}
-	)
-	&& std::all_of(
-		my_links.begin(), my_links.end(), [](const auto& l) {
-			return !l->IsHovered();
-		}
-	);
+	ImVec2  mouse_pos = ImGui::GetMousePos() - GetGridPosOnScreen();
+
+	my_node_query.clear();
+	my_node_index.QueryPoint(mouse_pos, my_node_query);
+
+	// pins count as free space, unless we check all them here too; debating!
+	for ( auto& n : my_node_query )
+	{
+		if ( n->IsHovered() )
+			return false;
+	}
+
+	my_link_query.clear();
+	my_link_index.QueryPoint(mouse_pos, my_link_query);
+
+	for ( auto& l : my_link_query )
+	{
+		if ( l->IsHovered() )
+			return false;
+	}
+
+	return true;
 }
 
 
 bool
 ImNodeGraph::MouseOnSelectedNode()
 {
+	my_node_query.clear();
+	my_node_index.QueryPoint(ImGui::GetMousePos() - GetGridPosOnScreen(), my_node_query);
+
 	return std::any_of(
-		my_nodes.begin(), my_nodes.end(), [](const auto& n) {
+		my_node_query.begin(), my_node_query.end(), [](BaseNode* n) {
 			return n->IsSelected() && n->IsHovered();
 		}
 	);
@@ -417,13 +803,14 @@ ImNodeGraph::MouseOnSelectedNode()
 
 void
 ImNodeGraph::RemoveLink(
-	std::shared_ptr<Link> link
+	std::shared_ptr<Link> link,
+	bool notify
 )
 {
 	using namespace trezanik::core;
 
-	auto  iter = std::find(my_links.begin(), my_links.end(), link);
-	if ( iter == my_links.end() )
+	auto  iter = my_link_ids.find(link->GetID());
+	if ( iter == my_link_ids.end() || my_links[iter->second] != link )
 	{
 		TZK_LOG_FORMAT(LogLevel::Warning, "Unable to find link %s", link->GetID().GetCanonical());
 		return;
@@ -433,14 +820,117 @@ ImNodeGraph::RemoveLink(
 	link->Source()->RemoveLink(link);
 	link->Target()->RemoveLink(link);
 
-	EventData::node_graph_update  nu{NodeGraphUpdate::LinkDeleted, link->Source()->GetAttachedNode()->GetNodegraph()};
-	nu.opt.link_uuid = link->GetID();
-	ServiceLocator::EventDispatcher()->DispatchEvent(uuid_nodegraph_update, nu);
+	if ( notify )
+	{
+		EventData::node_graph_update  nu{NodeGraphUpdate::LinkDeleted, link->Source()->GetAttachedNode()->GetNodegraph()};
+		nu.opt.link_uuid = link->GetID();
+		ServiceLocator::EventDispatcher()->DispatchEvent(uuid_nodegraph_update, nu);
+	}
 
 	TZK_LOG_FORMAT(LogLevel::Info, "Link %s (%s->%s) removed", link->GetID().GetCanonical(),
 		link->Source()->GetID().GetCanonical(), link->Target()->GetID().GetCanonical()
 	);
-	my_links.erase(iter);
+	my_link_index.Remove(link.get());
+	my_generation++;
+
+	// swap-and-pop; link order has no meaning, unlike nodes
+	size_t  pos = iter->second;
+	size_t  last = my_links.size() - 1;
+
+	my_link_ids.erase(iter);
+	if ( pos != last )
+	{
+		my_links[pos] = std::move(my_links[last]);
+		my_link_ids[my_links[pos]->GetID()] = pos;
+	}
+	my_links.pop_back();
+}
+
+
+void
+ImNodeGraph::RefreshSpatialIndex()
+{
+	if ( !my_dirty_nodes.empty() )
+	{
+		my_generation++;
+	}
+
+	for ( auto& n : my_dirty_nodes )
+	{
+		// removed nodes are purged from this list before release
+		if ( my_node_ids.find(n->GetID()) == my_node_ids.end() )
+			continue;
+
+		my_node_index.Update(n, ImRect(n->GetPosition(), n->GetPosition() + n->GetSize()));
+
+		for ( auto& p : n->GetPins() )
+		{
+			for ( auto& l : p->GetLinks() )
+			{
+				if ( my_link_index.Contains(l.get()) )
+				{
+					my_link_index.Update(l.get(), l->GetGridBounds());
+				}
+			}
+		}
+	}
+	my_dirty_nodes.clear();
+
+	if ( my_selected_link != nullptr && my_link_index.Contains(my_selected_link.get()) )
+	{
+		my_link_index.Update(my_selected_link.get(), my_selected_link->GetGridBounds());
+	}
+}
+
+
+void
+ImNodeGraph::RefreshZOrder()
+{
+	if ( my_z_raised.empty() )
+		return;
+
+	TZK_PROFILE_ZONE("ImNodeGraph::RefreshZOrder");
+
+	std::unordered_set<BaseNode*>  raised(my_z_raised.begin(), my_z_raised.end());
+
+	for ( auto& layer : my_z_layers )
+	{
+		layer.clear();
+	}
+
+	// everything not raised keeps its relative order within its layer
+	for ( auto& n : my_z_order )
+	{
+		if ( raised.count(n.get()) == 0 )
+		{
+			my_z_layers[ZLayerOf(n.get())].push_back(std::move(n));
+		}
+	}
+	// then raised nodes on top, in the order first raised
+	for ( auto& n : my_z_raised )
+	{
+		if ( raised.erase(n) == 0 )
+			continue;
+
+		auto  iter = my_node_ids.find(n->GetID());
+		if ( iter != my_node_ids.end() )
+		{
+			my_z_layers[ZLayerOf(n)].push_back(my_nodes[iter->second]);
+		}
+	}
+	my_z_raised.clear();
+
+	my_z_order.clear();
+	my_z_position.clear();
+	for ( auto& layer : my_z_layers )
+	{
+		for ( auto& n : layer )
+		{
+			my_z_position[n.get()] = my_z_order.size();
+			my_z_order.push_back(std::move(n));
+		}
+		layer.clear();
+	}
 }
 
 
@@ -461,6 +951,239 @@ ImNodeGraph::RemoveNodeFromSelection(
 }
 
 
+void
+ImNodeGraph::RemovePendingNodes(
+	std::vector<BaseNode*>& deletions
+)
+{
+	using namespace trezanik::core;
+
+	if ( deletions.empty() )
+		return;
+
+	for ( auto& n : deletions )
+	{
+		for ( auto& p : n->GetPins() )
+		{
+			/*
+			 * remove from nodegraph first; shared_ptr stays alive, enabling the
+			 * notification routine to accurately update the pins + links held
+			 * in the linked nodes if they're being kept alive.
+			 * RemoveLink modifies the pins collection, so iterate a copy. A
+			 * link between two deleted nodes is gone from both pins after its
+			 * first removal, so is never seen twice.
+			 */
+			std::vector<std::shared_ptr<Link>>  links = p->GetLinks();
+
+			for ( auto& l : links )
+			{
+				TZK_LOG_FORMAT(LogLevel::Debug, "Node has live link: %s", l->GetID().GetCanonical());
+				RemoveLink(l);
+			}
+		}
+	}
+
+	std::sort(deletions.begin(), deletions.end());
+
+	auto  is_deleted = [&deletions](BaseNode* n) {
+		return std::binary_search(deletions.begin(), deletions.end(), n);
+	};
+
+	for ( auto& n : deletions )
+	{
+		TZK_LOG_FORMAT(LogLevel::Debug, "Removing node: %s", n->GetID().GetCanonical());
+		my_node_index.Remove(n);
+	}
+
+	// no raw pointer references can remain once the shared_ptrs are released
+	my_dirty_nodes.erase(
+		std::remove_if(my_dirty_nodes.begin(), my_dirty_nodes.end(), is_deleted),
+		my_dirty_nodes.end()
+	);
+	my_drag_selected.erase(
+		std::remove_if(my_drag_selected.begin(), my_drag_selected.end(), is_deleted),
+		my_drag_selected.end()
+	);
+	my_z_raised.erase(
+		std::remove_if(my_z_raised.begin(), my_z_raised.end(), is_deleted),
+		my_z_raised.end()
+	);
+	my_selection_pending.erase(
+		std::remove_if(my_selection_pending.begin(), my_selection_pending.end(), is_deleted),
+		my_selection_pending.end()
+	);
+	my_proxy_links.erase(
+		std::remove_if(my_proxy_links.begin(), my_proxy_links.end(), [&is_deleted](const link_aggregate& agg) {
+			return is_deleted(agg.first) || is_deleted(agg.second);
+		}),
+		my_proxy_links.end()
+	);
+
+	// the z-order is the draw order, so compacted in one stable pass
+	my_z_order.erase(
+		std::remove_if(my_z_order.begin(), my_z_order.end(), [&is_deleted](const std::shared_ptr<BaseNode>& n) {
+			return is_deleted(n.get());
+		}),
+		my_z_order.end()
+	);
+	my_z_position.clear();
+	for ( size_t i = 0; i < my_z_order.size(); i++ )
+	{
+		my_z_position[my_z_order[i].get()] = i;
+	}
+
+	/*
+	 * my_nodes has no meaningful order, so swap-and-pop. This releases our
+	 * last reference; the node is not touched again once popped.
+	 * Pending destruction already advised, no further notifications needed
+	 */
+	for ( auto& n : deletions )
+	{
+		auto  iter = my_node_ids.find(n->GetID());
+		if ( iter == my_node_ids.end() )
+		{
+			// should never hit - we only just looked up this node!
+			TZK_DEBUG_BREAK;
+			continue;
+		}
+
+		size_t  pos = iter->second;
+		size_t  last = my_nodes.size() - 1;
+
+		my_node_ids.erase(iter);
+		if ( pos != last )
+		{
+			my_nodes[pos] = std::move(my_nodes[last]);
+			my_node_ids[my_nodes[pos]->GetID()] = pos;
+		}
+		my_nodes.pop_back();
+	}
+
+	my_generation++;
+}
+
+
+void
+ImNodeGraph::RenderGrid(
+	int length
+)
+{
+	using namespace trezanik::core;
+
+	TZK_PROFILE_ZONE("ImNodeGraph::RenderGrid");
+
+	// whole blocks of 256 pixels, never shrinking, so resizing rarely recreates
+	int  width = std::max(my_grid_texture.GetWidth(), (length + 255) & ~255);
+
+	if ( my_grid_texture.GetWidth() != width )
+	{
+		if ( my_grid_texture.Create(width, 4) != ErrNONE )
+			return;
+	}
+
+	ImU32*  pixels = my_grid_texture.GetPixels();
+	const grid_colours&  colours = settings.grid_style.colours;
+	int  size = settings.grid_style.size;
+	int  sub_step = settings.grid_style.subdivisions > 0 ? size / settings.grid_style.subdivisions : 0;
+
+	for ( int x = 0; x < width; x++ )
+	{
+		ImU32  major = (x % size == 0) ? colours.primary : IM_COL32_BLACK_TRANS;
+		// minor lines are drawn at every step, coincident major lines included
+		ImU32  minor = (sub_step > 0 && x % sub_step == 0) ? BlendOver(major, colours.secondary) : major;
+
+		pixels[x] = pixels[width + x] = major;
+		pixels[width * 2 + x] = pixels[width * 3 + x] = minor;
+	}
+
+	my_grid_texture.Upload();
+	my_grid_texture_style = settings.grid_style;
+	my_grid_renders++;
+
+	TZK_LOG_FORMAT(LogLevel::Trace, "Grid texture rendered; %d pixel pattern", width);
+}
+
+
+void
+ImNodeGraph::RenderMinimap()
+{
+	using namespace trezanik::core;
+
+	TZK_PROFILE_ZONE("ImNodeGraph::RenderMinimap");
+
+	int  size = settings.minimap_style.size;
+
+	if ( my_minimap_texture.GetWidth() != size || my_minimap_texture.GetHeight() != size )
+	{
+		if ( my_minimap_texture.Create(size, size) != ErrNONE )
+			return;
+	}
+
+	ImU32*  pixels = my_minimap_texture.GetPixels();
+
+	// the panel background is drawn separately, so retains its own alpha
+	std::fill(pixels, pixels + size * size, IM_COL32_BLACK_TRANS);
+
+	ImRect  bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+	for ( auto& n : my_nodes )
+	{
+		bounds.Add(ImRect(n->GetPosition(), n->GetPosition() + n->GetSize()));
+	}
+	if ( my_nodes.empty() )
+	{
+		bounds = ImRect(0.f, 0.f, 1.f, 1.f);
+	}
+
+	// square, so the aspect ratio is retained; padded so edge nodes are clear
+	float   extent = std::max(bounds.GetWidth(), bounds.GetHeight()) * 1.1f + 1.f;
+	ImVec2  half(extent * 0.5f, extent * 0.5f);
+
+	my_minimap_area = ImRect(bounds.GetCenter() - half, bounds.GetCenter() + half);
+
+	float   scale = size / extent;
+	ImVec2  origin = my_minimap_area.Min;
+
+	auto  centre_of = [&origin, scale](BaseNode* n) {
+		return (n->GetPosition() + n->GetSize() * 0.5f - origin) * scale;
+	};
+
+	// links beneath nodes
+	for ( auto& l : my_links )
+	{
+		BaseNode*  src = l->Source()->GetAttachedNode();
+		BaseNode*  tgt = l->Target()->GetAttachedNode();
+
+		PlotLine(pixels, size, size, centre_of(src), centre_of(tgt), settings.minimap_style.colours.link);
+	}
+	for ( auto& agg : my_proxy_links )
+	{
+		PlotLine(pixels, size, size, centre_of(agg.first), centre_of(agg.second), settings.minimap_style.colours.link);
+	}
+
+	for ( auto& n : my_nodes )
+	{
+		ImU32  colour = n->GetStatusColour();
+
+		if ( colour == IM_COL32_BLACK_TRANS )
+		{
+			colour = n->GetStyle()->bg;
+		}
+		// nodes are tiny at this scale, and a translucent one vanishes entirely
+		colour |= IM_COL32_A_MASK;
+
+		ImVec2  min = (n->GetPosition() - origin) * scale;
+		ImVec2  max = (n->GetPosition() + n->GetSize() - origin) * scale;
+
+		FillPixels(pixels, size, size, ImRect(min, max), colour);
+	}
+
+	my_minimap_texture.Upload();
+	my_minimap_generation = my_generation;
+	my_minimap_renders++;
+}
+
+
 void
 ImNodeGraph::ReplaceSelectedNodes(
 	std::shared_ptr<BaseNode> node
@@ -520,11 +1243,23 @@ ImNodeGraph::SelectNextNode()
 }
 
 
+void
+ImNodeGraph::SetProxyLinks(
+	std::vector<link_aggregate> links
+)
+{
+	my_proxy_links = std::move(links);
+	my_generation++;
+}
+
+
 void // return int for change count, use it to skip frame rendering?
 ImNodeGraph::Update()
 {
 	using namespace trezanik::core;
 
+	TZK_PROFILE_ZONE("ImNodeGraph::Update");
+
 	bool  clear_drag_state = false;
 
 	my_hovered_link = nullptr;
@@ -535,8 +1270,7 @@ ImNodeGraph::Update()
 	// Pre-Frame actions
 	{
 		// node cleanup each frame
-		std::vector<trezanik::core::UUID>   node_deletions;
-		std::vector<std::pair<bool, std::shared_ptr<Link>>>  link_deletions;
+		std::vector<BaseNode*>  node_deletions;
 		// selected nodes update each frame (nodes remember their state)
 		my_selected_nodes.clear();
 		my_selected_link = nullptr;
@@ -546,33 +1280,16 @@ ImNodeGraph::Update()
 			if ( n->IsPendingDestruction() )
 			{
 				TZK_LOG_FORMAT(LogLevel::Debug, "Node pending destruction: '%s'", n->GetID().GetCanonical());
-				node_deletions.push_back(n->GetID());
-
-				for ( auto& link : my_links )
-				{
-					bool  is_source = link->Source()->GetAttachedNode() == n.get();
-					bool  is_target = link->Target()->GetAttachedNode() == n.get();
-					if ( is_source || is_target )
-					{
-						TZK_LOG_FORMAT(LogLevel::Debug, "Node has live link: %s", link->GetID().GetCanonical());
-						link_deletions.push_back({ is_source, link });
-					}
-				}
+				node_deletions.push_back(n.get());
 			}
 			else if ( n->IsSelected() )
 			{
 				my_selected_nodes.push_back(n);
 			}
 		}
-		for ( auto& d : link_deletions )
-		{
-			/*
-			 * remove from nodegraph first; shared_ptr stays alive, enabling the
-			 * notification routine to accurately update the pins + links held
-			 * in the linked nodes if they're being kept alive
-			 */
-			RemoveLink(d.second);
-		}
+		RemovePendingNodes(node_deletions);
+		RefreshZOrder();
+
 		for ( auto& l : my_links )
 		{
 			if ( l->IsSelected() )
@@ -581,23 +1298,7 @@ ImNodeGraph::Update()
 				break;
 			}
 		}
-		for ( auto& d : node_deletions )
-		{
-			TZK_LOG_FORMAT(LogLevel::Debug, "Removing node: %s", d.GetCanonical());
-			auto  res = std::find_if(my_nodes.begin(), my_nodes.end(), [&d](const auto& n) {
-				return n->GetID() == d;
-			});
-			if ( res != my_nodes.end() )
-			{
-				// Pending destruction already advised, no further notifications needed
-				my_nodes.erase(res);
-			}
-			else
-			{
-				// should never hit - we only just looked up this node!
-				TZK_DEBUG_BREAK;
-			}
-		}
+		RefreshSpatialIndex();
 		
 
 		bool  canvas_hovered = my_canvas.IsHovered();
@@ -655,6 +1356,9 @@ ImNodeGraph::Update()
 
 	Draw();
 
+	// before nodes, so it has first claim on the mouse
+	UpdateMinimap();
+
 
 	// handle full unselection before node handling
 	if ( !my_selected_nodes.empty()
@@ -675,12 +1379,55 @@ ImNodeGraph::Update()
 //  Nodes
 // ###########
 
-	ImDrawList*  draw_list = ImGui::GetWindowDrawList();
-	my_dl_splitter.Split(draw_list, NodeGraphChannel_TOTAL);
+	/*
+	 * Only nodes within view are updated (and therefore drawn). Selected nodes
+	 * always are, as they must follow a drag and handle deletion even while
+	 * off-screen. Results are returned to z-order and drawn in that single
+	 * pass; each node is drawn complete, so layering needs no draw list
+	 * splitting.
+	 * As the lowest node is updated first, clicks are instead directed to the
+	 * topmost node under the mouse, determined up front.
+	 */
+	ImRect     view = GetViewOnGrid();
+	BaseNode*  click_target = nullptr;
+	size_t     click_target_z = 0;
+
+	my_node_query.clear();
+	my_node_index.QueryPoint(ImGui::GetMousePos() - GetGridPosOnScreen(), my_node_query);
+	for ( auto& n : my_node_query )
+	{
+		auto  iter = my_z_position.find(n);
+		if ( iter != my_z_position.end() && (click_target == nullptr || iter->second > click_target_z) )
+		{
+			click_target = n;
+			click_target_z = iter->second;
+		}
+	}
 
+	my_node_query.clear();
+	my_node_index.Query(view, my_node_query);
+	my_update_order.clear();
+	for ( auto& n : my_selected_nodes )
+	{
+		my_node_query.push_back(n.get());
+	}
+	for ( auto& n : my_node_query )
+	{
+		// nodes added mid-frame are not placed until the next
+		auto  iter = my_z_position.find(n);
+		if ( iter != my_z_position.end() )
+		{
+			my_update_order.push_back(iter->second);
+		}
+	}
+	std::sort(my_update_order.begin(), my_update_order.end());
+	my_update_order.erase(std::unique(my_update_order.begin(), my_update_order.end()), my_update_order.end());
+	my_nodes_updated = my_update_order.size();
 	
-	for ( auto& node : my_nodes )
+	for ( auto idx : my_update_order )
 	{
+		auto&  node = my_z_order[idx];
+
 #if 0
 		const std::string&  type = node->Typename();
 		const std::string*  name = node->GetName();
@@ -719,7 +1466,7 @@ ImNodeGraph::Update()
 		 * hover from anywhere to drag out - might have knock-on effects
 		 * elsewhere though.
 		 */
-		if ( my_hovered_pin == nullptr && node->IsHovered() )
+		if ( my_hovered_pin == nullptr && node->IsHovered() && node.get() == click_target )
 		{
 			// left click on hovered node = selection change
 			if ( !ImGui::IsKeyDown(ImGuiKey_LeftCtrl) )
@@ -809,22 +1556,96 @@ ImNodeGraph::Update()
 		 * on release, stop drawing rect, retain selection list
 		 */
 	}
-	// re-loop to apply the selected value states to the nodes (dislike, but works!)
-	for ( auto& node : my_nodes )
+	/*
+	 * Apply the selected value states to the nodes (dislike, but works!).
+	 * Only nodes with a selection change pending have anything to commit,
+	 * and they may be anywhere - unselected by a click on another node, or
+	 * externally - so they're tracked rather than found by query
+	 */
+	for ( auto& node : my_selection_pending )
 	{
 		node->UpdateComplete();
 	}
-
-	my_dl_splitter.Merge(draw_list);
+	my_selection_pending.clear();
 
 // ###########
 //  Links
 // ###########
 
-	for ( auto& link : my_links )
+	// nodes moved this frame also move their links
+	RefreshSpatialIndex();
+
+	my_link_query.clear();
+	my_link_index.Query(view, my_link_query);
+	my_update_order.clear();
+	for ( auto& l : my_link_query )
+	{
+		my_update_order.push_back(my_link_ids[l->GetID()]);
+	}
+	if ( my_selected_link != nullptr )
+	{
+		auto  iter = my_link_ids.find(my_selected_link->GetID());
+
+		// always updated, so a click elsewhere will unselect it
+		if ( iter != my_link_ids.end() )
+		{
+			my_update_order.push_back(iter->second);
+		}
+	}
+	std::sort(my_update_order.begin(), my_update_order.end());
+	my_update_order.erase(std::unique(my_update_order.begin(), my_update_order.end()), my_update_order.end());
+
+	// held for the duration, as a link can remove itself from the graph
+	my_link_aggregates.clear();
+	for ( auto idx : my_update_order )
+	{
+		auto&      link = my_links[idx];
+		BaseNode*  src = link->Source()->GetAttachedNode();
+		BaseNode*  tgt = link->Target()->GetAttachedNode();
+
+		/*
+		 * Both ends too small to tell apart - draw once per node pair. The
+		 * selected link is exempt, so a click elsewhere still unselects it
+		 */
+		if ( link != my_selected_link
+		  && GetDetailLevel(src->GetSize()) == NodeGraphDetail::Aggregated
+		  && GetDetailLevel(tgt->GetSize()) == NodeGraphDetail::Aggregated )
+		{
+			link_aggregate  agg;
+			agg.first = src < tgt ? src : tgt;
+			agg.second = src < tgt ? tgt : src;
+			agg.colour = link->Target()->GetStyle()->socket_colour;
+			agg.count = 1;
+			my_link_aggregates.push_back(agg);
+			continue;
+		}
+
+		my_update_links.push_back(link);
+	}
+	for ( auto& agg : my_proxy_links )
+	{
+		ImRect  bounds(agg.first->GetPosition(), agg.first->GetPosition() + agg.first->GetSize());
+		bounds.Add(ImRect(agg.second->GetPosition(), agg.second->GetPosition() + agg.second->GetSize()));
+
+		if ( bounds.Overlaps(view) )
+		{
+			my_link_aggregates.push_back(agg);
+		}
+	}
+	my_links_updated = my_update_links.size();
+	for ( auto& link : my_update_links )
 	{
 		link->Update();
 	}
+	my_update_links.clear();
+
+	DrawLinkAggregates();
+
+// ###########
+//  Minimap
+// ###########
+
+	DrawMinimap();
 
 // ###########
 //  Popups
@@ -842,6 +1663,7 @@ ImNodeGraph::Update()
 	 */
 	if ( my_popup
 	  && !my_rclick_was_dragging_prerelease
+	  && !my_minimap_hovered
 	  && my_canvas.IsHovered()
 	  && ImGui::IsMouseReleased(ImGuiMouseButton_Right) )
 	{
@@ -909,6 +1731,71 @@ ImNodeGraph::Update()
 }
 
 
+void
+ImNodeGraph::UpdateMinimap()
+{
+	my_minimap_hovered = false;
+	my_minimap_rect = ImRect();
+
+	if ( !settings.minimap_style.draw || my_nodes.empty() )
+	{
+		my_minimap_dragging = false;
+		return;
+	}
+
+	ImVec2  size(static_cast<float>(settings.minimap_style.size), static_cast<float>(settings.minimap_style.size));
+	ImVec2  margin(settings.minimap_style.margin, settings.minimap_style.margin);
+	ImVec2  max = my_canvas.GetOrigin() + my_canvas.GetSize() - margin;
+	ImVec2  min = max - size;
+
+	// no room; the minimap would obscure most of the graph
+	if ( min.x < my_canvas.GetOrigin().x + margin.x || min.y < my_canvas.GetOrigin().y + margin.y )
+	{
+		my_minimap_dragging = false;
+		return;
+	}
+
+	my_minimap_rect = ImRect(min, max);
+
+	ImVec2  mouse_pos = ImGui::GetMousePos();
+	bool    other_drag = my_dragging_node || IsSelectDragging() || IsLinkDragging();
+
+	if ( my_minimap_dragging )
+	{
+		if ( !ImGui::IsMouseDown(ImGuiMouseButton_Left) )
+		{
+			my_minimap_dragging = false;
+		}
+	}
+	else if ( !other_drag && ClickAvailable(ImGuiMouseButton_Left) && my_minimap_rect.Contains(mouse_pos) )
+	{
+		ConsumeClick(ImGuiMouseButton_Left);
+		my_minimap_dragging = true;
+	}
+
+	my_minimap_hovered = my_minimap_dragging
+		|| (!other_drag && my_canvas.IsHovered() && my_minimap_rect.Contains(mouse_pos));
+
+	if ( my_minimap_hovered )
+	{
+		// nothing beneath the minimap is to react to the mouse
+		my_window_has_focus = false;
+	}
+
+	// area is unknown until first rendered
+	if ( my_minimap_dragging && my_minimap_area.GetWidth() > 0.f )
+	{
+		ImVec2  pos = ImClamp(mouse_pos, my_minimap_rect.Min, my_minimap_rect.Max);
+		ImVec2  target = my_minimap_area.Min + (pos - my_minimap_rect.Min) * (my_minimap_area.GetWidth() / my_minimap_rect.GetWidth());
+		ImVec2  origin = my_canvas.GetOrigin();
+		float   scale = my_canvas.Scale();
+
+		// the inverse of GetViewOnGrid, with target as the view centre
+		my_canvas.SetScroll((origin + my_canvas.GetSize() * 0.5f - target) / scale - origin);
+	}
+}
+
+
 void
 ImNodeGraph::UpdateSelectionDragging()
 {
@@ -922,6 +1809,13 @@ ImNodeGraph::UpdateSelectionDragging()
 		ConsumeClick(ImGuiMouseButton_Left);
 		my_dragging_selection_next = true;
 
+		// existing selection is replaced unless within the selection rect
+		my_drag_selected.clear();
+		for ( auto& n : my_selected_nodes )
+		{
+			my_drag_selected.push_back(n.get());
+		}
+
 		my_drag_start = ImGui::GetMousePos();
 		TZK_LOG_FORMAT(LogLevel::Trace, "Starting drag-selection from (%d,%d)", static_cast<int32_t>(my_drag_start.x), static_cast<int32_t>(my_drag_start.y));
 	}
@@ -937,12 +1831,25 @@ ImNodeGraph::UpdateSelectionDragging()
 		auto   max = ImMax(my_drag_start, mouse_pos);
 		my_drag_selection = ImRect(min, max);
 
-		for ( auto& n : my_nodes )
+		ImVec2  offset = GetGridPosOnScreen();
+
+		my_node_query.clear();
+		my_node_index.Query(ImRect(min - offset, max - offset), my_node_query);
+		std::sort(my_node_query.begin(), my_node_query.end());
+		
+		// only those previously within the rect can need unselecting
+		for ( auto& n : my_drag_selected )
+		{
+			if ( !std::binary_search(my_node_query.begin(), my_node_query.end(), n) )
+			{
+				n->Selected(false);
+			}
+		}
+		for ( auto& n : my_node_query )
 		{
-			n->Selected(my_drag_selection.Overlaps(
-				ImRect(GetGridPosOnScreen(n->Position()), GetGridPosOnScreen(n->Position() + n->Size()))
-			));
+			n->Selected(true);
 		}
+		my_drag_selected.swap(my_node_query);
 
 		float  rounding = 0.f;
 		ImGui::GetWindowDrawList()->AddRect(min, max,
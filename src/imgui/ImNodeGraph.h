@@ -22,6 +22,8 @@ TZK_CC_DISABLE_WARNING(-Wcomment) // multi-line comment, third-party
 #include "imgui/imgui_bezier_math.h"
 TZK_CC_RESTORE_WARNING
 #include "imgui/ImNodeGraphLink.h"
+#include "imgui/SpatialGrid.h"
+#include "imgui/UserTexture.h"
 
 #include "core/UUID.h"
 
@@ -29,6 +31,7 @@ TZK_CC_RESTORE_WARNING
 #include <functional>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 
 namespace trezanik {
@@ -115,6 +118,36 @@ struct grid_settings
 };
 
 
+/**
+ * Colours for the minimap
+ */
+struct minimap_colours
+{
+	ImU32  background = 0; ///< panel background
+	ImU32  border = 0;     ///< panel outline
+	ImU32  link = 0;       ///< link lines; baked into the cached image
+	ImU32  viewport = 0;   ///< outline of the area visible in the canvas
+};
+
+/**
+ * Style settings for the minimap
+ */
+struct minimap_settings
+{
+	/** Boolean for actually drawing the minimap */
+	bool  draw = true;
+
+	/** Width and height of the minimap, in pixels */
+	int  size = 200;
+
+	/** Distance from the bottom-right corner of the canvas, in pixels */
+	float  margin = 10.f;
+
+	/** structure containing the minimap colours */
+	minimap_colours  colours;
+};
+
+
 /* 
  * Chucked here for now, see if there's a better location in future
  * 
@@ -258,21 +291,43 @@ struct context_popup
 
 
 /**
- * Sorter for nodes based on their (imgui) channel
+ * Layers of the node z-order, bottom to top
  * 
- * Lower channel values must be last, so the items destined for 'top' are drawn
- * first (noting that with same channel values, the last item to be drawn will
- * appear on top of the others, but be *last* for selection. This is
- * intentional!)
+ * Selected nodes always appear above unselected ones; nodes configured for
+ * NodeGraphChannel_Bottom sit beneath all others while unselected. Within a
+ * layer, the last node raised is on top.
  */
-struct channel_sort
+enum NodeGraphLayer_ : int
 {
-	bool operator()(
-		const std::shared_ptr<BaseNode> lhs,
-		const std::shared_ptr<BaseNode> rhs
+	NodeGraphLayer_Bottom = 0,  ///< Unselected nodes in NodeGraphChannel_Bottom
+	NodeGraphLayer_Regular,     ///< All other unselected nodes
+	NodeGraphLayer_Selected,    ///< Selected nodes
+	NodeGraphLayer_TOTAL        ///< Layer count; do not use
+};
+
+
+/**
+ * A node pair whose links are drawn as one
+ *
+ * Used at the lowest level of detail, and for proxy links standing in for
+ * links to nodes that are not present in the graph.
+ */
+struct link_aggregate
+{
+	/// the lower-addressed node of the pair
+	BaseNode*  first;
+	/// the higher-addressed node of the pair
+	BaseNode*  second;
+	/// line colour; taken from the target pin style of the first link seen
+	ImU32  colour;
+	/// number of links represented
+	uint32_t  count;
+
+	bool operator<(
+		const link_aggregate& rhs
 	) const
 	{
-		return lhs->GetChannel() > rhs->GetChannel();
+		return first < rhs.first || (first == rhs.first && second < rhs.second);
 	}
 };
 
@@ -297,9 +352,6 @@ private:
 	/// The canvas the nodes and grid are drawn on
 	Canvas  my_canvas;
 
-	/// Draw list splitter for merging draw calls
-	ImDrawListSplitter  my_dl_splitter;
-
 	/// Pointer to the presently hovered node
 	BaseNode*  my_hovered_node;
 
@@ -342,8 +394,8 @@ private:
 	/**
 	 * All created nodes that are displayed on the grid
 	 * 
-	 * Sorting is used for z-priority ordering, so those with lesser channel
-	 * values will update (and therefore handle interaction with) last
+	 * Unordered; removal moves the last node into the vacated position. Draw
+	 * order is held in my_z_order.
 	 */
 	std::vector<std::shared_ptr<BaseNode>>  my_nodes;
 
@@ -373,6 +425,99 @@ private:
 	/// true if right click was previously dragging before right release. reset each check
 	bool  my_rclick_was_dragging_prerelease;
 
+	/// Spatial index of all node bounds, in grid co-ordinates
+	SpatialGrid<BaseNode>  my_node_index;
+
+	/// Spatial index of all link bounds, in grid co-ordinates
+	SpatialGrid<Link>  my_link_index;
+
+	/// Nodes moved or resized since the spatial indexes were last refreshed
+	std::vector<BaseNode*>  my_dirty_nodes;
+
+	/// Position of each node within my_nodes, keyed by node ID
+	std::unordered_map<trezanik::core::UUID, size_t>  my_node_ids;
+
+	/// Position of each link within my_links, keyed by link ID
+	std::unordered_map<trezanik::core::UUID, size_t>  my_link_ids;
+
+	/// Nodes selected by the in-progress drag selection, as of the last frame
+	std::vector<BaseNode*>  my_drag_selected;
+
+	/// Reusable container for node query results
+	std::vector<BaseNode*>  my_node_query;
+
+	/// Reusable container for link query results
+	std::vector<Link*>  my_link_query;
+
+	/// Reusable container for the order positions of items to update
+	std::vector<size_t>  my_update_order;
+
+	/// Reusable container holding the links being updated this frame
+	std::vector<std::shared_ptr<Link>>  my_update_links;
+
+	/// Reusable container for the node pairs of links aggregated this frame
+	std::vector<link_aggregate>  my_link_aggregates;
+
+	/// Links drawn between nodes on behalf of links absent from the graph
+	std::vector<link_aggregate>  my_proxy_links;
+
+	/// All nodes in draw order, bottom to top; rebuilt only when a node is raised
+	std::vector<std::shared_ptr<BaseNode>>  my_z_order;
+
+	/// Position of each node within my_z_order
+	std::unordered_map<BaseNode*, size_t>  my_z_position;
+
+	/// Nodes raised (created, selected, unselected or dragged) since the z-order was built
+	std::vector<BaseNode*>  my_z_raised;
+
+	/// Nodes with a selection change awaiting BaseNode::UpdateComplete
+	std::vector<BaseNode*>  my_selection_pending;
+
+	/// Reusable per-layer containers for rebuilding the z-order
+	std::vector<std::shared_ptr<BaseNode>>  my_z_layers[NodeGraphLayer_TOTAL];
+
+	/// Number of nodes updated (not culled) in the last frame
+	size_t  my_nodes_updated;
+
+	/// Number of links updated (not culled) in the last frame
+	size_t  my_links_updated;
+
+	/**
+	 * Incremented whenever a node or link is added, removed, moved, resized
+	 * or changes appearance; cached renderings compare against it
+	 */
+	uint64_t  my_generation;
+
+	/// Cached grid line patterns, stretched across the canvas when drawn
+	UserTexture  my_grid_texture;
+
+	/// The grid style the grid texture was last rendered with
+	grid_settings  my_grid_texture_style;
+
+	/// Number of times the grid texture has been rendered
+	size_t  my_grid_renders;
+
+	/// Cached rendering of all nodes and links, drawn as the minimap
+	UserTexture  my_minimap_texture;
+
+	/// The value of my_generation when the minimap texture was last rendered
+	uint64_t  my_minimap_generation;
+
+	/// Grid area depicted by the minimap texture, in grid co-ordinates
+	ImRect  my_minimap_area;
+
+	/// Screen area occupied by the minimap this frame; empty if not shown
+	ImRect  my_minimap_rect;
+
+	/// true if the mouse is over the minimap, which takes it from the graph
+	bool  my_minimap_hovered;
+
+	/// true while the canvas is being panned by dragging within the minimap
+	bool  my_minimap_dragging;
+
+	/// Number of times the minimap texture has been rendered
+	size_t  my_minimap_renders;
+
 
 	/**
 	 * Adds a link between two pins to the graph
@@ -393,6 +538,9 @@ private:
 		std::shared_ptr<T>  link = std::make_shared<T>(std::forward<Params>(args)...);
 
 		my_links.emplace_back(link);
+		my_link_ids[link->GetID()] = my_links.size() - 1;
+		my_link_index.Update(link.get(), link->GetGridBounds());
+		my_generation++;
 
 		return link;
 	}
@@ -422,9 +570,13 @@ private:
 		node->SetNodegraph(this);
 
 		my_nodes.emplace_back(node);
-
-		// sort once, per each node addition. Not every frame or on timer!
-		std::sort(my_nodes.begin(), my_nodes.end(), channel_sort());
+		my_node_ids[node->GetID()] = my_nodes.size() - 1;
+		my_dirty_nodes.push_back(node.get());
+		// new nodes go on top of their layer
+		my_z_raised.push_back(node.get());
+		// commits any selection made before the graph was assigned
+		my_selection_pending.push_back(node.get());
+		my_generation++;
 
 		return node;
 	}
@@ -446,6 +598,120 @@ private:
 	);
 
 
+	/**
+	 * Draws the links collected in my_link_aggregates
+	 *
+	 * Each distinct node pair is drawn as a single straight line between the
+	 * node centres, thickened slightly with the number of links it stands in
+	 * for. None are interactive. Proxy links within view are included.
+	 */
+	void
+	DrawLinkAggregates();
+
+
+	/**
+	 * Draws the minimap over the bottom-right of the canvas
+	 *
+	 * The cached texture is re-rendered first if the graph has changed since
+	 * it was last; otherwise the cost is the one textured quad, plus the panel
+	 * outline and the rectangle marking the visible area.
+	 */
+	void
+	DrawMinimap();
+
+
+	/**
+	 * Obtains the visible canvas area in grid co-ordinates
+	 *
+	 * Expanded by a margin, so elements drawn partially beyond their bounds
+	 * (pins, hover highlights) are not culled while still on screen
+	 *
+	 * @return
+	 *  The viewing area
+	 */
+	ImRect
+	GetViewOnGrid() const;
+
+
+	/**
+	 * Brings the spatial indexes up to date
+	 *
+	 * Applies all pending node bound changes, along with the links attached to
+	 * those nodes. The selected link is always refreshed, as its control
+	 * points and method are editable externally.
+	 */
+	void
+	RefreshSpatialIndex();
+
+
+	/**
+	 * Rebuilds the z-order, if any nodes have been raised
+	 *
+	 * Each node is placed in its layer; nodes not raised retain their relative
+	 * order, with raised nodes placed above them in the order raised. No work
+	 * is done on frames without changes.
+	 */
+	void
+	RefreshZOrder();
+
+
+	/**
+	 * Renders the grid line patterns into the grid texture
+	 *
+	 * Lines run the full height or width of the canvas, so each direction is
+	 * described by a single row of pixels along the other axis; the vertical
+	 * and horizontal lines share the same row, sampled along x and y
+	 * respectively. Rows 0-1 hold the major lines alone, rows 2-3 the minor
+	 * lines composited over them. Each row is duplicated so the filtered
+	 * sample between the pair never picks up the neighbouring pattern.
+	 *
+	 * The pattern repeats every grid size, and is extended to cover the
+	 * requested length plus one repeat; the renderer backends clamp rather
+	 * than wrap texture co-ordinates, so the scroll offset is applied by
+	 * starting part way into the row instead.
+	 *
+	 * @param[in] length
+	 *  The minimum pattern length needed, in pixels. The texture is recreated
+	 *  only if this exceeds its current width, and then rounded up so window
+	 *  resizing does not recreate it every frame
+	 */
+	void
+	RenderGrid(
+		int length
+	);
+
+
+	/**
+	 * Renders every node and link into the minimap texture
+	 *
+	 * The depicted area is the bounds of all nodes, squared up and padded,
+	 * held in my_minimap_area for mapping between the minimap and the grid.
+	 * Nodes are filled with their status colour if they have one, otherwise
+	 * their style background; links are single-pixel lines between centres.
+	 * The texture is (re)created if the configured size has changed.
+	 */
+	void
+	RenderMinimap();
+
+
+	/**
+	 * Removes all nodes pending destruction, and every link attached to them
+	 *
+	 * Links are found through the pins of each node rather than searching the
+	 * full link collection, and both links and nodes are removed in constant
+	 * time each. Cost is therefore proportional to the deleted nodes and their
+	 * links, plus one pass over the z-order, regardless of how many nodes are
+	 * deleted at once.
+	 *
+	 * @param[in] deletions
+	 *  The nodes pending destruction, in any order
+	 */
+	void
+	RemovePendingNodes(
+		std::vector<BaseNode*>& deletions
+	);
+
+
 	/**
 	 * Replaces all selected nodes with the one supplied
 	 *
@@ -502,6 +768,19 @@ private:
 	UpdateLinkDragging();
 
 
+	/**
+	 * Handles mouse interaction with the minimap
+	 *
+	 * Determines the minimap placement for this frame. Clicking within it
+	 * centres the canvas on the corresponding grid position, continuing to
+	 * follow the mouse while the button is held. While hovered (and no other
+	 * drag is in progress), the graph is treated as unfocused so nodes and
+	 * links beneath the minimap do not react to the mouse.
+	 */
+	void
+	UpdateMinimap();
+
+
 	/**
 	 * Handles initiation of and selection within dragging on the graph
 	 */
@@ -522,6 +801,7 @@ public:
 	 */
 	struct {
 		grid_settings  grid_style;
+		minimap_settings  minimap_style;
 		int   link_default_method = static_cast<int>(LinkMethod::CubicBezier);
 		bool  node_draw_headers = false;
 		bool  node_drag_from_headers_only = false;
@@ -534,7 +814,11 @@ public:
 	 */
 	ImNodeGraph();
 
-	~ImNodeGraph() = default;
+
+	/**
+	 * Standard destructor
+	 */
+	~ImNodeGraph();
 	
 
 	/**
@@ -671,6 +955,10 @@ public:
 	/**
 	 * Draws the canvas, grid, and all nodes & links within
 	 * 
+	 * The grid is drawn as two textured quads, one for each line direction,
+	 * from a cached texture that is only re-rendered when the grid style
+	 * changes or the canvas outgrows it.
+	 * 
 	 * Needs to be called once per frame
 	 */
 	void
@@ -687,6 +975,24 @@ public:
 	DrawDebug();
 
 
+	/**
+	 * Determines the level of detail an item of the supplied size is drawn at
+	 * 
+	 * Based on the on-screen size of its shortest side at the current scale,
+	 * against the canvas configuration thresholds. The scale is only applied
+	 * while zooming is enabled; otherwise items are always drawn in full
+	 * 
+	 * @param[in] size
+	 *  The node size, in grid units
+	 * @return
+	 *  The level of detail to draw with
+	 */
+	NodeGraphDetail
+	GetDetailLevel(
+		const ImVec2& size
+	) const;
+
+
 	/**
 	 * Acquires the canvas
 	 * 
@@ -700,16 +1006,6 @@ public:
 	}
 
 
-	/**
-	 * Acquires the Draw List splitter
-	 *
-	 * @return
-	 *  Reference to the splitter object
-	 */
-	ImDrawListSplitter&
-	GetDrawListSplitter();
-
-
 	/**
 	 * Gets the arbritary 'position' on the screen from a grid point
 	 * 
@@ -795,6 +1091,20 @@ public:
 	}
 
 
+	/**
+	 * Obtains the link with the specified ID
+	 * 
+	 * @param[in] id
+	 *  The unique ID of the link
+	 * @return
+	 *  The shared_ptr to the link if found, otherwise nullptr
+	 */
+	std::shared_ptr<Link>
+	GetLink(
+		const trezanik::core::UUID& id
+	);
+
+
 	/**
 	 * Gets a reference to the vector of links
 	 * 
@@ -829,6 +1139,20 @@ public:
 	) const;
 
 
+	/**
+	 * Obtains the node with the specified ID
+	 * 
+	 * @param[in] id
+	 *  The unique ID of the node
+	 * @return
+	 *  The shared_ptr to the node if found, otherwise nullptr
+	 */
+	std::shared_ptr<BaseNode>
+	GetNode(
+		const trezanik::core::UUID& id
+	);
+
+
 	/**
 	 * All nodes getter
 	 * 
@@ -855,6 +1179,20 @@ public:
 	}
 
 
+	/**
+	 * Gets a reference to the proxy links
+	 * 
+	 * @return
+	 *  A const reference to the links drawn on behalf of those absent from
+	 *  the graph, as last supplied to SetProxyLinks
+	 */
+	const std::vector<link_aggregate>&
+	GetProxyLinks() const
+	{
+		return my_proxy_links;
+	}
+
+
 	/**
 	 * All selected nodes getter
 	 * 
@@ -971,7 +1309,8 @@ public:
 	/**
 	 * Determines if the mouse is on a 'free' space in the canvas
 	 *
-	 * Presently uses hover detection on all Nodes and Links (note: NOT Pins)
+	 * Presently uses hover detection on the Nodes and Links at the mouse
+	 * position, via the spatial indexes (note: NOT Pins)
 	 *
 	 * @return
 	 *  Boolean state
@@ -990,15 +1329,116 @@ public:
 	MouseOnSelectedNode();
 
 
+	/**
+	 * Notifies the graph that the appearance of a node has changed
+	 *
+	 * Used for changes that alter summary renderings of the graph, such as
+	 * the minimap, without affecting the node bounds - a new style or status
+	 * colour.
+	 *
+	 * @param[in] node
+	 *  Raw pointer to the node
+	 */
+	void
+	NodeAppearanceChanged(
+		BaseNode* TZK_UNUSED(node)
+	)
+	{
+		my_generation++;
+	}
+
+
+	/**
+	 * Notifies the graph that a node has been moved or resized
+	 *
+	 * The spatial index, and that of all attached links, is updated prior to
+	 * the next use. Must be called by anything modifying a nodes position,
+	 * size or pin placement.
+	 *
+	 * @param[in] node
+	 *  Raw pointer to the node
+	 */
+	void
+	NodeBoundsChanged(
+		BaseNode* node
+	)
+	{
+		my_dirty_nodes.push_back(node);
+	}
+
+
+	/**
+	 * Notifies the graph that a node is to be brought to the top of its layer
+	 *
+	 * Invoked as a node is selected, unselected or starts being dragged; the
+	 * z-order is rebuilt at the start of the next update.
+	 *
+	 * @param[in] node
+	 *  Raw pointer to the node
+	 */
+	void
+	NodeRaised(
+		BaseNode* node
+	)
+	{
+		my_z_raised.push_back(node);
+	}
+
+
+	/**
+	 * Notifies the graph that a node has a selection change to commit
+	 *
+	 * Invoked as a node is selected or unselected; BaseNode::UpdateComplete
+	 * is called for it once all nodes have been updated this frame.
+	 *
+	 * @param[in] node
+	 *  Raw pointer to the node
+	 */
+	void
+	NodeSelectionPending(
+		BaseNode* node
+	)
+	{
+		my_selection_pending.push_back(node);
+	}
+
+
 	/**
 	 * Removes the supplied link from the graph
 	 * 
+	 * Constant time; the final link is moved into the vacated position, so
+	 * link order is not retained.
+	 * 
 	 * @param[in] link
 	 *  The link to remove
+	 * @param[in] notify
+	 *  If false, no LinkDeleted notification is dispatched; for links being
+	 *  withdrawn from display while their data remains, such as those of
+	 *  nodes collapsed into a group
 	 */
 	void
 	RemoveLink(
-		std::shared_ptr<Link> link
+		std::shared_ptr<Link> link,
+		bool notify = true
+	);
+
+
+	/**
+	 * Replaces the set of proxy links
+	 *
+	 * Proxy links are drawn as aggregated links, but represent links that are
+	 * not present in the graph at all - such as those to members of a
+	 * collapsed group, drawn to the node standing in for the group. They are
+	 * not interactive, and are culled against the view like any other link.
+	 *
+	 * Any proxy link referencing a node is dropped when the node is removed.
+	 *
+	 * @param[in] links
+	 *  The proxy links; each pair should appear once, with its count
+	 */
+	void
+	SetProxyLinks(
+		std::vector<link_aggregate> links
 	);
 
 
@@ -13,6 +13,7 @@
 #include "core/services/log/Log.h"
 
 #include <algorithm>
+#include <cfloat>
 
 
 namespace trezanik {
@@ -160,6 +161,7 @@ Link::Link(
 , my_selected(false)
 , my_method(method)
 , my_control_points(control_points)
+, my_draw_method(LinkMethod::Invalid)
 {
 	using namespace trezanik::core;
 
@@ -208,6 +210,40 @@ Link::AddControlPoint(
 }
 
 
+void
+Link::CommitGeometry(
+	const ImVec2& start,
+	const ImVec2& end
+)
+{
+	link_geometry&  g = my_geometry;
+
+	g.bounds = ImRect(ImVec2(FLT_MAX, FLT_MAX), ImVec2(-FLT_MAX, -FLT_MAX));
+	for ( auto& p : g.points )
+	{
+		g.bounds.Add(p);
+	}
+
+	g.span = end - start;
+	g.source_relpos = my_source->GetRelativePosition();
+	g.target_relpos = my_target->GetRelativePosition();
+	g.scale = my_ctx->GetCanvas().Scale();
+	g.tessellation_tol = ImGui::GetStyle().CurveTessellationTol;
+	g.method = my_draw_method;
+
+	if ( g.method == LinkMethod::MultiLinePoint )
+	{
+		g.control_points = *my_control_points;
+	}
+	else
+	{
+		g.control_points.clear();
+	}
+
+	g.valid = true;
+}
+
+
 void
 Link::DeleteControlPoint(
 	ImVec2& point
@@ -277,173 +313,195 @@ Link::DrawCubicBezier()
 
 
 	ImDrawList*  dl = ImGui::GetWindowDrawList();
-	float   distance = sqrt(pow((end.x - start.x), 2.f) + pow((end.y - start.y), 2.f));
-	float   delta = distance * 0.45f;
+
+	if ( !GeometryIsCurrent(start, end) )
+	{
+		float   distance = sqrt(pow((end.x - start.x), 2.f) + pow((end.y - start.y), 2.f));
+		float   delta = distance * 0.45f;
 #if 0
-	bool    start_left = my_source->GetRelativePosition().x == 0.f;
-	bool    end_left = my_target->GetRelativePosition().x == 0.f;
+		bool    start_left = my_source->GetRelativePosition().x == 0.f;
+		bool    end_left = my_target->GetRelativePosition().x == 0.f;
 #endif
-	float   vert = 0.f;
-	ImVec2  control_point_1, control_point_2;
-
-	enum LinkDragPos_ : uint8_t
-	{
-		LinkDragPos_Unset = 0,
-		LinkDragPos_StartLeft = 1 << 0,
-		LinkDragPos_EndLeft = 1 << 1,
-		LinkDragPos_StartTop = 1 << 2,
-		LinkDragPos_EndTop = 1 << 3,
-		LinkDragPos_StartRight = 1 << 4,
-		LinkDragPos_EndRight = 1 << 5,
-		LinkDragPos_StartBottom = 1 << 6,
-		LinkDragPos_EndBottom = 1 << 7
-	};
-	typedef uint8_t  LinkDragPos;
-
-	LinkDragPos  drag_pos = LinkDragPos_Unset;
-
-	if ( my_source->GetRelativePosition().x == 0.f )
-		drag_pos |= LinkDragPos_StartLeft;
-	if ( my_source->GetRelativePosition().x == 1.f )
-		drag_pos |= LinkDragPos_StartRight;
-	if ( my_source->GetRelativePosition().y == 0.f )
-		drag_pos |= LinkDragPos_StartTop;
-	if ( my_source->GetRelativePosition().y == 1.f )
-		drag_pos |= LinkDragPos_StartBottom;
-	if ( my_target->GetRelativePosition().x == 0.f )
-		drag_pos |= LinkDragPos_EndLeft;
-	if ( my_target->GetRelativePosition().x == 1.f )
-		drag_pos |= LinkDragPos_EndRight;
-	if ( my_target->GetRelativePosition().y == 0.f )
-		drag_pos |= LinkDragPos_EndTop;
-	if ( my_target->GetRelativePosition().y == 1.f )
-		drag_pos |= LinkDragPos_EndBottom;
-
-
-	if ( drag_pos & LinkDragPos_StartLeft )
-	{
-		control_point_1 = start - ImVec2(delta, vert);
-
-		if ( drag_pos & LinkDragPos_EndLeft )
-		{
-			control_point_2 = end - ImVec2(delta, vert);
-		}
-		else if ( drag_pos & LinkDragPos_EndRight )
-		{
-			control_point_2 = end + ImVec2(delta, vert);
-		}
-		else if ( drag_pos & LinkDragPos_EndTop )
-		{
-			control_point_2 = end - ImVec2(vert, delta);
-		}
-		else if ( drag_pos & LinkDragPos_EndBottom )
-		{
-			control_point_2 = end + ImVec2(vert, delta);
-		}
-	}
-	else if ( drag_pos & LinkDragPos_StartTop )
-	{
-		control_point_1 = start - ImVec2(vert, delta);
+		float   vert = 0.f;
+		ImVec2  control_point_1, control_point_2;
 
-		if ( drag_pos & LinkDragPos_EndLeft )
-		{
-			control_point_2 = end - ImVec2(delta, vert);
-		}
-		else if ( drag_pos & LinkDragPos_EndRight )
+		enum LinkDragPos_ : uint8_t
 		{
-			control_point_2 = end + ImVec2(delta, vert);
-		}
-		else if ( drag_pos & LinkDragPos_EndTop )
+			LinkDragPos_Unset = 0,
+			LinkDragPos_StartLeft = 1 << 0,
+			LinkDragPos_EndLeft = 1 << 1,
+			LinkDragPos_StartTop = 1 << 2,
+			LinkDragPos_EndTop = 1 << 3,
+			LinkDragPos_StartRight = 1 << 4,
+			LinkDragPos_EndRight = 1 << 5,
+			LinkDragPos_StartBottom = 1 << 6,
+			LinkDragPos_EndBottom = 1 << 7
+		};
+		typedef uint8_t  LinkDragPos;
+
+		LinkDragPos  drag_pos = LinkDragPos_Unset;
+
+		if ( my_source->GetRelativePosition().x == 0.f )
+			drag_pos |= LinkDragPos_StartLeft;
+		if ( my_source->GetRelativePosition().x == 1.f )
+			drag_pos |= LinkDragPos_StartRight;
+		if ( my_source->GetRelativePosition().y == 0.f )
+			drag_pos |= LinkDragPos_StartTop;
+		if ( my_source->GetRelativePosition().y == 1.f )
+			drag_pos |= LinkDragPos_StartBottom;
+		if ( my_target->GetRelativePosition().x == 0.f )
+			drag_pos |= LinkDragPos_EndLeft;
+		if ( my_target->GetRelativePosition().x == 1.f )
+			drag_pos |= LinkDragPos_EndRight;
+		if ( my_target->GetRelativePosition().y == 0.f )
+			drag_pos |= LinkDragPos_EndTop;
+		if ( my_target->GetRelativePosition().y == 1.f )
+			drag_pos |= LinkDragPos_EndBottom;
+
+
+		if ( drag_pos & LinkDragPos_StartLeft )
 		{
-			control_point_2 = end - ImVec2(vert, delta);
-		}
-		else if ( drag_pos & LinkDragPos_EndBottom )
-		{
-			control_point_2 = end + ImVec2(vert, delta);
-		}
-	}
-	else if ( drag_pos & LinkDragPos_StartBottom )
-	{
-		control_point_1 = start + ImVec2(vert, delta);
+			control_point_1 = start - ImVec2(delta, vert);
 
-		if ( drag_pos & LinkDragPos_EndLeft )
-		{
-			control_point_2 = end - ImVec2(delta, vert);
-		}
-		else if ( drag_pos & LinkDragPos_EndRight )
-		{
-			control_point_2 = end + ImVec2(delta, vert);
-		}
-		else if ( drag_pos & LinkDragPos_EndTop )
-		{
-			control_point_2 = end - ImVec2(vert, delta);
+			if ( drag_pos & LinkDragPos_EndLeft )
+			{
+				control_point_2 = end - ImVec2(delta, vert);
+			}
+			else if ( drag_pos & LinkDragPos_EndRight )
+			{
+				control_point_2 = end + ImVec2(delta, vert);
+			}
+			else if ( drag_pos & LinkDragPos_EndTop )
+			{
+				control_point_2 = end - ImVec2(vert, delta);
+			}
+			else if ( drag_pos & LinkDragPos_EndBottom )
+			{
+				control_point_2 = end + ImVec2(vert, delta);
+			}
 		}
-		else if ( drag_pos & LinkDragPos_EndBottom )
+		else if ( drag_pos & LinkDragPos_StartTop )
 		{
-			control_point_2 = end + ImVec2(vert, delta);
-		}
-	}
-	else if ( drag_pos & LinkDragPos_StartRight )
-	{
-		control_point_1 = start + ImVec2(delta, vert);
+			control_point_1 = start - ImVec2(vert, delta);
 
-		if ( drag_pos & LinkDragPos_EndLeft )
-		{
-			control_point_2 = end - ImVec2(delta, vert);
-		}
-		else if ( drag_pos & LinkDragPos_EndRight )
-		{
-			control_point_2 = end + ImVec2(delta, vert);
+			if ( drag_pos & LinkDragPos_EndLeft )
+			{
+				control_point_2 = end - ImVec2(delta, vert);
+			}
+			else if ( drag_pos & LinkDragPos_EndRight )
+			{
+				control_point_2 = end + ImVec2(delta, vert);
+			}
+			else if ( drag_pos & LinkDragPos_EndTop )
+			{
+				control_point_2 = end - ImVec2(vert, delta);
+			}
+			else if ( drag_pos & LinkDragPos_EndBottom )
+			{
+				control_point_2 = end + ImVec2(vert, delta);
+			}
 		}
-		else if ( drag_pos & LinkDragPos_EndTop )
+		else if ( drag_pos & LinkDragPos_StartBottom )
 		{
-			control_point_2 = end - ImVec2(vert, delta);
+			control_point_1 = start + ImVec2(vert, delta);
+
+			if ( drag_pos & LinkDragPos_EndLeft )
+			{
+				control_point_2 = end - ImVec2(delta, vert);
+			}
+			else if ( drag_pos & LinkDragPos_EndRight )
+			{
+				control_point_2 = end + ImVec2(delta, vert);
+			}
+			else if ( drag_pos & LinkDragPos_EndTop )
+			{
+				control_point_2 = end - ImVec2(vert, delta);
+			}
+			else if ( drag_pos & LinkDragPos_EndBottom )
+			{
+				control_point_2 = end + ImVec2(vert, delta);
+			}
 		}
-		else if ( drag_pos & LinkDragPos_EndBottom )
+		else if ( drag_pos & LinkDragPos_StartRight )
 		{
-			control_point_2 = end + ImVec2(vert, delta);
+			control_point_1 = start + ImVec2(delta, vert);
+
+			if ( drag_pos & LinkDragPos_EndLeft )
+			{
+				control_point_2 = end - ImVec2(delta, vert);
+			}
+			else if ( drag_pos & LinkDragPos_EndRight )
+			{
+				control_point_2 = end + ImVec2(delta, vert);
+			}
+			else if ( drag_pos & LinkDragPos_EndTop )
+			{
+				control_point_2 = end - ImVec2(vert, delta);
+			}
+			else if ( drag_pos & LinkDragPos_EndBottom )
+			{
+				control_point_2 = end + ImVec2(vert, delta);
+			}
 		}
-	}
 
-	/*
-	 * I need help applying this to the top/bottom start/end.
-	 * Outside of creating an abomination of a branch structure, I have no idea
-	 * how to implement the proper algorithm.
-	 * 
-	 * Cubic beziers are therefore 'funky' if starting/ending on a top or bottom
-	 * of a node. They still reach their target, but the path is questionable..
-	 */
+		/*
+		 * I need help applying this to the top/bottom start/end.
+		 * Outside of creating an abomination of a branch structure, I have no idea
+		 * how to implement the proper algorithm.
+		 * 
+		 * Cubic beziers are therefore 'funky' if starting/ending on a top or bottom
+		 * of a node. They still reach their target, but the path is questionable..
+		 */
 #if 0
-	if ( !start_left )
-	{
-		if ( end_left )
-		{
-			// start right, end left
-			control_point_2 = end - ImVec2(delta, vert);
-		}
-		else
-		{
-			// start right, end right
-			control_point_2 = end + ImVec2(delta, vert);
-		}
-		control_point_1 = start + ImVec2(delta, vert);
-	}
-	else
-	{
-		if ( end_left )
+		if ( !start_left )
 		{
-			// start left, end left
-			control_point_2 = end - ImVec2(delta, vert);
+			if ( end_left )
+			{
+				// start right, end left
+				control_point_2 = end - ImVec2(delta, vert);
+			}
+			else
+			{
+				// start right, end right
+				control_point_2 = end + ImVec2(delta, vert);
+			}
+			control_point_1 = start + ImVec2(delta, vert);
 		}
 		else
 		{
-			// start left, end right
-			control_point_2 = end + ImVec2(delta, vert);
+			if ( end_left )
+			{
+				// start left, end left
+				control_point_2 = end - ImVec2(delta, vert);
+			}
+			else
+			{
+				// start left, end right
+				control_point_2 = end + ImVec2(delta, vert);
+			}
+			control_point_1 = start - ImVec2(delta, vert);
 		}
-		control_point_1 = start - ImVec2(delta, vert);
-	}
 #endif
-	if ( ImProjectOnCubicBezier(ImGui::GetMousePos(), start, control_point_1, control_point_2, end).Distance < radius )
+
+		my_geometry.bezier_points[0] = control_point_1 - start;
+		my_geometry.bezier_points[1] = control_point_2 - start;
+
+		// imgui tessellation, so the result is identical to AddBezierCubic
+		dl->PathLineTo(ImVec2(0.f, 0.f));
+		dl->PathBezierCubicCurveTo(my_geometry.bezier_points[0], my_geometry.bezier_points[1], end - start);
+		my_geometry.points.assign(dl->_Path.begin(), dl->_Path.end());
+		dl->PathClear();
+
+		CommitGeometry(start, end);
+	}
+
+	ImVec2  mouse_pos = ImGui::GetMousePos();
+
+	// projection is costly; only performed when the mouse is near the curve
+	if ( NearGeometry(start, mouse_pos, radius)
+	  && ImProjectOnCubicBezier(mouse_pos, start,
+		start + my_geometry.bezier_points[0], start + my_geometry.bezier_points[1], end
+	  ).Distance < radius )
 	{
 		my_hovered = true;
 
@@ -460,7 +518,7 @@ Link::DrawCubicBezier()
 		my_hovered = false;
 	}
 
-	dl->AddBezierCubic(start, control_point_1, control_point_2, end,
+	StrokeGeometry(dl, start,
 		my_target->GetStyle()->socket_colour,
 		my_hovered ? thickness + my_target->GetStyle()->link_hovered_extra_thickness : thickness
 	);
@@ -480,6 +538,15 @@ Link::DrawDirect()
 		my_selected = false;
 	}
 
+	if ( !GeometryIsCurrent(start, end) )
+	{
+		my_geometry.points.clear();
+		my_geometry.points.push_back(ImVec2(0.f, 0.f));
+		my_geometry.points.push_back(end - start);
+
+		CommitGeometry(start, end);
+	}
+
 	// can't figure out point intersection, but we can make it a line and use that!
 	ImVec2  mpos1 = ImGui::GetMousePos();
 	mpos1.x += thickness;
@@ -488,7 +555,7 @@ Link::DrawDirect()
 	mpos2.x -= thickness;
 	mpos2.y -= thickness;
 
-	if ( LinesIntersect(start, end, mpos1, mpos2) )
+	if ( NearGeometry(start, ImGui::GetMousePos(), thickness) && LinesIntersect(start, end, mpos1, mpos2) )
 	{
 		my_hovered = true;
 
@@ -521,7 +588,8 @@ Link::DrawMultiLinePoint()
 	 */
 
 	ImDrawList*  dl = ImGui::GetWindowDrawList();
-	ImVec2  last = my_source->PinPoint();
+	ImVec2  start = my_source->PinPoint();
+	ImVec2  end = my_target->PinPoint();
 	float   thickness = my_selected ? my_target->GetStyle()->link_selected_thickness : my_target->GetStyle()->link_thickness;
 	ImU32   socket_colour = my_target->GetStyle()->socket_colour;
 	bool    mouse_lclick_state = my_ctx->ClickAvailable(ImGuiMouseButton_Left);
@@ -531,58 +599,65 @@ Link::DrawMultiLinePoint()
 		my_selected = false;
 	}
 
-	ImVec2  mpos1 = ImGui::GetMousePos();
+	if ( !GeometryIsCurrent(start, end) )
+	{
+		// if no control points, this will be the equivalent of DrawDirect
+		my_geometry.points.clear();
+		my_geometry.points.push_back(ImVec2(0.f, 0.f));
+		for ( auto& cp : *my_control_points )
+		{
+			my_geometry.points.push_back(my_ctx->GetGridPosOnScreen(cp) - start);
+		}
+		my_geometry.points.push_back(end - start);
+
+		CommitGeometry(start, end);
+	}
+
+	ImVec2  mouse_pos = ImGui::GetMousePos();
+	ImVec2  mpos1 = mouse_pos;
 	mpos1.x -= thickness;
 	mpos1.y -= thickness;
-	ImVec2  mpos2 = ImGui::GetMousePos();
+	ImVec2  mpos2 = mouse_pos;
 	mpos2.x += thickness;
 	mpos2.y += thickness;
 
-	bool  any_intersect = false;
+	my_hovered = false;
 
-	auto intersect_check = [&](const ImVec2& cp){
-		if ( LinesIntersect(cp, last, mpos1, mpos2) )
-		{
-			any_intersect = true;
-			my_hovered = true;
+	/*
+	 * Every segment is tested before any are drawn, so the whole chain is
+	 * highlighted regardless of which segment is hovered
+	 */
+	if ( NearGeometry(start, mouse_pos, thickness) )
+	{
+		auto&  pts = my_geometry.points;
 
-			if ( mouse_lclick_state )
+		for ( size_t i = 1; i < pts.size(); i++ )
+		{
+			if ( LinesIntersect(start + pts[i], start + pts[i - 1], mpos1, mpos2) )
 			{
-				my_ctx->ConsumeClick(ImGuiMouseButton_Left);
-				my_selected = true;
+				my_hovered = true;
+				break;
 			}
-
-			my_ctx->HoveredLink(this);
 		}
-	};
-
-	my_hovered = false;
-
-	/*
-	 * So we can highlight every line in the chain regardless of which one is
-	 * hovered, check prior state and restore on entry.
-	 * Once all checks done, clear this if no longer hovering.
-	 * @note this is bugged for the final point-to-target, if at least 1 cp exists
-	 */
-	if ( my_ctx->GetHoveredLink() == this )
-		my_hovered = true;
+	}
 
-	for ( auto cp : *my_control_points )
+	if ( my_hovered )
 	{
-		auto  norm_pos = my_ctx->GetGridPosOnScreen(cp);
-		intersect_check(norm_pos);
-		dl->AddLine(last, norm_pos, socket_colour, my_hovered ? thickness + my_target->GetStyle()->link_hovered_extra_thickness : thickness);
-		dl->AddCircle(norm_pos, control_point_radius, socket_colour);
-		last = norm_pos;
+		if ( mouse_lclick_state )
+		{
+			my_ctx->ConsumeClick(ImGuiMouseButton_Left);
+			my_selected = true;
+		}
+
+		my_ctx->HoveredLink(this);
 	}
 
-	// if no control points, this will be the equivalent of DrawDirect
-	intersect_check(my_target->PinPoint());
-	dl->AddLine(last, my_target->PinPoint(), socket_colour, my_hovered ? thickness + my_target->GetStyle()->link_hovered_extra_thickness : thickness);
+	StrokeGeometry(dl, start, socket_colour, my_hovered ? thickness + my_target->GetStyle()->link_hovered_extra_thickness : thickness);
 
-	if ( !any_intersect )
+	// control points, excluding the pins at either end
+	for ( size_t i = 1; i + 1 < my_geometry.points.size(); i++ )
 	{
-		my_hovered = false;
+		dl->AddCircle(start + my_geometry.points[i], control_point_radius, socket_colour);
 	}
 }
 
@@ -592,35 +667,49 @@ Link::DrawQuadraticBezier()
 {
 	ImVec2  start = my_source->PinPoint();
 	ImVec2  end = my_target->PinPoint();
-	ImVec2  control_point{ end.x - start.x, end.y - start.y };
 	float   thickness = my_selected ? my_target->GetStyle()->link_selected_thickness : my_target->GetStyle()->link_thickness;
-	int     segs = 0;
-	bool    start_is_rightof_end = end.x >= start.x;
-	//bool    start_is_below_end = end.y >= start.y;
-	float   distance = sqrt(pow((start.x - end.x), 2.f) + pow((start.y - end.y), 2.f));
-	float   delta = distance * 0.45f;
-	
-	/*
-	 * can use this to determine where on the node we are/going to, and set the
-	 * initial direction based on that
-	 */
-	//my_source->GetRelativePosition().x;
+	ImDrawList* dl = ImGui::GetWindowDrawList();
 
-	/*
-	 * If start is left of end, then the control point will be on the right of start
-	 * If start is above end, then the control point will be ???
-	 */
-	if ( start_is_rightof_end )
+	if ( !GeometryIsCurrent(start, end) )
 	{
-		if ( start.x < end.x )
-			delta += 0.05f * (end.x - start.x);
-	}
-	else
-	{
-		if ( end.x < start.x )
-			delta += 0.05f * (start.x - end.x);
+		ImVec2  control_point{ end.x - start.x, end.y - start.y };
+		bool    start_is_rightof_end = end.x >= start.x;
+		//bool    start_is_below_end = end.y >= start.y;
+		float   distance = sqrt(pow((start.x - end.x), 2.f) + pow((start.y - end.y), 2.f));
+		float   delta = distance * 0.45f;
+		
+		/*
+		 * can use this to determine where on the node we are/going to, and set the
+		 * initial direction based on that
+		 */
+		//my_source->GetRelativePosition().x;
+
+		/*
+		 * If start is left of end, then the control point will be on the right of start
+		 * If start is above end, then the control point will be ???
+		 */
+		if ( start_is_rightof_end )
+		{
+			if ( start.x < end.x )
+				delta += 0.05f * (end.x - start.x);
+		}
+		else
+		{
+			if ( end.x < start.x )
+				delta += 0.05f * (start.x - end.x);
+		}
+		control_point = start_is_rightof_end ? start : end - ImVec2(delta, 0.f);
+
+		my_geometry.bezier_points[0] = control_point - start;
+
+		// imgui tessellation, so the result is identical to AddBezierQuadratic
+		dl->PathLineTo(ImVec2(0.f, 0.f));
+		dl->PathBezierQuadraticCurveTo(my_geometry.bezier_points[0], end - start);
+		my_geometry.points.assign(dl->_Path.begin(), dl->_Path.end());
+		dl->PathClear();
+
+		CommitGeometry(start, end);
 	}
-	control_point = start_is_rightof_end ? start : end - ImVec2(delta, 0.f);
 
 	/*
 	 * I know a cubic is two quadratics, so algorithms are in place; but the
@@ -632,22 +721,131 @@ Link::DrawQuadraticBezier()
 	// determine hover
 	// determine selection
 
-	ImDrawList* dl = ImGui::GetWindowDrawList();
-	dl->AddBezierQuadratic(start, control_point, end,
-		my_target->GetStyle()->socket_colour,
-		thickness,
-		segs
-	);
+	StrokeGeometry(dl, start, my_target->GetStyle()->socket_colour, thickness);
 }
 
 
+bool
+Link::GeometryIsCurrent(
+	const ImVec2& start,
+	const ImVec2& end
+) const
+{
+	const link_geometry&  g = my_geometry;
+
+	if ( !g.valid || g.method != my_draw_method )
+		return false;
+	if ( g.span != end - start )
+		return false;
+	if ( g.scale != my_ctx->GetCanvas().Scale() || g.tessellation_tol != ImGui::GetStyle().CurveTessellationTol )
+		return false;
+	if ( g.source_relpos != my_source->GetRelativePosition() || g.target_relpos != my_target->GetRelativePosition() )
+		return false;
+	if ( my_draw_method == LinkMethod::MultiLinePoint && g.control_points != *my_control_points )
+		return false;
+
+	return true;
+}
+
+
+ImRect
+Link::GetGridBounds()
+{
+	ImVec2  start = my_source->GridPoint();
+	ImVec2  end = my_target->GridPoint();
+	ImRect  retval(ImMin(start, end), ImMax(start, end));
+	auto    style = my_target->GetStyle();
+	float   pad = ImMax(control_point_radius, style->link_selected_thickness + style->link_hovered_extra_thickness);
+
+	switch ( *my_method )
+	{
+	case LinkMethod::QuadraticBezier:
+	case LinkMethod::CubicBezier:
+		{
+			/*
+			 * Control points extend out from the pins by up to half the pin
+			 * distance, and the curve never leaves their hull
+			 */
+			float  distance = sqrt(pow((end.x - start.x), 2.f) + pow((end.y - start.y), 2.f));
+			pad += distance * 0.5f;
+		}
+		break;
+	case LinkMethod::MultiLinePoint:
+		for ( auto& cp : *my_control_points )
+		{
+			retval.Add(cp);
+		}
+		break;
+	default:
+		break;
+	}
+
+	if ( my_text != nullptr && !my_text->empty() )
+	{
+		ImVec2  text_pos = BoundingBoxFor(start, end).GetCenter() + *my_text_offset;
+		retval.Add(text_pos);
+	}
+
+	// hover radius and thickness
+	retval.Expand(pad + 3.f);
+
+	return retval;
+}
+
+
+bool
+Link::NearGeometry(
+	const ImVec2& start,
+	const ImVec2& point,
+	float radius
+) const
+{
+	ImRect  bounds = my_geometry.bounds;
+
+	bounds.Translate(start);
+	bounds.Expand(radius);
+
+	return bounds.Contains(point);
+}
+
+
+void
+Link::StrokeGeometry(
+	ImDrawList* dl,
+	const ImVec2& start,
+	ImU32 colour,
+	float thickness
+)
+{
+	// the path buffer retains its capacity, so this is allocation-free
+	for ( auto& p : my_geometry.points )
+	{
+		dl->PathLineTo(start + p);
+	}
+	dl->PathStroke(colour, ImDrawFlags_None, thickness);
+}
+
 
 void
 Link::Update()
 {
 	using namespace trezanik::core;
 
-	switch ( *my_method )
+	/*
+	 * Endpoints are ordinarily recalculated as the attached nodes draw their
+	 * pins, which won't have happened if a node was culled as off-screen
+	 */
+	my_source->UpdatePinPoint();
+	my_target->UpdatePinPoint();
+
+	// curves and labels are indistinguishable once either node is this small
+	bool  full_detail =
+		my_ctx->GetDetailLevel(my_source->GetAttachedNode()->GetSize()) == NodeGraphDetail::Full &&
+		my_ctx->GetDetailLevel(my_target->GetAttachedNode()->GetSize()) == NodeGraphDetail::Full;
+
+	my_draw_method = full_detail ? *my_method : LinkMethod::Direct;
+
+	switch ( my_draw_method )
 	{
 	case LinkMethod::Direct:
 		DrawDirect();
@@ -666,7 +864,7 @@ Link::Update()
 		return;
 	}
 
-	if ( my_text != nullptr && !my_text->empty() )
+	if ( full_detail && my_text != nullptr && !my_text->empty() )
 	{
 		ImVec2  start = my_source->PinPoint();
 		ImVec2  end = my_target->PinPoint();
@@ -696,14 +894,10 @@ Link::Update()
 			my_source->GetID().GetCanonical(), my_target->GetID().GetCanonical()
 		);
 
-		for ( auto& l : my_ctx->GetLinks() )
+		auto  self = my_ctx->GetLink(my_uuid);
+		if ( self != nullptr )
 		{
-			if ( l.get() == this )
-			{
-				// iterator now broken
-				my_ctx->RemoveLink(l);
-				break;
-			}
+			my_ctx->RemoveLink(self);
 		}
 	}
 }
@@ -10,6 +10,7 @@
 
 #include "imgui/definitions.h"
 #include "imgui/dear_imgui/imgui.h"
+#include "imgui/dear_imgui/imgui_internal.h" // primarily for ImRect
 
 #include "core/UUID.h"
 
@@ -50,6 +51,50 @@ enum class LinkMethod : int
 };
 
 
+/**
+ * Cached geometry of a link, as last drawn
+ *
+ * All points are in screen units relative to the source pin point, so moving
+ * both ends by the same amount (scrolling, or dragging both nodes) does not
+ * invalidate the cache. Rebuilt only when an input to the geometry differs.
+ */
+struct link_geometry
+{
+	/// Tessellated points forming the drawn line, starting at {0,0}
+	std::vector<ImVec2>  points;
+
+	/// Bounds of all points, excluding line thickness
+	ImRect  bounds;
+
+	/// Bezier control points; cubic uses both, quadratic only the first
+	ImVec2  bezier_points[2];
+
+	/// Target pin point relative to the source, when built
+	ImVec2  span;
+
+	/// Source pin relative position on its node, when built
+	ImVec2  source_relpos;
+
+	/// Target pin relative position on its node, when built
+	ImVec2  target_relpos;
+
+	/// Explicit control points in grid co-ordinates, when built
+	std::vector<ImVec2>  control_points;
+
+	/// Canvas scale, when built
+	float  scale = 0.f;
+
+	/// Curve tessellation tolerance of the imgui style, when built
+	float  tessellation_tol = 0.f;
+
+	/// Link method the geometry was built for
+	LinkMethod  method = LinkMethod::Invalid;
+
+	/// true if the remaining members have been populated
+	bool  valid = false;
+};
+
+
 /**
  * A link between two pins that will be displayed on the node graph
  * 
@@ -92,6 +137,33 @@ private:
 	/** Location of all explicit control points for the link */
 	std::vector<ImVec2>*  my_control_points;
 
+	/** Geometry cache, rebuilt only when its inputs change */
+	link_geometry  my_geometry;
+
+	/**
+	 * Method drawn with this frame; my_method, unless reduced to Direct as
+	 * the attached nodes are below full detail
+	 */
+	LinkMethod  my_draw_method;
+
+
+	/**
+	 * Finalizes the geometry cache after its points have been replaced
+	 *
+	 * Records the inputs the geometry was built from and determines the
+	 * bounds of the points.
+	 *
+	 * @param[in] start
+	 *  The source pin point
+	 * @param[in] end
+	 *  The target pin point
+	 */
+	void
+	CommitGeometry(
+		const ImVec2& start,
+		const ImVec2& end
+	);
+
 
 	/**
 	 * Draws the link as a Cubic Bezier curve
@@ -125,6 +197,66 @@ private:
 	void
 	DrawQuadraticBezier();
 
+
+	/**
+	 * Determines if the geometry cache is valid for the current link state
+	 *
+	 * @param[in] start
+	 *  The source pin point
+	 * @param[in] end
+	 *  The target pin point
+	 * @return
+	 *  Boolean state; false if the geometry must be rebuilt
+	 */
+	bool
+	GeometryIsCurrent(
+		const ImVec2& start,
+		const ImVec2& end
+	) const;
+
+
+	/**
+	 * Determines if a point is within the cached geometry bounds
+	 *
+	 * Used to reject hover tests before performing any costly projection.
+	 *
+	 * @param[in] start
+	 *  The source pin point the geometry is relative to
+	 * @param[in] point
+	 *  The point to test, in screen co-ordinates
+	 * @param[in] radius
+	 *  The distance from the geometry still considered within
+	 * @return
+	 *  Boolean state; false if the point is definitely not on the link
+	 */
+	bool
+	NearGeometry(
+		const ImVec2& start,
+		const ImVec2& point,
+		float radius
+	) const;
+
+
+	/**
+	 * Draws the cached geometry as a single polyline
+	 *
+	 * @param[in] dl
+	 *  The draw list to add to
+	 * @param[in] start
+	 *  The source pin point the geometry is relative to
+	 * @param[in] colour
+	 *  The line colour
+	 * @param[in] thickness
+	 *  The line thickness
+	 */
+	void
+	StrokeGeometry(
+		ImDrawList* dl,
+		const ImVec2& start,
+		ImU32 colour,
+		float thickness
+	);
+
 protected:
 public:
 	/**
@@ -206,6 +338,20 @@ public:
 	}
 
 
+	/**
+	 * Gets the area covered by this link on the grid
+	 *
+	 * Encompasses both pins, all control points, the text anchor and any
+	 * curvature for bezier methods, plus the hover detection tolerance. Not
+	 * affected by scrolling; used for spatial indexing and visibility culling
+	 *
+	 * @return
+	 *  The bounding box, in grid co-ordinates
+	 */
+	ImRect
+	GetGridBounds();
+
+
 	/**
 	 * Gets the unique identifier for this link
 	 *
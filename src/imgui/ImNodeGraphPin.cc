@@ -35,6 +35,7 @@ Pin::Pin(
 , my_type(type)
 , my_parent(attached_node)
 , my_relative_pos(pos)
+, my_status_colour(0)
 , _style(style)
 , _nodegraph(node_graph)
 {
@@ -205,14 +206,27 @@ Pin::DrawSocket()
 		}
 	}
 
+	if ( my_status_colour != 0 )
+	{
+		float  status_radius = std::max(_style->socket_radius, _style->socket_hovered_radius) + _style->socket_thickness + 2.f;
+		draw_list->AddCircle(PinPoint(), status_radius, my_status_colour, 0, 2.f);
+	}
+
 	if ( ImGui::IsMouseHoveringRect(tl, br) )
 	{
 		_nodegraph->HoveredPin(this);
 
-		if ( !_tooltip.empty() )
+		if ( !_tooltip.empty() || !_status_text.empty() )
 		{
 			ImGui::BeginTooltip();
-			ImGui::Text("%s", _tooltip.c_str());
+			if ( !_tooltip.empty() )
+			{
+				ImGui::Text("%s", _tooltip.c_str());
+			}
+			if ( !_status_text.empty() )
+			{
+				ImGui::TextColored(ImGui::ColorConvertU32ToFloat4(my_status_colour), "%s", _status_text.c_str());
+			}
 			ImGui::EndTooltip();
 		}
 	}
@@ -279,6 +293,16 @@ Pin::GetStyle()
 }
 
 
+ImVec2
+Pin::GridPoint()
+{
+	auto&  ppos = my_parent->GetPosition();
+	auto&  psize = my_parent->GetSize();
+
+	return ImVec2(ppos.x + psize.x * my_relative_pos.x, ppos.y + psize.y * my_relative_pos.y);
+}
+
+
 trezanik::core::UUID
 Pin::ID()
 {
@@ -385,10 +409,25 @@ Pin::SetRelativePosition(
 	}
 
 	my_relative_pos = pos;
+
+	// attached links now terminate elsewhere
+	_nodegraph->NodeBoundsChanged(my_parent);
+
 	return true;
 }
 
 
+void
+Pin::SetStatus(
+	ImU32 colour,
+	const std::string& text
+)
+{
+	my_status_colour = colour;
+	_status_text = text;
+}
+
+
 void
 Pin::SetStyle(
 	std::shared_ptr<trezanik::imgui::PinStyle> style
@@ -430,6 +469,14 @@ Pin::Update()
 		return;
 	}
 	
+	UpdatePinPoint();
+	DrawSocket();
+}
+
+
+void
+Pin::UpdatePinPoint()
+{
 	// update the pinpoint
 	auto  ppos = my_parent->GetPosition();
 	auto  psize = my_parent->GetSize();
@@ -445,8 +492,6 @@ Pin::Update()
 
 		my_pin_point += ppos + _nodegraph->GetGridPosOnScreen({ 0.f, 0.f });
 	}
-
-	DrawSocket();
 }
 
 
@@ -418,6 +418,9 @@ private:
 	/** Resultant size of the pin after handling styling */
 	ImVec2  my_size;
 
+	/** Colour of the status ring drawn around the socket; 0 for none */
+	ImU32  my_status_colour;
+
 protected:
 
 	// no real benefit to these being weak, at least at present
@@ -440,6 +443,14 @@ protected:
 	 */
 	std::string   _tooltip;
 
+	/**
+	 * Status text appended to the tooltip, set alongside the status colour.
+	 *
+	 * Kept separate so tooltip refreshes don't discard the status, and vice
+	 * versa
+	 */
+	std::string   _status_text;
+
 public:
 	/**
 	 * Standard constructor
@@ -608,6 +619,19 @@ public:
 	GetStyle();
 
 
+	/**
+	 * Gets the position of the socket center on the grid
+	 *
+	 * Unlike PinPoint, this is calculated on demand from the parent node and
+	 * is unaffected by scrolling; used for spatial indexing
+	 *
+	 * @return
+	 *  The position in grid co-ordinates
+	 */
+	ImVec2
+	GridPoint();
+
+
 	/**
 	 * Gets a copy of this pins unique ID
 	 *
@@ -712,6 +736,26 @@ public:
 	);
 
 
+	/**
+	 * Sets the status indicated by this pin
+	 *
+	 * Used to reflect externally determined state, such as the availability
+	 * of the service the pin represents. A ring of the colour is drawn around
+	 * the socket, and the text is shown in the tooltip beneath any existing
+	 * tooltip text.
+	 *
+	 * @param[in] colour
+	 *  The status ring colour; 0 removes the indicator
+	 * @param[in] text
+	 *  The status text; empty for none
+	 */
+	void
+	SetStatus(
+		ImU32 colour,
+		const std::string& text
+	);
+
+
 	/**
 	 * Sets the style applied to this pin
 	 * 
@@ -765,6 +809,16 @@ public:
 	Update(); // make virtual interface used by others
 
 
+	/**
+	 * Recalculates the pin point from the parent node position
+	 *
+	 * Performed as part of Update; also invoked by links so their endpoints
+	 * remain correct when the parent node was culled from drawing
+	 */
+	void
+	UpdatePinPoint();
+
+
 	/** The maximum number of links this pin can have */
 	const uint8_t  max_connections = UINT8_MAX;
 };
@@ -0,0 +1,470 @@
+#pragma once
+
+/**
+ * @file        src/imgui/SpatialGrid.h
+ * @brief       Uniform grid spatial index for node graph elements
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "imgui/definitions.h"
+
+#include "imgui/dear_imgui/imgui.h"
+#include "imgui/dear_imgui/imgui_internal.h" // primarily for ImRect
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+
+namespace trezanik {
+namespace imgui {
+
+
+/**
+ * Indexes items by bounding box within a uniform grid of square cells
+ *
+ * Each item is referenced from every cell its bounds overlap, so area and
+ * point queries only examine items in the cells covered, rather than every
+ * item held. Items are not owned; the caller must Remove an item before it is
+ * destroyed.
+ *
+ * Items spanning more than the configured number of cells on either axis (in
+ * practice, long links) are held in a separate list that every query checks,
+ * preventing a single element from occupying thousands of cells.
+ *
+ * Bounds are expected in grid co-ordinates, so scrolling the canvas never
+ * requires the index to be updated; only moving or resizing an item does.
+ *
+ * Not thread-safe.
+ */
+template<typename T>
+class SpatialGrid
+{
+	TZK_NO_CLASS_ASSIGNMENT(SpatialGrid);
+	TZK_NO_CLASS_COPY(SpatialGrid);
+	TZK_NO_CLASS_MOVEASSIGNMENT(SpatialGrid);
+	TZK_NO_CLASS_MOVECOPY(SpatialGrid);
+
+private:
+
+	/**
+	 * An item reference as held within a cell
+	 *
+	 * The bounds and first cell are duplicated here so queries need no further
+	 * lookup, and an item overlapping multiple query cells is only reported
+	 * from the first of them.
+	 */
+	struct cell_item
+	{
+		/// the indexed item
+		T*      item;
+		/// the item bounds, grid co-ordinates
+		ImRect  bounds;
+		/// first cell column the item occupies
+		int     min_x;
+		/// first cell row the item occupies
+		int     min_y;
+	};
+
+	/**
+	 * Record of where an item presently resides
+	 */
+	struct item_entry
+	{
+		/// the item bounds, grid co-ordinates
+		ImRect  bounds;
+		/// first cell column
+		int   min_x;
+		/// first cell row
+		int   min_y;
+		/// last cell column
+		int   max_x;
+		/// last cell row
+		int   max_y;
+		/// true if held in the oversized list rather than the cells
+		bool  oversized;
+	};
+
+	/** Width and height of each cell, in grid units */
+	float  my_cell_size;
+
+	/** Cells an item can span on either axis before being deemed oversized */
+	int  my_max_item_cells;
+
+	/** Populated cells, keyed by packed column and row */
+	std::unordered_map<uint64_t, std::vector<cell_item>>  my_cells;
+
+	/** Every indexed item and its current placement */
+	std::unordered_map<T*, item_entry>  my_entries;
+
+	/** Items too large to be placed in cells */
+	std::vector<cell_item>  my_oversized;
+
+
+	/**
+	 * Converts a grid co-ordinate to a cell column or row
+	 *
+	 * @param[in] value
+	 *  The co-ordinate
+	 * @return
+	 *  The cell index along the axis
+	 */
+	int
+	CellCoord(
+		float value
+	) const
+	{
+		return static_cast<int>(std::floor(value / my_cell_size));
+	}
+
+
+	/**
+	 * Generates the lookup key for a cell
+	 *
+	 * @param[in] x
+	 *  The cell column
+	 * @param[in] y
+	 *  The cell row
+	 * @return
+	 *  The packed key
+	 */
+	static uint64_t
+	CellKey(
+		int x,
+		int y
+	)
+	{
+		return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+	}
+
+
+	/**
+	 * Removes an item from a container of cell items
+	 *
+	 * Order is not retained.
+	 *
+	 * @param[in] vec
+	 *  The container
+	 * @param[in] item
+	 *  The item to remove
+	 */
+	static void
+	EraseFrom(
+		std::vector<cell_item>& vec,
+		T* item
+	)
+	{
+		for ( size_t i = 0; i < vec.size(); i++ )
+		{
+			if ( vec[i].item == item )
+			{
+				vec[i] = vec.back();
+				vec.pop_back();
+				return;
+			}
+		}
+	}
+
+
+	/**
+	 * Detaches an item from all cells it currently occupies
+	 *
+	 * @param[in] item
+	 *  The item
+	 * @param[in] entry
+	 *  The items current placement
+	 */
+	void
+	Unlink(
+		T* item,
+		const item_entry& entry
+	)
+	{
+		if ( entry.oversized )
+		{
+			EraseFrom(my_oversized, item);
+			return;
+		}
+
+		for ( int y = entry.min_y; y <= entry.max_y; y++ )
+		{
+			for ( int x = entry.min_x; x <= entry.max_x; x++ )
+			{
+				auto  iter = my_cells.find(CellKey(x, y));
+				if ( iter == my_cells.end() )
+					continue;
+
+				EraseFrom(iter->second, item);
+				if ( iter->second.empty() )
+				{
+					my_cells.erase(iter);
+				}
+			}
+		}
+	}
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 *
+	 * @param[in] cell_size
+	 *  Width and height of each cell in grid units; ideally a little larger
+	 *  than the typical item
+	 * @param[in] max_item_cells
+	 *  Cells an item may span on either axis before it is held separately
+	 */
+	SpatialGrid(
+		float cell_size = 256.f,
+		int max_item_cells = 16
+	)
+	: my_cell_size(cell_size > 1.f ? cell_size : 1.f)
+	, my_max_item_cells(max_item_cells > 1 ? max_item_cells : 1)
+	{
+	}
+
+
+	/**
+	 * Standard destructor
+	 */
+	~SpatialGrid() = default;
+
+
+	/**
+	 * Removes all items from the index
+	 */
+	void
+	Clear()
+	{
+		my_cells.clear();
+		my_entries.clear();
+		my_oversized.clear();
+	}
+
+
+	/**
+	 * Determines if an item is indexed
+	 *
+	 * @param[in] item
+	 *  The item to check
+	 * @return
+	 *  Boolean state; true if present
+	 */
+	bool
+	Contains(
+		T* item
+	) const
+	{
+		return my_entries.find(item) != my_entries.end();
+	}
+
+
+	/**
+	 * Obtains all items whose bounds overlap an area
+	 *
+	 * Each item is reported once, in no particular order.
+	 *
+	 * @param[in] area
+	 *  The area to check, in grid co-ordinates
+	 * @param[out] out
+	 *  The container to append the found items to
+	 */
+	void
+	Query(
+		const ImRect& area,
+		std::vector<T*>& out
+	) const
+	{
+		for ( auto& ci : my_oversized )
+		{
+			if ( ci.bounds.Overlaps(area) )
+			{
+				out.push_back(ci.item);
+			}
+		}
+
+		int  min_x = CellCoord(area.Min.x);
+		int  min_y = CellCoord(area.Min.y);
+		int  max_x = CellCoord(area.Max.x);
+		int  max_y = CellCoord(area.Max.y);
+
+		/*
+		 * A sparsely populated grid queried over a vast area (zoomed right
+		 * out) would otherwise probe many empty cells; walking the populated
+		 * ones instead is cheaper once they're fewer
+		 */
+		int64_t  span = static_cast<int64_t>(max_x - min_x + 1) * static_cast<int64_t>(max_y - min_y + 1);
+
+		if ( span > static_cast<int64_t>(my_cells.size()) )
+		{
+			for ( auto& cell : my_cells )
+			{
+				int  cx = static_cast<int>(static_cast<uint32_t>(cell.first >> 32));
+				int  cy = static_cast<int>(static_cast<uint32_t>(cell.first & 0xFFFFFFFF));
+
+				if ( cx < min_x || cx > max_x || cy < min_y || cy > max_y )
+					continue;
+
+				for ( auto& ci : cell.second )
+				{
+					if ( cx == std::max(ci.min_x, min_x) && cy == std::max(ci.min_y, min_y) && ci.bounds.Overlaps(area) )
+					{
+						out.push_back(ci.item);
+					}
+				}
+			}
+			return;
+		}
+
+		for ( int y = min_y; y <= max_y; y++ )
+		{
+			for ( int x = min_x; x <= max_x; x++ )
+			{
+				auto  iter = my_cells.find(CellKey(x, y));
+				if ( iter == my_cells.end() )
+					continue;
+
+				for ( auto& ci : iter->second )
+				{
+					// report only from the first cell shared by item and area
+					if ( x == std::max(ci.min_x, min_x) && y == std::max(ci.min_y, min_y) && ci.bounds.Overlaps(area) )
+					{
+						out.push_back(ci.item);
+					}
+				}
+			}
+		}
+	}
+
+
+	/**
+	 * Obtains all items whose bounds contain a point
+	 *
+	 * @param[in] point
+	 *  The point to check, in grid co-ordinates
+	 * @param[out] out
+	 *  The container to append the found items to
+	 */
+	void
+	QueryPoint(
+		const ImVec2& point,
+		std::vector<T*>& out
+	) const
+	{
+		for ( auto& ci : my_oversized )
+		{
+			if ( ci.bounds.Contains(point) )
+			{
+				out.push_back(ci.item);
+			}
+		}
+
+		auto  iter = my_cells.find(CellKey(CellCoord(point.x), CellCoord(point.y)));
+		if ( iter == my_cells.end() )
+			return;
+
+		for ( auto& ci : iter->second )
+		{
+			if ( ci.bounds.Contains(point) )
+			{
+				out.push_back(ci.item);
+			}
+		}
+	}
+
+
+	/**
+	 * Removes an item from the index
+	 *
+	 * No effect if the item is not indexed.
+	 *
+	 * @param[in] item
+	 *  The item to remove
+	 */
+	void
+	Remove(
+		T* item
+	)
+	{
+		auto  iter = my_entries.find(item);
+		if ( iter == my_entries.end() )
+			return;
+
+		Unlink(item, iter->second);
+		my_entries.erase(iter);
+	}
+
+
+	/**
+	 * Obtains the number of items indexed
+	 *
+	 * @return
+	 *  The item count
+	 */
+	size_t
+	Size() const
+	{
+		return my_entries.size();
+	}
+
+
+	/**
+	 * Inserts an item, or updates the bounds of one already indexed
+	 *
+	 * @param[in] item
+	 *  The item
+	 * @param[in] bounds
+	 *  The items bounding box, in grid co-ordinates
+	 */
+	void
+	Update(
+		T* item,
+		const ImRect& bounds
+	)
+	{
+		item_entry  entry;
+
+		entry.bounds = bounds;
+		entry.min_x = CellCoord(bounds.Min.x);
+		entry.min_y = CellCoord(bounds.Min.y);
+		entry.max_x = CellCoord(bounds.Max.x);
+		entry.max_y = CellCoord(bounds.Max.y);
+		entry.oversized = (entry.max_x - entry.min_x) >= my_max_item_cells
+			|| (entry.max_y - entry.min_y) >= my_max_item_cells;
+
+		auto  iter = my_entries.find(item);
+		if ( iter != my_entries.end() )
+		{
+			Unlink(item, iter->second);
+			iter->second = entry;
+		}
+		else
+		{
+			my_entries.emplace(item, entry);
+		}
+
+		cell_item  ci{ item, bounds, entry.min_x, entry.min_y };
+
+		if ( entry.oversized )
+		{
+			my_oversized.push_back(ci);
+			return;
+		}
+
+		for ( int y = entry.min_y; y <= entry.max_y; y++ )
+		{
+			for ( int x = entry.min_x; x <= entry.max_x; x++ )
+			{
+				my_cells[CellKey(x, y)].push_back(ci);
+			}
+		}
+	}
+};
+
+
+} // namespace imgui
+} // namespace trezanik
@@ -0,0 +1,232 @@
+/**
+ * @file        src/imgui/UserTexture.cc
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "imgui/definitions.h"
+
+#include "imgui/UserTexture.h"
+#include "imgui/dear_imgui/imgui_internal.h" // user texture registration
+
+#include "core/services/log/Log.h"
+#include "core/error.h"
+
+
+namespace trezanik {
+namespace imgui {
+
+
+std::vector<ImTextureData*>  UserTexture::my_retired;
+
+
+UserTexture::UserTexture()
+: my_texture(nullptr)
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Constructor starting");
+	{
+	}
+	TZK_LOG(LogLevel::Trace, "Constructor finished");
+}
+
+
+UserTexture::~UserTexture()
+{
+	using namespace trezanik::core;
+
+	TZK_LOG(LogLevel::Trace, "Destructor starting");
+	{
+		Release();
+	}
+	TZK_LOG(LogLevel::Trace, "Destructor finished");
+}
+
+
+void
+UserTexture::CollectRetired()
+{
+	if ( my_retired.empty() )
+		return;
+
+	for ( size_t i = 0; i < my_retired.size(); )
+	{
+		ImTextureData*  tex = my_retired[i];
+
+		// a lost context takes the backend with it; nothing left to wait for
+		if ( ImGui::GetCurrentContext() != nullptr && tex->Status != ImTextureStatus_Destroyed )
+		{
+			i++;
+			continue;
+		}
+
+		if ( ImGui::GetCurrentContext() != nullptr )
+		{
+			ImGui::UnregisterUserTexture(tex);
+		}
+		IM_DELETE(tex);
+
+		my_retired[i] = my_retired.back();
+		my_retired.pop_back();
+	}
+}
+
+
+void
+UserTexture::DestroyRetired()
+{
+	using namespace trezanik::core;
+
+	if ( my_retired.empty() )
+		return;
+
+	TZK_LOG_FORMAT(LogLevel::Debug, "Destroying %zu retired user textures", my_retired.size());
+
+	for ( auto tex : my_retired )
+	{
+		if ( ImGui::GetCurrentContext() != nullptr )
+		{
+			ImGui::UnregisterUserTexture(tex);
+		}
+		IM_DELETE(tex);
+	}
+
+	my_retired.clear();
+}
+
+
+int
+UserTexture::Create(
+	int width,
+	int height
+)
+{
+	using namespace trezanik::core;
+
+	if ( width <= 0 || height <= 0 )
+	{
+		TZK_LOG_FORMAT(LogLevel::Warning, "Invalid texture dimensions: %dx%d", width, height);
+		return EINVAL;
+	}
+
+	Release();
+
+	my_texture = IM_NEW(ImTextureData)();
+	my_texture->Create(ImTextureFormat_RGBA32, width, height);
+	my_texture->UseColors = true;
+	ImGui::RegisterUserTexture(my_texture);
+
+	TZK_LOG_FORMAT(LogLevel::Trace, "Created %dx%d user texture", width, height);
+
+	return ErrNONE;
+}
+
+
+int
+UserTexture::GetHeight() const
+{
+	return my_texture == nullptr ? 0 : my_texture->Height;
+}
+
+
+ImU32*
+UserTexture::GetPixels()
+{
+	if ( my_texture == nullptr )
+		return nullptr;
+
+	return static_cast<ImU32*>(my_texture->GetPixels());
+}
+
+
+ImTextureRef
+UserTexture::GetTexRef() const
+{
+	if ( my_texture == nullptr )
+		return ImTextureRef();
+
+	return my_texture->GetTexRef();
+}
+
+
+int
+UserTexture::GetWidth() const
+{
+	return my_texture == nullptr ? 0 : my_texture->Width;
+}
+
+
+bool
+UserTexture::IsCreated() const
+{
+	return my_texture != nullptr;
+}
+
+
+void
+UserTexture::Release()
+{
+	CollectRetired();
+
+	if ( my_texture == nullptr )
+		return;
+
+	ImTextureData*  tex = my_texture;
+
+	my_texture = nullptr;
+
+	if ( ImGui::GetCurrentContext() == nullptr )
+	{
+		IM_DELETE(tex);
+		return;
+	}
+
+	/*
+	 * Never handed to the backend (or already destroyed by it, such as on
+	 * device loss, which leaves it wanting recreation) - no device texture to
+	 * wait on
+	 */
+	if ( tex->Status == ImTextureStatus_WantCreate || tex->Status == ImTextureStatus_Destroyed )
+	{
+		ImGui::UnregisterUserTexture(tex);
+		IM_DELETE(tex);
+		return;
+	}
+
+	// without this, the backend destroying it would flag it for recreation
+	tex->WantDestroyNextFrame = true;
+	tex->SetStatus(ImTextureStatus_WantDestroy);
+	my_retired.push_back(tex);
+}
+
+
+void
+UserTexture::Upload()
+{
+	if ( my_texture == nullptr )
+		return;
+
+	// pending creation already copies everything
+	if ( my_texture->Status == ImTextureStatus_WantCreate )
+		return;
+
+	ImTextureRect  rect;
+
+	rect.x = 0;
+	rect.y = 0;
+	rect.w = static_cast<unsigned short>(my_texture->Width);
+	rect.h = static_cast<unsigned short>(my_texture->Height);
+
+	// updates are never cleared for user textures, only queued; one suffices
+	my_texture->Updates.resize(0);
+	my_texture->Updates.push_back(rect);
+	my_texture->UpdateRect = rect;
+	my_texture->UsedRect = rect;
+	my_texture->SetStatus(ImTextureStatus_WantUpdates);
+}
+
+
+} // namespace imgui
+} // namespace trezanik
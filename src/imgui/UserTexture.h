@@ -0,0 +1,187 @@
+#pragma once
+
+/**
+ * @file        src/imgui/UserTexture.h
+ * @brief       CPU-generated texture uploaded by the imgui renderer backend
+ * @license     zlib (view the LICENSE file for details)
+ * @copyright   Trezanik Developers, 2014-2026
+ */
+
+
+#include "imgui/definitions.h"
+
+#include "imgui/dear_imgui/imgui.h"
+
+#include <vector>
+
+
+namespace trezanik {
+namespace imgui {
+
+
+/**
+ * A texture whose pixels are produced on the CPU, for drawing as an image
+ *
+ * Wraps an ImTextureData registered with the imgui context, so the renderer
+ * backend creates, updates and destroys the device texture through the same
+ * requests it already services for the font atlas; nothing here is backend
+ * specific.
+ *
+ * The pixels are written by the owner, then Upload is called to have the
+ * backend copy them in full at the next render. Drawing costs a single quad
+ * regardless of what the pixels depict, which is the point - content that
+ * rarely changes is rendered once rather than every frame.
+ *
+ * The device texture may still be referenced by the frame in flight when
+ * this object is destroyed or recreated, so release is deferred until the
+ * backend has actioned it; see CollectRetired.
+ *
+ * Must only be used from the thread running imgui.
+ */
+class IMGUI_API UserTexture
+{
+	TZK_NO_CLASS_ASSIGNMENT(UserTexture);
+	TZK_NO_CLASS_COPY(UserTexture);
+	TZK_NO_CLASS_MOVEASSIGNMENT(UserTexture);
+	TZK_NO_CLASS_MOVECOPY(UserTexture);
+
+private:
+
+	/** The texture data; nullptr until created */
+	ImTextureData*  my_texture;
+
+	/** Textures released while in use by the backend, pending its destruction */
+	static std::vector<ImTextureData*>  my_retired;
+
+
+	/**
+	 * Relinquishes the texture data, destroying it now or once the backend
+	 * has released the device texture
+	 */
+	void
+	Release();
+
+protected:
+public:
+	/**
+	 * Standard constructor
+	 */
+	UserTexture();
+
+
+	/**
+	 * Standard destructor
+	 */
+	~UserTexture();
+
+
+	/**
+	 * Frees all retired textures the backend has finished destroying
+	 *
+	 * Invoked on every creation and release, and once per frame by the
+	 * backend ahead of starting a new one, so memory is reclaimed promptly.
+	 */
+	static void
+	CollectRetired();
+
+
+	/**
+	 * Frees all retired textures, regardless of their state
+	 *
+	 * For use when the backend is shutting down, after it has destroyed its
+	 * device textures; nothing will action the outstanding requests beyond
+	 * this point, so they would otherwise leak.
+	 */
+	static void
+	DestroyRetired();
+
+
+	/**
+	 * Creates the texture, replacing any existing one
+	 *
+	 * Pixels are initialized to fully transparent. The backend creates the
+	 * device texture from the pixel content at the next render, so there is
+	 * no need to call Upload after populating a newly created texture.
+	 *
+	 * @param[in] width
+	 *  The width in pixels
+	 * @param[in] height
+	 *  The height in pixels
+	 * @return
+	 *  ErrNONE on success, or EINVAL if either dimension is not positive
+	 */
+	int
+	Create(
+		int width,
+		int height
+	);
+
+
+	/**
+	 * Obtains the texture height
+	 *
+	 * @return
+	 *  The height in pixels, or 0 if not created
+	 */
+	int
+	GetHeight() const;
+
+
+	/**
+	 * Obtains the writable pixel data
+	 *
+	 * RGBA32, one ImU32 per pixel in row order with no padding, so IM_COL32
+	 * values can be assigned directly.
+	 *
+	 * @return
+	 *  Pointer to the first pixel, or nullptr if not created
+	 */
+	ImU32*
+	GetPixels();
+
+
+	/**
+	 * Obtains the reference for drawing this texture
+	 *
+	 * Only valid for use while this object exists and is not recreated.
+	 *
+	 * @return
+	 *  The texture reference, for use with ImDrawList::AddImage and similar
+	 */
+	ImTextureRef
+	GetTexRef() const;
+
+
+	/**
+	 * Obtains the texture width
+	 *
+	 * @return
+	 *  The width in pixels, or 0 if not created
+	 */
+	int
+	GetWidth() const;
+
+
+	/**
+	 * Determines if the texture has been created
+	 *
+	 * @return
+	 *  Boolean state; true if created and drawable
+	 */
+	bool
+	IsCreated() const;
+
+
+	/**
+	 * Requests the backend copies the full pixel content to the device
+	 *
+	 * No effect if the texture is not created. Calling multiple times prior
+	 * to the next render results in a single copy.
+	 */
+	void
+	Upload();
+};
+
+
+} // namespace imgui
+} // namespace trezanik